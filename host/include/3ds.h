@@ -0,0 +1,276 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+// Host stand-in for the parts of libctru sysDowngrader uses.
+// Only types, constants and prototypes, ctru_host.cpp implements them.
+
+#ifndef _3DS_H_
+#define _3DS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t   s8;
+typedef int16_t  s16;
+typedef int32_t  s32;
+typedef int64_t  s64;
+
+typedef u32 Handle;
+typedef s32 Result;
+
+#define BIT(n) (1U<<(n))
+
+
+
+//===============================================
+// FS                                          ||
+//===============================================
+
+typedef enum
+{
+	PATH_INVALID = 0,
+	PATH_EMPTY   = 1,
+	PATH_BINARY  = 2,
+	PATH_ASCII   = 3,
+	PATH_UTF16   = 4,
+} FS_PathType;
+
+typedef enum
+{
+	MEDIATYPE_NAND      = 0,
+	MEDIATYPE_SD        = 1,
+	MEDIATYPE_GAME_CARD = 2,
+} FS_MediaType;
+
+enum
+{
+	FS_OPEN_READ   = BIT(0),
+	FS_OPEN_WRITE  = BIT(1),
+	FS_OPEN_CREATE = BIT(2),
+};
+
+enum
+{
+	FS_WRITE_FLUSH = BIT(0),
+};
+
+enum
+{
+	FS_ATTRIBUTE_DIRECTORY = BIT(0),
+	FS_ATTRIBUTE_HIDDEN    = BIT(8),
+	FS_ATTRIBUTE_ARCHIVE   = BIT(16),
+	FS_ATTRIBUTE_READ_ONLY = BIT(24),
+};
+
+typedef struct
+{
+	FS_PathType type;
+	u32 size;
+	const void* data;
+} FS_Path;
+
+typedef struct
+{
+	u32 id;
+	FS_Path lowPath;
+	u64 handle;
+} FS_Archive;
+
+typedef struct
+{
+	u16 name[0x106];
+	char shortName[0x0A];
+	char shortExt[0x04];
+	u8 valid;
+	u8 reserved;
+	u32 attributes;
+	u64 fileSize;
+} FS_DirectoryEntry;
+
+Result fsInit(void);
+void   fsExit(void);
+
+Result FSUSER_OpenArchive(FS_Archive* archive);
+Result FSUSER_CloseArchive(FS_Archive* archive);
+Result FSUSER_OpenFile(Handle* out, FS_Archive archive, FS_Path path, u32 openFlags, u32 attributes);
+Result FSUSER_OpenFileDirectly(Handle* out, FS_Archive archive, FS_Path path, u32 openFlags, u32 attributes);
+Result FSUSER_DeleteFile(FS_Archive archive, FS_Path path);
+Result FSUSER_RenameFile(FS_Archive srcArchive, FS_Path srcPath, FS_Archive dstArchive, FS_Path dstPath);
+Result FSUSER_DeleteDirectoryRecursively(FS_Archive archive, FS_Path path);
+Result FSUSER_CreateDirectory(FS_Archive archive, FS_Path path, u32 attributes);
+Result FSUSER_RenameDirectory(FS_Archive srcArchive, FS_Path srcPath, FS_Archive dstArchive, FS_Path dstPath);
+Result FSUSER_OpenDirectory(Handle* out, FS_Archive archive, FS_Path path);
+Result FSUSER_GetSdmcCid(u8* out, u32 length);
+
+Result FSFILE_Read(Handle handle, u32* bytesRead, u64 offset, void* buffer, u32 size);
+Result FSFILE_Write(Handle handle, u32* bytesWritten, u64 offset, const void* buffer, u32 size, u32 flags);
+Result FSFILE_GetSize(Handle handle, u64* size);
+Result FSFILE_SetSize(Handle handle, u64 size);
+Result FSFILE_Flush(Handle handle);
+Result FSFILE_Close(Handle handle);
+
+Result FSDIR_Read(Handle handle, u32* entriesRead, u32 entryCount, FS_DirectoryEntry* entries);
+Result FSDIR_Close(Handle handle);
+
+
+
+//===============================================
+// AM                                          ||
+//===============================================
+
+typedef struct
+{
+	u64 titleID;
+	u64 size;
+	u16 version;
+	u8 unk[6];
+} AM_TitleEntry;
+
+Result amInit(void);
+void   amExit(void);
+
+Result AM_GetTitleCount(FS_MediaType mediatype, u32* count);
+Result AM_GetTitleList(u32* titlesRead, FS_MediaType mediatype, u32 titleCount, u64* titleIds);
+Result AM_GetTitleInfo(FS_MediaType mediatype, u32 titleCount, u64* titleIds, AM_TitleEntry* titleInfo);
+Result AM_GetTitleProductCode(FS_MediaType mediatype, u64 titleId, char* productCode);
+Result AM_GetCiaFileInfo(FS_MediaType mediatype, AM_TitleEntry* titleEntry, Handle fileHandle);
+Result AM_StartCiaInstall(FS_MediaType mediatype, Handle* ciaHandle);
+Result AM_FinishCiaInstall(Handle ciaHandle);
+Result AM_CancelCIAInstall(Handle ciaHandle);
+Result AM_DeleteTitle(FS_MediaType mediatype, u64 titleID);
+Result AM_DeleteAppTitle(FS_MediaType mediatype, u64 titleID);
+Result AM_InstallFirm(u64 titleID);
+
+
+
+//===============================================
+// APT, HID, GFX, console, srv, svc            ||
+//===============================================
+
+typedef enum
+{
+	APPID_HOMEMENU = 0x101,
+} NS_APPID;
+
+typedef enum
+{
+	APP_NOTINITIALIZED,
+	APP_RUNNING,
+	APP_SUSPENDED,
+	APP_EXITING,
+} APT_AppStatus;
+
+enum
+{
+	KEY_A = BIT(0),
+	KEY_B = BIT(1),
+	KEY_X = BIT(10),
+	KEY_Y = BIT(11),
+};
+
+typedef enum
+{
+	GSP_RGBA8_OES  = 0,
+	GSP_BGR8_OES   = 1,
+	GSP_RGB565_OES = 2,
+} GSPGPU_FramebufferFormats;
+
+typedef enum
+{
+	GFX_TOP    = 0,
+	GFX_BOTTOM = 1,
+} gfxScreen_t;
+
+typedef struct PrintConsole PrintConsole;
+
+Result aptInit(void);
+void   aptExit(void);
+bool   aptMainLoop(void);
+void   aptOpenSession(void);
+void   aptCloseSession(void);
+void   aptSetStatus(APT_AppStatus status);
+Result APT_CheckNew3DS(u8* out);
+Result APT_HardwareResetAsync(void);
+Result APT_PrepareToStartSystemApplet(NS_APPID appID);
+Result APT_StartSystemApplet(NS_APPID appID, u32 bufSize, Handle applHandle, u8* buf);
+Result APT_PrepareToDoAppJump(u8 flags, u64 programID, u8 mediatype);
+Result APT_DoAppJump(u32 NSbuf0Size, u32 NSbuf1Size, u8* NSbuf0Ptr, u8* NSbuf1Ptr);
+
+typedef enum
+{
+	CFG_REGION_JPN = 0,
+	CFG_REGION_USA = 1,
+	CFG_REGION_EUR = 2,
+	CFG_REGION_AUS = 3,
+	CFG_REGION_CHN = 4,
+	CFG_REGION_KOR = 5,
+	CFG_REGION_TWN = 6,
+} CFG_Region;
+
+Result cfguInit(void);
+void   cfguExit(void);
+Result CFGU_SecureInfoGetRegion(u8* region);
+
+void hidScanInput(void);
+u32  hidKeysDown(void);
+void hidExit(void);
+
+void gfxInit(GSPGPU_FramebufferFormats topFormat, GSPGPU_FramebufferFormats bottomFormat, bool vrambuffers);
+void gfxExit(void);
+void gfxFlushBuffers(void);
+void gfxSwapBuffers(void);
+void gspWaitForVBlank(void);
+
+PrintConsole* consoleInit(gfxScreen_t screen, PrintConsole* console);
+void consoleClear(void);
+
+void   srvExit(void);
+Result srvGetServiceHandleDirect(Handle* out, const char* name);
+Result svcCloseHandle(Handle handle);
+void   svcSleepThread(s64 ns);
+u64    svcGetSystemTick(void);
+
+typedef enum
+{
+	RESET_ONESHOT = 0,
+	RESET_STICKY  = 1,
+	RESET_PULSE   = 2,
+} ResetType;
+
+typedef struct
+{
+	s32 state; // 1 signalled, 0 not
+	s32 resetType;
+} LightEvent;
+
+void LightEvent_Init(LightEvent* event, ResetType reset_type);
+void LightEvent_Signal(LightEvent* event);
+void LightEvent_Wait(LightEvent* event);
+
+#define SYSCLOCK_ARM11 268111856
+
+ssize_t utf16_to_utf8(u8* out, const u16* in, size_t len);
+ssize_t utf8_to_utf16(u16* out, const u8* in, size_t len);
+
+#endif // _3DS_H_
@@ -0,0 +1,87 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _CTRU_HOST_H_
+#define _CTRU_HOST_H_
+
+#include <functional>
+#include <map>
+#include <string>
+#include <3ds.h>
+
+// Controls for the host libctru. The SD card is a directory, NAND titles
+// live in memory and CIA installs go to a sink that only parses the TMD.
+namespace host
+{
+	// Simulated storage. Every call waits latencyUs, transfers also wait
+	// bytes / bandwidth. 0 means free. Beyond burstKB a transfer only gets
+	// slowKBs, like a card whose write cache or the FS bounce buffer ran out.
+	struct Device
+	{
+		u32 latencyUs;
+		u32 bandwidthKBs;
+		u32 burstKB;
+		u32 slowKBs;
+	};
+
+	struct Config
+	{
+		std::string sdmcRoot;  // Directory the SD archive maps to
+		Device sdmc;           // FS calls on the SD archive
+		Device nand;           // AM calls, CIA install writes
+		bool isNew3DS;
+		u8   region;           // CFG_REGION_*, 0xFF = CFG can't be opened
+		u32  keysDown;         // Returned by hidKeysDown()
+		u32  cardSerial;       // Part of the SD card CID
+	};
+
+	struct CallStats
+	{
+		u64 calls;
+		u64 bytes;
+		u64 waitNs; // Simulated device time
+	};
+
+	void configure(const Config& config);
+	const Config& config();
+
+	// Pretend a title is installed (or remove it with version < 0)
+	void setInstalledTitle(FS_MediaType mediaType, u64 titleID, int version, u64 size=0);
+	// Version of an installed title, -1 if not installed
+	int  installedVersion(FS_MediaType mediaType, u64 titleID);
+	void clearTitles();
+
+	// Simulated power cut: the given service call, counted from now, throws PowerLoss
+	// instead of running. Close calls are never cut, they run in destructors. 0 = never.
+	struct PowerLoss {};
+	void cutPowerAt(u64 call);
+
+	// Runs before every service call, to change the SD card between two of them. nullptr = none.
+	void onCall(std::function<void (const char *call)> hook);
+
+	// Keyed by libctru function name, the service is the part before '_'
+	const std::map<std::string, CallStats>& callStats();
+	void resetStats();
+	u32  openHandles();
+
+	// Parses title ID and version out of a CIA's TMD
+	Result parseCia(const u8* data, u64 size, AM_TitleEntry* entry);
+} // namespace host
+
+#endif // _CTRU_HOST_H_
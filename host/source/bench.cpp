@@ -0,0 +1,2123 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+// Replays installUpdates() against the host libctru and reports where the time goes.
+// Without -r it generates a synthetic /updates set first.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <3ds.h>
+#include "fs.h"
+#include "title.h"
+#include "installer.h"
+#include "trace.h"
+#include "metrics.h"
+#include "cia.h"
+#include "sha256.h"
+#include "sha256multi.h"
+#include "multidigest.h"
+#include "crc32.h"
+#include "progress.h"
+#include "journal.h"
+#include "iotune.h"
+#include "logger.h"
+#include "manifest.h"
+#include "ctru_host.h"
+#include "zlib.h"
+#include "zip.h"
+#include "unzip.h"
+
+
+u8 sysLang = 0; // title.cpp wants this, main.cpp isn't part of the host build
+
+// Title types installUpdates() sorts by, see titleTypes in installer.cpp
+static const u32 fixtureTypes[6] = {0x00040130, 0x00040030, 0x00040010, 0x0004001B, 0x0004009B, 0x000400DB};
+
+
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [options]\n"
+		"  -r DIR     SD card root with an updates dir (default: generate one in /tmp)\n"
+		"  -n COUNT   number of generated CIAs (default 60)\n"
+		"  -s KB      size of each generated CIA (default 2048)\n"
+		"  -u         upgrade instead of downgrade\n"
+		"  -H         every second title is already at its target version\n"
+		"  -q         hide the installer's console output\n"
+		"  -v         mirror the log to stderr\n"
+		"  -l US      SD latency per call in microseconds\n"
+		"  -b KB/S    SD bandwidth\n"
+		"  -L US      NAND/AM latency per call in microseconds\n"
+		"  -B KB/S    NAND/AM bandwidth\n"
+		"  -N         pretend to be a New 3DS\n"
+		"  -R REGION  CFG region of the console (default 2, EUR; 255 = no CFG)\n"
+		"  -w         install on the worker thread, drained at 60 fps like main() does\n"
+		"  -S COUNT   stress the progress ring with COUNT events and exit\n"
+		"  -K TRIALS  cut the power at random points of the install, then check the resumed run\n"
+		"  -T         check that the I/O tuner finds the best block size of a few synthetic SD cards\n"
+		"  -Z         check that truncated and foreign CIAs are refused before any hashing,\n"
+		"             renamed ones matched by title ID, and consoles of other regions refused\n"
+		"  -M         time startup, check the built-in manifest sets and time the title lookups, check\n"
+		"             the manifest file parser against damaged files, then exit\n"
+		"  -k         check the SHA-256 backends, the lanes of SHA256Multi, add() and MultiDigest against\n"
+		"             known answers and separate hashers and time them, then exit\n"
+		"  -z         check the zip port against zlib and time it (deflate with 1..N threads), then exit\n", prog);
+	exit(1);
+}
+
+static void putBE32(u8 *p, u32 v) {p[0] = v>>24; p[1] = v>>16; p[2] = v>>8; p[3] = v;}
+static void putLE32(u8 *p, u32 v) {p[0] = v; p[1] = v>>8; p[2] = v>>16; p[3] = v>>24;}
+
+// Just enough CIA for getCiaInfo() and AM: header, empty cert chain and ticket,
+// a TMD with title ID, version and one content chunk record, then filler content.
+static void writeFixtureCia(const std::string& path, u64 titleID, u16 version, u32 size)
+{
+	const u32 tmdOffset = 0x2040, tmdSize = 4 + 0x13C + 0xC4 + 0x24*64 + 0x30;
+	const u32 contentOffset = tmdOffset + ((tmdSize + 63) & ~63);
+	std::vector<u8> data(std::max<u32>(size, contentOffset + 64));
+	u8 *tmd = &data[tmdOffset + 4 + 0x13C];
+	u8 *chunk = tmd + 0xC4 + 0x24*64;
+	const u32 contentSize = data.size() - contentOffset;
+	u32 x = (u32)titleID | 1;
+
+
+	for(size_t i = contentOffset; i < data.size(); i++)
+	{
+		x ^= x<<13; x ^= x>>17; x ^= x<<5;
+		data[i] = x;
+	}
+
+	putLE32(&data[0x00], 0x2020);
+	putLE32(&data[0x10], tmdSize);
+	putLE32(&data[0x18], contentSize);
+	putBE32(&data[tmdOffset], 0x10004);
+	putBE32(tmd + 0x4C, titleID>>32);
+	putBE32(tmd + 0x50, (u32)titleID);
+	tmd[0x9C] = version>>8;
+	tmd[0x9D] = version;
+	tmd[0x9F] = 1; // Content count
+	putBE32(chunk + 0x0C, contentSize);
+
+	SHA256 sha256;
+	sha256.add(&data[contentOffset], contentSize);
+	sha256.getHash(chunk + 0x10);
+
+	FILE *f = fopen(path.c_str(), "wb");
+	if(!f || fwrite(data.data(), 1, data.size(), f) != data.size())
+	{
+		perror(path.c_str());
+		exit(1);
+	}
+	fclose(f);
+}
+
+// NATIVE_FIRM v1 plus the EUR home menu, writeFixtureManifest() makes the matching hashes
+static void makeFixture(const std::string& root, u32 count, u32 sizeKB)
+{
+	char name[32];
+
+	mkdir(root.c_str(), 0755);
+	mkdir((root + "/updates").c_str(), 0755);
+
+	// Leftovers of a bigger set would be installed too
+	if(DIR *dir = opendir((root + "/updates").c_str()))
+	{
+		while(struct dirent *ent = readdir(dir))
+			if(ent->d_name[0] != '.') unlink((root + "/updates/" + ent->d_name).c_str());
+		closedir(dir);
+	}
+	unlink((root + "/sysdowngrader-journal.bin").c_str()); // Would resume a run over the old set
+
+	writeFixtureCia(root + "/updates/0004013800000002.cia", 0x0004013800000002LL, 1, sizeKB * 1024);
+	for(u32 i=1; i<count; i++)
+	{
+		const u64 titleID = (i == 1 ? 0x0004003000009802LL : ((u64)fixtureTypes[i % 6]<<32) | (0x1000 + (i<<8) + 2));
+		snprintf(name, sizeof(name), "%016llX.cia", (unsigned long long)titleID);
+		writeFixtureCia(root + "/updates/" + name, titleID, 1024, sizeKB * 1024);
+	}
+}
+
+// Hashes and sizes of the generated set as /updates/manifest.bin, the installer takes it from there
+static void writeFixtureManifest(const std::string& root)
+{
+	std::vector<manifest::Entry> entries;
+	std::vector<manifest::Digest> digests;
+	std::vector<u8> data;
+	manifest::SetRecord record = manifest::SetRecord();
+
+
+	for(auto& it : fs::listDirContents(u"/updates", u".cia;"))
+	{
+		fs::File file(u"/updates/" + it.name, FS_OPEN_READ);
+		char name[256] = {0};
+		manifest::Entry entry = manifest::Entry();
+		manifest::Digest digest;
+		SHA256 sha256;
+
+		data.resize(file.size());
+		file.read(data.data(), data.size());
+		sha256.add(data.data(), data.size());
+		sha256.getHash(digest.sha256);
+		utf16_to_utf8((u8*)name, (const u16*)it.name.c_str(), sizeof(name) - 1);
+		entry.titleID = strtoull(name, nullptr, 16);
+		entry.size = data.size();
+		entry.digest = digests.size();
+		entries.push_back(entry);
+		digests.push_back(digest);
+	}
+	std::sort(entries.begin(), entries.end(), [](const manifest::Entry& a, const manifest::Entry& b) {return a.titleID < b.titleID;});
+
+	record.nativeFirm = NATIVE_FIRM_TITLE;
+	record.homeMenu = 0x0004003000009802LL;
+	record.firmVersion = 1;
+	record.entryCount = entries.size();
+
+	const std::vector<u8> file = manifest::build({manifest::Set(record, entries.data(), digests.data())});
+	FILE *f = fopen((root + "/updates/manifest.bin").c_str(), "wb");
+	if(!f || fwrite(file.data(), 1, file.size(), f) != file.size())
+	{
+		perror("manifest.bin");
+		exit(1);
+	}
+	fclose(f);
+}
+
+// Every CIA is installed in a newer version so downgrading deletes and installs all of them.
+// For an upgrade nothing is installed yet. With halfDone every second title is already at
+// the version of its CIA, as after an interrupted run.
+static u64 seedTitles(const std::string& root, bool downgrade, bool halfDone)
+{
+	std::string dirPath = root + "/updates";
+	DIR *dir = opendir(dirPath.c_str());
+	u64 total = 0;
+	u32 count = 0;
+
+
+	if(!dir)
+	{
+		perror(dirPath.c_str());
+		exit(1);
+	}
+	host::clearTitles();
+
+	while(struct dirent *ent = readdir(dir))
+	{
+		const std::string path = dirPath + "/" + ent->d_name;
+		u8 head[0x10000];
+		AM_TitleEntry entry;
+		struct stat st;
+
+		if(ent->d_name[0] == '.' || strlen(ent->d_name) < 4 || strcmp(ent->d_name + strlen(ent->d_name) - 4, ".cia")) continue;
+
+		int fd = open(path.c_str(), O_RDONLY);
+		ssize_t len = (fd < 0 ? -1 : pread(fd, head, sizeof(head), 0));
+		if(fd >= 0)
+		{
+			fstat(fd, &st);
+			close(fd);
+		}
+		if(len < 0 || host::parseCia(head, len, &entry))
+		{
+			fprintf(stderr, "%s: not a CIA\n", path.c_str());
+			continue;
+		}
+
+		total += st.st_size;
+		if(halfDone && (count++ & 1)) host::setInstalledTitle(MEDIATYPE_NAND, entry.titleID, entry.version);
+		else if(downgrade) host::setInstalledTitle(MEDIATYPE_NAND, entry.titleID, std::min(entry.version + 1, 0xFFFF));
+	}
+	closedir(dir);
+
+	return total;
+}
+
+static void report(double seconds, u64 ciaBytes)
+{
+	std::map<std::string, host::CallStats> services;
+	u64 moved = 0, waitNs = 0;
+
+
+	for(auto& it : host::callStats())
+	{
+		host::CallStats& s = services[it.first.substr(0, it.first.find('_'))];
+		s.calls  += it.second.calls;
+		s.bytes  += it.second.bytes;
+		s.waitNs += it.second.waitNs;
+		moved    += it.second.bytes;
+		waitNs   += it.second.waitNs;
+	}
+
+	fprintf(stderr, "\nwall time      %10.3f s (simulated device time %.3f s)\n", seconds, waitNs / 1e9);
+	fprintf(stderr, "CIA bytes      %10.1f MB\n", ciaBytes / 1048576.0);
+	fprintf(stderr, "bytes moved    %10.1f MB (%.2fx the CIAs, %.1f MB/s)\n",
+	        moved / 1048576.0, ciaBytes ? (double)moved / ciaBytes : 0.0, moved / 1048576.0 / seconds);
+	fprintf(stderr, "open handles   %10u\n\n", host::openHandles());
+
+	fprintf(stderr, "%-34s %10s %12s %10s\n", "call", "count", "MB", "device s");
+	for(auto& it : services)
+		fprintf(stderr, "%-34s %10llu %12.1f %10.3f\n", it.first.c_str(),
+		        (unsigned long long)it.second.calls, it.second.bytes / 1048576.0, it.second.waitNs / 1e9);
+	fprintf(stderr, "\n");
+	for(auto& it : host::callStats())
+		fprintf(stderr, "  %-32s %10llu %12.1f %10.3f\n", it.first.c_str(),
+		        (unsigned long long)it.second.calls, it.second.bytes / 1048576.0, it.second.waitNs / 1e9);
+}
+
+// The app's own counters have to agree with what the backend saw. AM gets CIA
+// data through FSFILE_Write, the backend books those writes as AM_CiaWrite.
+static bool checkMetrics()
+{
+	const std::map<std::string, host::CallStats>& seen = host::callStats();
+	std::map<std::string, host::CallStats> expected;
+	u32 matched = 0, failed = 0;
+
+
+	for(auto& it : seen)
+	{
+		if(it.first.compare(0, 2, "FS") && it.first.compare(0, 3, "AM_")) continue;
+		if(it.first == "AM_CiaRead") continue; // AM's own reads, not a call the app makes
+
+		host::CallStats& e = expected[it.first == "AM_CiaWrite" ? "FSFILE_Write" : it.first];
+		e.calls += it.second.calls;
+		e.bytes += it.second.bytes;
+	}
+
+	for(u32 i=0; i<metrics::CALL_COUNT; i++)
+	{
+		const metrics::Call call = (metrics::Call)i;
+		const metrics::Stats& s = metrics::get(call);
+		auto it = expected.find(metrics::name(call));
+		const u64 calls = (it == expected.end() ? 0 : it->second.calls);
+		const bool checkBytes = (call == metrics::FSFILE_Read || call == metrics::FSFILE_Write);
+		// The log writer counts its own calls
+		const u64 counted = s.calls + logger::serviceCalls(call);
+		const u64 bytes = s.bytes + (call == metrics::FSFILE_Write ? logger::stats().bytes : 0);
+
+		if(counted != calls || (checkBytes && bytes != it->second.bytes))
+		{
+			fprintf(stderr, "metrics: %s counted %llu calls, %llu bytes, backend saw %llu calls, %llu bytes\n",
+			        metrics::name(call), (unsigned long long)counted, (unsigned long long)bytes,
+			        (unsigned long long)calls, (unsigned long long)(it == expected.end() ? 0 : it->second.bytes));
+			failed++;
+		}
+		else if(calls) matched++;
+
+		if(it != expected.end()) expected.erase(it);
+	}
+
+	for(auto& it : expected)
+	{
+		fprintf(stderr, "metrics: %s isn't counted by the app (%llu calls)\n", it.first.c_str(), (unsigned long long)it.second.calls);
+		failed++;
+	}
+
+	fprintf(stderr, "metrics: %u calls agree with the backend, %u don't\n", matched, failed);
+	return (failed == 0);
+}
+
+// getCiaInfo() against the backend's own parser and the fixture layout,
+// plus a file that isn't a CIA
+static bool checkCiaParser(const std::string& root)
+{
+	const std::vector<fs::DirEntry> files = fs::listDirContents(u"/updates", u".cia;");
+	u32 matched = 0, failed = 0;
+
+
+	for(auto& it : files)
+	{
+		const std::u16string path = u"/updates/" + it.name;
+		CiaInfo info = getCiaInfo(path);
+		fs::File file(path, FS_OPEN_READ);
+		std::vector<u8> data(file.size());
+		AM_TitleEntry entry;
+		bool ok;
+
+		file.read(data.data(), data.size());
+		ok = !host::parseCia(data.data(), data.size(), &entry) && entry.titleID == info.titleID && entry.version == info.version &&
+		     info.size == data.size() && info.contentOffset + info.contentSize == data.size();
+
+		// Only generated fixtures have one content with a hash of the plain bytes
+		if(ok && root == "/tmp/sysdowngrader-bench")
+		{
+			u8 hash[SHA256::HashBytes];
+			SHA256 sha256;
+
+			sha256.add(&data[info.contentOffset], info.contentSize);
+			sha256.getHash(hash);
+			ok = info.contents.size() == 1 && info.contents[0].size == info.contentSize && !memcmp(hash, info.contents[0].hash, sizeof(hash));
+		}
+
+		if(ok) matched++;
+		else
+		{
+			fprintf(stderr, "cia: %016llX v%u parsed differently\n", (unsigned long long)info.titleID, info.version);
+			failed++;
+		}
+	}
+
+	{
+		fs::File junk(u"/bench-invalid.cia", FS_OPEN_WRITE|FS_OPEN_CREATE);
+		std::vector<u8> data(0x3000, 0x5A);
+		junk.setSize(0);
+		junk.write(data.data(), data.size());
+		try
+		{
+			getCiaInfo(junk);
+			fprintf(stderr, "cia: garbage parsed as a CIA\n");
+			failed++;
+		}
+		catch(titleException& e) {}
+		junk.del();
+	}
+
+	fprintf(stderr, "cia: %u files parsed like the backend does, %u not\n", matched, failed);
+	return (failed == 0);
+}
+
+// main()'s side of startInstall(): drain once per frame, answer questions with the
+// configured buttons. Text goes to stdout, the tail of it to stderr if the install fails.
+static InstallSummary installOnWorker(bool downgrade, int& ret)
+{
+	progress::Channel channel;
+	progress::Event event;
+	std::string text;
+	u32 frames = 0, updates = 0;
+	bool done = false;
+	std::vector<std::pair<u32, u32>> etas; // Frame, ETA in seconds
+
+
+	if(!startInstall(downgrade, channel))
+	{
+		fprintf(stderr, "worker: couldn't start the install thread\n");
+		ret = 1;
+		return InstallSummary();
+	}
+
+	while(!done)
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(16667));
+		frames++;
+
+		while(channel.events.pop(event))
+		{
+			switch(event.phase)
+			{
+				case progress::PHASE_TEXT: fputs(event.text, stdout); text += event.text; break;
+				case progress::PHASE_PROMPT: progress::answer(channel, hidKeysDown() & KEY_A); break;
+				case progress::PHASE_DONE: done = true; break;
+				case progress::PHASE_FAILED: done = true; ret = 1; break;
+				default:
+					updates++;
+					if(event.etaSeconds) etas.push_back(std::make_pair(frames, event.etaSeconds));
+			}
+		}
+	}
+
+	const InstallSummary summary = finishInstall();
+	if(ret) fprintf(stderr, "\n%s\n", text.substr(text.size() > 400 ? text.size() - 400 : 0).c_str());
+	fprintf(stderr, "worker: %u frames, %u status updates drawn, %u dropped on a full ring\n", frames, updates, channel.dropped);
+
+	// What the bottom screen said halfway against what it took
+	for(auto& it : etas)
+	{
+		if(it.first < frames / 2) continue;
+		fprintf(stderr, "worker: halfway the ETA was %u s, the rest took %.1f s\n", it.second, (frames - it.first) / 60.0);
+		break;
+	}
+
+	return summary;
+}
+
+// Producer and consumer on separate threads. Every 4th event is posted losslessly and
+// has to arrive in order with its text intact, the rest may be dropped but never reordered.
+static bool stressRing(u32 count)
+{
+	progress::Channel channel;
+	u32 lossless = 0, lossy = 0, failed = 0;
+	u64 last = 0, nextLossless = 0;
+	bool first = true;
+
+
+	const auto start = std::chrono::steady_clock::now();
+	std::thread producer([&]()
+	{
+		progress::Event event = progress::Event();
+		for(u32 i = 0; i < count; i++)
+		{
+			event.bytes = i;
+			if(i % 4 == 0)
+			{
+				event.phase = progress::PHASE_INSTALL;
+				snprintf(event.text, sizeof(event.text), "event %u", i);
+				progress::post(channel, event);
+			}
+			else
+			{
+				event.phase = progress::PHASE_VERIFY;
+				event.text[0] = 0;
+				progress::tryPost(channel, event);
+			}
+		}
+		event.phase = progress::PHASE_DONE;
+		progress::post(channel, event);
+	});
+
+	for(u32 pops = 0;; pops++)
+	{
+		progress::Event event;
+		char expected[PROGRESS_TEXT_SIZE];
+
+		if(!channel.events.pop(event))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		if(event.phase == progress::PHASE_DONE) break;
+
+		if(!first && event.bytes <= last) failed++;
+		first = false;
+		last = event.bytes;
+
+		if(event.phase == progress::PHASE_INSTALL)
+		{
+			snprintf(expected, sizeof(expected), "event %u", (u32)event.bytes);
+			if(event.bytes != nextLossless || strcmp(event.text, expected)) failed++;
+			nextLossless += 4;
+			lossless++;
+		}
+		else lossy++;
+
+		// Fall behind now and then so the producer runs into a full ring
+		if(pops % 1024 == 0) std::this_thread::sleep_for(std::chrono::microseconds(500));
+	}
+	producer.join();
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	const u32 expectedLossless = (count + 3) / 4;
+	if(lossless != expectedLossless || lossy + channel.dropped != count - expectedLossless) failed++;
+
+	fprintf(stderr, "ring: %u events in %.3f s (%.1f M/s), %u lossless, %u lossy delivered, %u dropped, %u errors\n",
+	        count, elapsed.count(), count / elapsed.count() / 1e6, lossless, lossy, channel.dropped, failed);
+	return (failed == 0);
+}
+
+static u64 cuttableCalls()
+{
+	u64 calls = 0;
+
+	for(auto& it : host::callStats())
+		if(it.first.find("Close") == std::string::npos) calls += it.second.calls;
+	return calls;
+}
+
+// Each trial starts over from the seeded NAND, cuts the power at a random service call
+// and sometimes leaves a torn record at the end of the journal. The next run has to
+// finish the job and install and hash only what the journal doesn't have as done.
+static bool crashTest(const std::string& root, u32 trials, bool downgrade, bool halfDone)
+{
+	auto install = [&]() {return installUpdates(downgrade);};
+	const std::string journalPath = root + "/sysdowngrader-journal.bin";
+	std::mt19937 random(trials);
+	u32 failed = 0, resumed = 0;
+	u64 redone = 0, fresh;
+
+
+	// A clean run tells how many calls there are to cut
+	seedTitles(root, downgrade, halfDone);
+	host::resetStats();
+	const InstallSummary reference = install();
+	const u64 calls = cuttableCalls();
+	fresh = reference.titlesInstalled;
+
+	for(u32 trial = 0; trial < trials; trial++)
+	{
+		const u64 cut = 1 + random() % calls;
+		bool torn = false;
+
+		seedTitles(root, downgrade, halfDone);
+		unlink(journalPath.c_str());
+		host::cutPowerAt(cut);
+		try
+		{
+			install();
+		}
+		catch(host::PowerLoss&) {}
+		host::cutPowerAt(0);
+
+		// Power went while a record was written
+		if(random() % 2 && !access(journalPath.c_str(), F_OK))
+		{
+			u8 record[24] = {'J', 'R', 'N', 'L', JOURNAL_INSTALLED, 0, 0, 0, 8};
+			FILE *f = fopen(journalPath.c_str(), "ab");
+			fwrite(record, 1, 1 + random() % sizeof(record), f);
+			fclose(f);
+			torn = true;
+		}
+
+		// The least the next run can do
+		const JournalState state = Journal::replay(u"/sysdowngrader-journal.bin");
+		u32 installs = reference.titlesInstalled;
+		u64 hashed = reference.bytesHashed;
+		if(!state.files.empty())
+		{
+			installs = hashed = 0;
+			for(auto& it : state.files)
+			{
+				if(!it.planned) continue;
+				if(!state.installed.count(it.info.titleID)) installs++;
+				if(reference.filesVerified && !state.verified.count(it.name)) hashed += it.info.size;
+			}
+		}
+
+		host::resetStats();
+		InstallSummary summary = InstallSummary();
+		try
+		{
+			summary = install();
+		}
+		catch(std::exception& e)
+		{
+			fprintf(stderr, "crash: trial %u (call %llu): %s\n", trial, (unsigned long long)cut, e.what());
+			failed++;
+			continue;
+		}
+
+		u32 wrong = 0;
+		for(auto& it : fs::listDirContents(u"/updates", u".cia;"))
+		{
+			const CiaInfo info = getCiaInfo(u"/updates/" + it.name);
+			if(host::installedVersion(MEDIATYPE_NAND, info.titleID) != info.version) wrong++;
+		}
+
+		const u64 started = host::callStats().count("AM_StartCiaInstall") ? host::callStats().at("AM_StartCiaInstall").calls : 0;
+		if(wrong || summary.titlesInstalled != installs || started != installs || summary.bytesHashed != hashed ||
+		   summary.resumed == state.files.empty() || !access(journalPath.c_str(), F_OK))
+		{
+			fprintf(stderr, "crash: trial %u (call %llu of %llu%s): installed %u/%u, hashed %llu/%llu bytes, %u titles at the wrong version\n",
+			        trial, (unsigned long long)cut, (unsigned long long)calls, (torn ? ", torn" : ""), summary.titlesInstalled, installs,
+			        (unsigned long long)summary.bytesHashed, (unsigned long long)hashed, wrong);
+			failed++;
+		}
+		if(summary.resumed) resumed++;
+		redone += summary.titlesInstalled;
+	}
+
+	fprintf(stderr, "crash: %u power cuts, %u resumed from the journal, %.1f of %llu titles installed again on average, %u wrong\n",
+	        trials, resumed, (trials ? (double)redone / trials : 0.0), (unsigned long long)fresh, failed);
+
+	// A journal of other files says everything was deleted and installed, a fresh run
+	// must not believe a word of it
+	{
+		std::vector<JournalFile> files;
+		for(auto& it : fs::listDirContents(u"/updates", u".cia;"))
+		{
+			JournalFile file = JournalFile();
+			file.name = it.name;
+			file.info = getCiaInfo(u"/updates/" + it.name);
+			file.info.contents.clear();
+			file.planned = file.requiresDelete = true;
+			files.push_back(file);
+		}
+
+		seedTitles(root, downgrade, halfDone);
+		unlink(journalPath.c_str());
+		{
+			Journal stale;
+			stale.open(0);
+			stale.plan(downgrade, Journal::fingerprint(fs::listDirContents(u"/updates", u".cia;")) + 1, files);
+			for(auto& it : files)
+			{
+				stale.deleted(it.info.titleID);
+				stale.installed(it.info.titleID);
+			}
+		}
+
+		host::resetStats();
+		const InstallSummary summary = install();
+		const u64 deletes = host::callStats().count("AM_DeleteTitle") ? host::callStats().at("AM_DeleteTitle").calls : 0;
+		const bool right = !summary.resumed && summary.titlesInstalled == reference.titlesInstalled &&
+		                   summary.titlesDeleted == reference.titlesDeleted && deletes == reference.titlesDeleted;
+		fprintf(stderr, "crash: stale journal ignored: %u/%u installed, %u/%u deleted%s\n", summary.titlesInstalled,
+		        reference.titlesInstalled, summary.titlesDeleted, reference.titlesDeleted, (right ? "" : "  <- wrong"));
+		if(!right) failed++;
+	}
+
+	return (failed == 0);
+}
+
+// Seconds a read of size bytes takes on the simulated device
+static double modelSeconds(const host::Device& dev, u64 size)
+{
+	u64 fast = size, slow = 0;
+
+	if(dev.burstKB && dev.slowKBs && size > (u64)dev.burstKB * 1024)
+	{
+		fast = (u64)dev.burstKB * 1024;
+		slow = size - fast;
+	}
+	return dev.latencyUs / 1e6 + fast / (dev.bandwidthKBs * 1024.0) + (slow ? slow / (dev.slowKBs * 1024.0) : 0);
+}
+
+// Truncated and foreign CIAs in the generated set. Where the NATIVE_FIRM still has its size
+// the directory listing is enough to refuse the set, not a byte of a CIA may be read. A cut
+// NATIVE_FIRM needs the headers for the version, still nothing may be hashed. Without a
+// cached block size nothing may be probed either, the probe comes after these checks.
+static bool checkTruncated(const std::string& root)
+{
+	struct Case
+	{
+		const char *what;
+		const char *name;
+		s64 change;         // Bytes cut off (< 0) or added
+		bool headersRead;   // The set is only known after reading the headers
+	};
+	static const Case cases[] =
+	{
+		{"CIA cut short by a byte", "0004001000001202.cia", -1, false},
+		{"home menu of another region (bigger)", "0004003000009802.cia", 16384, false},
+		{"CIA cut in half", "0004001000001802.cia", -1024 * 1024, false},
+		{"NATIVE_FIRM cut short", "0004013800000002.cia", -4096, true}
+	};
+	const std::string journalPath = root + "/sysdowngrader-journal.bin", tunePath = root + "/sysdowngrader-iotune.bin";
+	u32 failed = 0, cias = 0;
+
+
+	if(DIR *dir = opendir((root + "/updates").c_str()))
+	{
+		while(struct dirent *ent = readdir(dir))
+			if(strstr(ent->d_name, ".cia")) cias++;
+		closedir(dir);
+	}
+
+	for(auto& it : cases)
+	{
+		const std::string path = root + "/updates/" + it.name;
+		struct stat st;
+		if(stat(path.c_str(), &st))
+		{
+			perror(path.c_str());
+			return false;
+		}
+
+		std::vector<u8> original(st.st_size);
+		FILE *f = fopen(path.c_str(), "rb");
+		fread(original.data(), 1, original.size(), f);
+		fclose(f);
+
+		std::vector<u8> changed(original);
+		changed.resize(original.size() + it.change, 0x5A);
+		f = fopen(path.c_str(), "wb");
+		fwrite(changed.data(), 1, changed.size(), f);
+		fclose(f);
+
+		unlink(journalPath.c_str());
+		unlink(tunePath.c_str());
+		host::resetStats();
+		const auto start = std::chrono::steady_clock::now();
+		std::string error;
+		try
+		{
+			installUpdates(true);
+		}
+		catch(titleException& e) {error = e.what();}
+		catch(fsException& e) {error = e.what();}
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		const std::map<std::string, host::CallStats>& stats = host::callStats();
+		const u64 read = stats.count("FSFILE_Read") ? stats.at("FSFILE_Read").bytes : 0;
+		const u64 manifestSize = (stat((root + "/updates/manifest.bin").c_str(), &st) ? 0 : st.st_size);
+		const bool touched = stats.count("AM_StartCiaInstall") || stats.count("AM_DeleteTitle");
+		const bool probed = !stat(tunePath.c_str(), &st);
+		const bool right = !error.empty() && !touched && !probed && (it.headersRead ? read <= manifestSize + (u64)cias * CIA_FIRST_READ : read == manifestSize);
+
+		fflush(stdout);
+		fprintf(stderr, "sizes: %-38s %s in %.1f ms, %llu bytes read%s%s\n", it.what, (error.empty() ? "installed" : "refused"),
+		        elapsed.count() * 1000, (unsigned long long)read, (probed ? ", probed" : ""), (right ? "" : "  <- wrong"));
+		if(!right) failed++;
+
+		f = fopen(path.c_str(), "wb");
+		fwrite(original.data(), 1, original.size(), f);
+		fclose(f);
+	}
+
+	unlink(journalPath.c_str());
+	return (failed == 0);
+}
+
+// Files are matched by the title ID in their header, the name doesn't count. A renamed CIA
+// still installs (the size check by name is skipped), a second copy of one title under
+// another name in place of a missing title is refused before anything is installed.
+static bool checkRenamed(const std::string& root)
+{
+	const std::string updates = root + "/updates/", journalPath = root + "/sysdowngrader-journal.bin";
+	const std::string copy = "0004001000001202.cia", missing = "0004001000001802.cia";
+	u32 failed = 0;
+
+
+	auto run = [&](const char *what, bool refuse)
+	{
+		unlink(journalPath.c_str());
+		host::resetStats();
+		std::string error;
+		try
+		{
+			installUpdates(true);
+		}
+		catch(titleException& e) {error = e.what();}
+		catch(fsException& e) {error = e.what();}
+
+		const bool touched = host::callStats().count("AM_StartCiaInstall") || host::callStats().count("AM_DeleteTitle");
+		const bool right = (refuse ? !error.empty() && !touched : error.empty());
+		fflush(stdout);
+		fprintf(stderr, "names: %-38s %s%s\n", what, (error.empty() ? "installed" : "refused"), (right ? "" : "  <- wrong"));
+		if(!right) failed++;
+	};
+
+	rename((updates + copy).c_str(), (updates + "sysupdate part 12.cia").c_str());
+	run("CIA renamed by another dumper", false);
+	rename((updates + "sysupdate part 12.cia").c_str(), (updates + copy).c_str());
+
+	std::vector<u8> data(1024 * 1024);
+	FILE *in = fopen((updates + copy).c_str(), "rb"), *out = fopen((updates + "copy of " + copy).c_str(), "wb");
+	for(size_t got; in && out && (got = fread(data.data(), 1, data.size(), in)) > 0; ) fwrite(data.data(), 1, got, out);
+	if(in) fclose(in);
+	if(out) fclose(out);
+	rename((updates + missing).c_str(), (root + "/" + missing).c_str());
+	run("one title twice, another one missing", true);
+	unlink((updates + "copy of " + copy).c_str());
+	rename((root + "/" + missing).c_str(), (updates + missing).c_str());
+
+	unlink(journalPath.c_str());
+	return (failed == 0);
+}
+
+// The set comes from what the console is. The generated set is an Old 3DS EUR one: a USA
+// console refuses it after reading the headers and before hashing, an AUS one (EUR home
+// menu) and a New 3DS (after the warning about the old NATIVE_FIRM) take it. Without CFG
+// the set is the one the files make up, as before.
+static bool checkConsole(const std::string& root)
+{
+	struct Case
+	{
+		const char *what;
+		bool new3DS;
+		u8 region;
+		bool refuse;
+	};
+	static const Case cases[] =
+	{
+		{"Old 3DS, EUR", false, CFG_REGION_EUR, false},
+		{"Old 3DS, AUS", false, CFG_REGION_AUS, false},
+		{"Old 3DS, USA", false, CFG_REGION_USA, true},
+		{"Old 3DS, JPN", false, CFG_REGION_JPN, true},
+		{"New 3DS, EUR", true, CFG_REGION_EUR, false},
+		{"Old 3DS, no CFG", false, 0xFF, false}
+	};
+	const std::string journalPath = root + "/sysdowngrader-journal.bin";
+	const host::Config saved = host::config();
+	u32 failed = 0;
+
+
+	for(auto& it : cases)
+	{
+		host::Config config = saved;
+		config.isNew3DS = it.new3DS;
+		config.region = it.region;
+		host::configure(config);
+
+		seedTitles(root, true, false); // Older versions on the NAND, so there is something to verify
+		unlink(journalPath.c_str());
+		host::resetStats();
+		std::string error;
+		InstallSummary summary = InstallSummary();
+		try
+		{
+			summary = installUpdates(true);
+		}
+		catch(titleException& e) {error = e.what();}
+		catch(fsException& e) {error = e.what();}
+
+		const bool touched = host::callStats().count("AM_StartCiaInstall") || host::callStats().count("AM_DeleteTitle");
+		const bool right = (it.refuse ? !error.empty() && !touched && summary.bytesHashed == 0 : error.empty() && summary.filesVerified > 0);
+		fflush(stdout);
+		fprintf(stderr, "console: %-36s %s%s\n", it.what, (error.empty() ? "installed" : "refused"), (right ? "" : "  <- wrong"));
+		if(!right) failed++;
+	}
+
+	host::configure(saved);
+	unlink(journalPath.c_str());
+	return (failed == 0);
+}
+
+// A CIA that changes between the verification and the install (same size, one byte flipped
+// past the headers) has to be cancelled before AM commits it: no AM_FinishCiaInstall, one
+// AM_CancelCIAInstall. Changed after a run died past the verification, the resumed run trusts
+// the journalled hashes and only the install check is left to catch it.
+static bool checkChanged(const std::string& root)
+{
+	const std::string updates = root + "/updates/", journalPath = root + "/sysdowngrader-journal.bin";
+	std::vector<std::string> names;
+	u32 failed = 0;
+
+
+	if(DIR *dir = opendir(updates.c_str()))
+	{
+		while(struct dirent *ent = readdir(dir))
+			if(strstr(ent->d_name, ".cia")) names.push_back(ent->d_name);
+		closedir(dir);
+	}
+
+	// Flips (and flips back) a byte near the end of every CIA
+	auto flip = [&]()
+	{
+		for(auto& it : names)
+		{
+			const int fd = open((updates + it).c_str(), O_RDWR);
+			struct stat st;
+			u8 byte;
+			if(fd < 0 || fstat(fd, &st) || pread(fd, &byte, 1, st.st_size - 100) != 1) {failed++; if(fd >= 0) close(fd); continue;}
+			byte ^= 0x80;
+			if(pwrite(fd, &byte, 1, st.st_size - 100) != 1) failed++;
+			close(fd);
+		}
+	};
+
+	auto run = [&](const char *what, bool resumed)
+	{
+		host::resetStats();
+		std::string error;
+		InstallSummary summary = InstallSummary();
+		try
+		{
+			summary = installUpdates(true);
+		}
+		catch(titleException& e) {error = e.what();}
+		catch(fsException& e) {error = e.what();}
+		host::onCall(nullptr);
+
+		const std::map<std::string, host::CallStats>& stats = host::callStats();
+		const bool right = !error.empty() && !stats.count("AM_FinishCiaInstall") && stats.count("AM_CancelCIAInstall") &&
+		                   stats.at("AM_CancelCIAInstall").calls == 1 && (!resumed || summary.bytesHashed == 0);
+		fflush(stdout);
+		fprintf(stderr, "changed: %-38s %s%s\n", what, (error.empty() ? "installed" : "cancelled"), (right ? "" : "  <- wrong"));
+		if(!right) failed++;
+	};
+
+	// Changed while the first title is being deleted, after the verification
+	seedTitles(root, true, false);
+	unlink(journalPath.c_str());
+	bool flipped = false;
+	host::onCall([&](const char *call) {if(!flipped && !strcmp(call, "AM_DeleteTitle")) {flipped = true; flip();}});
+	run("CIA changed after verification", false);
+	flip();
+
+	// The power goes before the first install, the files change, the next run resumes
+	seedTitles(root, true, false);
+	unlink(journalPath.c_str());
+	host::onCall([](const char *call) {if(!strcmp(call, "AM_DeleteTitle")) throw host::PowerLoss();});
+	try
+	{
+		installUpdates(true);
+	}
+	catch(host::PowerLoss&) {}
+	catch(std::exception& e) {failed++;}
+	host::onCall(nullptr);
+	flip();
+	run("CIA changed before a resumed run", true);
+	flip();
+
+	unlink(journalPath.c_str());
+	return (failed == 0);
+}
+
+// Probes cards with known latency/bandwidth curves. The chosen block has to come within
+// IOTUNE_TOLERANCE (plus some timer noise) of the best throughput the model allows, and a
+// second start on the same card has to take the size from the cache without reading.
+static bool checkTuner(const std::string& root)
+{
+	static const host::Device cards[] =
+	{
+		{1000, 20000, 0, 0},      // Only latency, big blocks win
+		{5000, 10000, 256, 5000}, // Slow beyond 256 KB
+		{200, 30000, 1024, 15000},
+		{20000, 8000, 0, 0}       // Very slow card
+	};
+	std::u16string probePath;
+	u64 probeSize = 0;
+	u32 failed = 0;
+
+
+	for(auto& it : fs::listDirContents(u"/updates", u".cia;"))
+		if(it.size > probeSize) {probeSize = it.size; probePath = u"/updates/" + it.name;}
+
+	for(u32 i = 0; i < sizeof(cards) / sizeof(cards[0]); i++)
+	{
+		host::Config config = host::config();
+		config.sdmc = cards[i];
+		config.cardSerial = 0x7E570000 + i;
+		host::configure(config);
+
+		const u32 chosen = iotune::tune(probePath, false);
+		double best = 0, bestSize = 0;
+		for(auto& it : iotune::probes())
+		{
+			const double modelled = it.blockSize / modelSeconds(cards[i], it.blockSize);
+			if(modelled > best) {best = modelled; bestSize = it.blockSize;}
+		}
+		const double reached = chosen / modelSeconds(cards[i], chosen) / best;
+
+		const u32 cached = iotune::tune(probePath);
+		const bool read = !iotune::probes().empty();
+
+		fprintf(stderr, "iotune: card %u picked %4u KB (model best %4u KB), %5.1f%% of the best throughput%s\n",
+		        i, chosen / 1024, (u32)(bestSize / 1024), reached * 100, (cached != chosen || read ? ", cache missed" : ""));
+		if(reached * 100 < 100 - IOTUNE_TOLERANCE - 3 || cached != chosen || read) failed++;
+	}
+
+	// A probe file that can't be read keeps the size the tuner has, the install goes on
+	const u32 before = iotune::blockSize();
+	bool thrown = false;
+	try
+	{
+		if(iotune::tune(u"/updates/not there.cia", false) != before || !iotune::probes().empty()) failed++;
+	} catch(fsException& e) {thrown = true;}
+	fprintf(stderr, "iotune: unreadable probe file %s\n", (thrown ? "aborted the tuning  <- wrong" : "kept the current size"));
+	if(thrown) failed++;
+
+	return (failed == 0);
+}
+
+// Same probe as the app: from the first constructor to main()
+static u64 startTick = 0, mainTick = 0;
+
+__attribute__((constructor(101))) static void markStart()
+{
+	startTick = svcGetSystemTick();
+}
+
+static double tickMs(u64 ticks) {return ticks * 1000.0 / SYSCLOCK_ARM11;}
+
+// Every built-in set has to be found by its titles, and only with the right version. The
+// pool is measured against the text tables hashes.h had before (a 21 byte name, 65 byte hex
+// string and two pointers per title, decoded to a 48 byte entry once used) and the v1 file
+// (48 byte entries), then every title of every set is looked up to time Set::find().
+static bool checkBuiltinSets(std::vector<manifest::Set>& sets)
+{
+	const std::vector<manifest::Set>& builtin = manifest::builtin();
+	const u32 rounds = 200;
+	u32 failed = 0, entries = 0, lookups = 0, sum = 0;
+	std::set<std::string> distinct;
+
+
+	fprintf(stderr, "startup: %.3f ms to main()\n", tickMs(mainTick - startTick));
+
+	for(auto const &set : builtin)
+	{
+		std::vector<u64> titleIDs;
+		for(u32 j = 0; j < set.size(); j++)
+		{
+			titleIDs.push_back(set.entries()[j].titleID);
+			distinct.insert(std::string((const char*)set.sha256(set.entries()[j]), SHA256::HashBytes));
+		}
+		entries += set.size();
+
+		const bool right = manifest::find(set.firmVersion(), titleIDs) == &set && set.find(set.nativeFirm()) &&
+		                   set.find(set.homeMenu()) && !set.find(0x0004001000000000LL) &&
+		                   !manifest::find(set.firmVersion() + 1, titleIDs);
+		if(!right)
+		{
+			fprintf(stderr, "manifest: set v%u (%016llX, %016llX) not found by its titles\n", set.firmVersion(),
+			        (unsigned long long)set.nativeFirm(), (unsigned long long)set.homeMenu());
+			failed++;
+		}
+		else sets.push_back(set);
+	}
+
+	const u32 pooled = distinct.size() * sizeof(manifest::Digest) + entries * sizeof(manifest::Entry) + builtin.size() * sizeof(manifest::SetRecord);
+	const u32 text = entries * (21 + 65 + 2 * 4 + 48), fileV1 = 32 + builtin.size() * 32 + entries * 48;
+	fprintf(stderr, "manifest: %u built-in sets, %u hashes, %u distinct; %u bytes pooled, text tables were %u (%u saved), "
+	        "v1 file %u (%u saved)\n", (unsigned int)builtin.size(), entries, (unsigned int)distinct.size(), pooled, text,
+	        text - pooled, fileV1, fileV1 - pooled);
+
+	const u64 tick = svcGetSystemTick();
+	for(u32 round = 0; round < rounds; round++)
+	{
+		for(auto const &set : builtin)
+		{
+			for(u32 j = 0; j < set.size(); j++)
+			{
+				const manifest::Entry *entry = set.find(set.entries()[j].titleID);
+				sum += set.sha256(*entry)[round % SHA256::HashBytes];
+				lookups++;
+			}
+		}
+	}
+	const double elapsed = tickMs(svcGetSystemTick() - tick);
+	fprintf(stderr, "manifest: %u lookups (title to digest) in %.3f ms, %.1f ns each (%u)\n", lookups, elapsed,
+	        elapsed * 1000000.0 / lookups, sum & 0xFF);
+
+	return (failed == 0);
+}
+
+// The built-in sets written as a manifest file have to come back the same. Damaged
+// files (any flipped byte, short, long, valid CRC but inconsistent) must be refused.
+static bool checkManifestFile(const std::vector<manifest::Set>& sets)
+{
+	const std::vector<u8> image = manifest::build(sets);
+	const manifest::Header *header = (const manifest::Header*)image.data();
+	manifest::Manifest file;
+	std::mt19937 random(image.size());
+	u32 failed = 0, refused = 0, tried = 0;
+
+
+	if(!file.parse(image.data(), image.size()) || file.sets().size() != sets.size()) failed++;
+	for(u32 i = 0; !failed && i < sets.size(); i++)
+	{
+		const manifest::Set& set = file.sets()[i];
+		std::vector<u64> titleIDs;
+		for(u32 j = 0; j < sets[i].size(); j++)
+		{
+			const manifest::Entry& original = sets[i].entries()[j];
+			const manifest::Entry *entry = set.find(original.titleID);
+			if(!entry || entry->size != original.size || memcmp(set.sha256(*entry), sets[i].sha256(original), SHA256::HashBytes)) failed++;
+			titleIDs.push_back(sets[i].entries()[j].titleID);
+		}
+		if(set.firmVersion() != sets[i].firmVersion() || set.nativeFirm() != sets[i].nativeFirm() || set.homeMenu() != sets[i].homeMenu()) failed++;
+		if(!file.find(sets[i].firmVersion(), titleIDs)) failed++;
+	}
+	if(failed) fprintf(stderr, "manifest: the file doesn't give back the sets it was made of\n");
+
+	// Fields fixed up to a valid CRC, only the consistency checks can catch these
+	auto damaged = [&](std::function<void(std::vector<u8>&)> damage, bool fixCrc)
+	{
+		std::vector<u8> data = image;
+		damage(data);
+		if(fixCrc && data.size() >= sizeof(manifest::Header))
+		{
+			const u32 crc = CRC32::update(0, &data[sizeof(manifest::Header)], data.size() - sizeof(manifest::Header));
+			memcpy(&data[offsetof(manifest::Header, crc32)], &crc, 4);
+		}
+		tried++;
+		if(!file.parse(data.data(), data.size()) && file.sets().empty()) refused++;
+	};
+	auto setField = [&](std::vector<u8>& data, u32 offset, u32 value) {memcpy(&data[offset], &value, 4);};
+	const u32 firstSet = header->setOffset, firstEntry = header->entryOffset;
+
+	damaged([](std::vector<u8>& data) {data.pop_back();}, true);
+	damaged([](std::vector<u8>& data) {data.push_back(0);}, true);
+	damaged([](std::vector<u8>& data) {data.resize(sizeof(manifest::Header) - 1);}, false);
+	damaged([&](std::vector<u8>& data) {setField(data, offsetof(manifest::Header, magic), 0x464D4454);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, offsetof(manifest::Header, version), MANIFEST_VERSION + 1);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, offsetof(manifest::Header, setCount), header->setCount + 1);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, offsetof(manifest::Header, entryCount), 0x10000000);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, offsetof(manifest::Header, digestCount), header->digestCount - 1);}, true);
+	damaged([&](std::vector<u8>& data) {data.resize(data.size() - sizeof(manifest::Digest));
+	                                    setField(data, offsetof(manifest::Header, digestCount), header->digestCount - 1);
+	                                    setField(data, offsetof(manifest::Header, fileSize), data.size());}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, firstSet + offsetof(manifest::SetRecord, firstEntry), header->entryCount);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, firstSet + offsetof(manifest::SetRecord, entryCount), 0xFFFFFFFF);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, firstSet + offsetof(manifest::SetRecord, homeMenu), 0x12345678);}, true);
+	damaged([&](std::vector<u8>& data) {setField(data, firstEntry + offsetof(manifest::Entry, digest), header->digestCount);}, true);
+	damaged([&](std::vector<u8>& data) {std::swap_ranges(&data[firstEntry], &data[firstEntry + 16], &data[firstEntry + 16]);}, true);
+	for(u32 i = 0; i < 2000; i++)
+	{
+		const u32 offset = random() % image.size();
+		damaged([&](std::vector<u8>& data) {data[offset] ^= 1 << (random() % 8);}, false);
+	}
+
+	fprintf(stderr, "manifest: file of %u sets (%u bytes) read back %s, %u of %u damaged copies refused\n",
+	        (unsigned int)sets.size(), (unsigned int)image.size(), (failed ? "wrong" : "right"), refused, tried);
+	return (failed == 0 && refused == tried);
+}
+
+// A manifest file only adds firmwares: for a built-in one the built-in set is used, and a file
+// whose hashes for it are other ones is refused. One of another version comes from the file.
+static bool checkFileOrder()
+{
+	const manifest::Set& first = manifest::builtin()[0];
+	std::vector<manifest::Entry> entries(first.entries(), first.entries() + first.size());
+	std::vector<manifest::Digest> digests(first.size());
+	manifest::SetRecord record = manifest::SetRecord();
+	manifest::Manifest file;
+	bool fromFile = true, refused = false;
+	u32 failed = 0;
+
+
+	for(u32 i = 0; i < entries.size(); i++)
+	{
+		memcpy(digests[i].sha256, first.sha256(entries[i]), SHA256::HashBytes);
+		entries[i].digest = i;
+	}
+	record.nativeFirm = first.nativeFirm();
+	record.homeMenu = first.homeMenu();
+	record.firmVersion = first.firmVersion();
+	record.entryCount = entries.size();
+
+	// The same hashes: no complaint, the built-in set is the one picked
+	std::vector<u8> image = manifest::build({manifest::Set(record, entries.data(), digests.data())});
+	try
+	{
+		if(!file.parse(image.data(), image.size())) failed++;
+		manifest::checkBuiltin(file);
+	}
+	catch(titleException&) {failed++;}
+	if(manifest::resolve(file, record.firmVersion, record.nativeFirm, record.homeMenu, &fromFile) != &first || fromFile) failed++;
+
+	// Another version of it isn't built in, that one is the file's
+	record.firmVersion += 0x10000;
+	image = manifest::build({manifest::Set(record, entries.data(), digests.data())});
+	if(!file.parse(image.data(), image.size())) failed++;
+	if(manifest::resolve(file, record.firmVersion, record.nativeFirm, record.homeMenu, &fromFile) != &file.sets()[0] || !fromFile) failed++;
+
+	// One hash changed for the built-in version
+	record.firmVersion -= 0x10000;
+	digests.back().sha256[0] ^= 1;
+	image = manifest::build({manifest::Set(record, entries.data(), digests.data())});
+	try
+	{
+		if(!file.parse(image.data(), image.size())) failed++;
+		manifest::checkBuiltin(file);
+	}
+	catch(titleException&) {refused = true;}
+	if(!refused) failed++;
+
+	fprintf(stderr, "manifest: built-in set before the file %s, a file with other hashes for it %s\n",
+	        (failed ? "wrong" : "right"), (refused ? "refused" : "taken <- wrong"));
+	return (failed == 0);
+}
+
+// The lookup phase over a big /updates: a title ID per file name and the set entry for it.
+// Before, each name went through utf16_to_utf8 into a 256 byte buffer and strtoull.
+static bool checkNameLookup()
+{
+	const u32 count = 8192, rounds = 20;
+	std::vector<std::u16string> names;
+	std::vector<manifest::Entry> entries(count, manifest::Entry());
+	manifest::Digest digest = manifest::Digest();
+	manifest::SetRecord record = manifest::SetRecord();
+	u32 failed = 0;
+
+
+	for(u32 i = 0; i < count; i++)
+	{
+		char name[32];
+		entries[i].titleID = 0x0004001000000000LL | ((u64)i << 8) | 2;
+		snprintf(name, sizeof(name), "%016llX.cia", (unsigned long long)entries[i].titleID);
+		names.push_back(std::u16string(name, name + strlen(name)));
+	}
+	record.entryCount = count;
+	const manifest::Set set(record, entries.data(), &digest);
+
+	u64 tick = svcGetSystemTick();
+	for(u32 round = 0; round < rounds; round++)
+	{
+		for(u32 i = 0; i < count; i++)
+		{
+			char name[256];
+			memset(name, 0, sizeof(name));
+			utf16_to_utf8((u8*)name, (const u16*)names[i].c_str(), sizeof(name) - 1);
+			if(set.find(strtoull(name, nullptr, 16)) != &entries[i]) failed++;
+		}
+	}
+	const double transcoded = tickMs(svcGetSystemTick() - tick);
+
+	tick = svcGetSystemTick();
+	for(u32 round = 0; round < rounds; round++)
+	{
+		for(u32 i = 0; i < count; i++)
+		{
+			u64 titleID;
+			if(!manifest::titleID(names[i], &titleID) || set.find(titleID) != &entries[i]) failed++;
+		}
+	}
+	const double direct = tickMs(svcGetSystemTick() - tick);
+
+	u64 titleID;
+	if(manifest::titleID(u"0004001000001202.ci", &titleID) || manifest::titleID(u"0004001000001202.txt", &titleID) ||
+	   manifest::titleID(u"000400100000120G.cia", &titleID) || !manifest::titleID(u"000400100000a902.CIA", &titleID) ||
+	   titleID != 0x000400100000A902LL) failed++;
+
+	fprintf(stderr, "names: %u files, by UTF-8 name %.1f ns, by title ID %.1f ns per lookup%s\n", count,
+	        transcoded * 1000000.0 / (count * rounds), direct * 1000000.0 / (count * rounds), (failed ? "  <- wrong" : ""));
+	return (failed == 0);
+}
+
+static bool checkManifest()
+{
+	std::vector<manifest::Set> sets;
+	const bool builtin = checkBuiltinSets(sets);
+
+	return checkManifestFile(sets) & checkFileOrder() & checkNameLookup() & builtin;
+}
+
+// Every CRC-32 kernel the CPU has against zlib's crc32(): odd lengths and alignments, fed
+// in one go and in pieces, then combine() against crc32_combine() and the throughput.
+static bool checkCrc32()
+{
+	static const CRC32::Kernel kernels[] = {CRC32::Slicing8, CRC32::Slicing16, CRC32::ArmCrc, CRC32::Pclmul};
+	const u32 size = 16<<20, rounds = 8;
+	std::vector<u8> data(size + 64);
+	std::mt19937 random(size);
+	u32 failed = 0;
+
+
+	for(auto& it : data) it = random();
+	if(CRC32()("123456789") != "cbf43926") failed++;
+
+	const u64 zlibTick = svcGetSystemTick();
+	uLong expected = 0;
+	for(u32 round = 0; round < rounds; round++) expected = crc32(0, data.data(), size);
+	const double zlibMs = tickMs(svcGetSystemTick() - zlibTick);
+	fprintf(stderr, "crc32: zlib %8.1f MB/s\n", rounds * (size / 1048576.0) / (zlibMs / 1000));
+
+	for(auto kernel : kernels)
+	{
+		if(CRC32::selectKernel(kernel) != kernel)
+		{
+			fprintf(stderr, "crc32: %-13s not supported here\n", CRC32::kernelName(kernel));
+			continue;
+		}
+
+		u32 wrong = 0;
+		for(u32 i = 0; i < 2000; i++)
+		{
+			const u32 offset = random() % 64, length = (i < 300 ? i : random() % 70000);
+			const u32 split = (length ? random() % length : 0);
+			const u32 crc = CRC32::update(0, &data[offset], length);
+			if(crc != crc32(0, &data[offset], length) ||
+			   CRC32::update(CRC32::update(0, &data[offset], split), &data[offset + split], length - split) != crc) wrong++;
+		}
+
+		const u64 tick = svcGetSystemTick();
+		u32 crc = 0;
+		for(u32 round = 0; round < rounds; round++) crc = CRC32::update(0, data.data(), size);
+		const double ms = tickMs(svcGetSystemTick() - tick);
+		if(crc != expected) wrong++;
+
+		fprintf(stderr, "crc32: %-13s %8.1f MB/s (%.2fx zlib)%s\n", CRC32::kernelName(kernel),
+		        rounds * (size / 1048576.0) / (ms / 1000), zlibMs / ms, (wrong ? "  <- wrong" : ""));
+		failed += wrong;
+	}
+	CRC32::selectKernel();
+
+	u32 wrong = 0;
+	for(u32 i = 0; i < 2000; i++)
+	{
+		const u32 lengthA = random() % 70000, lengthB = (i < 100 ? i : random() % 70000);
+		const uLong crcA = crc32(0, data.data(), lengthA), crcB = crc32(0, &data[lengthA], lengthB);
+		if(CRC32::combine(crcA, crcB, lengthB) != crc32_combine(crcA, crcB, lengthB)) wrong++;
+	}
+	if(CRC32::combine(0x12345678, 0x9ABCDEF0, 1ULL<<40) != crc32_combine64(0x12345678, 0x9ABCDEF0, 1LL<<40)) wrong++;
+	fprintf(stderr, "crc32: combine() %s crc32_combine()\n", (wrong ? "differs from" : "matches"));
+	failed += wrong;
+
+	return (failed == 0);
+}
+
+// FIPS 180-2 vectors (and the empty message) through every SHA-256 backend the CPU has, every
+// backend against the portable one for lengths 0..2000 at odd alignments, then their throughput.
+static bool checkSha256()
+{
+	static const SHA256::Backend backends[] = {SHA256::Portable, SHA256::ShaNi, SHA256::ArmCrypto};
+	static const struct {const char *message; u32 repeat; const char *hash;} vectors[] =
+	{
+		{"", 1, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+		{"abc", 1, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+		{"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+		{"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+		 "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1"},
+		{"a", 1000000, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"}
+	};
+	const u32 size = 32<<20;
+	std::vector<u8> data(size + 64);
+	std::vector<std::string> reference;
+	std::mt19937 random(size);
+	u32 failed = 0;
+
+
+	for(auto& it : data) it = random();
+	SHA256::selectBackend(SHA256::Portable);
+	for(u32 length = 0; length <= 2000; length++) reference.push_back(SHA256()(&data[length % 64], length));
+
+	for(auto backend : backends)
+	{
+		if(SHA256::selectBackend(backend) != backend)
+		{
+			fprintf(stderr, "sha256: %-13s not supported here\n", SHA256::backendName(backend));
+			continue;
+		}
+
+		u32 wrong = 0;
+		for(auto& it : vectors)
+		{
+			SHA256 sha256;
+			for(u32 i = 0; i < it.repeat; i++) sha256.add(it.message, strlen(it.message));
+			if(sha256.getHash() != it.hash) wrong++;
+		}
+		for(u32 length = 0; length <= 2000; length++)
+		{
+			SHA256 sha256;
+			const u32 split = random() % (length + 1);
+			sha256.add(&data[length % 64], split);
+			sha256.add(&data[length % 64 + split], length - split);
+			if(sha256.getHash() != reference[length]) wrong++;
+		}
+
+		const u64 tick = svcGetSystemTick();
+		SHA256()(data.data(), size);
+		const double ms = tickMs(svcGetSystemTick() - tick);
+
+		fprintf(stderr, "sha256: %-13s %7.1f MB/s, FIPS 180-2 vectors and portable %s\n", SHA256::backendName(backend),
+		        (size / 1048576.0) / (ms / 1000), (wrong ? "differ  <- wrong" : "match"));
+		failed += wrong;
+	}
+	SHA256::selectBackend();
+
+	return (failed == 0);
+}
+
+// Every SHA256Multi backend against SHA256 lane by lane: 1..8 lanes, chunks around the block
+// size, then a tail of a different length per lane. The throughput is over 8 lanes.
+static bool checkSha256Multi()
+{
+	static const SHA256Multi::Backend backends[] = {SHA256Multi::Scalar, SHA256Multi::Sse2, SHA256Multi::Avx2, SHA256Multi::Neon};
+	static const u32 chunks[] = {1, 63, 64, 65, 1000, 4096, 65537};
+	const u32 size = 4<<20;
+	std::vector<u8> data(SHA256Multi::MaxLanes * size);
+	std::mt19937 random(size);
+	u32 failed = 0;
+
+
+	for(auto& it : data) it = random();
+
+	// The SIMD lanes do what the portable code does, the speedup is against that
+	double scalarMs = 0;
+	for(auto backend : {SHA256::Auto, SHA256::Portable})
+	{
+		SHA256::selectBackend(backend);
+		const u64 tick = svcGetSystemTick();
+		for(u32 lane = 0; lane < SHA256Multi::MaxLanes; lane++) SHA256()(&data[lane * size], size);
+		scalarMs = tickMs(svcGetSystemTick() - tick);
+		fprintf(stderr, "sha256multi: one file after another, %-13s %7.1f MB/s\n",
+		        SHA256::backendName(SHA256::selectedBackend()), data.size() / 1048576.0 / (scalarMs / 1000));
+	}
+	SHA256::selectBackend();
+
+	for(auto backend : backends)
+	{
+		if(SHA256Multi::selectBackend(backend) != backend)
+		{
+			fprintf(stderr, "sha256multi: %-6s not supported here\n", SHA256Multi::backendName(backend));
+			continue;
+		}
+
+		u32 wrong = 0;
+		for(u32 lanes = 1; lanes <= SHA256Multi::MaxLanes; lanes++)
+		{
+			for(auto chunk : chunks)
+			{
+				SHA256Multi multi(lanes);
+				SHA256 single[SHA256Multi::MaxLanes];
+				const void *pointers[SHA256Multi::MaxLanes];
+
+				for(u32 offset = 0; offset + chunk <= 3 * chunk + 100; offset += chunk)
+				{
+					for(u32 lane = 0; lane < lanes; lane++)
+					{
+						pointers[lane] = &data[lane * size + offset];
+						single[lane].add(pointers[lane], chunk);
+					}
+					multi.add(pointers, chunk);
+				}
+				for(u32 lane = 0; lane < lanes; lane++)
+				{
+					const u32 tail = random() % 200;
+					multi.add(lane, &data[lane * size + size - tail], tail);
+					single[lane].add(&data[lane * size + size - tail], tail);
+					if(multi.getHash(lane) != single[lane].getHash()) wrong++;
+				}
+			}
+		}
+
+		SHA256Multi multi(SHA256Multi::MaxLanes);
+		const void *pointers[SHA256Multi::MaxLanes];
+		const u64 tick = svcGetSystemTick();
+		for(u32 offset = 0; offset < size; offset += 0x10000)
+		{
+			for(u32 lane = 0; lane < SHA256Multi::MaxLanes; lane++) pointers[lane] = &data[lane * size + offset];
+			multi.add(pointers, 0x10000);
+		}
+		for(u32 lane = 0; lane < SHA256Multi::MaxLanes; lane++) multi.getHash(lane);
+		const double ms = tickMs(svcGetSystemTick() - tick);
+
+		fprintf(stderr, "sha256multi: %-6s %u lane%s %7.1f MB/s (%.2fx portable), lanes %s SHA256\n", SHA256Multi::backendName(backend),
+		        SHA256Multi::backendLanes(backend), (SHA256Multi::backendLanes(backend) > 1 ? "s" : " "), data.size() / 1048576.0 / (ms / 1000),
+		        scalarMs / ms, (wrong ? "differ from  <- wrong" : "match"));
+		failed += wrong;
+	}
+	SHA256Multi::selectBackend();
+
+	return (failed == 0);
+}
+
+// add() stages partial blocks with bulk copies. Fed a byte at a time, in odd chunks or as a
+// scatter/gather list of odd segments, the hash has to be the one of a single add(); the
+// throughput of the odd chunks shows what the staging costs.
+static bool checkSha256Staging()
+{
+	static const u32 chunks[] = {1, 3, 7, 13, 31, 63, 65, 100, 1000};
+	const u32 size = 8<<20;
+	std::vector<u8> data(size);
+	std::mt19937 random(size);
+	u32 failed = 0;
+
+
+	for(auto& it : data) it = random();
+	const std::string expected = SHA256()(data.data(), size);
+
+	{
+		SHA256 bytes, segmented;
+		std::vector<SHA256::Segment> segments;
+		for(u32 offset = 0; offset < (1<<20); offset++) bytes.add(&data[offset], 1);
+		for(u32 offset = 0; offset < (1<<20);)
+		{
+			const u32 length = std::min<u32>(random() % 200, (1<<20) - offset); // Empty ones too
+			segments.push_back({&data[offset], length});
+			offset += length;
+		}
+		segmented.add(segments.data(), segments.size());
+		const std::string whole = SHA256()(data.data(), 1<<20);
+		if(bytes.getHash() != whole || segmented.getHash() != whole) failed++;
+		fprintf(stderr, "sha256: byte at a time and %u segments %s one add()\n", (u32)segments.size(), (failed ? "differ from  <- wrong" : "match"));
+	}
+
+	for(auto chunk : chunks)
+	{
+		SHA256 sha256;
+		const u64 tick = svcGetSystemTick();
+		for(u32 offset = 0; offset < size; offset += chunk) sha256.add(&data[offset], std::min(chunk, size - offset));
+		const std::string hash = sha256.getHash();
+		const double ms = tickMs(svcGetSystemTick() - tick);
+
+		fprintf(stderr, "sha256: %4u byte chunks %7.1f MB/s%s\n", chunk, size / 1048576.0 / (ms / 1000), (hash != expected ? "  <- wrong" : ""));
+		if(hash != expected) failed++;
+	}
+
+	return (failed == 0);
+}
+
+// MultiDigest against a SHA256 pass and a CRC32 pass over the same chunks, with every digest,
+// with one of them and in odd chunks, then the time of one pass against the two.
+static bool checkMultiDigest()
+{
+	const u32 size = 64<<20, chunk = 2<<20;
+	std::vector<u8> data(size);
+	std::mt19937 random(size);
+	u32 failed = 0;
+
+
+	for(auto& it : data) it = random();
+
+	const u64 separateTick = svcGetSystemTick();
+	SHA256 sha256;
+	CRC32 crc32;
+	for(u32 offset = 0; offset < size; offset += chunk) sha256.add(&data[offset], chunk);
+	for(u32 offset = 0; offset < size; offset += chunk) crc32.add(&data[offset], chunk);
+	const std::string hash = sha256.getHash();
+	const double separateMs = tickMs(svcGetSystemTick() - separateTick);
+
+	const u64 tick = svcGetSystemTick();
+	MultiDigest digest;
+	for(u32 offset = 0; offset < size; offset += chunk) digest.add(&data[offset], chunk);
+	const bool right = (digest.getSha256() == hash && digest.getCrc32() == crc32.getValue() && digest.getSize() == size);
+	const double ms = tickMs(svcGetSystemTick() - tick);
+	if(!right) failed++;
+
+	MultiDigest shaOnly(MultiDigest::Sha256), crcOnly(MultiDigest::Crc32), odd;
+	for(u32 offset = 0; offset < size;)
+	{
+		const u32 length = std::min<u32>(1 + random() % 100000, size - offset);
+		shaOnly.add(&data[offset], length);
+		crcOnly.add(&data[offset], length);
+		odd.add(&data[offset], length);
+		offset += length;
+	}
+	if(shaOnly.getSha256() != hash || crcOnly.getCrc32() != crc32.getValue() || crcOnly.getSize() != size ||
+	   odd.getSha256() != hash || odd.getCrc32() != crc32.getValue()) failed++;
+
+	fprintf(stderr, "multidigest: %u MB in %u KB chunks, SHA256 then CRC32 %.1f ms, one pass %.1f ms (%.2fx), digests %s\n",
+	        size>>20, chunk>>10, separateMs, ms, separateMs / ms, (failed ? "differ  <- wrong" : "match"));
+	return (failed == 0);
+}
+
+// The hashing the verifier and installer do, against known answers and separate passes
+static bool checkHashes()
+{
+	return checkSha256() & checkSha256Multi() & checkSha256Staging() & checkMultiDigest();
+}
+
+typedef std::vector<std::pair<std::string, const std::vector<u8>*>> ZipFiles;
+
+// Heap calls made while countHeap is set, for the zip writer's allocation counts
+static std::atomic<bool> countHeap(false);
+static std::atomic<u32> heapCalls(0);
+
+#ifdef __GLIBC__
+extern "C"
+{
+	void *__libc_malloc(size_t size);
+	void *__libc_calloc(size_t count, size_t size);
+	void *__libc_realloc(void *ptr, size_t size);
+
+	void *malloc(size_t size) noexcept
+	{
+		if(countHeap) heapCalls++;
+		return __libc_malloc(size);
+	}
+
+	void *calloc(size_t count, size_t size) noexcept
+	{
+		if(countHeap) heapCalls++;
+		return __libc_calloc(count, size);
+	}
+
+	void *realloc(void *ptr, size_t size) noexcept
+	{
+		if(countHeap) heapCalls++;
+		return __libc_realloc(ptr, size);
+	}
+}
+#endif
+
+// Something deflate has to work on: words of a small vocabulary, lines of random length
+static std::vector<u8> makeText(u32 size, u32 seed)
+{
+	static const char *words[] = {"title", "install", "firmware", "NATIVE_FIRM", "region", "0004013800000002",
+	                              "cia", "ticket", "tmd", "content", "delete", "version", "sha256", "sd", "nand"};
+	std::mt19937 random(seed);
+	std::vector<u8> data;
+
+
+	data.reserve(size + 32);
+	while(data.size() < size)
+	{
+		const char *word = words[random() % (sizeof(words) / sizeof(words[0]))];
+		data.insert(data.end(), word, word + strlen(word));
+		data.push_back(random() % 9 ? ' ' : '\n');
+	}
+	data.resize(size);
+	return data;
+}
+
+static std::vector<u8> makeNoise(u32 size, u32 seed)
+{
+	std::mt19937 random(seed);
+	std::vector<u8> data(size);
+
+
+	for(auto& it : data) it = random();
+	return data;
+}
+
+static u64 hostFileSize(const std::string& path)
+{
+	struct stat st;
+	return (stat(path.c_str(), &st) ? 0 : st.st_size);
+}
+
+// Writes files to <root>/zipbench/name, deflated with the given number of threads,
+// sampled first when sample isn't 0
+static bool writeZip(const std::string& root, const char *name, const ZipFiles& files, int threads, uLong sample = 0)
+{
+	const std::string hostPath = root + "/zipbench/" + name;
+	const std::u16string path = u"/zipbench/" + std::u16string(name, name + strlen(name));
+	zip_fileinfo info = zip_fileinfo();
+	int err = ZIP_OK;
+
+
+	unlink(hostPath.c_str());
+	zipFile zip = zipOpen64(path.c_str(), APPEND_STATUS_CREATE);
+	if(!zip) return false;
+	if(threads > 1) err = zipSetParallelDeflate(zip, threads, 0);
+	if(sample && err == ZIP_OK) err = zipSetAdaptiveStore(zip, sample, 0);
+
+	for(auto& it : files)
+	{
+		if(err == ZIP_OK) err = zipOpenNewFileInZip64(zip, it.first.c_str(), &info, nullptr, 0, nullptr, 0, nullptr,
+		                                              Z_DEFLATED, Z_DEFAULT_COMPRESSION, 1);
+		for(u32 offset = 0; err == ZIP_OK && offset < it.second->size(); offset += 0x10000)
+			err = zipWriteInFileInZip(zip, it.second->data() + offset, std::min<u32>(0x10000, it.second->size() - offset));
+		if(err == ZIP_OK) err = zipCloseFileInZip(zip);
+	}
+
+	return (zipClose(zip, nullptr) == ZIP_OK && err == ZIP_OK);
+}
+
+// Every file has to come back byte for byte, with the CRC unzip checks on close
+static bool readZip(const char *name, const ZipFiles& files, std::vector<int> *methods = nullptr)
+{
+	const std::u16string path = u"/zipbench/" + std::u16string(name, name + strlen(name));
+	std::vector<u8> buffer(0x10000);
+	u32 wrong = 0;
+
+
+	unzFile unz = unzOpen64(path.c_str());
+	if(!unz) return false;
+
+	int err = unzGoToFirstFile(unz);
+	for(auto& it : files)
+	{
+		unz_file_info64 info;
+		char fileName[256];
+		std::vector<u8> data;
+
+		if(err == UNZ_OK) err = unzGetCurrentFileInfo64(unz, &info, fileName, sizeof(fileName), nullptr, 0, nullptr, 0);
+		if(err == UNZ_OK) err = unzOpenCurrentFile(unz);
+		while(err == UNZ_OK)
+		{
+			const int read = unzReadCurrentFile(unz, buffer.data(), buffer.size());
+			if(read <= 0) {err = read; break;}
+			data.insert(data.end(), buffer.begin(), buffer.begin() + read);
+		}
+		if(err == UNZ_OK) err = unzCloseCurrentFile(unz);
+		if(err != UNZ_OK) break;
+
+		if(it.first != fileName || data != *it.second) wrong++;
+		if(methods) methods->push_back(info.compression_method);
+		const int next = unzGoToNextFile(unz);
+		if(next != UNZ_OK && next != UNZ_END_OF_LIST_OF_FILE) err = next;
+	}
+
+	unzClose(unz);
+	return (err == UNZ_OK && wrong == 0);
+}
+
+// pigz style deflate with 1..N threads: the archive has to inflate back byte for byte
+// whatever the thread count and however the files fall on the block boundaries. Files
+// shorter than one batch have to come out as the single stream wrote them.
+static bool checkParallelDeflate(const std::string& root)
+{
+	const u32 threads = std::max<u32>(2, std::min<u32>(8, std::thread::hardware_concurrency()));
+	const std::vector<u8> text = makeText(24<<20, 1), odd = makeText(3 * 128 * 1024 + 17, 2), small = makeText(1000, 3);
+	const std::vector<u8> mid = makeText(2 * 128 * 1024 - 1, 9), empty;
+	const ZipFiles files = {{"text.txt", &text}, {"odd.txt", &odd}, {"small.txt", &small}, {"empty.txt", &empty}};
+	const ZipFiles shortFiles = {{"small.txt", &small}, {"mid.txt", &mid}, {"empty.txt", &empty}};
+	std::vector<u8> serial;
+	double single = 0;
+	u32 failed = 0;
+
+
+	for(u32 i = 1; i <= threads; i++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const bool written = writeZip(root, "pdeflate.zip", files, i);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		const bool right = written && readZip("pdeflate.zip", files);
+		if(i == 1) single = elapsed.count();
+
+		std::vector<u8> image(writeZip(root, "pdeflate-short.zip", shortFiles, i) ? hostFileSize(root + "/zipbench/pdeflate-short.zip") : 0);
+		FILE *f = fopen((root + "/zipbench/pdeflate-short.zip").c_str(), "rb");
+		if(f)
+		{
+			if(fread(image.data(), 1, image.size(), f) != image.size()) image.clear();
+			fclose(f);
+		}
+		if(i == 1) serial = image;
+		const bool same = !image.empty() && image == serial && readZip("pdeflate-short.zip", shortFiles);
+
+		fprintf(stderr, "pdeflate: %u thread%s %7.1f MB/s (%.2fx), %.1f%% of the input%s%s\n", i, (i > 1 ? "s" : " "),
+		        (text.size() + odd.size() + small.size()) / 1048576.0 / elapsed.count(), single / elapsed.count(),
+		        hostFileSize(root + "/zipbench/pdeflate.zip") * 100.0 / (text.size() + odd.size() + small.size()),
+		        (right ? "" : "  <- doesn't inflate back"), (same ? "" : "  <- short files not the single stream's"));
+		if(!right || !same) failed++;
+	}
+
+	return (failed == 0);
+}
+
+// A mixed corpus like a backup of /updates: encrypted CIAs (random bytes, one of them smaller
+// than the sample) and text. With sampling the CIAs have to be STORED and the text deflated,
+// single stream and parallel, and everything has to read back.
+static bool checkAdaptiveStore(const std::string& root)
+{
+	const uLong sample = 128 * 1024;
+	const std::vector<u8> cia1 = makeNoise(8<<20, 4), cia2 = makeNoise(3<<20, 5), cia3 = makeNoise(50000, 6);
+	const std::vector<u8> text = makeText(4<<20, 7), log = makeText(90000, 8);
+	const ZipFiles files = {{"a.cia", &cia1}, {"readme.txt", &text}, {"b.cia", &cia2}, {"small.cia", &cia3}, {"log.txt", &log}};
+	const int expected[] = {0, Z_DEFLATED, 0, 0, Z_DEFLATED}; // 0 is STORED
+	double seconds[2] = {0, 0};
+	u64 sizes[2] = {0, 0};
+	u32 failed = 0;
+
+
+	for(u32 threads = 1; threads <= 2; threads++)
+	{
+		for(u32 adaptive = 0; adaptive < 2; adaptive++)
+		{
+			std::vector<int> methods;
+			const auto start = std::chrono::steady_clock::now();
+			const bool written = writeZip(root, "adaptive.zip", files, threads, (adaptive ? sample : 0));
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			bool right = written && readZip("adaptive.zip", files, &methods) && methods.size() == files.size();
+			for(u32 i = 0; right && i < methods.size(); i++)
+				if(methods[i] != (adaptive ? expected[i] : Z_DEFLATED)) right = false;
+			if(!right) failed++;
+
+			if(threads == 1)
+			{
+				seconds[adaptive] = elapsed.count();
+				sizes[adaptive] = hostFileSize(root + "/zipbench/adaptive.zip");
+			}
+			else if(!right) fprintf(stderr, "adaptive: with 2 threads the wrong methods were picked or it doesn't read back\n");
+		}
+	}
+
+	fprintf(stderr, "adaptive: deflate all %.3f s, %llu bytes; sampled %.3f s (%.1f%% of the time), %llu bytes (%+lld)%s\n",
+	        seconds[0], (unsigned long long)sizes[0], seconds[1], seconds[1] * 100 / seconds[0], (unsigned long long)sizes[1],
+	        (long long)(sizes[1] - sizes[0]), (failed ? "  <- wrong" : ""));
+	return (failed == 0);
+}
+
+// 20k small STORED files, so only the central directory allocates. The block list it replaced
+// made one 4080 byte block per 4080 bytes of directory plus one header per file; the arena
+// has to stay within a few reallocations. Then a few more files are appended, the existing
+// directory is read into the arena, and every file has to be there.
+static bool checkCentralDir(const std::string& root)
+{
+	const u32 count = 20000, appended = 10;
+	const std::vector<u8> data = makeText(100, 9);
+	zip_fileinfo info = zip_fileinfo();
+	ZipFiles files;
+	std::vector<std::string> names;
+	u32 calls = 0;
+	int err = ZIP_OK;
+
+
+	for(u32 i = 0; i < count + appended; i++)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "dir%02u/file%05u.txt", i / 1000, i);
+		names.push_back(name);
+	}
+	for(auto& it : names) files.push_back(std::make_pair(it, &data));
+
+	unlink((root + "/zipbench/central.zip").c_str());
+	const auto start = std::chrono::steady_clock::now();
+	for(u32 pass = 0; pass < 2; pass++)
+	{
+		const u32 first = (pass ? count : 0), last = (pass ? count + appended : count);
+
+		heapCalls = 0;
+		countHeap = true;
+		zipFile zip = zipOpen64(u"/zipbench/central.zip", (pass ? APPEND_STATUS_ADDINZIP : APPEND_STATUS_CREATE));
+		if(!zip) err = ZIP_ERRNO;
+		for(u32 i = first; err == ZIP_OK && i < last; i++)
+		{
+			err = zipOpenNewFileInZip64(zip, names[i].c_str(), &info, nullptr, 0, nullptr, 0, nullptr, 0, 0, 0);
+			if(err == ZIP_OK) err = zipWriteInFileInZip(zip, data.data(), data.size());
+			if(err == ZIP_OK) err = zipCloseFileInZip(zip);
+		}
+		if(zip && zipClose(zip, nullptr) != ZIP_OK) err = ZIP_ERRNO;
+		countHeap = false;
+		if(!pass) calls = heapCalls;
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	const bool right = (err == ZIP_OK && readZip("central.zip", files));
+	u64 directory = 0;
+	for(u32 i = 0; i < count; i++) directory += 46 + names[i].size();
+	const u32 blockList = (directory + 4079) / 4080 + count;
+
+	fprintf(stderr, "central dir: %u files (%.1f KB of directory) in %.3f s, %u heap calls, the block list made %u%s\n",
+	        count, directory / 1024.0, elapsed.count(), calls, blockList, (right ? "" : "  <- doesn't read back"));
+	return (right && calls < 32);
+}
+
+// Reads length bytes at offset of the open file through unzSeekCurrentFile64()
+static bool readAt(unzFile unz, u64 offset, u32 length, const std::vector<u8>& expected)
+{
+	std::vector<u8> data(length);
+
+
+	if(unzSeekCurrentFile64(unz, offset) != UNZ_OK || unztell64(unz) != offset) return false;
+	for(u32 done = 0; done < length;)
+	{
+		const int read = unzReadCurrentFile(unz, &data[done], length - done);
+		if(read <= 0) return false;
+		done += read;
+	}
+	return !memcmp(data.data(), &expected[offset], length);
+}
+
+// Reads at random offsets of a deflated and a stored file against the whole file: without an
+// index (inflating again from the start to go back), with one, and with one saved next to the
+// archive and loaded after reopening it. An index of the other file has to be refused.
+static bool checkSeek(const std::string& root)
+{
+	const u32 seeks = 200, length = 4096;
+	const std::vector<u8> text = makeText(24<<20, 10), cia = makeNoise(4<<20, 11);
+	const ZipFiles files = {{"text.txt", &text}, {"a.cia", &cia}};
+	std::mt19937 random(seeks);
+	std::vector<u64> offsets[2];
+	u32 failed = 0;
+
+
+	for(u32 i = 0; i < seeks; i++)
+	{
+		offsets[0].push_back(random() % (text.size() - length));
+		offsets[1].push_back(random() % (cia.size() - length));
+	}
+	if(!writeZip(root, "seek.zip", files, 1, 128 * 1024) || !readZip("seek.zip", files)) return false;
+	unlink((root + "/zipbench/seek.zip.idx").c_str());
+
+	// Runs the seeks over file i, after prepare() is done with it opened
+	auto seekAll = [&](u32 i, const char *what, std::function<int(unzFile)> prepare) -> double
+	{
+		unzFile unz = unzOpen64(u"/zipbench/seek.zip");
+		u32 wrong = 0;
+		double ms = 0;
+
+		if(!unz || unzLocateFile(unz, files[i].first.c_str(), 0) != UNZ_OK || unzOpenCurrentFile(unz) != UNZ_OK) wrong++;
+		else
+		{
+			const u64 tick = svcGetSystemTick();
+			if(prepare(unz) != UNZ_OK) wrong++;
+			for(u32 j = 0; !wrong && j < seeks; j++)
+				if(!readAt(unz, offsets[i][j], length, *files[i].second)) wrong++;
+			ms = tickMs(svcGetSystemTick() - tick);
+			unzCloseCurrentFile(unz);
+		}
+		if(unz) unzClose(unz);
+
+		fprintf(stderr, "seek: %-8s %-20s %4u reads in %8.1f ms%s\n", files[i].first.c_str(), what, seeks, ms, (wrong ? "  <- wrong" : ""));
+		failed += wrong;
+		return ms;
+	};
+
+	seekAll(0, "no index", [](unzFile) {return UNZ_OK;});
+	seekAll(0, "index every 1 MB", [](unzFile unz) {return unzBuildAccessIndex(unz, 1<<20);});
+	seekAll(0, "index saved", [](unzFile unz)
+	{
+		const int err = unzBuildAccessIndex(unz, 1<<20);
+		return (err == UNZ_OK ? unzSaveAccessIndex(unz, u"/zipbench/seek.zip.idx") : err);
+	});
+	seekAll(0, "index loaded", [](unzFile unz) {return unzLoadAccessIndex(unz, u"/zipbench/seek.zip.idx");});
+	seekAll(1, "stored", [](unzFile) {return UNZ_OK;});
+	seekAll(1, "other file's index", [](unzFile unz)
+	{
+		return (unzLoadAccessIndex(unz, u"/zipbench/seek.zip.idx") == UNZ_BADZIPFILE ? UNZ_OK : UNZ_ERRNO);
+	});
+
+	return (failed == 0);
+}
+
+// The zip port lives on the SD card like the app would use it, in <root>/zipbench
+static bool checkZip(const std::string& root)
+{
+	return checkCrc32() & checkParallelDeflate(root) & checkAdaptiveStore(root) & checkCentralDir(root) & checkSeek(root);
+}
+
+int main(int argc, char *argv[])
+{
+	mainTick = svcGetSystemTick();
+
+	host::Config config = host::config();
+	std::string root;
+	u32 count = 60, sizeKB = 2048;
+	bool downgrade = true, quiet = false, halfDone = false, generated = false, onWorker = false;
+	u32 crashTrials = 0;
+	bool tuneTest = false, verbose = false, sizeTest = false, zipTest = false;
+	int opt;
+
+
+	while((opt = getopt(argc, argv, "r:n:s:uHqvl:b:L:B:NR:wS:K:TMZzk")) != -1)
+	{
+		switch(opt)
+		{
+			case 'r': root = optarg; break;
+			case 'n': count = strtoul(optarg, nullptr, 0); break;
+			case 's': sizeKB = strtoul(optarg, nullptr, 0); break;
+			case 'u': downgrade = false; break;
+			case 'H': halfDone = true; break;
+			case 'q': quiet = true; break;
+			case 'v': verbose = true; break;
+			case 'l': config.sdmc.latencyUs = strtoul(optarg, nullptr, 0); break;
+			case 'b': config.sdmc.bandwidthKBs = strtoul(optarg, nullptr, 0); break;
+			case 'L': config.nand.latencyUs = strtoul(optarg, nullptr, 0); break;
+			case 'B': config.nand.bandwidthKBs = strtoul(optarg, nullptr, 0); break;
+			case 'N': config.isNew3DS = true; break;
+			case 'R': config.region = strtoul(optarg, nullptr, 0); break;
+			case 'w': onWorker = true; break;
+			case 'T': tuneTest = true; break;
+			case 'Z': sizeTest = true; break;
+			case 'z': zipTest = true; break;
+			case 'K': crashTrials = strtoul(optarg, nullptr, 0); break;
+			case 'S': return (stressRing(strtoul(optarg, nullptr, 0)) ? 0 : 2);
+			case 'M': return (checkManifest() ? 0 : 2);
+			case 'k': return (checkHashes() ? 0 : 2);
+			default: usage(argv[0]);
+		}
+	}
+	if(count < 1) usage(argv[0]);
+
+	if(zipTest)
+	{
+		if(root.empty()) root = "/tmp/sysdowngrader-bench";
+		mkdir(root.c_str(), 0755);
+		mkdir((root + "/zipbench").c_str(), 0755);
+		config.sdmcRoot = root;
+		host::configure(config);
+		sdmcArchiveInit();
+		const bool ok = checkZip(root);
+		sdmcArchiveExit();
+		return (ok ? 0 : 2);
+	}
+
+	if(root.empty())
+	{
+		root = "/tmp/sysdowngrader-bench";
+		makeFixture(root, count, sizeKB);
+		generated = true;
+	}
+	config.sdmcRoot = root;
+	host::configure(config);
+
+	const u64 ciaBytes = seedTitles(root, downgrade, halfDone);
+	sdmcArchiveInit();
+	if(generated) writeFixtureManifest(root);
+	host::resetStats();
+	metrics::reset();
+
+	fflush(stdout);
+	int savedStdout = dup(STDOUT_FILENO);
+	if(quiet)
+	{
+		int devNull = open("/dev/null", O_WRONLY);
+		dup2(devNull, STDOUT_FILENO);
+		close(devNull);
+	}
+
+	if(tuneTest || sizeTest)
+	{
+		const int ok = (tuneTest ? checkTuner(root) : checkTruncated(root) & checkRenamed(root) & checkConsole(root) & checkChanged(root));
+		sdmcArchiveExit();
+		fflush(stdout);
+		dup2(savedStdout, STDOUT_FILENO);
+		close(savedStdout);
+		return (ok ? 0 : 2);
+	}
+
+	// Not in the crash test, the log thread would see the cut calls too
+	if(!crashTrials)
+	{
+		if(!logger::init()) fprintf(stderr, "log: can't open %s/sysdowngrader.log\n", root.c_str());
+		if(verbose) logger::setMirror([](const char *line) {fprintf(stderr, "%s\n", line);}, 1000);
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	int ret = 0;
+	InstallSummary summary = InstallSummary();
+	if(crashTrials)
+	{
+		if(!crashTest(root, crashTrials, downgrade, halfDone)) ret = 2;
+	}
+	else if(onWorker) summary = installOnWorker(downgrade, ret);
+	else try
+	{
+		summary = installUpdates(downgrade);
+	}
+	catch(fsException& e)
+	{
+		fprintf(stderr, "\n%s\n", e.what());
+		ret = 1;
+	}
+	catch(titleException& e)
+	{
+		fprintf(stderr, "\n%s\n", e.what());
+		ret = 1;
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	fflush(stdout);
+	dup2(savedStdout, STDOUT_FILENO);
+	close(savedStdout);
+	logger::exit();
+
+	// The counters span all trials and the cut calls, nothing to compare them with
+	if(crashTrials)
+	{
+		sdmcArchiveExit();
+		return ret;
+	}
+
+	if(!quiet) metrics::print();
+	fprintf(stderr, "installUpdates(%s) on %s\n", downgrade ? "downgrade" : "upgrade", root.c_str());
+	report(elapsed.count(), ciaBytes);
+	fprintf(stderr, "verified %u CIAs (%.1f MB hashed), skipped %u, deleted %u titles, installed %u\n",
+	        summary.filesVerified, summary.bytesHashed / 1048576.0, summary.filesSkipped, summary.titlesDeleted, summary.titlesInstalled);
+	if(generated && !ret && (summary.filesVerified + summary.filesResumed != summary.titlesInstalled + summary.titlesResumed ||
+	                       summary.filesVerified + summary.filesSkipped + summary.filesResumed != count))
+	{
+		fprintf(stderr, "verify: hashed other files than the plan installs\n");
+		ret = 2;
+	}
+	const logger::Stats& log = logger::stats();
+	fprintf(stderr, "log: %u records, %u written in %u batches (%.1f KB), %u dropped, %u rotations\n",
+	        log.records, log.written, log.batches, log.bytes / 1024.0, log.dropped, log.rotations);
+	if(log.failed || log.written + log.dropped != log.records)
+	{
+		fprintf(stderr, "log: %u records lost, %u write errors\n", log.records - log.written - log.dropped, log.failed);
+		ret = 2;
+	}
+	if(!checkMetrics()) ret = 2;
+	try
+	{
+		if(!checkCiaParser(root)) ret = 2;
+	}
+	catch(std::exception& e)
+	{
+		fprintf(stderr, "\n%s\n", e.what());
+		ret = 2;
+	}
+	metrics::write(downgrade ? "bench-downgrade" : "bench-upgrade");
+
+#ifdef TRACE_ENABLED
+	if(trace::dump()) fprintf(stderr, "\ntrace written to %s/sysdowngrader-trace.json\n", root.c_str());
+#endif
+
+	sdmcArchiveExit();
+	return ret;
+}
@@ -0,0 +1,773 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <3ds.h>
+#include "ctru_host.h"
+
+
+// Same values the real services return for these cases
+#define HOST_ERR_NOT_FOUND     ((Result)0xC8804478)
+#define HOST_ERR_EXISTS        ((Result)0xC82044BE)
+#define HOST_ERR_INVALID       ((Result)0xE0E04401)
+#define HOST_ERR_BAD_HANDLE    ((Result)0xD8E007F7)
+#define HOST_ERR_CIA           ((Result)0xD8A083FA)
+
+#define HOST_ARCHIVE_SDMC      (0x00000009)
+#define HOST_CIA_PEEK_SIZE     (0x10000) // The TMD header is well within this
+
+
+
+namespace
+{
+	enum ObjectType {OBJ_FILE, OBJ_DIR, OBJ_CIA};
+
+	struct Object
+	{
+		ObjectType type;
+		int fd;                                 // OBJ_FILE
+		std::vector<FS_DirectoryEntry> entries; // OBJ_DIR
+		size_t next;                            // OBJ_DIR
+		FS_MediaType mediaType;                 // OBJ_CIA
+		std::vector<u8> head;                   // OBJ_CIA, first bytes for the TMD
+		u64 written;                            // OBJ_CIA
+	};
+
+	host::Config settings = {".", {0, 0, 0, 0}, {0, 0, 0, 0}, false, CFG_REGION_EUR, KEY_A, 0x12345678};
+	std::map<std::string, host::CallStats> stats;
+	std::map<Handle, Object> objects;
+	Handle nextHandle = 0x100;
+	std::map<u64, AM_TitleEntry> titles[3]; // Per media type
+	u64 powerCalls = 0, powerCut = 0;
+	std::function<void (const char *call)> callHook;
+
+
+	// Counts the call and sleeps for as long as the device would take
+	void account(const char *call, const host::Device& dev, u64 bytes=0)
+	{
+		if(callHook) callHook(call);
+		if(powerCut && !strstr(call, "Close") && ++powerCalls == powerCut)
+		{
+			powerCut = 0;
+			throw host::PowerLoss();
+		}
+
+		host::CallStats& s = stats[call];
+		u64 ns = (u64)dev.latencyUs * 1000;
+
+		u64 fast = bytes, slow = 0;
+		if(dev.burstKB && dev.slowKBs && bytes > (u64)dev.burstKB * 1024)
+		{
+			fast = (u64)dev.burstKB * 1024;
+			slow = bytes - fast;
+		}
+		if(dev.bandwidthKBs) ns += fast * 1000000000 / ((u64)dev.bandwidthKBs * 1024);
+		if(slow) ns += slow * 1000000000 / ((u64)dev.slowKBs * 1024);
+
+		s.calls++;
+		s.bytes += bytes;
+		s.waitNs += ns;
+		if(ns) std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
+	}
+
+	const host::Device& deviceFor(const FS_Archive& archive)
+	{
+		return (archive.id == HOST_ARCHIVE_SDMC ? settings.sdmc : settings.nand);
+	}
+
+	Handle addObject(const Object& obj)
+	{
+		objects[nextHandle] = obj;
+		return nextHandle++;
+	}
+
+	Object* findObject(Handle handle, ObjectType type)
+	{
+		auto it = objects.find(handle);
+		if(it == objects.end() || it->second.type != type) return nullptr;
+		return &it->second;
+	}
+
+	// Only the SD archive is backed by something, other archives (NAND, title icons) don't exist here
+	bool hostPath(const FS_Archive& archive, const FS_Path& path, std::string& out)
+	{
+		if(archive.id != HOST_ARCHIVE_SDMC) return false;
+
+		char tmp[0x106*3+1];
+		switch(path.type)
+		{
+			case PATH_UTF16:
+				if(utf16_to_utf8((u8*)tmp, (const u16*)path.data, sizeof(tmp)-1) < 0) return false;
+				tmp[sizeof(tmp)-1] = 0;
+				break;
+			case PATH_ASCII:
+				snprintf(tmp, sizeof(tmp), "%.*s", (int)path.size, (const char*)path.data);
+				break;
+			default:
+				return false;
+		}
+
+		out = settings.sdmcRoot + tmp;
+		return true;
+	}
+
+	Result errnoResult()
+	{
+		return (errno == ENOENT || errno == ENOTDIR ? HOST_ERR_NOT_FOUND :
+		        errno == EEXIST ? HOST_ERR_EXISTS : HOST_ERR_INVALID);
+	}
+
+	Result openFile(Handle* out, const FS_Archive& archive, const FS_Path& path, u32 openFlags)
+	{
+		std::string p;
+		int flags;
+
+		if(!hostPath(archive, path, p)) return HOST_ERR_NOT_FOUND;
+
+		flags = ((openFlags & FS_OPEN_WRITE) ? O_RDWR : O_RDONLY);
+		if(openFlags & FS_OPEN_CREATE) flags |= O_CREAT;
+
+		int fd = open(p.c_str(), flags, 0644);
+		if(fd < 0) return errnoResult();
+
+		struct stat st;
+		if(fstat(fd, &st) || S_ISDIR(st.st_mode))
+		{
+			close(fd);
+			return HOST_ERR_NOT_FOUND;
+		}
+
+		Object obj = Object();
+		obj.type = OBJ_FILE;
+		obj.fd = fd;
+		*out = addObject(obj);
+		return 0;
+	}
+
+	int removeTree(const std::string& path)
+	{
+		DIR *dir = opendir(path.c_str());
+
+		if(!dir) return unlink(path.c_str());
+		while(struct dirent *ent = readdir(dir))
+		{
+			if(!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+			removeTree(path + "/" + ent->d_name);
+		}
+		closedir(dir);
+		return rmdir(path.c_str());
+	}
+
+	u32 readBE32(const u8 *p) {return ((u32)p[0]<<24) | ((u32)p[1]<<16) | ((u32)p[2]<<8) | p[3];}
+	u32 readLE32(const u8 *p) {return ((u32)p[3]<<24) | ((u32)p[2]<<16) | ((u32)p[1]<<8) | p[0];}
+	u64 align64(u64 x) {return (x + 63) & ~63ULL;}
+}
+
+
+
+namespace host
+{
+	void configure(const Config& cfg) {settings = cfg;}
+	const Config& config() {return settings;}
+
+	void setInstalledTitle(FS_MediaType mediaType, u64 titleID, int version, u64 size)
+	{
+		if(version < 0) {titles[mediaType].erase(titleID); return;}
+
+		AM_TitleEntry entry = AM_TitleEntry();
+		entry.titleID = titleID;
+		entry.size = size;
+		entry.version = (u16)version;
+		titles[mediaType][titleID] = entry;
+	}
+
+	int installedVersion(FS_MediaType mediaType, u64 titleID)
+	{
+		auto it = titles[mediaType].find(titleID);
+		return (it == titles[mediaType].end() ? -1 : it->second.version);
+	}
+
+	void clearTitles()
+	{
+		for(auto& it : titles) it.clear();
+	}
+
+	void cutPowerAt(u64 call)
+	{
+		powerCalls = 0;
+		powerCut = call;
+	}
+
+	void onCall(std::function<void (const char *call)> hook) {callHook = hook;}
+
+	const std::map<std::string, CallStats>& callStats() {return stats;}
+	void resetStats() {stats.clear();}
+	u32  openHandles() {return objects.size();}
+
+	// CIA: little endian header, then cert chain, ticket and TMD, each 64 byte aligned.
+	// TMD: big endian signature type, signature + padding, then the header.
+	Result parseCia(const u8* data, u64 size, AM_TitleEntry* entry)
+	{
+		if(size < 0x20) return HOST_ERR_CIA;
+
+		const u64 tmdOffset = align64(readLE32(data)) + align64(readLE32(data + 0x08)) + align64(readLE32(data + 0x0C));
+		if(tmdOffset + 4 > size) return HOST_ERR_CIA;
+
+		u32 sigSize;
+		switch(readBE32(data + tmdOffset))
+		{
+			case 0x10000: case 0x10003: sigSize = 0x200 + 0x3C; break; // RSA 4096
+			case 0x10001: case 0x10004: sigSize = 0x100 + 0x3C; break; // RSA 2048
+			case 0x10002: case 0x10005: sigSize = 0x3C + 0x40;  break; // ECDSA
+			default: return HOST_ERR_CIA;
+		}
+
+		const u8 *tmd = data + tmdOffset + 4 + sigSize;
+		if(tmdOffset + 4 + sigSize + 0xC4 > size) return HOST_ERR_CIA;
+
+		memset(entry, 0, sizeof(AM_TitleEntry));
+		entry->titleID = ((u64)readBE32(tmd + 0x4C)<<32) | readBE32(tmd + 0x50);
+		entry->version = (tmd[0x9C]<<8) | tmd[0x9D];
+		return 0;
+	}
+} // namespace host
+
+
+
+//===============================================
+// FS                                          ||
+//===============================================
+
+Result fsInit(void) {return 0;}
+void   fsExit(void) {}
+
+Result FSUSER_OpenArchive(FS_Archive* archive)
+{
+	account("FSUSER_OpenArchive", deviceFor(*archive));
+	archive->handle = archive->id;
+	return 0;
+}
+
+Result FSUSER_CloseArchive(FS_Archive* archive)
+{
+	account("FSUSER_CloseArchive", deviceFor(*archive));
+	return 0;
+}
+
+Result FSUSER_OpenFile(Handle* out, FS_Archive archive, FS_Path path, u32 openFlags, u32 attributes)
+{
+	account("FSUSER_OpenFile", deviceFor(archive));
+	return openFile(out, archive, path, openFlags);
+}
+
+Result FSUSER_OpenFileDirectly(Handle* out, FS_Archive archive, FS_Path path, u32 openFlags, u32 attributes)
+{
+	account("FSUSER_OpenFileDirectly", deviceFor(archive));
+	return openFile(out, archive, path, openFlags);
+}
+
+// Manufacturer and product name of a made up card, the serial comes from the config
+Result FSUSER_GetSdmcCid(u8* out, u32 length)
+{
+	const u8 cid[16] = {0x03, 'S', 'D', 'H', 'O', 'S', 'T', 0x10, (u8)(settings.cardSerial>>24), (u8)(settings.cardSerial>>16),
+	                    (u8)(settings.cardSerial>>8), (u8)settings.cardSerial, 0x01, 0x0A, 0x00, 0x01};
+
+	account("FSUSER_GetSdmcCid", settings.sdmc);
+	memcpy(out, cid, std::min<u32>(length, sizeof(cid)));
+	return 0;
+}
+
+Result FSUSER_DeleteFile(FS_Archive archive, FS_Path path)
+{
+	std::string p;
+
+	account("FSUSER_DeleteFile", deviceFor(archive));
+	if(!hostPath(archive, path, p)) return HOST_ERR_NOT_FOUND;
+	return (unlink(p.c_str()) ? errnoResult() : 0);
+}
+
+Result FSUSER_RenameFile(FS_Archive srcArchive, FS_Path srcPath, FS_Archive dstArchive, FS_Path dstPath)
+{
+	std::string src, dst;
+
+	account("FSUSER_RenameFile", deviceFor(srcArchive));
+	if(!hostPath(srcArchive, srcPath, src) || !hostPath(dstArchive, dstPath, dst)) return HOST_ERR_NOT_FOUND;
+	return (rename(src.c_str(), dst.c_str()) ? errnoResult() : 0);
+}
+
+Result FSUSER_DeleteDirectoryRecursively(FS_Archive archive, FS_Path path)
+{
+	std::string p;
+
+	account("FSUSER_DeleteDirectoryRecursively", deviceFor(archive));
+	if(!hostPath(archive, path, p)) return HOST_ERR_NOT_FOUND;
+	return (removeTree(p) ? errnoResult() : 0);
+}
+
+Result FSUSER_CreateDirectory(FS_Archive archive, FS_Path path, u32 attributes)
+{
+	std::string p;
+
+	account("FSUSER_CreateDirectory", deviceFor(archive));
+	if(!hostPath(archive, path, p)) return HOST_ERR_NOT_FOUND;
+	return (mkdir(p.c_str(), 0755) ? errnoResult() : 0);
+}
+
+Result FSUSER_RenameDirectory(FS_Archive srcArchive, FS_Path srcPath, FS_Archive dstArchive, FS_Path dstPath)
+{
+	std::string src, dst;
+
+	account("FSUSER_RenameDirectory", deviceFor(srcArchive));
+	if(!hostPath(srcArchive, srcPath, src) || !hostPath(dstArchive, dstPath, dst)) return HOST_ERR_NOT_FOUND;
+	return (rename(src.c_str(), dst.c_str()) ? errnoResult() : 0);
+}
+
+// The whole listing is taken at open, FSDIR_Read() hands it out in pieces
+Result FSUSER_OpenDirectory(Handle* out, FS_Archive archive, FS_Path path)
+{
+	std::string p;
+
+	account("FSUSER_OpenDirectory", deviceFor(archive));
+	if(!hostPath(archive, path, p)) return HOST_ERR_NOT_FOUND;
+
+	DIR *dir = opendir(p.c_str());
+	if(!dir) return errnoResult();
+
+	Object obj = Object();
+	obj.type = OBJ_DIR;
+	while(struct dirent *ent = readdir(dir))
+	{
+		if(!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+
+		struct stat st;
+		if(stat((p + "/" + ent->d_name).c_str(), &st)) continue;
+
+		FS_DirectoryEntry entry;
+		memset(&entry, 0, sizeof(entry));
+		if(utf8_to_utf16(entry.name, (const u8*)ent->d_name, 0x105) < 0) continue;
+		entry.valid = 1;
+		entry.attributes = (S_ISDIR(st.st_mode) ? FS_ATTRIBUTE_DIRECTORY : FS_ATTRIBUTE_ARCHIVE);
+		entry.fileSize = (S_ISDIR(st.st_mode) ? 0 : st.st_size);
+		obj.entries.push_back(entry);
+	}
+	closedir(dir);
+
+	*out = addObject(obj);
+	return 0;
+}
+
+Result FSFILE_Read(Handle handle, u32* bytesRead, u64 offset, void* buffer, u32 size)
+{
+	Object *obj = findObject(handle, OBJ_FILE);
+	if(!obj) return HOST_ERR_BAD_HANDLE;
+
+	ssize_t res = pread(obj->fd, buffer, size, offset);
+	if(res < 0) return errnoResult();
+
+	account("FSFILE_Read", settings.sdmc, res);
+	*bytesRead = res;
+	return 0;
+}
+
+// Writes to a CIA install handle go to the AM sink instead of a file
+Result FSFILE_Write(Handle handle, u32* bytesWritten, u64 offset, const void* buffer, u32 size, u32 flags)
+{
+	auto it = objects.find(handle);
+	if(it == objects.end()) return HOST_ERR_BAD_HANDLE;
+
+	Object& obj = it->second;
+	if(obj.type == OBJ_CIA)
+	{
+		if(offset < HOST_CIA_PEEK_SIZE)
+		{
+			const u64 end = std::min<u64>(offset + size, HOST_CIA_PEEK_SIZE);
+			if(obj.head.size() < end) obj.head.resize(end);
+			memcpy(&obj.head[offset], buffer, end - offset);
+		}
+		obj.written = std::max<u64>(obj.written, offset + size);
+
+		account("AM_CiaWrite", settings.nand, size);
+		*bytesWritten = size;
+		return 0;
+	}
+	if(obj.type != OBJ_FILE) return HOST_ERR_BAD_HANDLE;
+
+	ssize_t res = pwrite(obj.fd, buffer, size, offset);
+	if(res < 0) return errnoResult();
+
+	account("FSFILE_Write", settings.sdmc, res);
+	*bytesWritten = res;
+	return 0;
+}
+
+Result FSFILE_GetSize(Handle handle, u64* size)
+{
+	Object *obj = findObject(handle, OBJ_FILE);
+	struct stat st;
+
+	account("FSFILE_GetSize", settings.sdmc);
+	if(!obj) return HOST_ERR_BAD_HANDLE;
+	if(fstat(obj->fd, &st)) return errnoResult();
+
+	*size = st.st_size;
+	return 0;
+}
+
+Result FSFILE_SetSize(Handle handle, u64 size)
+{
+	Object *obj = findObject(handle, OBJ_FILE);
+
+	account("FSFILE_SetSize", settings.sdmc);
+	if(!obj) return HOST_ERR_BAD_HANDLE;
+	return (ftruncate(obj->fd, size) ? errnoResult() : 0);
+}
+
+Result FSFILE_Flush(Handle handle)
+{
+	account("FSFILE_Flush", settings.sdmc);
+	return (findObject(handle, OBJ_FILE) ? 0 : HOST_ERR_BAD_HANDLE);
+}
+
+Result FSFILE_Close(Handle handle)
+{
+	auto it = objects.find(handle);
+	if(it == objects.end()) return HOST_ERR_BAD_HANDLE;
+
+	account("FSFILE_Close", settings.sdmc);
+	if(it->second.type == OBJ_FILE) close(it->second.fd);
+	objects.erase(it);
+	return 0;
+}
+
+Result FSDIR_Read(Handle handle, u32* entriesRead, u32 entryCount, FS_DirectoryEntry* entries)
+{
+	Object *obj = findObject(handle, OBJ_DIR);
+	if(!obj) return HOST_ERR_BAD_HANDLE;
+
+	u32 count = std::min<size_t>(entryCount, obj->entries.size() - obj->next);
+	memcpy(entries, &obj->entries[obj->next], count * sizeof(FS_DirectoryEntry));
+	obj->next += count;
+
+	account("FSDIR_Read", settings.sdmc, count * sizeof(FS_DirectoryEntry));
+	*entriesRead = count;
+	return 0;
+}
+
+Result FSDIR_Close(Handle handle)
+{
+	account("FSDIR_Close", settings.sdmc);
+	return (objects.erase(handle) ? 0 : HOST_ERR_BAD_HANDLE);
+}
+
+
+
+//===============================================
+// AM                                          ||
+//===============================================
+
+Result amInit(void) {return 0;}
+void   amExit(void) {}
+
+Result AM_GetTitleCount(FS_MediaType mediatype, u32* count)
+{
+	account("AM_GetTitleCount", settings.nand);
+	*count = titles[mediatype].size();
+	return 0;
+}
+
+Result AM_GetTitleList(u32* titlesRead, FS_MediaType mediatype, u32 titleCount, u64* titleIds)
+{
+	u32 i = 0;
+
+	account("AM_GetTitleList", settings.nand);
+	for(auto it = titles[mediatype].begin(); it != titles[mediatype].end() && i < titleCount; ++it)
+		titleIds[i++] = it->first;
+
+	*titlesRead = i;
+	return 0;
+}
+
+Result AM_GetTitleInfo(FS_MediaType mediatype, u32 titleCount, u64* titleIds, AM_TitleEntry* titleInfo)
+{
+	account("AM_GetTitleInfo", settings.nand);
+	for(u32 i=0; i<titleCount; i++)
+	{
+		auto it = titles[mediatype].find(titleIds[i]);
+		if(it == titles[mediatype].end()) return HOST_ERR_NOT_FOUND;
+		titleInfo[i] = it->second;
+	}
+
+	return 0;
+}
+
+Result AM_GetTitleProductCode(FS_MediaType mediatype, u64 titleId, char* productCode)
+{
+	account("AM_GetTitleProductCode", settings.nand);
+	if(!titles[mediatype].count(titleId)) return HOST_ERR_NOT_FOUND;
+
+	snprintf(productCode, 16, "CTR-N-%04X", (u32)(titleId>>8) & 0xFFFF);
+	return 0;
+}
+
+// AM reads the file itself so the bytes count against the SD card
+Result AM_GetCiaFileInfo(FS_MediaType mediatype, AM_TitleEntry* titleEntry, Handle fileHandle)
+{
+	Object *obj = findObject(fileHandle, OBJ_FILE);
+	u8 head[HOST_CIA_PEEK_SIZE];
+	struct stat st;
+
+	account("AM_GetCiaFileInfo", settings.nand);
+	if(!obj) return HOST_ERR_BAD_HANDLE;
+	if(fstat(obj->fd, &st)) return errnoResult();
+
+	ssize_t len = pread(obj->fd, head, sizeof(head), 0);
+	if(len < 0) return errnoResult();
+	account("AM_CiaRead", settings.sdmc, len);
+
+	Result res = host::parseCia(head, len, titleEntry);
+	if(!res) titleEntry->size = st.st_size;
+	return res;
+}
+
+Result AM_StartCiaInstall(FS_MediaType mediatype, Handle* ciaHandle)
+{
+	account("AM_StartCiaInstall", settings.nand);
+
+	Object obj = Object();
+	obj.type = OBJ_CIA;
+	obj.mediaType = mediatype;
+	*ciaHandle = addObject(obj);
+	return 0;
+}
+
+// The title shows up as installed with whatever the TMD says
+Result AM_FinishCiaInstall(Handle ciaHandle)
+{
+	Object *obj = findObject(ciaHandle, OBJ_CIA);
+	AM_TitleEntry entry;
+
+	account("AM_FinishCiaInstall", settings.nand);
+	if(!obj) return HOST_ERR_BAD_HANDLE;
+
+	Result res = host::parseCia(obj->head.data(), obj->head.size(), &entry);
+	if(!res)
+	{
+		entry.size = obj->written;
+		titles[obj->mediaType][entry.titleID] = entry;
+	}
+
+	objects.erase(ciaHandle);
+	return res;
+}
+
+Result AM_CancelCIAInstall(Handle ciaHandle)
+{
+	account("AM_CancelCIAInstall", settings.nand);
+	return (objects.erase(ciaHandle) ? 0 : HOST_ERR_BAD_HANDLE);
+}
+
+Result AM_DeleteTitle(FS_MediaType mediatype, u64 titleID)
+{
+	account("AM_DeleteTitle", settings.nand);
+	return (titles[mediatype].erase(titleID) ? 0 : HOST_ERR_NOT_FOUND);
+}
+
+Result AM_DeleteAppTitle(FS_MediaType mediatype, u64 titleID)
+{
+	account("AM_DeleteAppTitle", settings.nand);
+	return (titles[mediatype].erase(titleID) ? 0 : HOST_ERR_NOT_FOUND);
+}
+
+Result AM_InstallFirm(u64 titleID)
+{
+	account("AM_InstallFirm", settings.nand);
+	return (titles[MEDIATYPE_NAND].count(titleID) ? 0 : HOST_ERR_NOT_FOUND);
+}
+
+
+
+//===============================================
+// APT, HID, GFX, console, srv, svc            ||
+//===============================================
+
+Result aptInit(void) {return 0;}
+void   aptExit(void) {}
+bool   aptMainLoop(void) {return true;}
+void   aptOpenSession(void) {}
+void   aptCloseSession(void) {}
+void   aptSetStatus(APT_AppStatus status) {}
+
+Result APT_CheckNew3DS(u8* out)
+{
+	account("APT_CheckNew3DS", host::Device());
+	*out = settings.isNew3DS;
+	return 0;
+}
+
+Result cfguInit(void) {return (settings.region == 0xFF ? HOST_ERR_NOT_FOUND : 0);}
+void   cfguExit(void) {}
+
+Result CFGU_SecureInfoGetRegion(u8* region)
+{
+	account("CFGU_SecureInfoGetRegion", host::Device());
+	*region = settings.region;
+	return 0;
+}
+
+Result APT_HardwareResetAsync(void) {account("APT_HardwareResetAsync", host::Device()); return 0;}
+Result APT_PrepareToStartSystemApplet(NS_APPID appID) {return 0;}
+Result APT_StartSystemApplet(NS_APPID appID, u32 bufSize, Handle applHandle, u8* buf) {return 0;}
+Result APT_PrepareToDoAppJump(u8 flags, u64 programID, u8 mediatype) {return 0;}
+Result APT_DoAppJump(u32 NSbuf0Size, u32 NSbuf1Size, u8* NSbuf0Ptr, u8* NSbuf1Ptr) {return 0;}
+
+void hidScanInput(void) {}
+u32  hidKeysDown(void) {return settings.keysDown;}
+void hidExit(void) {}
+
+void gfxInit(GSPGPU_FramebufferFormats topFormat, GSPGPU_FramebufferFormats bottomFormat, bool vrambuffers) {}
+void gfxExit(void) {}
+void gfxFlushBuffers(void) {}
+void gfxSwapBuffers(void) {}
+void gspWaitForVBlank(void) {}
+
+PrintConsole* consoleInit(gfxScreen_t screen, PrintConsole* console) {return console;}
+void consoleClear(void) {}
+
+void srvExit(void) {}
+
+// Always hand out am:u, svchax is never needed on the host
+Result srvGetServiceHandleDirect(Handle* out, const char* name)
+{
+	*out = 1;
+	return 0;
+}
+
+Result svcCloseHandle(Handle handle) {return 0;}
+void   svcSleepThread(s64 ns) {std::this_thread::sleep_for(std::chrono::nanoseconds(ns));}
+
+u64 svcGetSystemTick(void)
+{
+	using namespace std::chrono;
+	const u64 ns = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+	return (ns / 1000000000) * SYSCLOCK_ARM11 + (ns % 1000000000) * SYSCLOCK_ARM11 / 1000000000;
+}
+
+// All events share one lock, a signal wakes every waiter and each checks its own event.
+// No RESET_PULSE, nothing uses it.
+static std::mutex eventLock;
+static std::condition_variable eventWake;
+
+void LightEvent_Init(LightEvent* event, ResetType reset_type)
+{
+	event->state = 0;
+	event->resetType = reset_type;
+}
+
+void LightEvent_Signal(LightEvent* event)
+{
+	std::lock_guard<std::mutex> lock(eventLock);
+	event->state = 1;
+	eventWake.notify_all();
+}
+
+void LightEvent_Wait(LightEvent* event)
+{
+	std::unique_lock<std::mutex> lock(eventLock);
+	eventWake.wait(lock, [event]() {return event->state != 0;});
+	if(event->resetType == RESET_ONESHOT) event->state = 0;
+}
+
+extern "C" Result svchax_init(bool patch_srv) {return 0;}
+
+
+
+ssize_t utf16_to_utf8(u8* out, const u16* in, size_t len)
+{
+	size_t n = 0;
+
+	for(; *in; in++)
+	{
+		u32 c = *in;
+		if(c >= 0xD800 && c < 0xDC00 && in[1] >= 0xDC00 && in[1] < 0xE000)
+		{
+			c = 0x10000 + ((c - 0xD800)<<10) + (in[1] - 0xDC00);
+			in++;
+		}
+
+		u8 buf[4];
+		size_t units;
+		if(c < 0x80)         {buf[0] = c; units = 1;}
+		else if(c < 0x800)   {buf[0] = 0xC0 | c>>6;  buf[1] = 0x80 | (c & 0x3F); units = 2;}
+		else if(c < 0x10000) {buf[0] = 0xE0 | c>>12; buf[1] = 0x80 | (c>>6 & 0x3F); buf[2] = 0x80 | (c & 0x3F); units = 3;}
+		else                 {buf[0] = 0xF0 | c>>18; buf[1] = 0x80 | (c>>12 & 0x3F); buf[2] = 0x80 | (c>>6 & 0x3F); buf[3] = 0x80 | (c & 0x3F); units = 4;}
+
+		if(n + units > len) break;
+		memcpy(out + n, buf, units);
+		n += units;
+	}
+	if(n < len) out[n] = 0; // libctru doesn't terminate, callers here clear their buffers anyway
+
+	return n;
+}
+
+ssize_t utf8_to_utf16(u16* out, const u8* in, size_t len)
+{
+	size_t n = 0;
+
+	while(*in)
+	{
+		u32 c = *in++;
+		int extra = (c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0);
+
+		if(extra) c &= (0x3F >> extra);
+		for(; extra > 0; extra--)
+		{
+			if((*in & 0xC0) != 0x80) return -1;
+			c = (c<<6) | (*in++ & 0x3F);
+		}
+
+		if(c >= 0x10000)
+		{
+			if(n + 2 > len) break;
+			out[n++] = 0xD800 + ((c - 0x10000)>>10);
+			out[n++] = 0xDC00 + ((c - 0x10000) & 0x3FF);
+		}
+		else
+		{
+			if(n + 1 > len) break;
+			out[n++] = c;
+		}
+	}
+	if(n < len) out[n] = 0;
+
+	return n;
+}
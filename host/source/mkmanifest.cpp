@@ -0,0 +1,310 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+// Writes the manifest file the installer reads from /updates/manifest.bin (or romfs):
+// one set per directory of CIAs named by title ID, like /updates, plus the built-in sets
+// if asked. The same sets can be written as include/hashes.h to build them in. Also lists
+// what is in an existing manifest file.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <unistd.h>
+#include <3ds.h>
+#include "sha256.h"
+#include "manifest.h"
+
+// title.cpp wants it, as in main.cpp
+u8 sysLang = 0;
+
+
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-o FILE] [-c FILE] [-b] [VERSION:DIR ...]\n"
+		"       %s -l FILE\n"
+		"  VERSION:DIR  CIAs of one firmware for one device and region, VERSION is\n"
+		"               the version of the NATIVE_FIRM CIA among them\n"
+		"  -b           add the sets built into the app\n"
+		"  -o FILE      output (default manifest.bin)\n"
+		"  -c FILE      write the sets as hashes.h instead\n"
+		"  -l FILE      list the sets of a manifest file\n", prog, prog);
+	exit(1);
+}
+
+// Sets made from directories, kept alive here as the sets point into them
+struct Storage
+{
+	std::vector<std::vector<manifest::Entry>> entries;
+	std::vector<std::vector<manifest::Digest>> digests;
+};
+
+static bool hashFile(const std::string& path, manifest::Entry& entry, manifest::Digest& digest)
+{
+	FILE *f = fopen(path.c_str(), "rb");
+	std::vector<u8> buffer(1024 * 1024);
+	SHA256 sha256;
+	size_t got;
+
+
+	if(!f) return false;
+	u64 size = 0;
+	while((got = fread(buffer.data(), 1, buffer.size(), f)) > 0)
+	{
+		sha256.add(buffer.data(), got);
+		size += got;
+	}
+	const bool ok = !ferror(f) && size <= 0xFFFFFFFF; // FAT32 can't hold more anyway
+	entry.size = size;
+	fclose(f);
+
+	sha256.getHash(digest.sha256);
+	return ok;
+}
+
+// Digests are pooled by manifest::build(), here every entry has its own
+static bool readSet(const std::string& arg, Storage& storage, std::vector<manifest::Set>& sets)
+{
+	const size_t colon = arg.find(':');
+	const std::string dir = (colon == std::string::npos ? "" : arg.substr(colon + 1));
+	std::vector<std::pair<manifest::Entry, manifest::Digest>> hashed;
+	std::vector<manifest::Entry> entries;
+	std::vector<manifest::Digest> digests;
+	manifest::SetRecord record = manifest::SetRecord();
+	DIR *d;
+
+
+	if(dir.empty() || !(d = opendir(dir.c_str())))
+	{
+		fprintf(stderr, "%s: expected VERSION:DIR\n", arg.c_str());
+		return false;
+	}
+	record.firmVersion = strtoul(arg.c_str(), nullptr, 0);
+
+	while(struct dirent *ent = readdir(d))
+	{
+		const std::string name = ent->d_name;
+		manifest::Entry entry = manifest::Entry();
+		manifest::Digest digest;
+		char *end;
+
+		if(name.size() < 4 || strcasecmp(name.c_str() + name.size() - 4, ".cia")) continue;
+		entry.titleID = strtoull(name.c_str(), &end, 16);
+		if(end != name.c_str() + 16 || name.size() != 20)
+		{
+			fprintf(stderr, "%s/%s: not named by its title ID\n", dir.c_str(), name.c_str());
+			closedir(d);
+			return false;
+		}
+		if(!hashFile(dir + "/" + name, entry, digest))
+		{
+			perror((dir + "/" + name).c_str());
+			closedir(d);
+			return false;
+		}
+		hashed.push_back(std::make_pair(entry, digest));
+
+		if(entry.titleID == NATIVE_FIRM_TITLE || entry.titleID == NEW_NATIVE_FIRM_TITLE) record.nativeFirm = entry.titleID;
+		// The home menu in a directory says which region it is
+		for(u8 region = CFG_REGION_JPN; region <= CFG_REGION_TWN; region++)
+			if(entry.titleID == manifest::homeMenu(region)) record.homeMenu = entry.titleID;
+	}
+	closedir(d);
+
+	if(!record.nativeFirm || !record.homeMenu)
+	{
+		fprintf(stderr, "%s: no NATIVE_FIRM or home menu CIA\n", dir.c_str());
+		return false;
+	}
+
+	std::sort(hashed.begin(), hashed.end(), [](const std::pair<manifest::Entry, manifest::Digest>& a,
+	          const std::pair<manifest::Entry, manifest::Digest>& b) {return a.first.titleID < b.first.titleID;});
+	for(auto &it : hashed)
+	{
+		it.first.digest = digests.size();
+		entries.push_back(it.first);
+		digests.push_back(it.second);
+	}
+	record.entryCount = entries.size();
+	storage.entries.push_back(entries);
+	storage.digests.push_back(digests);
+	sets.push_back(manifest::Set(record, storage.entries.back().data(), storage.digests.back().data()));
+	return true;
+}
+
+static int list(const char *path)
+{
+	std::vector<u8> data;
+	manifest::Manifest file;
+	FILE *f = fopen(path, "rb");
+
+
+	if(!f)
+	{
+		perror(path);
+		return 1;
+	}
+	data.resize(MANIFEST_MAX_SIZE + 1);
+	data.resize(fread(data.data(), 1, data.size(), f));
+	fclose(f);
+
+	if(!file.parse(data.data(), data.size()))
+	{
+		fprintf(stderr, "%s: not a valid manifest\n", path);
+		return 2;
+	}
+
+	for(auto const &it : file.sets())
+	{
+		u64 bytes = 0;
+		for(u32 i = 0; i < it.size(); i++) bytes += it.entries()[i].size;
+		printf("v%-5u  %016llX  %016llX  %3u titles  %.1f MB\n", it.firmVersion(), (unsigned long long)it.nativeFirm(),
+		       (unsigned long long)it.homeMenu(), it.size(), bytes / 1048576.0);
+	}
+	return 0;
+}
+
+// The built-in form of a manifest image: the same records as C arrays
+static bool writeHeader(const std::string& path, const std::vector<u8>& image)
+{
+	manifest::Manifest file;
+	FILE *f;
+
+
+	if(!file.parse(image.data(), image.size()) || !(f = fopen(path.c_str(), "w"))) return false;
+
+	const manifest::Header *header = (const manifest::Header*)image.data();
+	const manifest::Digest *digests = (const manifest::Digest*)&image[header->digestOffset];
+
+	fprintf(f, "/*\n"
+	           " *  Copyright (C) 2016 Plailect\n"
+	           " *\n"
+	           " *  This program is free software: you can redistribute it and/or modify\n"
+	           " *  it under the terms of the GNU General Public License as published by\n"
+	           " *  the Free Software Foundation, either version 3 of the License, or\n"
+	           " *  (at your option) any later version.\n"
+	           " *\n"
+	           " *  This program is distributed in the hope that it will be useful,\n"
+	           " *  but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+	           " *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+	           " *  GNU General Public License for more details.\n"
+	           " *\n"
+	           " *  You should have received a copy of the GNU General Public License\n"
+	           " *  along with this program.  If not, see <http://www.gnu.org/licenses/\n"
+	           " */\n\n\n"
+	           "#ifndef _HASHES_H_\n#define _HASHES_H_\n\n#include \"manifest.h\"\n\n"
+	           "// Only included by manifest.cpp, see manifest.h\n//\n"
+	           "// Written by host/mkmanifest, to add a firmware:\n"
+	           "// host/mkmanifest -b -c include/hashes.h VERSION:DIR\n\n");
+
+	fprintf(f, "static const manifest::Digest builtinDigests[] = {\n");
+	for(u32 i = 0; i < header->digestCount; i++)
+	{
+		fprintf(f, "{{");
+		for(u32 j = 0; j < sizeof(digests[i].sha256); j++) fprintf(f, "%s0x%02x", (j ? "," : ""), digests[i].sha256[j]);
+		fprintf(f, "}}%s\n", (i + 1 < header->digestCount ? "," : ""));
+	}
+
+	// Sizes are left out, the built-in sets don't know them
+	fprintf(f, "};\n\nstatic const manifest::Entry builtinEntries[] = {\n");
+	for(auto const &it : file.sets())
+	{
+		fprintf(f, "// v%u, %016llX, %016llX\n", it.firmVersion(), (unsigned long long)it.nativeFirm(), (unsigned long long)it.homeMenu());
+		for(u32 i = 0; i < it.size(); i++)
+		{
+			const bool last = (&it == &file.sets().back() && i + 1 == it.size());
+			fprintf(f, "{0x%016llXLL, 0, %u}%s\n", (unsigned long long)it.entries()[i].titleID, it.entries()[i].digest, (last ? "" : ","));
+		}
+	}
+
+	fprintf(f, "};\n\nstatic const manifest::SetRecord builtinSets[] = {\n");
+	for(u32 i = 0, first = 0; i < file.sets().size(); first += file.sets()[i++].size())
+	{
+		const manifest::Set& set = file.sets()[i];
+		fprintf(f, "{0x%016llXLL, 0x%016llXLL, %u, %u, %u}%s\n", (unsigned long long)set.nativeFirm(), (unsigned long long)set.homeMenu(),
+		        set.firmVersion(), first, set.size(), (i + 1 < file.sets().size() ? "," : ""));
+	}
+	fprintf(f, "};\n\n#endif // _HASHES_H_\n");
+
+	return (fclose(f) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+	std::string output = "manifest.bin", header;
+	Storage storage;
+	std::vector<manifest::Set> sets;
+	bool builtin = false;
+	int opt;
+
+
+	while((opt = getopt(argc, argv, "o:c:bl:")) != -1)
+	{
+		switch(opt)
+		{
+			case 'o': output = optarg; break;
+			case 'c': header = optarg; break;
+			case 'b': builtin = true; break;
+			case 'l': return list(optarg);
+			default: usage(argv[0]);
+		}
+	}
+
+	storage.entries.reserve(argc); // readSet() keeps pointers into them
+	storage.digests.reserve(argc);
+	for(int i = optind; i < argc; i++)
+		if(!readSet(argv[i], storage, sets)) return 1;
+
+	// Built-in sets first, so their digests keep their indices in a new hashes.h
+	if(builtin) sets.insert(sets.begin(), manifest::builtin().begin(), manifest::builtin().end());
+	if(sets.empty()) usage(argv[0]);
+
+	const std::vector<u8> data = manifest::build(sets);
+	const manifest::Header *info = (const manifest::Header*)data.data();
+	if(data.empty())
+	{
+		fprintf(stderr, "more than %u different CIAs\n", MANIFEST_MAX_DIGESTS);
+		return 1;
+	}
+	if(!header.empty())
+	{
+		if(!writeHeader(header, data))
+		{
+			perror(header.c_str());
+			return 1;
+		}
+		printf("%s: %u sets, %u titles, %u digests\n", header.c_str(), info->setCount, info->entryCount, info->digestCount);
+		return 0;
+	}
+
+	FILE *f = fopen(output.c_str(), "wb");
+	if(!f || fwrite(data.data(), 1, data.size(), f) != data.size() || fclose(f))
+	{
+		perror(output.c_str());
+		return 1;
+	}
+
+	printf("%s: %u sets, %u titles, %u digests, %u bytes\n", output.c_str(), info->setCount, info->entryCount, info->digestCount,
+	       (unsigned int)data.size());
+	return 0;
+}
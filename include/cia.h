@@ -0,0 +1,61 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _CIA_H_
+#define _CIA_H_
+
+#include <string>
+#include <vector>
+#include <3ds.h>
+#include "fs.h"
+
+#define CIA_HEADER_SIZE    (0x2020)
+#define CIA_FIRST_READ     (0x4000) // Header, certs, ticket and TMD of update titles fit in here
+
+
+
+struct CiaContent
+{
+	u32 id;
+	u16 index;
+	u16 type;
+	u64 size;
+	u8  hash[0x20]; // SHA256 of the decrypted content
+};
+
+struct CiaInfo
+{
+	u64 titleID;
+	u16 version;
+	u64 size;          // Size of the CIA file
+	u64 contentOffset; // Where the contents start in the file
+	u64 contentSize;   // All contents together
+	std::vector<CiaContent> contents;
+
+	// What AM_GetCiaFileInfo() would have returned
+	AM_TitleEntry titleEntry() const;
+};
+
+
+// Parses the CIA header and TMD of an open file, usually with one read.
+// Throws titleException if the file is no CIA.
+CiaInfo getCiaInfo(fs::File& file);
+CiaInfo getCiaInfo(const std::u16string& path, FS_Archive& archive=sdmcArchive);
+
+#endif // _CIA_H_
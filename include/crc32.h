@@ -0,0 +1,71 @@
+// //////////////////////////////////////////////////////////
+// crc32.h
+// CRC-32 (IEEE 802.3, same as zlib/ZIP) with runtime selected kernels
+//
+
+#pragma once
+
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// compute CRC32 hash
+/** Usage:
+    CRC32 crc32;
+    std::string myHash  = crc32("Hello World");     // std::string
+    std::string myHash2 = crc32("How are you", 11); // arbitrary data, 11 bytes
+
+    // or in a streaming fashion:
+
+    CRC32 crc32;
+    while (more data available)
+      crc32.add(pointer to fresh data, number of new bytes);
+    std::string myHash3 = crc32.getHash();
+
+    // zlib style for the minizip code:
+    uLong crc = CRC32::update(0, buffer, length);
+  */
+class CRC32 //: public Hash
+{
+public:
+  /// hash is 4 bytes long
+  enum { HashBytes = 4 };
+
+  /// available block kernels, see kernelName()
+  enum Kernel { Auto = 0, Slicing8, Slicing16, ArmCrc, Pclmul };
+
+  /// same as reset()
+  CRC32();
+
+  /// compute CRC32 of a memory block
+  std::string operator()(const void* data, size_t numBytes);
+  /// compute CRC32 of a string, excluding final zero
+  std::string operator()(const std::string& text);
+
+  /// add arbitrary number of bytes
+  void add(const void* data, size_t numBytes);
+
+  /// return latest hash as 8 hex characters
+  std::string getHash();
+  /// return latest hash as bytes (big endian, like the hex string)
+  void        getHash(unsigned char buffer[HashBytes]);
+  /// return latest hash as integer
+  uint32_t    getValue() const { return m_hash; }
+
+  /// restart
+  void reset();
+
+  /// continue a zlib compatible CRC (start with 0), same semantics as zlib's crc32()
+  static uint32_t update(uint32_t crc, const void* data, size_t numBytes);
+  /// CRC of A+B from CRC(A), CRC(B) and the length of B, same as zlib's crc32_combine()
+  static uint32_t combine(uint32_t crcA, uint32_t crcB, uint64_t lengthB);
+
+  /// force a kernel (Auto = pick the fastest one the CPU supports), returns the kernel in use
+  static Kernel   selectKernel(Kernel kernel = Auto);
+  static const char* kernelName(Kernel kernel);
+
+private:
+  /// current CRC, zlib convention (not inverted)
+  uint32_t m_hash;
+};
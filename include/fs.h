@@ -26,16 +26,19 @@
 #include <vector>
 #include <cstdio>
 #include <3ds.h>
+#include "metrics.h"
 //#include "zip.h"
 
 #define FS_PATH_MAX_LENGTH         (0x106)
-#define MAX_BUF_SIZE               (0x200000) // 2 MB
+#define MAX_BUF_SIZE               (0x200000) // 2 MB, largest block iotune picks
 #define FS_ERR_DOESNT_EXIST        ((Result)0xC8804478)
 #define FS_ERR_DOES_ALREADY_EXIST  ((Result)0xC82044BE) // Sometimes the API returns 0xC82044B9 instead
 
 
 extern FS_Archive sdmcArchive;
 
+class MultiDigest;
+
 class fsException : public std::exception
 {
 	char errStr[256];
@@ -89,7 +92,7 @@ namespace fs
 		u64  tell() {return _offset_;}
 		u64  size();
 		void setSize(const u64 size);
-		void close() {if(_fileHandle_) FSFILE_Close(_fileHandle_); _fileHandle_ = 0;}
+		void close() {if(_fileHandle_) SERVICE_CALL(FSFILE_Close, _fileHandle_); _fileHandle_ = 0;}
 		void move(const std::u16string& dst, FS_Archive& dstArchive=sdmcArchive);
 		u64  copy(const std::u16string& dst, std::function<void (const std::u16string& file, u32 percent)> callback=nullptr, FS_Archive& dstArchive=sdmcArchive);
 		void del(); // Delete the currently opened file
@@ -103,7 +106,7 @@ namespace fs
 	// Other file functions
 	bool fileExist(const std::u16string& path, FS_Archive& archive=sdmcArchive);
 	void moveFile(const std::u16string& src, const std::u16string& dst, FS_Archive& srcArchive=sdmcArchive, FS_Archive& dstArchive=sdmcArchive);
-	u64  copyFile(const std::u16string& src, const std::u16string& dst, std::function<void (const std::u16string& file, u32 percent)> callback=nullptr, FS_Archive& srcArchive=sdmcArchive, FS_Archive& dstArchive=sdmcArchive);
+	u64  copyFile(const std::u16string& src, const std::u16string& dst, std::function<void (const std::u16string& file, u32 percent)> callback=nullptr, FS_Archive& srcArchive=sdmcArchive, FS_Archive& dstArchive=sdmcArchive, MultiDigest *digest=nullptr);
 	void deleteFile(const std::u16string& path, FS_Archive& archive=sdmcArchive);
 
 
@@ -19,1326 +19,1812 @@
 #ifndef _HASHES_H_
 #define _HASHES_H_
 
-#include <map>
-#include <string>
-#include <3ds.h>
+#include "manifest.h"
 
-// generate the hashes in the correct format for copy + paste:
-// sha256sum *.cia | awk '{print "\{\""$2 "\", \"" $1 "\"\},"}' 2>/dev/null
+// Only included by manifest.cpp, see manifest.h
+//
+// Written by host/mkmanifest, to add a firmware:
+// host/mkmanifest -b -c include/hashes.h VERSION:DIR
 
-std::map<std::string, std::string> oldHashes2_1_0E = {
-{"0004001000022000.cia", "6cd3e87494b67e879d8796d671a084a1cecb980f581ceb4e7dc24b8177f6afb3"},
-{"0004001000022100.cia", "c66662d8f6a051399d357f22e42046f234855a2c55e2e0c54c44b87505ecea72"},
-{"0004001000022200.cia", "d6d2a2d940dbabd805abbc9d961328e182b64702ac3ddcfb5ca28922cf630bc7"},
-{"0004001000022300.cia", "44bcda7d39235245d9334824f69f79fc19d700c947589c751e4d70cf31493d2f"},
-{"0004001000022400.cia", "a5d9c136a6d4a274e056bec70b8a2d70f6c043d364f6324d2456a51ab36be55a"},
-{"0004001000022500.cia", "ee53a274ddde0e25549097cc3cd30ea5b59affe7cbf462d416765fa0210ed9fa"},
-{"0004001000022700.cia", "ea9e40144e84b83bc85a9ee05ce84969c77fb67e3962631a0a12af4f05336513"},
-{"0004001000022800.cia", "c5139e3500923851a5fa6eeba948407c908f5a938d9350348a3d949696033c73"},
-{"0004001000022900.cia", "17e837b6b3718e24f55bb328a0a9e684ef2b0ebfcea7dbfd20e9883ce49dc0a3"},
-{"0004001000022A00.cia", "f66f5d585184a4dc9b598e25dc42f1e64ccbce487ada7ab61dcb732a3521b4a8"},
-{"0004001000022B00.cia", "d692ec5734fbed2a4b375863fdcc13f7248ab76047a01eee1be4bc89dd4a9210"},
-{"0004001000022D00.cia", "1cee9f5943a5f6837408d829ebde2e146b6ed76b312ca74d0f87c6f8228b9851"},
-{"0004001000022E00.cia", "3dde33b85104ba66cdeaf214c2dd657bdfd5efe793373ea84a983197dfb2e61d"},
-{"0004001000022F00.cia", "34dafc44fda2dd782baafe754d42c0c6d725ee534ed8dfaf004af54b38d313de"},
-{"0004001000025000.cia", "12b66740fd192c59b0e5ff9d7e6e9dc317df1331e0af528c572e12127e57ead0"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004003000008A02.cia", "03b3e2a1d2109e1ecfe0e57cd4bbb68edc0195f431231b57e0aa3f669226aab2"},
-{"0004003000008A03.cia", "d801824e9198a30812bd873ab6daa6120677905921aec36f84d3b99a8474e7a8"},
-{"0004003000009802.cia", "70e516204125e7adb6b7a7b134085e55db7097b31fcabc6132235c7a5c9bef6b"},
-{"0004003000009902.cia", "58214b57fee31a44798e84050a7a9f20bea32ab12921cc12b4afedc702165cf2"},
-{"0004003000009B02.cia", "5e9c64197eed206e37ac818692d2804a2eec327ab8dec3c8f6f8d7ad183a1831"},
-{"0004003000009C02.cia", "bbd1a9e95abbcfb1b58282feabaf20bfeb42b3dd2393ec986d38782ad5e66a77"},
-{"0004003000009D02.cia", "22209a4f1d75f7ef7a18c46363d7ac2562ce563e6061e1667f01f353e9ca9903"},
-{"0004003000009F02.cia", "a11ae0ea4a0cc92aee5e15f73259b21de8de7a989148921c9c0c4a2066d29e5a"},
-{"000400300000A002.cia", "79bef2064b95245238afc53e7ad28b028ed5711535d6b4ca49f7212917024511"},
-{"000400300000C502.cia", "a99109d8ec714e2981ab289c042b39ffcdd3208d50fe274bfc90cfa2e716c8c7"},
-{"000400300000C503.cia", "ffab7a4be558f69845b2d81cdde444b027078f146f5d4b3746f4e925ef1eab41"},
-{"000400300000D002.cia", "1e5df57ae3a06202908f8b875600fd1d1e64cf55d226ddd0273b0da0c1c539c5"},
-{"000400300000D003.cia", "7d68f810a471ed5b67b3fbfa5a189f90c5fa6d933f309062654d640b666bd35c"},
-{"000400300000D102.cia", "b94f83dbf41e490088597668e1e9b5a7e2692ed39d6cebbfe1991a3bd83704e2"},
-{"000400300000D302.cia", "676ceb86de3be3f9d44793a2e916daaa4ef6fb3bb1498d54ec297689e335c7a6"},
-{"000400300000D402.cia", "6a605a38bcc39ae9e3d258be4977e9501f9b03dcf4ea230ed6f5187c3bd74806"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "a0bedf49faf09c32d58696296f11090acc762d2fc21177f9e12f21ed6f071007"},
-{"0004009B00010602.cia", "ef06a3917cf337480c54222b903428f6feeb0987880017b8cbc4864fcaef26c5"},
-{"0004009B00011202.cia", "7c3e7e0e8c7491bfe5f9d4d8aa0bd227e0d4efae1f9a56f707c5f6a7829a9984"},
-{"0004009B00011302.cia", "940bf39b42032a42b1fa851ac747b87bc694d1a87e921de3315db38485fcf5e4"},
-{"0004009B00011502.cia", "68b7f11b4db925bb7b49b399e1788aaf22734768acaf61a7bb4c705dabcddb45"},
-{"0004009B00011702.cia", "d54310ace0b165ee09a34f3c4b14d9409e0d03971a194644df0803ce50c747cb"},
-{"0004009B00011802.cia", "91456cc609adfdb1c3ba1ff996906cd0e7847596ff786e8403463ddfb32de345"},
-{"0004009B00011B02.cia", "7931c8817577c39f2aea225ebb32e4a5ba390f4a40f6fd2c1699eaa04d98d1ff"},
-{"0004009B00011C02.cia", "aa1f3852b3caa76ec516e3716da6c33543997918b4deb2330efde1d1bf49413e"},
-{"0004009B00011D02.cia", "b415e29df37906fe5bcb0edbe4f8e847b772d0254ecc4c2c97bbaced8e1458d3"},
-{"0004009B00012102.cia", "5acf2831e2bdab69a5dac373813823ec08b5b9f8281a5316332125859ac16f3d"},
-{"0004009B00013102.cia", "5a0f35fae989d66d1e604272da6f32a67497d216c6b2813b52aea0cea1d17429"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "9df3e5035a178dcfcb85151b3368c42d6d64a5d3aafc9a83835f12dd135ccad0"},
-{"0004009B00014202.cia", "354f0cfae5458d2d1474c29465e317e5fd4f3edfed6e0e9da1cf1699f111fe88"},
-{"0004009B00014302.cia", "36b0cfeb085ce013aa86c4d9204d11a33692669fe994097445310d8a1b443015"},
-{"0004009B00015102.cia", "43a249bf736908a3b4af0825456eb82702f8851bcd09d3e00bd62ca21652ea9c"},
-{"000400DB00010302.cia", "83c33485d3fc9c933c2065f17dd10568a6853445aab9fe1719910fbd022bd1f4"},
-{"000400DB00010502.cia", "b7d9d3a09758798dda5bf7c53a8fee676c67df1597931c01cd0187d2b72de254"},
-{"000400DB00016102.cia", "6b033f73c691b94a36b358c01cd8635f3d753cf1b4bd85d153504d5056698a07"},
-{"000400DB00017102.cia", "50f11c7aff3b734d6e935c97e01317a1424e393e556a971c40fd257ac7189892"},
-{"0004013000001502.cia", "dd938384c708be17d9fd8f8d31f7c76eba5d1d2a4a37257fdac59f9fa9465335"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "bbdcb4720f1e4ab29f9a9c59bf6827bbaec61754f9d24149fa2885c5c9574540"},
-{"0004013000001702.cia", "4042bbc3225f3d25b44eb752bcafee892a9afc8fdb498d416d09b68954635049"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "959c7bfbccbc6c75efffa869b3738306d173a9289348c66d06a01124ed8de448"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "e73a7353d0461f844b8d655e5c8be64310ee5d646b154a2328476ec109cc3f4f"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "27e04e1e89783294c781d7396783a464805cc0c6b12ae8c84b60afd67a4b1245"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8a734f27e5ffac152956b583257937b39750172d236a0d8acb7a61f43bbbea5c"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "efbd47c3c2aafad335193781949fa060dc7059fd18c953ff35715fa5c8324cd5"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "608473b7cf35a5206b5583239b5e6d7d187556bbc91241a35ac02d06b4aec884"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "b55400def59c104449b0ac89046d9e25e4ee6b3d7f0061cc1bc7ce2224cb27fd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "f0385abbdaf697cf503a2d0a4af9ee57d7240a10b333f146f61ba62d135bedb0"},
-{"0004013000002102.cia", "89002e2a5877cb7bba0caaf0a3514c6ffb68d6215299df9e1188efcda6495dd9"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "61f5cc6cf5a318af26e4f7ee0d8670b4b4a816def337b8a96077ecdc562b7040"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "677a1094ab6231f0d5dfb472e496d851817d1d578326d62c3b4cc477c420af92"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "e872d8b6b104f7848534a250128dc3ba1945e70f3d025caef9c8aba4ac76bd17"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "f52c1ad745914aa5e586f6ef5db4915def639799d58dd6f064d72befa5bcd035"},
-{"0004013000002702.cia", "381c99a5654800e48139c6ea34a77631474e20857b3a8072d73c72309407efe3"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "63dcd464627b9a5726ea689fdd7405d07fd4b89403fea07b3b629cafda221128"},
-{"0004013000002902.cia", "94cb38c721febaa19b855313fc75539402415ef4c54fb80153855755b8ca7c68"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "7cb3638f7077566e1c8dc487b3a72390299dfe968b2a252508c84047dd93714e"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "5eedb5e761c8a52b75dbb3715115d96ee69126518607da2a282b48ad5a5118b0"},
-{"0004013000002C02.cia", "f072c352a32cddaf226298ae58611550a75096a91b3a88600316f7b6abbeca9e"},
-{"0004013000002C03.cia", "64299626e854c53b28d53b491b1f669c9c5aab0c00f4c90abbae0a410b5712e1"},
-{"0004013000002D02.cia", "de01713861009f758c8048a782b50d20427dac0f91e2894d7a6a52c44ca09af0"},
-{"0004013000002D03.cia", "786dab650e9dde2b04c122703487f5efda7738ca4f227742943cf96ac0a8f1a0"},
-{"0004013000002E02.cia", "869f28aed3b0411ede1465fbbcb4288dbfc5c41c34bb375593c6f821478d6048"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "39c655fff4cf8694c0ad81e5676bcb10b9964749bfa2396f12e2eff9cc31d730"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "7503e9e4b129b1ad69a4752ee6be9b260d146376b73a5632dc026319b6869e35"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "bce3cd61edc4bd617ec83289aa6b0fffdf0992e4748cba4491b66c9254e2694d"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "8e6a151faef8e41869f97721ab86d0fd93a615800c80dbfd8eb18799dfa84a79"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "c8eda9d4bad23601685c01b99209f352c1856bbdfd65d9757aca68b76325e0a0"},
-{"0004013000003502.cia", "a4dc12975dc37ff8a78c93215bf2b2317ebe1d12b588e9d6aa1f150c3084ef48"},
-{"0004013000003702.cia", "266711953b31d4af12d37d86cbad4a0c442adeaff4f406ca1d9b488ee541ebb7"},
-{"0004013000008002.cia", "a1ebfa578a9b16169f3bf7420bacbc6c585348b1d119e3e8c378f59f9d33a725"},
-{"0004013000008003.cia", "67410a62d701aef615a535c46fd1209e3a869be00e719f93fdb02544addceb82"},
-{"0004013800000002.cia", "7e091ea90b5c77a1fa90d133fc178edc8ace70f64ee658324e6605fce336ef29"},
-{"0004013800000003.cia", "e201a7ef750b9d8909b637f9b8fb6af3ae73061636d32176782b673e034f5c51"},
-{"0004013800000102.cia", "117cca47bbc90e36f8595159fbe165b999648e45a93d2f20ce1624054882c962"}
+static const manifest::Digest builtinDigests[] = {
+{{0x2f,0x23,0xda,0x1e,0x18,0x15,0xc6,0x6f,0x4c,0x35,0xd5,0xb1,0xa2,0x1c,0xea,0x28,0x52,0xfe,0x0d,0xe9,0xff,0xa6,0x9e,0x0e,0xcd,0x6b,0x3f,0xbd,0x65,0x37,0x1d,0x82}},
+{{0x3f,0xd8,0x2c,0x97,0x1c,0x56,0xbc,0x8d,0x88,0x6c,0x3f,0x59,0x50,0xff,0x42,0x93,0x47,0x74,0x68,0xb6,0x4a,0x78,0x15,0xf1,0x0e,0x14,0x78,0xb4,0x41,0x6c,0xe3,0x15}},
+{{0xaf,0x3d,0x12,0x5a,0xd8,0xf5,0x46,0x60,0xeb,0x90,0x5d,0x58,0xbb,0x0c,0x3b,0xc2,0xd9,0xe7,0x57,0x24,0x9a,0x8b,0x3d,0xe7,0x71,0x8f,0x80,0xf5,0xa8,0x39,0x36,0xb2}},
+{{0x9a,0x4a,0xe9,0x76,0x14,0x80,0x52,0xce,0xc6,0x16,0x36,0xf7,0xec,0xa7,0x56,0x64,0xf1,0x86,0x3a,0x6f,0x88,0x87,0x95,0x67,0xde,0xa4,0xd9,0x99,0x55,0xe1,0xd3,0x97}},
+{{0x25,0x7c,0x90,0x29,0xff,0xbb,0x4f,0x0c,0x44,0x8f,0xa7,0x99,0x7b,0x68,0x06,0x97,0xa0,0xdc,0x27,0x68,0xdd,0x1a,0x06,0xde,0x57,0x7e,0xb9,0x35,0x70,0x2f,0xf4,0xe8}},
+{{0x9d,0xed,0x6f,0xc8,0x51,0x9d,0xf1,0xc8,0x49,0xc4,0x14,0xbe,0xa0,0x90,0x6a,0x8b,0x28,0x1b,0xab,0x2b,0x6c,0xa4,0x74,0xae,0x89,0x72,0xc2,0x88,0x07,0xc1,0x93,0x83}},
+{{0x14,0x26,0x5b,0x92,0x84,0x4d,0xf1,0x0c,0xbb,0x6e,0x27,0x71,0x04,0xce,0x90,0x0f,0x68,0xaf,0x1d,0x51,0xd2,0xb6,0x99,0xfb,0x85,0xba,0xe1,0x66,0xfb,0xa9,0xcd,0x27}},
+{{0x6d,0xc4,0x30,0x42,0x1e,0x3a,0xa6,0x98,0x3b,0xe5,0x9b,0xdb,0x4b,0x9c,0x65,0xe2,0x60,0xa7,0xf4,0xec,0x53,0x77,0x20,0xdc,0x49,0xbc,0x8f,0x51,0x41,0xee,0x5d,0x11}},
+{{0x54,0x86,0x82,0x1d,0x91,0xc2,0x1a,0xf2,0xc8,0x11,0x12,0x04,0x47,0xd8,0x5c,0x98,0x68,0x5a,0x3d,0xf5,0x3a,0xa4,0x8a,0x26,0xca,0x43,0x9f,0x8b,0x6d,0xf1,0xd9,0x95}},
+{{0xd7,0xc8,0x9b,0x60,0xf8,0xca,0xd7,0xe5,0x03,0x8f,0xa0,0x30,0x78,0x77,0xbd,0x5f,0x9f,0xbe,0xc7,0x34,0xe7,0x1c,0x19,0x50,0xf4,0xa9,0xfa,0x0f,0xf7,0xd8,0x6e,0xb4}},
+{{0x32,0x50,0xfd,0x73,0x67,0xf0,0x91,0xf4,0x65,0x24,0x64,0x61,0x61,0x2b,0x20,0xb9,0x55,0xb3,0xd5,0xbf,0x78,0x40,0xb9,0x77,0x86,0x65,0x32,0x43,0x92,0x36,0x3e,0xb8}},
+{{0xcf,0xc3,0x6d,0x1f,0xd7,0xc7,0x11,0xd5,0xfb,0x16,0xe7,0xde,0x27,0x11,0xa3,0x9b,0xf9,0x3e,0xb2,0x0a,0xf2,0xd9,0xb5,0x00,0xe5,0x3f,0xbe,0x2c,0xf1,0x3a,0xf1,0x56}},
+{{0xd8,0x10,0x49,0x83,0x66,0x08,0x57,0x14,0x94,0x8a,0x2e,0x7b,0xd8,0x3d,0xa2,0xa4,0xe0,0x1f,0xdc,0x60,0x55,0xbe,0x63,0x0b,0x8f,0x1b,0x87,0x2d,0xf0,0x0b,0xa2,0xf2}},
+{{0x96,0xb2,0x0d,0x6d,0xba,0x19,0x82,0xec,0x9b,0xb7,0x52,0x3f,0x4e,0x4a,0xd1,0x8d,0x8b,0x6b,0x9d,0x5d,0xd2,0xc6,0x41,0x62,0x72,0xa8,0x9c,0x2d,0x77,0x6d,0xae,0x1b}},
+{{0x12,0xb6,0x67,0x40,0xfd,0x19,0x2c,0x59,0xb0,0xe5,0xff,0x9d,0x7e,0x6e,0x9d,0xc3,0x17,0xdf,0x13,0x31,0xe0,0xaf,0x52,0x8c,0x57,0x2e,0x12,0x12,0x7e,0x57,0xea,0xd0}},
+{{0xcd,0xd4,0x32,0x28,0xbe,0x78,0x01,0x69,0xbe,0x89,0x67,0x7c,0xa3,0x5f,0x11,0x42,0x4c,0x35,0x94,0xa4,0x13,0x8c,0xf9,0x62,0xcd,0xed,0x3c,0xf7,0xfe,0xe9,0xd7,0xf9}},
+{{0xd8,0xd9,0xe4,0x55,0x54,0x51,0xf7,0x96,0xff,0x01,0x79,0x38,0x6d,0xc5,0x27,0xe3,0xf7,0xf3,0xc6,0xcd,0x11,0xf4,0xee,0x17,0x1b,0x25,0x1b,0xd5,0x9e,0x48,0x93,0xb9}},
+{{0xde,0xf4,0xff,0xa1,0x7a,0x8a,0x05,0x2f,0x40,0x03,0xb2,0x9b,0x56,0xfd,0x5b,0x38,0x7e,0xc5,0x2a,0xce,0xd7,0x6d,0x83,0xda,0xfd,0x02,0x5d,0xdf,0x3e,0xed,0xd5,0x05}},
+{{0xe3,0xcf,0xff,0x43,0xd5,0x9e,0x77,0xbf,0xd9,0x66,0x99,0x36,0x15,0x59,0x76,0x13,0xe4,0x0e,0x27,0x53,0xb1,0x55,0x30,0x11,0xc9,0x19,0x3b,0x07,0xad,0xc0,0x1b,0xb9}},
+{{0xd1,0x1c,0xc5,0x3f,0x45,0x9a,0x65,0x4c,0xe7,0x1b,0xec,0x5f,0x61,0x44,0xf2,0xd3,0xf8,0x88,0x73,0xbc,0x22,0x42,0x1c,0xef,0xa0,0x88,0xb2,0x54,0x24,0x67,0xdc,0x9f}},
+{{0xf0,0x84,0x1d,0x10,0xd5,0x88,0xaa,0xf3,0xd0,0x7a,0xeb,0x7f,0x04,0x8d,0x7d,0x1b,0xf3,0xeb,0x29,0x1d,0xc5,0xea,0xbe,0x06,0x62,0x07,0x34,0xfc,0xb1,0xa6,0x12,0x48}},
+{{0x19,0x1c,0xfc,0x05,0x69,0x5e,0x39,0xe7,0x99,0xe3,0x63,0xc0,0x13,0xf4,0xb9,0xdf,0xbd,0x5d,0x67,0xef,0x18,0x4b,0x20,0x93,0x11,0xf6,0x61,0xc6,0xf2,0x6d,0x26,0x13}},
+{{0xa1,0x01,0x58,0x39,0xb8,0x39,0x60,0x71,0x26,0xd6,0xda,0x40,0x9a,0xd4,0x03,0x22,0xaf,0x89,0xd2,0x00,0xc0,0x71,0xa9,0xb3,0x31,0x28,0xdb,0x24,0x00,0xd2,0xdc,0x8c}},
+{{0xd8,0x01,0x82,0x4e,0x91,0x98,0xa3,0x08,0x12,0xbd,0x87,0x3a,0xb6,0xda,0xa6,0x12,0x06,0x77,0x90,0x59,0x21,0xae,0xc3,0x6f,0x84,0xd3,0xb9,0x9a,0x84,0x74,0xe7,0xa8}},
+{{0xc3,0x33,0xc5,0xc2,0x11,0xf9,0xb1,0x0c,0x39,0x46,0xc0,0x1d,0x92,0xb5,0xb3,0x19,0x17,0x54,0xd0,0x00,0x57,0x7a,0x8d,0x54,0xc9,0x3f,0x20,0x51,0x84,0x52,0xd6,0xb9}},
+{{0x54,0x76,0xa6,0x04,0xc5,0xe9,0x4b,0xdc,0x28,0x66,0xcc,0xb8,0x2d,0xa2,0x09,0xc0,0x68,0x3d,0xd5,0x0d,0xb3,0x14,0xd5,0x29,0x15,0x03,0xef,0xb7,0xf9,0x15,0x6f,0xf9}},
+{{0xbb,0x49,0x59,0x8a,0x56,0x6b,0xde,0xab,0x9c,0x1f,0x08,0x30,0xba,0xb0,0xf5,0x86,0xc3,0xda,0x43,0xc8,0x99,0x44,0x63,0x85,0x6f,0x69,0xd6,0xc0,0xb0,0x05,0x9f,0xfe}},
+{{0x94,0x54,0x04,0xd8,0x2e,0xa9,0xae,0x88,0x51,0xe8,0x44,0x15,0xd5,0xfe,0x1b,0xcb,0xbd,0xde,0xc9,0x54,0x8e,0xc1,0x1e,0x73,0x88,0x64,0x7f,0x33,0x62,0x62,0xd7,0x1b}},
+{{0xc4,0x95,0xc6,0x4e,0x13,0xce,0x58,0xe4,0x89,0xd1,0xec,0x71,0x37,0x4d,0x47,0x47,0x49,0x15,0x98,0x00,0x49,0xbe,0x18,0x45,0x35,0xd0,0x41,0x28,0xb8,0xf3,0x79,0x50}},
+{{0x72,0x78,0x87,0x4a,0xb8,0x2c,0x75,0x11,0x7c,0x87,0xda,0xed,0x75,0x3c,0x57,0x19,0x9d,0x63,0x62,0xf7,0xe4,0x9a,0xfd,0x41,0xfa,0x28,0x91,0x89,0x39,0x68,0x3e,0x4d}},
+{{0x53,0x12,0x88,0x84,0x3e,0x9c,0x58,0xba,0x4e,0xd9,0xeb,0x0a,0x0f,0x55,0x3f,0x9b,0x1d,0x2e,0x46,0x51,0x9e,0x44,0x2b,0x27,0x98,0x8e,0x98,0x56,0x11,0x98,0x88,0x2e}},
+{{0xf9,0xb8,0x67,0xb8,0x03,0x61,0xb7,0x22,0x24,0xbb,0x4b,0xc0,0x67,0xa0,0x15,0x22,0xb1,0x3a,0xb1,0x88,0xcf,0xe9,0xf6,0x20,0x9f,0x8b,0xd4,0x51,0x13,0x2f,0x14,0x2a}},
+{{0xbf,0xee,0x4a,0x83,0xb8,0x26,0x97,0x16,0x65,0xbd,0x89,0x4d,0x04,0xda,0x9d,0xe1,0xdd,0x2b,0x56,0x8d,0xf8,0x2b,0xba,0x1a,0xc6,0x45,0xd7,0x5a,0xba,0xa8,0x24,0x1c}},
+{{0x32,0x9e,0x6d,0xfe,0xd8,0x13,0x18,0x11,0xab,0xb9,0x1c,0x7e,0x3c,0x2d,0x87,0xab,0x0e,0x49,0x43,0x76,0xa6,0x22,0x56,0xa8,0xa2,0x4b,0x37,0xd5,0x3e,0x86,0x99,0x33}},
+{{0xff,0xab,0x7a,0x4b,0xe5,0x58,0xf6,0x98,0x45,0xb2,0xd8,0x1c,0xdd,0xe4,0x44,0xb0,0x27,0x07,0x8f,0x14,0x6f,0x5d,0x4b,0x37,0x46,0xf4,0xe9,0x25,0xef,0x1e,0xab,0x41}},
+{{0xe0,0x4f,0x8b,0x0f,0xb7,0x27,0x4c,0x6d,0x0a,0xee,0x76,0xe9,0xde,0x3c,0xdb,0x4b,0xbd,0xf8,0x8a,0x40,0xbb,0xba,0x8a,0x6e,0x82,0x34,0xbd,0x11,0xa8,0x2c,0x24,0xf7}},
+{{0x2e,0x12,0x6d,0x7a,0x77,0xe1,0x3d,0x35,0xef,0xe3,0x07,0x99,0xbb,0x96,0x7c,0x2a,0x39,0x3a,0x03,0x64,0xdc,0x44,0x5a,0x24,0x0e,0x6f,0xbf,0x4b,0x34,0xbf,0x65,0x77}},
+{{0x7d,0x68,0xf8,0x10,0xa4,0x71,0xed,0x5b,0x67,0xb3,0xfb,0xfa,0x5a,0x18,0x9f,0x90,0xc5,0xfa,0x6d,0x93,0x3f,0x30,0x90,0x62,0x65,0x4d,0x64,0x0b,0x66,0x6b,0xd3,0x5c}},
+{{0x2b,0x25,0x11,0x25,0x59,0x05,0x14,0x3e,0x52,0x6b,0xc4,0x81,0xcf,0x87,0xad,0x43,0x31,0x66,0xad,0xe7,0x49,0x9f,0x21,0xdf,0xab,0x23,0xee,0x41,0x8b,0xe8,0x03,0x4f}},
+{{0xc7,0xa8,0xcf,0xf4,0xa6,0xce,0xf7,0x4d,0x09,0xef,0x87,0x5c,0xa7,0x02,0x9e,0xa9,0xe0,0xcc,0x75,0xa8,0xb7,0x71,0xc7,0x3f,0xf4,0xd6,0x62,0x1c,0x23,0xc9,0xf5,0xd6}},
+{{0x41,0xd7,0x89,0x83,0x8a,0xae,0x4a,0x5a,0x6b,0x5f,0xf7,0xac,0x88,0xf9,0x1f,0x7a,0x4b,0xb6,0x67,0x40,0xbe,0xa2,0x2d,0x5a,0xb0,0x82,0x70,0xb5,0x37,0xbe,0x38,0x4e}},
+{{0xbc,0x0f,0x82,0x34,0x35,0x9b,0x51,0x1c,0x9a,0x20,0x0e,0xe3,0x18,0x21,0x49,0xd0,0xb9,0x90,0x25,0x32,0x7e,0x3f,0xd9,0x0a,0x8d,0x19,0x21,0xd1,0xbb,0xc4,0x8e,0xfb}},
+{{0x71,0x33,0x1c,0xac,0x11,0xae,0x2f,0x19,0x40,0x5f,0x7a,0x94,0x1f,0x4a,0x88,0x59,0x11,0x28,0x28,0x9f,0x62,0x7c,0xad,0x3f,0x5f,0x89,0x1b,0xce,0x34,0x76,0xae,0xfd}},
+{{0xed,0xe2,0xfb,0x56,0x2e,0x80,0xcf,0x66,0xa1,0x55,0x4d,0xa0,0xcb,0xe2,0x60,0x99,0x20,0xe4,0xdb,0xff,0xd9,0xf9,0x71,0x82,0xd4,0x71,0xb9,0x12,0xb3,0x07,0x9b,0xfb}},
+{{0x7d,0x54,0xa7,0xfb,0xf2,0x0f,0xc2,0xa5,0x25,0xfb,0x64,0x7c,0x42,0x88,0xe6,0xb6,0xaa,0x16,0xe6,0x06,0xcb,0xb5,0x04,0x9f,0x19,0x8d,0x05,0x27,0xf4,0xae,0x41,0xbf}},
+{{0x5b,0xb4,0x7c,0xd0,0x82,0xd2,0x79,0x2e,0x95,0xf7,0x0d,0xf7,0x17,0x0d,0xd2,0xb3,0xa5,0xa9,0x6e,0x21,0xa4,0x8a,0xbf,0x32,0xc6,0x24,0x10,0x1f,0x50,0xcd,0xc6,0xc7}},
+{{0x7c,0x3e,0x7e,0x0e,0x8c,0x74,0x91,0xbf,0xe5,0xf9,0xd4,0xd8,0xaa,0x0b,0xd2,0x27,0xe0,0xd4,0xef,0xae,0x1f,0x9a,0x56,0xf7,0x07,0xc5,0xf6,0xa7,0x82,0x9a,0x99,0x84}},
+{{0x94,0x0b,0xf3,0x9b,0x42,0x03,0x2a,0x42,0xb1,0xfa,0x85,0x1a,0xc7,0x47,0xb8,0x7b,0xc6,0x94,0xd1,0xa8,0x7e,0x92,0x1d,0xe3,0x31,0x5d,0xb3,0x84,0x85,0xfc,0xf5,0xe4}},
+{{0x68,0xb7,0xf1,0x1b,0x4d,0xb9,0x25,0xbb,0x7b,0x49,0xb3,0x99,0xe1,0x78,0x8a,0xaf,0x22,0x73,0x47,0x68,0xac,0xaf,0x61,0xa7,0xbb,0x4c,0x70,0x5d,0xab,0xcd,0xdb,0x45}},
+{{0xd5,0x43,0x10,0xac,0xe0,0xb1,0x65,0xee,0x09,0xa3,0x4f,0x3c,0x4b,0x14,0xd9,0x40,0x9e,0x0d,0x03,0x97,0x1a,0x19,0x46,0x44,0xdf,0x08,0x03,0xce,0x50,0xc7,0x47,0xcb}},
+{{0x91,0x45,0x6c,0xc6,0x09,0xad,0xfd,0xb1,0xc3,0xba,0x1f,0xf9,0x96,0x90,0x6c,0xd0,0xe7,0x84,0x75,0x96,0xff,0x78,0x6e,0x84,0x03,0x46,0x3d,0xdf,0xb3,0x2d,0xe3,0x45}},
+{{0x79,0x31,0xc8,0x81,0x75,0x77,0xc3,0x9f,0x2a,0xea,0x22,0x5e,0xbb,0x32,0xe4,0xa5,0xba,0x39,0x0f,0x4a,0x40,0xf6,0xfd,0x2c,0x16,0x99,0xea,0xa0,0x4d,0x98,0xd1,0xff}},
+{{0xaa,0x1f,0x38,0x52,0xb3,0xca,0xa7,0x6e,0xc5,0x16,0xe3,0x71,0x6d,0xa6,0xc3,0x35,0x43,0x99,0x79,0x18,0xb4,0xde,0xb2,0x33,0x0e,0xfd,0xe1,0xd1,0xbf,0x49,0x41,0x3e}},
+{{0xb4,0x15,0xe2,0x9d,0xf3,0x79,0x06,0xfe,0x5b,0xcb,0x0e,0xdb,0xe4,0xf8,0xe8,0x47,0xb7,0x72,0xd0,0x25,0x4e,0xcc,0x4c,0x2c,0x97,0xbb,0xac,0xed,0x8e,0x14,0x58,0xd3}},
+{{0x26,0x97,0x39,0x38,0xcc,0x70,0x75,0xa1,0x20,0x37,0x99,0xd3,0xe8,0x68,0x8c,0x36,0x01,0xb7,0xca,0x58,0x18,0xea,0xfc,0x82,0xf6,0xbf,0x72,0x77,0x1f,0xbf,0x46,0x12}},
+{{0xdf,0x98,0x58,0x7f,0x19,0xe7,0x08,0x68,0x7d,0xaa,0xee,0xa4,0x90,0x30,0xcd,0x43,0x42,0x99,0xde,0x20,0x1b,0x52,0xee,0x27,0x31,0xae,0x00,0x07,0x85,0xd8,0x51,0xdb}},
+{{0x37,0xd0,0x76,0xc2,0xe4,0x65,0x40,0xc8,0xdd,0xfd,0xef,0x81,0x78,0xa9,0x98,0xa5,0xcb,0x44,0xbe,0xc7,0x9b,0x1a,0x91,0x64,0xf1,0x32,0x9e,0x19,0x99,0x19,0x80,0x6e}},
+{{0xf3,0x8d,0xfa,0x54,0x49,0xfc,0x0f,0xd8,0x88,0x21,0xfb,0xfe,0x87,0x1b,0x19,0xe6,0xaf,0x23,0x7b,0x90,0xc1,0x94,0xe0,0x0e,0xf4,0xd2,0xd9,0xfc,0x23,0x87,0xff,0xca}},
+{{0xad,0xeb,0x95,0x4b,0xf9,0xd3,0x9e,0x62,0x91,0xec,0xe8,0x78,0xca,0x8b,0xa7,0x07,0x16,0xb0,0xa7,0xd5,0x13,0x70,0xf6,0xa5,0xea,0x44,0x48,0x9d,0x23,0x51,0x76,0xc5}},
+{{0xad,0xf7,0xbb,0xcf,0x88,0x0c,0x53,0x47,0x38,0x12,0x22,0x51,0x48,0x1f,0x49,0x04,0xc9,0xa1,0x8c,0x89,0x40,0xf5,0xc1,0xc8,0x3a,0x3d,0xd7,0x96,0xbc,0x46,0xc1,0xf2}},
+{{0xc7,0x9c,0xef,0x04,0x48,0xdd,0xa8,0x75,0x6b,0x12,0x7b,0x42,0x39,0x7a,0xec,0x3f,0xaa,0xb4,0x90,0x30,0x3e,0x90,0x3a,0xc2,0x2c,0x5d,0xb8,0x45,0xca,0xb8,0xf3,0xa8}},
+{{0xbc,0x5e,0xd7,0x19,0x3b,0x2a,0x2d,0x5f,0x67,0xa4,0x22,0x2a,0x3c,0xcc,0x2d,0xde,0x38,0x9b,0x97,0xa0,0xdc,0xf1,0xf6,0xf5,0x5f,0xbf,0x37,0xcc,0xb3,0x05,0xbf,0x4a}},
+{{0x94,0x44,0x7c,0x4a,0x9a,0xaa,0x76,0x1b,0xf3,0x69,0x28,0x73,0x09,0x30,0x57,0x12,0x36,0xcc,0xeb,0x78,0x25,0x22,0xd9,0xbe,0xd9,0x7d,0x22,0xc8,0xf6,0xa9,0xb6,0x61}},
+{{0xa8,0x36,0x89,0xcb,0x52,0x2e,0x01,0xf5,0x05,0x9f,0x6a,0xa0,0x29,0xbb,0x97,0x45,0xf6,0xd0,0xfc,0x10,0x8b,0xd9,0x7f,0x14,0xc0,0xb3,0xfe,0xdd,0x77,0x95,0x3b,0x35}},
+{{0x75,0x45,0x38,0xe5,0xf4,0x9f,0x77,0x2e,0x3f,0xb5,0x5c,0xf2,0xbe,0x25,0x10,0x77,0x2e,0x33,0x0a,0x61,0xe2,0x8d,0x42,0xed,0x2a,0x47,0x1d,0x1d,0x9e,0x8e,0x53,0xe6}},
+{{0x46,0xc3,0xa4,0x13,0x2f,0x76,0x96,0x8f,0x43,0x5c,0x8a,0xd7,0x42,0xff,0xf0,0x21,0x4b,0xfa,0xba,0x9c,0x6d,0x86,0xc1,0xf5,0x02,0xc3,0x4c,0x32,0x9d,0x7b,0x76,0xdb}},
+{{0xd9,0xe8,0x50,0x1e,0xf9,0x54,0xf3,0x5e,0xcc,0x04,0x69,0x90,0x2b,0x6f,0x0e,0x60,0x34,0x7d,0x27,0x99,0xa2,0x85,0x00,0x6b,0x9b,0x62,0x10,0x10,0x40,0x31,0x2c,0x5b}},
+{{0x15,0xf9,0x0c,0x7b,0xa6,0x34,0x98,0x32,0xc0,0xd9,0x3a,0xec,0x4c,0xa6,0x18,0x08,0x39,0x00,0xa2,0xfd,0x80,0x26,0x2d,0xc3,0x93,0xe4,0x80,0xd5,0x6e,0xee,0x0b,0xd9}},
+{{0x0a,0x98,0x3c,0x19,0xa5,0x70,0x03,0x4b,0x6c,0x50,0xb1,0xba,0xbd,0xd9,0x5f,0x13,0xf1,0xf5,0x9d,0x73,0x88,0x1d,0xd8,0x63,0x08,0xb2,0xe4,0x37,0xea,0x42,0x9e,0x7e}},
+{{0x5a,0x6a,0x91,0x18,0xa0,0x60,0x2a,0x8c,0xe4,0x83,0xdb,0xd8,0x93,0x64,0x4b,0x73,0xa5,0xc9,0xee,0xfd,0xb1,0x2f,0x3a,0x12,0xeb,0x2e,0xad,0xae,0x86,0x99,0x1d,0xca}},
+{{0x44,0x9d,0xb4,0x38,0x4e,0x32,0x1a,0x19,0x11,0x8e,0xe0,0x61,0x48,0x3d,0xa9,0x80,0x65,0x9f,0x90,0x24,0xb9,0x02,0x1e,0x6b,0x55,0x3e,0x9b,0x5c,0x7c,0x21,0x0c,0xf6}},
+{{0x53,0x6a,0x4a,0xdd,0x27,0x1f,0x64,0x9a,0xed,0x3e,0x04,0x76,0x27,0x2d,0xc1,0xce,0x8e,0x7b,0xa6,0x12,0x41,0x46,0xca,0xb2,0x5a,0x51,0xa6,0x65,0x0b,0xaa,0x9d,0x8e}},
+{{0x8f,0x3b,0x0b,0x3b,0x9f,0xe5,0x63,0x7e,0xe5,0xf1,0xde,0x00,0xe8,0x55,0x9e,0x6c,0x9c,0xd7,0x83,0x1e,0x7f,0xc4,0x48,0x3a,0xc8,0xc6,0x5d,0xfb,0x3d,0xe8,0x9c,0x43}},
+{{0x1f,0x4f,0x44,0xa8,0x22,0x2c,0x4a,0x28,0x72,0xbb,0x21,0x13,0x0c,0x18,0x33,0xe7,0xbe,0xff,0x42,0x4e,0x73,0x86,0xaa,0x75,0x5f,0x90,0x35,0x76,0x7e,0x95,0x20,0x50}},
+{{0x40,0xb0,0x9a,0x76,0x77,0x9e,0x2b,0x65,0x05,0x75,0x6e,0xd7,0xd6,0x2a,0x08,0x63,0xbe,0xfe,0x87,0x5a,0x7a,0xdd,0x37,0x5a,0x85,0x4e,0x1f,0xe0,0xef,0x65,0xc3,0xc7}},
+{{0xab,0xd7,0x87,0x12,0xf4,0x85,0x8e,0x5f,0x65,0x51,0xca,0x60,0xc6,0xe0,0x22,0x30,0xee,0xa0,0x20,0xe9,0x8c,0xea,0x43,0x4e,0xcf,0x76,0x86,0x03,0xb1,0x07,0x8c,0xa1}},
+{{0xe4,0x3b,0xd4,0x8f,0x8a,0x0c,0xa1,0xec,0x44,0xc0,0x45,0xe4,0xfd,0x17,0xf5,0xe3,0xf0,0xdc,0x79,0xc2,0xc5,0xbb,0x99,0xda,0x0e,0x9a,0x35,0x2b,0x61,0x99,0xae,0x84}},
+{{0xf6,0xf8,0x54,0xcf,0x96,0xe1,0x78,0x8a,0x66,0xf0,0xec,0x0f,0x17,0xa3,0xce,0x95,0xb0,0xa5,0xd3,0x0e,0x90,0x3a,0x27,0xa9,0x1f,0x68,0x1c,0x46,0xa0,0xe7,0xf4,0x81}},
+{{0x11,0x39,0xad,0x6c,0x76,0xf9,0x3e,0x5b,0x0c,0x5a,0xd2,0x3b,0x9b,0xcd,0xe7,0xfc,0x7f,0xad,0x17,0xa6,0xa1,0xfd,0x6a,0x5a,0x51,0xac,0xfa,0xcd,0x32,0x17,0xac,0xce}},
+{{0xd8,0x44,0x83,0x37,0xa0,0x89,0x9b,0x99,0x52,0x26,0xa0,0x62,0xa3,0xd9,0xb5,0x5c,0x65,0xa1,0x29,0x68,0x36,0x9a,0x5f,0x18,0xd1,0x0a,0x4d,0xce,0x7a,0x02,0x51,0x91}},
+{{0x14,0xd5,0x50,0x93,0xa1,0x8b,0x41,0x7c,0xfd,0x78,0x81,0x45,0xa6,0xce,0xe3,0x8c,0x66,0x12,0x90,0x23,0x58,0x17,0xf8,0x03,0x2f,0x40,0x6d,0x94,0x2c,0xdd,0x57,0x97}},
+{{0xaf,0x1a,0x3b,0x13,0x98,0xbc,0x49,0xf4,0x79,0x52,0xf9,0xb5,0xe5,0x10,0xf6,0x59,0x01,0x51,0x07,0x1b,0xe6,0x8b,0xd6,0xad,0xdd,0xc4,0x32,0x52,0xca,0xfb,0xd2,0xa5}},
+{{0xc0,0x68,0x07,0xc8,0x54,0x04,0x71,0x00,0xdc,0x49,0xf2,0xdb,0xe7,0x4c,0x84,0xf7,0x0d,0xda,0x29,0x18,0xf5,0xd1,0x47,0x8d,0x30,0x21,0xea,0x4f,0xdd,0xc3,0x99,0xbd}},
+{{0xc7,0x1f,0xca,0x01,0x45,0x35,0x10,0x14,0x86,0x0d,0xaf,0xeb,0x76,0xf1,0x76,0xeb,0x9d,0x80,0x4a,0x7e,0x6a,0xf2,0x25,0x0f,0x5d,0x51,0x06,0x21,0x15,0xfa,0x00,0xfd}},
+{{0x22,0x87,0xe5,0x4d,0x5e,0xdb,0x62,0x8c,0x46,0xf9,0xec,0x8a,0xb6,0xd7,0xdb,0x68,0xe4,0x24,0xc5,0xc1,0x40,0x07,0x3b,0x1c,0x0f,0xfe,0x97,0xd1,0x88,0xc0,0x66,0x13}},
+{{0x8b,0x10,0xd0,0x31,0x2e,0xa4,0x8f,0x60,0x91,0x19,0x51,0xe7,0x7b,0x08,0x37,0x97,0xc6,0xac,0x59,0x6a,0x98,0xff,0x8a,0x41,0xe2,0xce,0x84,0xc7,0xda,0xab,0xc6,0x3f}},
+{{0xff,0xb2,0x10,0x59,0x89,0x30,0x6a,0x03,0x69,0xf1,0x33,0x65,0x03,0xf1,0x5c,0x1c,0x15,0xd2,0x82,0x4e,0x13,0xda,0xe5,0xc4,0x0d,0xfb,0x7c,0xe0,0x6f,0x5d,0xbe,0xfd}},
+{{0x5e,0x9b,0x7c,0xa7,0x3f,0xd7,0x41,0x7d,0x4d,0xeb,0xa5,0xce,0xf2,0x38,0xa4,0x1f,0xad,0xb3,0x9a,0x1c,0x17,0x06,0x44,0x51,0xc2,0xa9,0x41,0x28,0xa1,0xfe,0xef,0x06}},
+{{0x64,0xe5,0x48,0x98,0x4c,0x1d,0x07,0xab,0x86,0xdc,0xf6,0x06,0x42,0x05,0x04,0xce,0x14,0x7d,0x76,0xc6,0x41,0x54,0xc4,0x3f,0x8d,0xc2,0x01,0x6c,0x48,0x95,0xcc,0xce}},
+{{0x4a,0xd3,0x30,0x99,0x35,0xaa,0x5c,0x1a,0xff,0x74,0x2a,0x00,0xac,0xef,0x95,0x80,0x00,0x07,0xd5,0x4b,0x09,0xc9,0x27,0xbf,0xc1,0xdf,0x18,0x97,0x63,0x65,0x96,0x83}},
+{{0xd1,0x5e,0x97,0xb8,0xcd,0xcf,0xe2,0x9c,0xa1,0x04,0xf2,0x9a,0x90,0xa2,0x49,0xf8,0x03,0x7a,0xf8,0x48,0x09,0x2f,0x4b,0x72,0x37,0xa6,0xb3,0xfa,0x47,0x57,0x92,0x51}},
+{{0xae,0xa0,0x74,0x2d,0xf3,0x37,0xec,0x46,0x42,0x4e,0x86,0x76,0xcc,0x1d,0x4a,0xb0,0x1f,0x82,0x77,0x16,0xf2,0xcb,0x38,0x9f,0x9a,0xe7,0xdc,0x25,0x0c,0x2f,0xa2,0xee}},
+{{0xa5,0x61,0xb8,0x70,0xb5,0x31,0x06,0x01,0xdd,0x49,0xe9,0x43,0xd5,0xb8,0xf1,0xe7,0xd0,0x0d,0xcc,0x5e,0x74,0x7a,0x89,0x71,0x96,0xb8,0x57,0xdc,0xbf,0xd4,0x7d,0x49}},
+{{0x1a,0x11,0xf8,0xf0,0xaf,0x70,0x30,0x0e,0xd4,0xaf,0xaa,0xf4,0x83,0xcb,0xc7,0x04,0xdc,0xb6,0x09,0x03,0x31,0x7a,0x64,0x50,0x67,0x31,0xf4,0x50,0xed,0xeb,0x19,0x42}},
+{{0xf9,0xe3,0x2e,0x0b,0xd1,0x89,0x48,0x93,0xe5,0x3e,0x34,0x22,0xfc,0xdf,0x2d,0x1b,0x75,0x11,0xbf,0x8c,0xd7,0x4f,0xfc,0x62,0x17,0xf5,0xf7,0x08,0xf2,0xc9,0x78,0xe7}},
+{{0xee,0x89,0x1f,0xd4,0x5d,0xc5,0xd7,0x39,0x2b,0x31,0x5d,0xf7,0x68,0xec,0x5a,0x81,0x29,0x17,0x98,0x84,0xc1,0x5b,0xef,0x7e,0xbf,0x32,0x55,0x42,0x20,0xc7,0xb8,0x95}},
+{{0x9d,0x0a,0x48,0x0b,0xe9,0x56,0xae,0x30,0xd1,0x79,0x46,0x23,0xb8,0xff,0x8e,0x32,0x25,0xd6,0x94,0x89,0xba,0x95,0x6f,0xee,0xaa,0xdf,0x7c,0x64,0x8f,0xae,0x8e,0x9e}},
+{{0x24,0xda,0xaf,0x54,0x73,0x98,0xec,0x1a,0x5a,0x40,0x7f,0x12,0xe9,0x5c,0xdb,0xef,0x76,0x18,0xc2,0xb9,0x01,0xa9,0xfd,0x86,0x99,0xee,0xf6,0x55,0x05,0xa9,0x39,0x30}},
+{{0x21,0xcd,0xe5,0x66,0xa9,0x76,0x77,0x5c,0x90,0xbd,0xbf,0xf8,0x33,0x94,0x69,0x04,0x2c,0x4d,0x04,0xb2,0xc2,0xbf,0xed,0x40,0xed,0x5b,0x78,0x83,0x49,0x11,0xda,0x5b}},
+{{0xdd,0xf0,0x4e,0xfd,0xfc,0xf8,0x56,0xed,0x49,0xa1,0x62,0x2f,0x69,0x35,0x4d,0xa1,0x72,0xe9,0xac,0x8a,0x30,0x11,0x13,0xe2,0xc6,0x04,0x6e,0x45,0xb7,0x99,0xd3,0xaf}},
+{{0x56,0xa1,0x00,0x97,0xf1,0xa4,0xa7,0x3a,0x82,0xf9,0x73,0xaa,0x33,0x1e,0x78,0xbc,0x94,0xc9,0x89,0xdc,0x1b,0xd4,0x61,0x35,0x45,0x49,0x2d,0x96,0x6b,0xcb,0x48,0x19}},
+{{0xea,0x30,0x67,0xf4,0xa3,0x4b,0xbb,0x1d,0xe1,0x5a,0xaa,0x9b,0x4f,0x71,0x88,0x2c,0x05,0x05,0x74,0xf0,0xb3,0x2b,0xbf,0xf3,0xab,0x2b,0x9e,0x47,0xf7,0x80,0x34,0x93}},
+{{0x67,0x6a,0x9c,0x98,0x30,0x9f,0xf9,0x2b,0x04,0x33,0xb9,0xd2,0x8e,0x44,0x9d,0x57,0xe4,0xed,0xa8,0xca,0x77,0xdc,0x25,0xa9,0x82,0xc3,0x53,0x0f,0x26,0x39,0x16,0x2b}},
+{{0x64,0x29,0x96,0x26,0xe8,0x54,0xc5,0x3b,0x28,0xd5,0x3b,0x49,0x1b,0x1f,0x66,0x9c,0x9c,0x5a,0xab,0x0c,0x00,0xf4,0xc9,0x0a,0xbb,0xae,0x0a,0x41,0x0b,0x57,0x12,0xe1}},
+{{0xdd,0xba,0x60,0xce,0xb2,0x92,0x1e,0xe2,0xe1,0x01,0x67,0xa8,0xed,0x32,0x0a,0x16,0xa8,0x74,0xe9,0xc8,0xaa,0x95,0x55,0xab,0xdf,0xce,0xb9,0x02,0xfc,0xab,0xf0,0xb6}},
+{{0x0b,0x03,0x62,0x2b,0x59,0x89,0x5d,0xe4,0xe8,0x73,0x4d,0xe4,0x0c,0x53,0xc4,0x2c,0xa3,0xa3,0x24,0xbf,0xd0,0xe1,0x2e,0xf8,0xe3,0x5e,0x4f,0xc7,0x59,0x58,0x52,0x15}},
+{{0x92,0xd5,0xf9,0x7d,0xce,0x65,0xf0,0xc7,0x89,0x34,0x7d,0x02,0xca,0x6c,0xb6,0x19,0x90,0xf2,0x72,0xa7,0xa7,0x5b,0x63,0x58,0x4f,0x20,0xbe,0xe8,0xf9,0xe4,0x4f,0xed}},
+{{0x7f,0xbf,0xbb,0x0c,0x0d,0x7e,0x64,0xe5,0xf8,0xbb,0x66,0x39,0x62,0x02,0xf4,0xf4,0xeb,0x6a,0xa4,0xb7,0xec,0x49,0x5c,0x88,0x3a,0x21,0x4e,0x15,0xf0,0x20,0xc7,0xcb}},
+{{0x65,0xdd,0x56,0x48,0x36,0x27,0x85,0x0a,0x8c,0x55,0x83,0x27,0x19,0xcd,0x21,0xd3,0x78,0x96,0x6f,0xcf,0x54,0x51,0xb9,0x4c,0xd8,0x87,0xd4,0x19,0x7b,0xbe,0xa6,0x19}},
+{{0x51,0xf9,0x28,0x97,0x0f,0x13,0x9a,0x80,0x9c,0xbe,0x30,0x74,0x98,0xaf,0xa0,0xd4,0x27,0x03,0xc1,0x6b,0x73,0xfc,0x3a,0xc9,0x32,0x3c,0xc6,0x3d,0x85,0x3e,0xb4,0x83}},
+{{0x91,0xa9,0x97,0x72,0xfd,0x4b,0x85,0xe2,0x6e,0x1a,0x4a,0xc6,0x11,0x20,0x71,0xab,0xbc,0xfc,0x3a,0x31,0x9c,0xf5,0x6e,0xa4,0x85,0xd2,0x88,0xaf,0x94,0x0d,0xcf,0x8e}},
+{{0xc8,0xf2,0x7c,0x5f,0x58,0x2b,0x54,0xc8,0x0c,0x09,0x98,0xae,0xae,0x42,0x1f,0x15,0x31,0xba,0x78,0xad,0x3d,0xe2,0xfe,0x7b,0x85,0x0e,0x91,0x82,0x60,0x46,0xd8,0x83}},
+{{0x1b,0x46,0xeb,0xd9,0xf2,0x70,0x0b,0xca,0x53,0x86,0x9b,0xfd,0x95,0xbb,0xcf,0xcf,0xb9,0x65,0x3b,0x0a,0x75,0x03,0x67,0xb4,0x2c,0xc6,0x78,0xf3,0xab,0x23,0x30,0x0c}},
+{{0x69,0xef,0x9a,0xe9,0xcc,0xc0,0x62,0x79,0xf3,0xd6,0xd7,0xb1,0xf9,0xd0,0xf6,0x04,0xfb,0x25,0xac,0x5e,0x83,0xd5,0xda,0x77,0xbc,0x67,0x4e,0x11,0x5c,0x25,0xc9,0xee}},
+{{0x24,0xe9,0xe1,0x8c,0xb2,0xa0,0x0d,0x9e,0x12,0x2a,0xec,0x60,0x65,0xb4,0xc8,0x1b,0x1d,0x05,0xcb,0x21,0xb3,0xb6,0xf7,0xc0,0xf1,0xbe,0x77,0xe8,0x05,0x32,0x8d,0x48}},
+{{0x49,0xaf,0x0f,0x7a,0xa2,0x30,0xe3,0xee,0x1e,0xa2,0x8b,0x31,0x35,0xf9,0xb6,0xbb,0x2b,0x47,0xa4,0x3f,0x14,0xbf,0xc8,0x29,0x95,0x9d,0x9b,0x00,0xcf,0xc4,0xe8,0xcb}},
+{{0xbd,0xa2,0xee,0x92,0xe5,0x64,0xe3,0x5d,0xa9,0x79,0x3b,0xe2,0xbe,0xcf,0x44,0x69,0x57,0x83,0xaa,0x89,0x1f,0x63,0x01,0xed,0x39,0x88,0xa4,0xf8,0xda,0x62,0xa0,0xee}},
+{{0xb1,0x29,0xc8,0xf5,0xce,0x76,0xd2,0x33,0x6c,0xbc,0x5d,0xe8,0x8e,0x23,0xed,0x40,0xd2,0x14,0x84,0x2a,0xe0,0xe7,0xe6,0x12,0x2a,0xe7,0x1b,0x5a,0x8e,0x6c,0x3e,0x9b}},
+{{0xb7,0xf0,0x24,0xe2,0xed,0x3c,0x2c,0x5a,0x9e,0x6b,0x8d,0xb5,0x88,0x0c,0x16,0xc9,0x30,0x51,0xa4,0x04,0x4c,0xfc,0x94,0xb0,0x0e,0x93,0x4a,0xd7,0x65,0x4c,0xb2,0x8b}},
+{{0x35,0x70,0x2f,0x8e,0x1c,0xa2,0xad,0x3f,0xd4,0x4b,0xce,0x68,0x8d,0xa8,0x74,0xcf,0x4a,0x0c,0xdf,0x1e,0x3c,0x34,0xb2,0x03,0xea,0x4e,0x32,0x21,0xcd,0x36,0xcf,0xdb}},
+{{0x52,0x9d,0x52,0xd7,0xb5,0xcb,0x34,0x8c,0xfa,0x03,0x9c,0x56,0x61,0x20,0xc0,0x6e,0xb4,0x99,0x0a,0xed,0xa3,0x60,0xaf,0x45,0xb1,0xe9,0xea,0xbb,0xe5,0xe7,0xd0,0x71}},
+{{0x67,0x41,0x0a,0x62,0xd7,0x01,0xae,0xf6,0x15,0xa5,0x35,0xc4,0x6f,0xd1,0x20,0x9e,0x3a,0x86,0x9b,0xe0,0x0e,0x71,0x9f,0x93,0xfd,0xb0,0x25,0x44,0xad,0xdc,0xeb,0x82}},
+{{0x54,0x0a,0xbb,0x61,0xc0,0xce,0x2b,0x65,0x37,0xa7,0xbe,0xc0,0x87,0xf1,0x74,0x2d,0xb9,0xb9,0xff,0x27,0xd0,0xe3,0x18,0xb7,0x0e,0x3a,0x1a,0x00,0x5a,0x16,0x42,0x7c}},
+{{0xf3,0xf1,0x35,0xcd,0x73,0x46,0xab,0x56,0x0f,0x48,0x05,0x5a,0x41,0xf4,0x70,0x4c,0x72,0xf4,0xa2,0xe7,0x75,0x2b,0xc2,0x21,0x34,0xfd,0xd8,0x8b,0xed,0x0b,0x0c,0x84}},
+{{0x41,0x17,0xde,0xbe,0xf6,0xd0,0x64,0x63,0x3e,0xfd,0xe4,0xbb,0xb6,0x99,0xbe,0xeb,0x32,0x94,0x7b,0x38,0xb4,0x6f,0x44,0x6a,0x99,0x70,0x56,0x8d,0x71,0xa1,0x66,0x3a}},
+{{0xad,0x5a,0x32,0xc4,0xba,0x77,0x09,0x23,0x90,0x7c,0x94,0x8e,0x53,0x5b,0x04,0xfe,0xbd,0xa4,0x17,0xbc,0xce,0x62,0x4f,0xea,0x4a,0x15,0x48,0x17,0x19,0xf1,0xef,0xba}},
+{{0x4b,0xdb,0x85,0x2a,0x24,0xf4,0xfd,0x72,0x01,0x71,0xd8,0x22,0x50,0xd8,0xbd,0xf1,0x23,0x31,0x27,0xff,0x6a,0x0f,0x76,0x9f,0xbf,0xc4,0xdb,0x16,0x7c,0x47,0x57,0x49}},
+{{0x78,0xde,0xea,0x68,0x26,0x81,0x76,0x10,0x95,0x3b,0x9e,0x40,0x7d,0x2d,0x08,0xa8,0xfb,0x6e,0xc0,0xd1,0xc7,0x50,0x92,0x7b,0xc3,0x9b,0xc9,0x65,0x18,0xa9,0x1f,0xa8}},
+{{0x80,0xe9,0x04,0x97,0xdc,0x18,0x38,0xc7,0xc6,0x62,0x59,0x82,0x72,0xb7,0x3a,0xce,0x11,0x55,0x50,0x9b,0x46,0xc6,0xcd,0x83,0x6c,0x65,0x36,0x1e,0x6d,0x56,0xc7,0x41}},
+{{0xd3,0xc6,0xcf,0x92,0x7b,0xbd,0xf1,0x20,0xa8,0xef,0x71,0x1e,0x34,0x09,0x2f,0x0a,0x76,0x97,0x67,0xc0,0x84,0xd1,0xed,0xde,0x5f,0x7c,0x64,0x16,0x0d,0xa6,0x03,0x82}},
+{{0x4f,0xa9,0x6c,0x59,0x6b,0xac,0xf5,0xfd,0x45,0xf0,0x92,0x3e,0x19,0x3f,0x94,0x28,0x94,0x9a,0xc8,0x48,0x81,0x01,0x8d,0x63,0x0a,0xdf,0x71,0x61,0x1f,0xb7,0xfe,0x61}},
+{{0x19,0x5c,0xfd,0xbb,0x6d,0x55,0xed,0x41,0x7f,0x67,0x3b,0xa4,0x72,0x07,0xdc,0xa0,0x34,0x36,0x79,0xef,0x73,0x44,0xc5,0x17,0x72,0xe3,0x35,0x97,0xd0,0x69,0x2d,0x72}},
+{{0x08,0x9f,0xa0,0xa3,0x16,0xa6,0xfa,0x23,0x92,0x90,0x59,0x2d,0x9a,0x25,0xd5,0x83,0x52,0x52,0x89,0x54,0x57,0x82,0x7e,0x00,0xab,0x85,0x9f,0x4c,0x0c,0x7f,0x61,0xdc}},
+{{0x10,0x38,0xb7,0x48,0x17,0x14,0x5a,0xc1,0xf2,0x43,0x80,0xbb,0xb0,0x55,0xa9,0x6f,0x90,0xf9,0x00,0xa5,0xae,0xf6,0x07,0x4f,0x13,0x12,0x7e,0x33,0xf3,0xc1,0x76,0x0b}},
+{{0x6a,0x7c,0xa3,0xee,0x50,0x52,0x80,0x32,0x6e,0xe9,0x29,0x5b,0x63,0x68,0xc8,0x6e,0x82,0xa9,0x50,0x11,0x5c,0x41,0x39,0x23,0x28,0x32,0x49,0x1e,0xb5,0xe7,0x28,0xbd}},
+{{0x00,0xdd,0xbe,0x70,0x6c,0x3d,0x5c,0xcc,0x25,0x8f,0x68,0xd8,0x98,0xdb,0x90,0x1c,0x33,0xd0,0x21,0xdc,0x2f,0xe0,0x1a,0xf3,0x78,0xa1,0x5e,0x9d,0x72,0x33,0x00,0x8b}},
+{{0x52,0xd9,0x5d,0xe0,0x63,0x6d,0x3b,0x76,0xb8,0x72,0x74,0xd8,0xe1,0xf3,0xdb,0xfd,0x3e,0x01,0x92,0xed,0x22,0x15,0x16,0x78,0x24,0x4e,0x90,0xdf,0xab,0x58,0xf4,0x10}},
+{{0x51,0x14,0x27,0xb6,0xff,0x96,0xdf,0x15,0xbf,0x97,0x0c,0x22,0x0d,0xb4,0x17,0xcb,0x4f,0xe2,0x30,0xde,0xc4,0x15,0x1d,0x31,0x3f,0x3e,0xbd,0x6e,0xc1,0x9f,0x66,0xe8}},
+{{0x8d,0x01,0xec,0xb8,0xf5,0xf5,0x2e,0x4b,0x74,0xae,0x06,0xa2,0xf6,0xf3,0x73,0x51,0x43,0x5e,0xb5,0x6a,0x89,0x00,0x47,0xa4,0x6b,0x32,0x36,0x29,0x24,0xf0,0xab,0x57}},
+{{0x0a,0x63,0x59,0x39,0x68,0xe9,0x97,0x0a,0xdf,0x90,0xb6,0x9b,0x45,0xc0,0xba,0x5b,0x55,0x8b,0xfc,0xb6,0xd4,0xb6,0x24,0xa2,0x6a,0x4b,0xdb,0x2b,0xf9,0x6e,0x32,0xb4}},
+{{0xe2,0x68,0xc5,0x02,0x76,0xfe,0x06,0x9c,0x19,0xea,0x63,0x37,0x40,0x2d,0x67,0x23,0x49,0x87,0xb2,0xf3,0xcb,0xc8,0xb6,0x26,0xe7,0xfc,0xb0,0xd1,0x4d,0x43,0xb9,0x0a}},
+{{0xa7,0xaa,0x97,0x6b,0xcb,0x09,0x10,0x64,0x39,0xed,0xfc,0x2b,0xd1,0xd2,0xac,0x00,0x59,0x03,0xf7,0xca,0xf0,0x1e,0x5c,0x81,0xd6,0xc3,0xd8,0x63,0xe2,0x4f,0x15,0x74}},
+{{0xcd,0x9a,0x99,0xd0,0x2d,0x3d,0x70,0xf1,0x32,0x7f,0x72,0x8a,0x69,0x8e,0xad,0x9f,0x54,0xfe,0x9f,0xb6,0x8e,0xba,0x19,0x85,0x3a,0xa2,0x2d,0xbe,0x59,0xb7,0x6c,0x0d}},
+{{0x78,0xed,0x47,0x0f,0xd6,0x3e,0xcb,0x73,0x65,0x73,0x12,0x01,0xc7,0x4c,0x50,0xf3,0x47,0xe9,0xab,0xeb,0x51,0x35,0x21,0xc8,0x2a,0x5d,0xba,0x21,0xa1,0x39,0x8b,0x6b}},
+{{0x20,0xed,0x3c,0x14,0xcd,0xf1,0x91,0xd6,0xe7,0x7f,0xf4,0xad,0xa3,0x85,0x88,0x01,0x79,0x06,0x2e,0x21,0x79,0x32,0xfd,0x89,0xa4,0x35,0x31,0x48,0xa8,0xc3,0xee,0x42}},
+{{0xe3,0x03,0xbd,0xa4,0x28,0x50,0xc6,0xcd,0xa5,0xba,0x1d,0x90,0x72,0x04,0x1f,0x8d,0x0a,0xb5,0x40,0x67,0xec,0x2f,0x77,0xbe,0x18,0x44,0x53,0x4f,0x77,0x65,0x47,0x47}},
+{{0x60,0xbe,0x27,0x38,0xa6,0x3f,0x49,0x45,0x9b,0x81,0x49,0x5b,0x4b,0x9a,0xd1,0x33,0x54,0xaa,0xd4,0x7b,0x3f,0x89,0xe2,0xd5,0xde,0xe6,0x0b,0xd4,0x29,0xd8,0x0d,0x5d}},
+{{0x63,0x0f,0xfd,0xbe,0x21,0x9d,0x66,0xec,0xff,0x48,0xd5,0xa6,0x5d,0xeb,0xb7,0x9c,0x94,0x0f,0x4f,0xd8,0x9e,0x94,0xa0,0x1d,0x72,0xba,0xc9,0xba,0x39,0xec,0x40,0xd4}},
+{{0x17,0x4b,0x24,0x1e,0x26,0x20,0xbd,0xea,0x93,0x29,0xb4,0x25,0xab,0xe3,0xca,0x92,0xb7,0xdd,0xd0,0x10,0x13,0xef,0x41,0xa0,0xeb,0xc5,0xda,0x66,0xb5,0xb4,0x72,0x37}},
+{{0xb5,0xe6,0xb6,0xc4,0xe7,0x5d,0xe1,0x0f,0x64,0x85,0xf5,0xe4,0xe0,0x52,0xa9,0x91,0x94,0x2d,0x23,0x61,0x5b,0x34,0x27,0x9a,0xfc,0xb7,0xc4,0x2a,0x9c,0xec,0x98,0xc0}},
+{{0x38,0x84,0x2d,0x8f,0xbe,0xb8,0xe2,0xfc,0x93,0x3e,0xc8,0x93,0x60,0xe0,0xa7,0x33,0x7f,0xac,0xbd,0xf0,0x71,0xd5,0x28,0xe9,0xf0,0x0f,0x34,0x47,0x43,0x9a,0x21,0x1b}},
+{{0xf7,0x22,0xa7,0xfc,0x78,0x45,0x30,0x3b,0xc7,0x3e,0xca,0xc8,0x39,0xbf,0xb5,0x41,0xde,0x70,0xa2,0x27,0xe2,0xe0,0xfa,0xa3,0x56,0x80,0x8e,0x0d,0x04,0xe1,0xb4,0xff}},
+{{0xa5,0x0b,0x18,0x56,0x01,0xbb,0x4c,0x64,0x16,0xfb,0x65,0xd9,0x9c,0x1b,0x84,0xd0,0xa7,0x0e,0xed,0xea,0x54,0x6f,0xb1,0x44,0xa8,0x78,0x06,0xc4,0x2f,0x35,0x9b,0xe1}},
+{{0x3b,0x7e,0x27,0x16,0x25,0x1a,0x1c,0x97,0x9f,0xa9,0x91,0xff,0xe0,0x66,0xdb,0x16,0x6b,0xa2,0xc8,0x54,0xbd,0x52,0x8d,0x89,0xb5,0x2c,0x06,0x95,0xfe,0x99,0xe2,0x36}},
+{{0x0d,0xa0,0x85,0x9d,0xf3,0xa8,0xfb,0xde,0x65,0xec,0x7d,0xc8,0xd1,0x21,0xc8,0xb0,0x15,0x59,0x1d,0x43,0xf5,0x9d,0x76,0x57,0x5a,0x91,0x1c,0xcb,0x4d,0xc1,0x26,0xb1}},
+{{0x3d,0xfd,0x56,0x8c,0x09,0xc7,0x2b,0xa9,0xe3,0x51,0xc9,0x26,0x62,0xd2,0x6e,0xab,0x9c,0x98,0xfe,0x4a,0x23,0xcd,0x16,0xf2,0xca,0xb6,0xbd,0xd9,0xe5,0x6f,0x34,0xb7}},
+{{0x6e,0x13,0xff,0x86,0x6a,0xf8,0x51,0x09,0xa6,0x42,0x43,0x19,0x19,0x3b,0xe2,0x19,0x9b,0x74,0x19,0x12,0xaa,0x85,0xe6,0xb9,0x7b,0x87,0xda,0x6e,0x25,0xa5,0xa7,0x7f}},
+{{0xd3,0x6e,0xf6,0xa9,0x0b,0x96,0x6d,0x82,0x88,0x31,0xba,0xc3,0x5a,0x5f,0x2f,0xa8,0xbe,0x3e,0x53,0x79,0xf9,0x66,0x38,0x8b,0xd5,0xfb,0xf5,0x62,0xf0,0x33,0xc9,0x7c}},
+{{0x57,0xf3,0x83,0xe9,0x07,0x93,0xfa,0xf9,0xb6,0xdc,0xe7,0xbb,0x42,0xa1,0xb1,0xd7,0x09,0x36,0x6a,0x71,0xec,0x52,0xb6,0xde,0xfb,0x31,0x63,0xe4,0x62,0xab,0x2d,0x2d}},
+{{0x7b,0xcd,0x78,0xb9,0x18,0x39,0x40,0x63,0xd0,0x31,0x7c,0x17,0x43,0x96,0xf1,0x36,0x1c,0x5a,0xc8,0x94,0x5b,0xbc,0x09,0x7c,0x79,0xde,0xea,0x8b,0x15,0x6e,0x26,0x90}},
+{{0x15,0x19,0xb6,0x25,0x5e,0x2c,0x29,0x2c,0x8d,0xef,0xfa,0xb2,0x8c,0x7e,0x16,0x44,0xfc,0xf2,0xb9,0xbe,0x1a,0xdd,0x05,0xd3,0x85,0x12,0x04,0x7a,0x34,0xb9,0x67,0xdc}},
+{{0x6d,0x76,0x20,0xeb,0x44,0x08,0x52,0xc4,0xc9,0x1a,0x15,0xc0,0x38,0x79,0x12,0xaf,0xac,0x19,0x13,0xc3,0xb9,0x74,0x64,0x1f,0xdb,0x8b,0xaa,0xf0,0xf8,0xee,0xe3,0xb5}},
+{{0xae,0xeb,0x11,0xaa,0x73,0x47,0x0a,0x5e,0x2f,0xbb,0x5a,0xea,0x35,0x37,0x22,0x09,0xa6,0xb9,0xf7,0x12,0x97,0x54,0x06,0x95,0x73,0x30,0xc2,0x05,0xd3,0x17,0xe6,0xdd}},
+{{0x61,0xdf,0xc4,0xec,0x22,0x04,0xbf,0xe2,0x23,0xbc,0xba,0x82,0xb3,0xf5,0x7d,0xaf,0x49,0x69,0xfc,0x63,0x19,0x86,0xf1,0xf5,0x47,0x19,0x5e,0x63,0x7e,0xcc,0xef,0x21}},
+{{0x4b,0x63,0x12,0x0b,0x66,0xde,0x3c,0x67,0x1c,0xc8,0x2b,0x3a,0xb0,0xce,0x90,0x2e,0xd8,0xad,0x02,0x14,0xa7,0x51,0x7d,0x8f,0xbc,0x68,0x58,0x7d,0xf3,0xe8,0x66,0xe3}},
+{{0xbc,0xd5,0x83,0x05,0x16,0x4c,0x9f,0x14,0x8e,0x3b,0xb1,0x7e,0xcb,0xf4,0xdf,0x53,0x31,0x3f,0x33,0xe5,0x4c,0x78,0x14,0x4e,0x18,0xa5,0xb1,0x29,0x9c,0x27,0x97,0xda}},
+{{0x01,0x11,0x5e,0xd7,0x5c,0xdf,0xbe,0x4b,0x69,0x98,0x28,0x38,0x2c,0xf9,0x0e,0x1e,0xff,0x65,0x16,0x5b,0x30,0xa2,0x7f,0xd0,0x07,0x1f,0x74,0x03,0xfc,0xba,0xa8,0x15}},
+{{0xc3,0xc1,0x5f,0x03,0xe3,0xc8,0x52,0xf9,0x11,0xd1,0xf2,0x1a,0x75,0x76,0x42,0x4e,0x98,0x50,0xda,0xed,0xc9,0x5f,0x47,0xb0,0x14,0xae,0xba,0x8e,0x8c,0x7a,0x1b,0xeb}},
+{{0xa1,0x93,0xac,0x11,0x00,0xc1,0xcb,0xc6,0x19,0x81,0xa6,0xfe,0xd1,0x1e,0x0e,0xd8,0x6f,0x28,0xd9,0xf1,0x55,0x8d,0x14,0xc0,0xde,0xfd,0x0f,0x30,0x67,0xc4,0xe6,0x56}},
+{{0xac,0x52,0xc1,0x9f,0xc9,0x8a,0x8c,0xd8,0xc4,0x96,0xf9,0x91,0x16,0x1e,0xc4,0x41,0xc7,0x42,0xc1,0x97,0xc9,0xe9,0x3d,0x4d,0x85,0x76,0x4d,0xa7,0x19,0x07,0xdc,0xfa}},
+{{0x0c,0x9f,0x10,0x56,0x15,0xc2,0xae,0x9c,0x14,0x8a,0x5d,0x52,0x33,0x85,0x45,0xf2,0x59,0xbd,0x5d,0x38,0xa1,0xc7,0x4f,0x34,0x68,0x8c,0xfa,0x71,0xab,0x34,0xe4,0xbc}},
+{{0x2f,0xc9,0x49,0x24,0xcb,0xac,0xf2,0x26,0xc9,0xf8,0x4f,0x1a,0x44,0x9a,0xd7,0x98,0xac,0x10,0x14,0xac,0x93,0x28,0x65,0xc0,0xeb,0xcd,0x79,0xbe,0x0b,0xad,0x2b,0xb4}},
+{{0xa2,0x01,0xa4,0x75,0x88,0x8c,0xca,0xb8,0x1a,0xe0,0x58,0x2e,0x69,0x75,0xfb,0x8b,0x10,0xac,0x65,0x19,0xdb,0x8d,0x63,0x20,0x0f,0xb4,0xe5,0xf7,0x39,0x9d,0x41,0x29}},
+{{0x69,0xb3,0x05,0xdf,0xc2,0x37,0xd4,0xc4,0xf9,0xb0,0xd2,0x5b,0x98,0xd3,0xad,0xc6,0x71,0xfd,0x5a,0x80,0xd1,0x2b,0xcf,0x1d,0xe0,0x2a,0x4f,0x26,0x79,0x58,0xfb,0x59}},
+{{0x97,0x37,0xd7,0xc3,0x3c,0xaa,0xbb,0xff,0x45,0xdd,0x27,0x4b,0xec,0x1b,0xad,0x7c,0xc6,0x7f,0x83,0x66,0x8e,0x74,0x89,0xaf,0x53,0xa2,0x21,0x5b,0x33,0x3c,0x96,0xbb}},
+{{0x8d,0xbb,0x1d,0xa9,0xc0,0x00,0xbe,0x9e,0xfc,0x0a,0xee,0xcd,0xf4,0x23,0x35,0x3a,0x2b,0xc8,0x31,0xee,0x37,0xee,0xdb,0x6c,0x55,0x53,0xd3,0x7d,0x32,0x44,0xc7,0xd6}},
+{{0xa7,0xd2,0x87,0xe2,0x01,0x30,0xe0,0x49,0x4e,0x0a,0x3e,0xc7,0x07,0x79,0x39,0x78,0x57,0x07,0xe6,0xe9,0xa9,0xaf,0x7c,0xee,0xc2,0x5d,0x42,0x13,0xf3,0x59,0x58,0x8a}},
+{{0xe0,0xee,0x0d,0x5e,0xd7,0x5b,0x57,0xb8,0x0d,0x36,0xdb,0x78,0x2a,0xcf,0x18,0xe8,0xa5,0xb3,0x4b,0x14,0x57,0x3b,0x31,0xae,0xea,0x87,0xa2,0x2e,0x41,0x6f,0x60,0xee}},
+{{0x4e,0x30,0xff,0x5d,0x8b,0xbf,0x83,0x36,0x6a,0x18,0x59,0x24,0x1b,0x8f,0x5f,0x8b,0x7f,0x32,0x74,0x88,0xe9,0x00,0x57,0x6e,0xbc,0xe6,0x09,0x41,0x13,0x80,0x10,0x39}},
+{{0x6b,0x83,0x1f,0x5b,0x3e,0xfe,0x5a,0x90,0xc1,0x20,0xb1,0x57,0xfc,0xd0,0x6c,0xc4,0x7a,0xa6,0x1e,0xfc,0x5c,0x78,0x70,0xf2,0x4e,0x0f,0x4c,0xa6,0x1d,0x9c,0xdf,0x52}},
+{{0x9b,0x42,0x2d,0x51,0xaa,0x09,0xd7,0x77,0xc0,0x26,0xae,0x9c,0x76,0x75,0x54,0xf8,0x10,0xf6,0xfc,0xfd,0x03,0x8f,0xbf,0x6f,0x63,0x1a,0x98,0x93,0x74,0x81,0xbb,0xeb}},
+{{0xa7,0x0f,0x3a,0xd7,0xcf,0x0e,0x34,0x16,0xde,0xa8,0x0a,0xae,0xb7,0xc3,0x3b,0x78,0xae,0x09,0xce,0xe9,0x76,0x71,0xc7,0x8b,0xf7,0x5f,0x6d,0xad,0xa3,0x6f,0xf9,0x42}},
+{{0x26,0x9f,0xc0,0x4c,0xa7,0x22,0x95,0x85,0x46,0x93,0x5e,0x48,0x74,0x82,0x7c,0x90,0xb4,0x9e,0x2d,0xf6,0x06,0x09,0x8f,0xc8,0x17,0xad,0x4c,0x42,0xdc,0x5b,0x5f,0x4b}},
+{{0x68,0x29,0x4c,0x7b,0xfa,0x1b,0x3b,0x3f,0xa9,0xa0,0x42,0x50,0x82,0x89,0x66,0xd5,0x39,0x13,0x06,0x59,0x7b,0xf2,0xb2,0x54,0xc7,0xe8,0x33,0x4f,0x78,0x46,0xb5,0xd5}},
+{{0xd6,0x46,0xd1,0xd0,0xd3,0xe2,0x05,0x98,0x8e,0x45,0x7e,0x51,0x89,0xda,0x45,0xe2,0xa0,0xc7,0x11,0x23,0x58,0xc4,0x26,0x16,0xce,0xfe,0xc3,0x2f,0xd2,0x90,0x23,0xd2}},
+{{0x65,0x60,0xe9,0xc3,0xf6,0x8f,0x45,0xa3,0xfe,0xa0,0x8a,0x4c,0x6a,0x5b,0x62,0x47,0x7b,0xf2,0xfd,0x3c,0xcc,0x5f,0x08,0xc9,0x1d,0x94,0xbf,0xc4,0x6c,0xaf,0x5e,0xab}},
+{{0xe8,0x58,0xa4,0xf2,0x68,0x15,0xe8,0x46,0x31,0x5d,0x20,0x95,0x9f,0xca,0x0f,0x98,0x91,0x29,0x16,0x8f,0xb4,0x76,0xd0,0x07,0xa6,0x0d,0x44,0x57,0xe4,0x34,0xcf,0x12}},
+{{0xd8,0xe0,0xf1,0x47,0x1d,0x52,0xb7,0x92,0xbb,0x32,0x76,0x92,0xf7,0xa1,0xee,0x57,0xae,0xbe,0x02,0xd2,0xc4,0xf5,0xb4,0xfd,0xa9,0x9c,0xd5,0xc3,0x6b,0x59,0xeb,0x9c}},
+{{0x84,0xa5,0xa0,0xc1,0xf5,0x12,0x60,0xcb,0x41,0xe9,0x34,0xf3,0x32,0x62,0x01,0x37,0x3e,0x55,0x4a,0x25,0x1e,0xf4,0xbc,0x5e,0x25,0x07,0x3c,0xf4,0xdf,0x00,0xb5,0xe1}},
+{{0xf9,0x8c,0xa5,0x45,0xd3,0xa9,0x1b,0xdd,0x18,0xfd,0x75,0x88,0xe7,0x9f,0x81,0x75,0x28,0x76,0xa5,0x4d,0x57,0xa3,0x4e,0xce,0x5c,0x92,0x04,0x9f,0x0d,0xd5,0x95,0x4a}},
+{{0x6a,0x77,0x45,0xb7,0x8b,0x9b,0x00,0x6e,0x86,0xec,0xe5,0x53,0x73,0x48,0xe8,0xc0,0x94,0xef,0x9f,0x7d,0xeb,0xa9,0x62,0x4d,0x7a,0x63,0x83,0xf2,0x04,0xaa,0x75,0xae}},
+{{0x0f,0x72,0xab,0xb1,0xc7,0x99,0xf0,0x14,0xd2,0x42,0xed,0x1b,0xf3,0x8f,0x41,0x97,0xaf,0x67,0xeb,0xe0,0xcf,0x1d,0x44,0x0a,0xce,0x6a,0x9d,0x7f,0xec,0x08,0x20,0x85}},
+{{0xe8,0x0d,0x82,0xdc,0xff,0xa8,0x65,0x06,0xa9,0x04,0x1b,0x97,0x5b,0xf9,0xf1,0x9b,0x06,0x16,0xca,0x93,0x39,0x47,0xb5,0x2e,0x66,0xe1,0xdb,0x5c,0xab,0x58,0x9d,0x67}},
+{{0xa6,0x5f,0x06,0x2c,0x83,0x60,0x11,0x46,0x37,0xec,0x4b,0x11,0x57,0xe1,0x40,0x6b,0x35,0xcf,0x80,0xf6,0xcf,0x8c,0xfc,0xa9,0x64,0x9d,0x3a,0x62,0xb5,0x0e,0xd3,0xa2}},
+{{0x85,0x72,0x13,0x49,0xcb,0x8d,0xed,0x3e,0x38,0x15,0xd7,0xb5,0x24,0x0b,0x6e,0x73,0x14,0x00,0x6f,0x2c,0x87,0x34,0xf7,0x3d,0x5f,0xf8,0x60,0xb9,0x58,0x27,0xe2,0x61}},
+{{0xdc,0x16,0x06,0xac,0xca,0x07,0xf0,0xc7,0x3a,0x85,0xe4,0x67,0x01,0xd8,0x23,0x8e,0x2b,0xa4,0x55,0x71,0xe8,0x61,0xe5,0xac,0xac,0xd7,0x88,0x7d,0x9d,0x45,0x15,0xa1}},
+{{0xf9,0x4d,0xbc,0x74,0xfd,0x75,0xa0,0xff,0x90,0x31,0x56,0x7e,0xba,0xa7,0xff,0x45,0x82,0x95,0x82,0xd4,0x59,0x47,0xb8,0x22,0x46,0x17,0xc4,0xaf,0xbb,0x83,0x92,0xac}},
+{{0x42,0x3a,0x1f,0x6c,0x0a,0x1a,0x61,0x70,0x45,0x1c,0x00,0xb7,0xe4,0xe5,0xa3,0x3e,0xe4,0x8f,0x2b,0xd4,0xbb,0x57,0x3a,0x6e,0x85,0x66,0x46,0xb7,0x5d,0x7f,0x05,0x1f}},
+{{0x19,0x25,0x74,0x56,0xff,0x41,0x39,0xb2,0x92,0xd0,0x57,0x1b,0x50,0x9e,0x60,0xf4,0x73,0xd8,0x7e,0x7e,0xb1,0x42,0x69,0x25,0x17,0x71,0x10,0x84,0x99,0x84,0x55,0x6a}},
+{{0xc9,0x08,0xb3,0xf3,0xa5,0x75,0x6a,0xe7,0xc0,0x66,0x3e,0xf9,0xf4,0x94,0x95,0x57,0x34,0xbc,0x97,0x7d,0x7d,0x71,0xfc,0x2f,0xf7,0x30,0x76,0x98,0xbe,0xdd,0x1e,0x84}},
+{{0x8d,0x4c,0xd9,0x8c,0x99,0x3a,0xca,0x61,0xf0,0x4f,0x07,0xa2,0x21,0xb4,0xd1,0x8e,0x3a,0x6d,0x4f,0xfb,0x3f,0xf1,0xe5,0xe3,0x94,0xf6,0x2a,0x38,0x32,0xe6,0x12,0x9b}},
+{{0x86,0xa8,0xf2,0x76,0xd8,0xf4,0xb2,0x26,0xa3,0x95,0x5a,0x48,0x02,0xee,0xf5,0xca,0x3b,0x10,0x86,0x91,0x93,0x9a,0x52,0xd0,0x29,0x0b,0x8d,0x89,0xeb,0xf1,0x35,0x83}},
+{{0x33,0x22,0x12,0x81,0x72,0xf9,0xff,0x74,0xed,0x95,0x4f,0x0d,0xb8,0x5b,0xe3,0x4b,0x0b,0x30,0x62,0x51,0xab,0x19,0xeb,0x4d,0x9d,0xb7,0xad,0x3a,0xd5,0xe6,0x65,0xbc}},
+{{0x52,0xcd,0x8a,0xf9,0xeb,0x4b,0x8a,0x32,0xe1,0xf4,0x29,0x9e,0x17,0x75,0x60,0x58,0xab,0x91,0xe3,0x3a,0x02,0x48,0x22,0xb4,0x40,0x0f,0x39,0xf1,0x9d,0x2f,0xce,0xb5}},
+{{0xe9,0x07,0x44,0xf5,0x75,0x20,0x07,0xbb,0x46,0x6a,0x2d,0x80,0x6d,0xe7,0xeb,0xe5,0x3a,0xc1,0x47,0x78,0xff,0xc4,0xb4,0xa5,0x69,0xcd,0x03,0x9b,0x24,0x99,0x79,0x40}},
+{{0x03,0xa8,0xde,0x3b,0x9b,0x62,0x81,0xe7,0xf0,0x4e,0x54,0xb5,0x67,0x24,0xde,0xed,0x06,0x43,0xd9,0x11,0x90,0x8e,0xbc,0x56,0x4f,0x6a,0x6b,0xa0,0x7e,0xc6,0xd9,0xa7}},
+{{0x26,0x53,0xc8,0xd7,0x26,0x62,0x0a,0xd4,0xc8,0x7a,0x57,0x28,0x00,0x45,0xb1,0x05,0x88,0x30,0x65,0xdb,0xa9,0xd4,0xbf,0x97,0x00,0xad,0x2f,0xb5,0x63,0x70,0xa5,0x12}},
+{{0xfa,0x3d,0x3a,0xc6,0x4f,0x97,0x5c,0x44,0x42,0x84,0x9b,0x35,0x58,0x52,0x3d,0xee,0xaa,0xd2,0x15,0xd7,0x2e,0xbf,0x86,0x3c,0x75,0xef,0xfa,0xbf,0xb8,0x18,0xa3,0x50}},
+{{0x2d,0xd0,0x96,0x8e,0xe4,0x4c,0x4f,0xd3,0x83,0x48,0x2c,0xb3,0x42,0x4c,0x5f,0x14,0x44,0xc2,0x94,0xd0,0x57,0xee,0x37,0xfc,0xe3,0x20,0xe6,0x4e,0x29,0x7a,0x19,0x6c}},
+{{0x95,0x9e,0xe3,0x8b,0x0b,0xc7,0xf0,0x40,0x6d,0x9a,0xec,0xd7,0xdb,0x89,0x6a,0xe5,0x67,0x8c,0xbb,0x7f,0x10,0xca,0xb8,0x3e,0x11,0x32,0x09,0x56,0xd0,0x01,0x0d,0x05}},
+{{0xc5,0x94,0x6f,0x01,0x8a,0x37,0x50,0x8c,0x99,0xc2,0xcc,0xfc,0xc3,0x4e,0xe5,0x20,0x3a,0x96,0x74,0x48,0xd9,0xa7,0x7c,0x56,0xaa,0xd5,0x1a,0x99,0x3c,0x6c,0x7b,0x9f}},
+{{0xdc,0x00,0x1b,0x01,0x94,0xa7,0xda,0xbf,0x4d,0x70,0x46,0x01,0x0d,0xac,0x80,0xaa,0xed,0x66,0xe2,0x57,0x33,0x55,0xd3,0x19,0x5f,0x22,0x7e,0x98,0xcd,0x6b,0xda,0x51}},
+{{0x2c,0x8a,0x6e,0x37,0xd7,0xca,0x49,0x35,0xad,0xbb,0x21,0x5b,0xc5,0x6b,0x2a,0x00,0x65,0xd9,0x1e,0x9a,0x43,0x8c,0x30,0x88,0x6a,0xc9,0xdf,0x11,0x16,0x76,0x2d,0x04}},
+{{0x6b,0xe1,0x07,0xc8,0xb1,0xda,0x74,0x4e,0x67,0x60,0x81,0x6a,0x1f,0xa7,0x8e,0x2f,0xeb,0xf0,0xd5,0x9e,0xb0,0xf0,0xd6,0x44,0x07,0x37,0x5c,0xfd,0xfa,0xbf,0xcf,0xa8}},
+{{0x64,0xf4,0x47,0xc5,0x88,0x2a,0x33,0xe2,0x91,0x3c,0x92,0x55,0xdd,0xbe,0xf6,0xe1,0xa8,0x56,0x60,0xb1,0xef,0x57,0x53,0x90,0xfa,0x95,0xb3,0xb3,0xec,0xf8,0x82,0xab}},
+{{0xf2,0xbe,0xc2,0x99,0x3e,0x33,0xbc,0x6b,0x6f,0xaa,0xb0,0x7c,0x58,0x22,0xa4,0xef,0x59,0x46,0xca,0xfa,0x29,0x42,0x4f,0x93,0x39,0xc6,0x73,0x7c,0x29,0x82,0x59,0x31}},
+{{0x0d,0x12,0xeb,0x0c,0xc4,0x4e,0x03,0xcd,0x89,0x36,0x8f,0xa4,0x92,0xef,0xd6,0x03,0x84,0x67,0x8e,0x79,0xa0,0xac,0x2f,0x5a,0xc3,0x37,0x30,0xb8,0xa0,0x4a,0x50,0xc3}},
+{{0x3a,0xae,0xf1,0x8e,0xf1,0x25,0x96,0xdf,0x46,0x47,0x64,0x6b,0xf2,0x90,0xc8,0x22,0x8f,0x3b,0x7e,0x0f,0x85,0x79,0xa9,0x7a,0xf3,0xcc,0x5e,0x08,0x71,0xa6,0xb9,0x13}},
+{{0xeb,0x83,0x86,0xea,0x49,0x9a,0x10,0x2a,0xc8,0x15,0xc5,0xe3,0xf1,0x8b,0x1c,0xef,0x73,0x78,0x03,0x5b,0xdf,0x24,0x4f,0x22,0x2e,0x2d,0xac,0x48,0x97,0x69,0x95,0x61}},
+{{0x91,0xb9,0x9e,0x10,0xda,0x6d,0x5f,0x6b,0x68,0x23,0x98,0x7b,0x50,0x64,0xb9,0x6c,0x92,0x74,0xd3,0x2a,0x0c,0x3e,0xdf,0xe2,0xdb,0x44,0x3d,0xbf,0x2f,0x7c,0x88,0x92}},
+{{0x2c,0x73,0xab,0x1b,0x07,0x39,0x07,0x0f,0x35,0x32,0xa1,0x93,0xdc,0x40,0x9a,0xd4,0xed,0x16,0x2d,0x38,0xfc,0xe9,0x5a,0x8a,0x3c,0xb8,0x18,0xb9,0xe4,0x30,0xc8,0x64}},
+{{0x0f,0x1c,0x03,0x6a,0xcc,0x27,0xcf,0xbe,0x1f,0x6f,0x99,0xd8,0x43,0xd7,0x6e,0x95,0xa5,0x12,0x79,0xaa,0x7d,0x6c,0xf2,0xfa,0x86,0xd3,0x9d,0xba,0xed,0x0d,0xbc,0xb8}},
+{{0xcc,0x33,0x45,0x4d,0x54,0x51,0xc4,0x54,0x3e,0x67,0x93,0xc7,0xa4,0xff,0x96,0x86,0x18,0x09,0xb4,0x1b,0xe9,0xbd,0x9f,0xfc,0x94,0x64,0x47,0x8f,0x1a,0xca,0x9b,0x92}},
+{{0x3f,0xbc,0x6b,0x06,0x1e,0x3e,0xd7,0xcf,0x62,0x37,0xe9,0xd9,0x46,0xf8,0xea,0x5f,0xdc,0x42,0x23,0xef,0x1e,0xe6,0x0a,0x37,0x25,0x25,0x2d,0x4d,0xb4,0xf3,0x18,0x54}},
+{{0xad,0x07,0x04,0xc2,0x46,0x6f,0x4a,0x74,0x40,0x98,0x4d,0xf2,0x50,0x08,0xfc,0xfb,0x38,0x24,0xec,0xdf,0x59,0xdd,0x73,0x49,0xda,0xe8,0x9e,0xb9,0x07,0xc0,0x82,0xff}},
+{{0x1e,0x10,0xb5,0xff,0xc6,0xdc,0x1f,0xf1,0xb5,0x87,0xea,0x38,0xc5,0xde,0x1e,0xd9,0xc3,0xc4,0x6e,0xb2,0xaa,0xef,0x0a,0x9f,0xcc,0x1e,0xf0,0x69,0xdd,0xf6,0x43,0x09}},
+{{0x58,0x05,0xde,0xae,0xb4,0xf9,0xcd,0x9d,0x95,0xbc,0x47,0x71,0x9e,0x7c,0xfe,0xc6,0xbe,0xb8,0xd4,0xaf,0x43,0x06,0x3c,0xa4,0xca,0xfe,0xb5,0x61,0x0d,0xb0,0x94,0x13}},
+{{0x70,0x45,0x96,0x0d,0x09,0x94,0xe2,0x38,0xbc,0x46,0x3c,0x62,0x3f,0x4b,0xd6,0x54,0x4d,0x83,0xd7,0xc3,0x09,0x8a,0x74,0x58,0x51,0xdf,0x24,0xcb,0xa4,0x96,0x6c,0xfa}},
+{{0x23,0x44,0xd1,0x04,0xe8,0x0d,0x0d,0x9a,0x15,0x76,0x45,0xab,0xb2,0xb8,0xf0,0xbd,0x1d,0xd7,0xf2,0x5d,0xbb,0xe8,0x02,0xff,0xf1,0xcf,0x58,0x89,0x37,0x5c,0xff,0xcb}},
+{{0xf3,0x7e,0xe1,0x26,0x59,0x01,0x8f,0xc1,0xe0,0xfc,0x36,0x20,0x37,0xb0,0xf1,0x13,0xb4,0x32,0x76,0xd4,0x5b,0xce,0xe8,0xf0,0x2d,0xf1,0xc7,0x2b,0x00,0xfc,0xea,0xa6}},
+{{0x18,0xf1,0xbf,0x1a,0xa3,0xbe,0x26,0x65,0xd4,0x29,0x96,0x89,0xf7,0xf7,0x4f,0xbb,0x56,0x10,0xe0,0x6c,0xc1,0xca,0x1e,0xa9,0x9f,0x17,0x83,0x52,0x1e,0xe4,0xc3,0xfc}},
+{{0xad,0x8c,0x91,0xe8,0x52,0xf3,0x9d,0x5e,0x21,0x8b,0x41,0x7a,0xa4,0xd1,0x2d,0xb4,0xbc,0xe7,0x7b,0x8b,0xff,0x5f,0x46,0x71,0xfe,0x64,0x72,0x6c,0x76,0x59,0x6a,0xc8}},
+{{0x7a,0xb0,0x88,0xe4,0xbb,0xf7,0x77,0xc8,0x67,0x28,0xb0,0x41,0x59,0x4e,0xcd,0xfa,0x71,0x4a,0x9d,0xb2,0x7a,0x1a,0x60,0x61,0x0f,0xaa,0x05,0xf3,0x0e,0x50,0xa4,0x10}},
+{{0xe8,0xf3,0xf7,0x98,0x92,0xdc,0xf5,0x39,0xe6,0x9c,0x42,0xe7,0x10,0x5b,0x74,0x8a,0xae,0x7d,0x08,0x7d,0xa6,0xaf,0xf8,0x55,0xee,0xbf,0xe8,0xa6,0xec,0x37,0xd5,0xcc}},
+{{0x44,0x57,0x00,0x54,0xd1,0x2a,0x05,0x45,0x6a,0x19,0xfd,0x97,0xf5,0x1b,0xe8,0xdd,0x93,0x6d,0xe2,0xa6,0x0b,0xe6,0x04,0x7f,0x91,0x70,0xfe,0x75,0xc8,0x8a,0xbe,0x20}},
+{{0xa0,0x1d,0x52,0x5c,0x37,0x21,0x54,0x40,0xc9,0x5e,0xe7,0xc4,0xee,0x30,0x34,0x92,0xfc,0x8b,0x93,0x96,0x11,0x3a,0xa3,0x26,0xd5,0xf5,0x2c,0xc8,0x46,0xd8,0x0c,0xef}},
+{{0x4f,0xb0,0xc1,0xf7,0x9c,0xf8,0x52,0x8a,0x8c,0x21,0xf4,0xa8,0xcd,0xe1,0xa2,0x36,0xde,0xdf,0x95,0xc6,0x36,0x52,0xe6,0x0e,0xe1,0xe2,0x5c,0xc2,0x60,0xb5,0x6d,0x78}},
+{{0xd6,0xa3,0x06,0x17,0xe6,0xe0,0x38,0xf2,0xf9,0x83,0xbd,0x12,0xab,0x79,0x83,0x12,0x9b,0x10,0xee,0xff,0x7d,0xd4,0xf7,0x83,0x42,0xf3,0xde,0x82,0xe5,0x17,0x4b,0xe3}},
+{{0x7d,0xea,0x42,0x66,0x3c,0x99,0xa7,0xc7,0xe6,0x14,0xb1,0xac,0x63,0x5a,0x20,0x8f,0xba,0x0f,0x62,0x3e,0xa2,0x71,0xd2,0x60,0xe5,0xc1,0xb0,0x5e,0x99,0xce,0x67,0xbc}},
+{{0x95,0xe1,0xe4,0xd8,0x65,0x26,0x3c,0xbf,0x59,0xd6,0xf5,0x7b,0x59,0x4e,0x8f,0x4e,0xdc,0xb1,0x9f,0xa1,0x54,0x65,0xa5,0xc8,0x0f,0xbd,0x31,0x73,0x9f,0xe8,0x5f,0x14}},
+{{0x78,0x1e,0xd4,0x3a,0x83,0x86,0x3b,0x79,0x14,0x36,0x29,0xec,0x0a,0xfd,0x17,0xfc,0x85,0xbc,0xfd,0x02,0x93,0x2a,0x9f,0xdd,0x4a,0xf0,0x90,0x19,0x40,0x19,0x74,0x7b}},
+{{0x52,0x80,0x72,0x56,0xd5,0xc0,0x0e,0x80,0x7e,0x01,0x69,0x45,0xa9,0x8e,0xd2,0x6a,0x6d,0x49,0xe8,0xd2,0xdc,0xd2,0xd0,0x97,0xc9,0x43,0x1f,0x22,0x56,0x12,0xa0,0x36}},
+{{0xe2,0xa1,0xf0,0x65,0x54,0x0f,0x73,0xd4,0x61,0xbc,0xa9,0x2d,0xb6,0x16,0x97,0xd7,0xbf,0x7d,0x8e,0x2a,0x34,0x1d,0x81,0x4b,0xf2,0x24,0x6f,0xb7,0xfc,0xca,0x4a,0xaa}},
+{{0xd4,0x50,0x2c,0xff,0x31,0xf1,0xd9,0xae,0x62,0xc3,0xb9,0xd2,0x1a,0xe3,0xad,0xb7,0x2d,0xbb,0x6a,0x13,0x72,0x1e,0x9a,0xbb,0x08,0xa3,0xd1,0xd6,0xd4,0xa1,0x24,0xf7}},
+{{0x7e,0x63,0x09,0xcb,0x1e,0x7a,0xc1,0x9d,0x7e,0x4e,0x1c,0x84,0xd7,0x52,0x30,0x7b,0x60,0xfd,0xc1,0x5a,0x43,0x4b,0x56,0xf9,0xe4,0x2d,0x45,0x23,0xbe,0x92,0xf9,0x97}},
+{{0xb3,0x51,0x12,0x2b,0x57,0xaa,0xd8,0xf1,0x24,0x1f,0x64,0x40,0x79,0xdf,0x39,0x5a,0xac,0x2f,0xee,0x0c,0x0b,0x17,0x37,0xf8,0x1f,0x8d,0x20,0x8f,0x6f,0x09,0x3f,0x0e}},
+{{0x97,0x8a,0xa5,0x37,0x34,0x5a,0x7c,0x71,0xf6,0x11,0x28,0xa7,0xea,0x48,0xb3,0x80,0x9b,0x21,0xb2,0x2f,0x59,0x0d,0x1b,0xf1,0xe5,0x5e,0x20,0x94,0x90,0x55,0xe3,0x57}},
+{{0x31,0xe3,0x91,0x20,0x4f,0x0a,0x31,0x55,0xa6,0x86,0x55,0xf6,0x2a,0xf5,0x52,0xf9,0x55,0x23,0xb0,0x85,0xb3,0x2f,0x18,0x41,0x03,0xe6,0xae,0x2e,0x00,0x33,0x44,0xf5}},
+{{0x59,0xe1,0x7a,0x4e,0x9c,0xdc,0x97,0x77,0x77,0x89,0x35,0x2a,0xdf,0x50,0xbf,0x75,0x8f,0xfb,0xf1,0xf7,0x38,0x0c,0x72,0xcd,0x25,0xde,0x05,0x66,0xc3,0xc5,0xce,0x92}},
+{{0x61,0xf8,0x10,0x10,0x59,0xc2,0xe5,0x91,0xcb,0x49,0x38,0x67,0x01,0x03,0x3f,0x51,0xd0,0x0d,0xa1,0x33,0xd3,0xc0,0xba,0x0b,0x76,0xa7,0x71,0xa5,0x4e,0x84,0xd8,0x25}},
+{{0xb1,0x82,0xc5,0xb6,0x6f,0xae,0xaf,0x90,0xf7,0x41,0x4f,0x19,0x61,0xc6,0x23,0xdb,0x2a,0x0d,0x9a,0x22,0x3b,0x09,0x1d,0x85,0xe1,0x68,0x20,0xa9,0x7f,0x3c,0x87,0x65}},
+{{0xb5,0x7f,0xfd,0xd7,0xf8,0xc1,0x67,0xee,0xc3,0x89,0x96,0xbc,0x7c,0x02,0x64,0xc1,0x1f,0xd6,0xfa,0x06,0xcf,0x65,0xe4,0x42,0x66,0x32,0x69,0x97,0xa4,0xb7,0xb3,0x1b}},
+{{0xae,0x44,0x74,0x91,0xaa,0x83,0x2f,0x2a,0xd1,0x7c,0xb5,0x70,0x45,0x86,0x2b,0xcf,0xe8,0x35,0x8b,0x25,0x35,0xf8,0x76,0x6c,0x83,0x9e,0x59,0x21,0x9b,0x91,0xbe,0x56}},
+{{0xa6,0xdf,0xd5,0x5a,0xbc,0x90,0xee,0x5b,0xef,0xc5,0x83,0x9c,0xcf,0x34,0xc3,0x3f,0x83,0x22,0x27,0x24,0x41,0xf6,0xd5,0x39,0x1c,0x7a,0x0c,0x06,0x56,0x76,0x74,0x58}},
+{{0x6d,0xbc,0x13,0x45,0x33,0x5e,0x0b,0x2e,0x4d,0x42,0x60,0x2f,0x19,0xaf,0x51,0xd3,0x49,0xb7,0xe0,0x8a,0x0b,0xa3,0x46,0x7a,0x63,0x91,0xd0,0xc6,0x01,0xa6,0x1f,0xe9}},
+{{0x45,0x1a,0xc3,0x47,0xd4,0xa0,0xb5,0x92,0x83,0x09,0x7d,0x17,0xf6,0xac,0x05,0xc4,0xb8,0xce,0x10,0x61,0x4c,0x70,0x8c,0x9e,0x88,0x04,0xa6,0x80,0x38,0x85,0xe3,0xd3}},
+{{0xb3,0x06,0x42,0x39,0xdf,0x2b,0x0a,0x73,0x5d,0x32,0x43,0xf0,0x36,0x51,0x77,0xc2,0x2d,0xb0,0xed,0x55,0x35,0xcc,0xa1,0xa9,0x5c,0xf8,0x3c,0x73,0x7c,0x8b,0x20,0x07}},
+{{0x91,0xfa,0xef,0xde,0x87,0x4c,0x35,0xf2,0x6a,0x28,0xef,0xf5,0xa3,0x3e,0x6d,0x38,0xc2,0x10,0x27,0x32,0x5c,0xc7,0x9a,0x6d,0x6e,0x11,0xf9,0x70,0xc1,0x80,0xfa,0x9c}},
+{{0xcf,0x32,0xc6,0x56,0xdb,0x8e,0x58,0xe2,0x60,0xd6,0xe8,0xa7,0xbc,0xa4,0x15,0xd0,0x6d,0xf2,0xd7,0x49,0xdb,0xf3,0xea,0xdb,0xee,0xe3,0x88,0x07,0xb4,0xcb,0x1d,0xc7}},
+{{0xd1,0xd1,0x40,0x46,0x8c,0x31,0x5f,0x1e,0x51,0xf3,0x9b,0x7f,0xf1,0x6d,0x54,0xa6,0xc7,0x9f,0xa0,0x9d,0xcc,0x59,0x99,0x43,0x77,0x0f,0x04,0xb4,0x68,0x01,0xce,0xce}},
+{{0xf7,0x60,0xfe,0x33,0x42,0x2f,0x8f,0x37,0x21,0xe7,0x4a,0xd1,0x81,0x8f,0x0f,0x86,0x4f,0x6a,0xc4,0xa0,0x24,0x7e,0x5f,0xa2,0xd0,0xcb,0x14,0xd6,0x67,0x0c,0xec,0xc9}},
+{{0xe8,0xce,0x50,0x18,0x59,0x34,0x28,0x8d,0x63,0x5d,0x30,0x87,0xc2,0xde,0xbd,0x5e,0x23,0x28,0x2c,0x5b,0xf6,0x70,0x8d,0x3f,0xc5,0x6c,0xe6,0xb4,0x0e,0x19,0x62,0x24}},
+{{0x15,0x94,0x14,0xd5,0x3e,0x7d,0x04,0x55,0xa4,0x3a,0xa1,0x72,0x3f,0x95,0x0a,0x14,0x59,0x25,0xf5,0xf5,0x16,0x4f,0x09,0xc1,0xd4,0x86,0xd1,0x0a,0x94,0x8f,0x86,0x50}},
+{{0x2a,0x78,0x46,0x13,0xd2,0x66,0x2d,0x5d,0xc0,0x09,0x6a,0xbb,0xb8,0xb2,0x83,0xea,0x21,0x13,0x2d,0x8f,0x27,0xd0,0x94,0x86,0xc8,0x15,0x00,0x29,0xa5,0x77,0x3a,0x64}},
+{{0x68,0x4b,0xca,0xee,0x2f,0x3f,0xe1,0x8f,0x86,0xe0,0x39,0x9b,0x6f,0x3c,0xc5,0xba,0x87,0x4c,0xe2,0x47,0x32,0x36,0x29,0xc1,0x53,0xc4,0x14,0xdf,0xfa,0xbe,0x01,0x05}},
+{{0x95,0x44,0xd2,0xba,0xf8,0xb3,0x97,0x07,0x39,0x78,0x2a,0xa7,0x61,0xe5,0x84,0xdb,0x3e,0x25,0x80,0xdf,0x2e,0x57,0x08,0xe4,0x0d,0xcf,0x61,0xc5,0x5a,0x35,0x1a,0x56}},
+{{0xb2,0xfb,0x41,0x8f,0xd3,0xb4,0xbd,0xc2,0x1f,0xe7,0xaa,0x03,0xfc,0xaa,0x49,0xcb,0xb0,0x67,0xe2,0xeb,0x63,0xc0,0x67,0x0c,0x63,0xbc,0x46,0xca,0x54,0xfe,0x5b,0x36}},
+{{0x2e,0xb5,0xa1,0x40,0x2f,0xd3,0x5d,0xa9,0xcb,0x3b,0x06,0xe6,0x82,0xd3,0x6c,0x2b,0xaf,0xd1,0xb7,0xb6,0x67,0xb5,0x89,0xb2,0x16,0x9f,0xd3,0x95,0xc0,0xb6,0x52,0xed}},
+{{0xa1,0x67,0x24,0x55,0x02,0xd9,0x31,0xad,0xc2,0x7f,0xbd,0x00,0x13,0x32,0x94,0x06,0x9e,0x04,0x1b,0x7a,0x93,0xd3,0xcf,0xba,0x42,0xfc,0xaa,0xf7,0x02,0x74,0x69,0x8f}},
+{{0x3d,0x52,0xbd,0xdc,0xdc,0xca,0xb7,0xf0,0x47,0x26,0x2b,0xcf,0xf0,0xc1,0xec,0x7e,0x34,0x36,0x7b,0x2a,0xa7,0x1f,0x16,0xcd,0x53,0xcf,0x72,0xc8,0x30,0xa0,0x0b,0x7d}},
+{{0xfd,0xc9,0x7d,0x53,0x55,0x48,0xea,0x05,0x92,0x46,0x69,0x2b,0xd1,0x1f,0x39,0xc1,0x6d,0x7c,0xc6,0x2d,0x58,0xf9,0xa8,0xbb,0xd8,0x04,0x0c,0x47,0x98,0xaf,0xc4,0xcd}},
+{{0xc7,0xfd,0x25,0xde,0x01,0x86,0x03,0x5f,0xdb,0x6b,0x2b,0x15,0x43,0x7a,0xac,0x39,0xbf,0x80,0x61,0xbb,0x23,0xa3,0x70,0x03,0xca,0xe6,0xc6,0xdb,0xa2,0xc1,0x6a,0x06}},
+{{0xc4,0x6d,0xfe,0xde,0xc2,0xd4,0x77,0xfc,0x64,0xd5,0xe7,0x49,0x8e,0x3e,0xd4,0xa6,0xd8,0x4a,0xd4,0x35,0xaf,0x01,0xf3,0xb8,0xc0,0xec,0x34,0xb1,0x50,0x21,0x66,0xe2}},
+{{0x66,0x89,0x9c,0x7f,0x0b,0x2b,0x86,0xc2,0x29,0xef,0xd1,0xd5,0xe9,0x7e,0xec,0xde,0x24,0xa2,0x3c,0x40,0x5f,0xd9,0xff,0x1d,0xc8,0x51,0xb4,0xcb,0xb5,0x66,0xfa,0x16}},
+{{0x5f,0x74,0xf9,0x7b,0xcf,0xf2,0x37,0x23,0xc6,0x1d,0x4a,0xb8,0x93,0xf6,0x55,0xf0,0xf8,0x95,0x85,0x7f,0xf5,0x8f,0x69,0x70,0x58,0x93,0xce,0x1c,0x05,0xe7,0xf2,0xae}},
+{{0x28,0xc0,0xb7,0x88,0xa6,0x1d,0xe2,0xb9,0x91,0x9e,0x05,0xb3,0x5a,0x98,0x12,0x77,0x31,0xab,0xb1,0xc3,0x4d,0x62,0x8a,0x05,0x7b,0xa8,0xd3,0x25,0xaf,0xe0,0xb8,0x40}},
+{{0x9e,0x01,0x25,0x5b,0xdb,0x91,0x50,0xa5,0x29,0x97,0x76,0x5d,0xf2,0xc6,0xe4,0x60,0xaa,0xe8,0x9e,0x4e,0x6e,0x3a,0x26,0x16,0x26,0x97,0x6f,0x34,0x63,0x51,0xf5,0x06}},
+{{0x62,0x9f,0x73,0x3b,0x19,0x5d,0xd6,0x8c,0x32,0xfb,0x10,0x19,0x5c,0xab,0xe4,0xb1,0x63,0x4d,0x5c,0x10,0x2b,0xf3,0xc0,0xe3,0x4c,0xf8,0xe9,0x3b,0xbd,0xb6,0x35,0xf8}},
+{{0xb6,0xb4,0x16,0x2d,0x8d,0x6f,0x87,0xe5,0x81,0x29,0x80,0x40,0xc2,0x2f,0x2b,0xa5,0x07,0x0d,0x8f,0xea,0xd5,0x06,0x6e,0x75,0x50,0xd3,0x81,0xb0,0x49,0x0f,0xf1,0xec}},
+{{0x63,0xd9,0xd1,0x4c,0x2c,0x85,0xc1,0x21,0x89,0x42,0x16,0xf6,0xb6,0x0f,0xf7,0xbd,0x7f,0xcc,0xf9,0x01,0x79,0x1c,0x29,0x9b,0x5b,0x5f,0x09,0x89,0xf3,0xe5,0x63,0x64}},
+{{0x6d,0x45,0x62,0x96,0x3a,0x56,0xc0,0x57,0xdd,0x96,0xda,0x1d,0x13,0x35,0x4d,0xc5,0x1f,0xfc,0xb0,0xe6,0x56,0xd6,0x24,0x78,0x15,0x25,0x74,0xc2,0x51,0xac,0x96,0x9d}},
+{{0x55,0xfd,0x58,0xd2,0xbd,0x2f,0x93,0x20,0x6d,0x49,0x45,0xfc,0x8c,0x55,0x53,0x35,0x72,0x6c,0x26,0xf9,0xc2,0x3c,0x45,0x30,0x72,0x83,0x52,0xe2,0x27,0xf2,0x58,0xdc}},
+{{0x03,0x3c,0x6b,0xea,0x76,0xf0,0x61,0x31,0xe7,0xee,0x64,0xe7,0x69,0x3c,0x59,0x13,0x80,0xc7,0x39,0x2a,0x28,0x00,0x66,0x2f,0x32,0xa7,0x13,0x85,0xea,0x73,0x98,0x53}},
+{{0x7e,0xbf,0x3a,0x61,0x9d,0xff,0x22,0xc9,0x48,0x1b,0x0a,0x29,0xb1,0xdb,0x90,0x61,0xf0,0x4e,0x02,0x6d,0x44,0x74,0x71,0xc2,0x81,0xaa,0x21,0x5a,0xc8,0x0b,0xe4,0x5a}},
+{{0xb0,0xb2,0x9e,0x65,0xed,0xb0,0x5e,0xb9,0x41,0xc5,0x2f,0x2f,0x1b,0x45,0x7e,0xfd,0xd2,0x51,0x2c,0x7c,0x3d,0x19,0xc9,0xc1,0x52,0x48,0xc7,0x36,0x88,0xce,0x27,0x46}},
+{{0x47,0xfb,0xd5,0x9f,0x02,0x1a,0x24,0x92,0x52,0x4a,0x32,0xb8,0xc0,0x8b,0xed,0x4a,0xd1,0xe3,0x7f,0xe5,0x10,0x1f,0x2d,0xc6,0xa9,0xc5,0x94,0x5a,0xb2,0x56,0xd4,0x52}},
+{{0xee,0x43,0xc4,0x6d,0x3c,0x12,0xfb,0x38,0x10,0x9e,0x96,0x55,0x60,0x4f,0xa3,0xb4,0x47,0x4f,0x27,0xd1,0xe3,0x91,0xfb,0x0d,0xd4,0xb3,0x72,0xf2,0xae,0x15,0x48,0x9f}},
+{{0xcf,0xfd,0x5c,0xee,0x18,0x26,0x06,0x15,0x30,0x5e,0xa4,0x2d,0xc2,0x54,0x7b,0xc4,0x66,0xf5,0x57,0x5c,0x2c,0x4d,0x81,0xbd,0xc5,0x00,0xd0,0x3c,0x75,0xca,0xd9,0xc7}},
+{{0x5c,0xae,0x11,0x43,0xa4,0xaa,0xbc,0xee,0xa0,0xd4,0xb7,0x0d,0xc9,0x44,0xe5,0x08,0xc2,0xec,0xc6,0x69,0x5c,0xeb,0xd5,0x13,0xd2,0x6d,0xd2,0x93,0x25,0xc5,0x6d,0x5a}},
+{{0x90,0xac,0x9d,0x36,0x9e,0x04,0x41,0x04,0x3e,0x86,0xa5,0x66,0xbb,0xdb,0xc1,0x97,0xa5,0xa2,0x0d,0x33,0xbe,0x12,0xf1,0xac,0x04,0x7f,0xf6,0x68,0xcc,0xcc,0x9e,0xd4}},
+{{0x04,0xf3,0x6e,0xfd,0xf1,0x86,0xf6,0x9f,0x37,0xbf,0x98,0x54,0x56,0x58,0x10,0x79,0x7d,0x94,0x60,0x5f,0x50,0x96,0xed,0xa6,0x14,0x0c,0x94,0xf0,0xbe,0x47,0xa3,0x0e}},
+{{0xb0,0xa2,0x9c,0x6d,0x43,0xe2,0xd4,0x9c,0x2a,0x28,0xf0,0xad,0x3a,0x55,0x5e,0x63,0x5e,0x56,0x2d,0xf2,0x72,0x9b,0x68,0xc4,0x41,0x0a,0x26,0x49,0xad,0xaf,0x22,0xea}},
+{{0x5d,0xed,0xaf,0xf9,0x20,0xb0,0xba,0x36,0x9c,0x4b,0x5c,0xbe,0xd5,0x4d,0xf4,0xde,0x5c,0x8e,0x5a,0x72,0xdf,0x82,0x4e,0x7f,0xba,0x29,0xc2,0xa8,0x63,0x16,0x26,0xdb}},
+{{0x1e,0xc1,0x22,0xfe,0xd2,0x6b,0xe3,0x41,0x00,0x0f,0x5b,0x0d,0xd5,0xce,0x9d,0x18,0x2b,0x8c,0x0d,0xf1,0x42,0xb2,0x3a,0xe4,0x8d,0x91,0x65,0xbc,0xcb,0x57,0xaa,0xe5}},
+{{0x69,0xf4,0x19,0x45,0xae,0x3a,0x6d,0x76,0x0e,0xc6,0xbd,0x51,0x62,0xef,0x9d,0x20,0xd6,0x6f,0x63,0xdd,0xba,0xff,0xe5,0xf4,0x56,0x98,0xd0,0x24,0x28,0x5f,0x58,0xa9}},
+{{0xd3,0xdb,0xf7,0x02,0xbe,0x6b,0x59,0xa6,0x60,0x01,0xfd,0xb7,0xdb,0x88,0x39,0xa2,0xe0,0x66,0x52,0x70,0x50,0x00,0xa2,0x68,0xe5,0x52,0xd0,0x61,0x0f,0x2c,0xee,0x3f}},
+{{0xdd,0xe2,0x47,0x40,0x05,0x7f,0xba,0xfe,0xfd,0xdf,0xb5,0x82,0xbb,0x64,0xf3,0x4c,0x88,0x37,0x9f,0x30,0x81,0xc6,0x04,0x93,0xc0,0xcb,0x8f,0x48,0x36,0x02,0x44,0x4c}},
+{{0x6f,0x08,0x76,0x5e,0x8c,0x7d,0x17,0x5b,0x0a,0x64,0xf8,0x86,0xfe,0xf6,0xbd,0x69,0x48,0x98,0x56,0x42,0xd6,0x4f,0xa3,0x19,0x5d,0x91,0xd4,0x19,0x0b,0xe7,0x1e,0x38}},
+{{0x4e,0x51,0x20,0x7c,0xa5,0x27,0xe1,0x6c,0x98,0x61,0xd1,0xc7,0xc3,0x27,0x10,0x1e,0x0c,0x94,0x15,0x23,0xd9,0x36,0x90,0x58,0x3e,0x66,0x20,0x04,0x46,0x63,0x4b,0x05}},
+{{0x4f,0x00,0x2f,0x22,0xe1,0x44,0x26,0x55,0x3e,0xa2,0x68,0x62,0x7c,0xf7,0xe3,0x18,0x29,0xb7,0x6f,0xa0,0x64,0x12,0x42,0x4d,0x45,0xe0,0x83,0x98,0xe8,0x04,0x30,0x37}},
+{{0x95,0x37,0xb4,0x5b,0xd4,0xac,0xf9,0x04,0x47,0x15,0xba,0x76,0xd7,0xf1,0x1e,0x69,0x07,0x40,0xa5,0xde,0x4b,0x3a,0xe5,0xfe,0x7b,0x9a,0x79,0xbe,0xbe,0x83,0xa2,0xe9}},
+{{0x74,0x6f,0xba,0xfa,0xa5,0x73,0x84,0x77,0x1e,0x71,0xfb,0xa6,0xf4,0xb5,0xb0,0xd0,0x5a,0xae,0xc1,0x7f,0x22,0xba,0x09,0xd0,0xaa,0x7d,0x34,0x96,0x2a,0xae,0x0d,0xd4}},
+{{0xd4,0x68,0x65,0x89,0x0c,0xa6,0xd2,0x50,0xb2,0x23,0x44,0x01,0xce,0xd0,0xf8,0x57,0x35,0x68,0xe0,0xc7,0xcd,0xd1,0x26,0x32,0x41,0x7d,0xaf,0xdb,0x26,0xee,0x96,0x05}},
+{{0x39,0x3e,0x3d,0x16,0xb7,0xb9,0xc0,0x8d,0x69,0xc4,0x78,0xac,0xd5,0xe5,0x19,0x69,0x68,0x66,0xf7,0x4b,0x04,0xb7,0x63,0xcd,0xd6,0x39,0xcd,0x76,0x60,0xc1,0x62,0x0d}},
+{{0x11,0x35,0x4f,0xaa,0x9b,0xe7,0x8a,0x08,0xb4,0xc6,0x92,0x2b,0x95,0x94,0x8e,0x0f,0x02,0xb3,0xea,0x40,0xf3,0x4d,0xaf,0xc8,0x22,0xb2,0x16,0x18,0x71,0xbb,0x94,0xf8}},
+{{0xdb,0xd7,0x2d,0x40,0x17,0xd0,0x5e,0x42,0x54,0x9a,0xef,0xa4,0x59,0x46,0xfc,0xab,0x78,0x17,0x24,0x6d,0x6f,0xd0,0x0f,0x3e,0x3c,0xdb,0x39,0xef,0xf4,0xca,0x49,0x9f}},
+{{0x16,0x48,0xa1,0xfc,0x62,0x90,0x51,0xf0,0x84,0xe4,0x11,0x47,0x8a,0x3d,0xb5,0x76,0xd1,0x3f,0x88,0x3e,0x5c,0x6d,0xd7,0xdc,0xdd,0x57,0xe7,0x88,0x75,0xa2,0x2b,0xf1}},
+{{0x3b,0x8a,0x96,0x20,0x82,0xe7,0xe6,0x01,0x0f,0x85,0xed,0x26,0x74,0xe6,0x6b,0xa9,0xef,0x89,0x98,0x8d,0xdf,0xe7,0x14,0x62,0xf8,0xf4,0xf1,0xd2,0xc7,0xb5,0x26,0xe8}},
+{{0x73,0xfb,0xee,0x04,0x71,0xdd,0xef,0x01,0x2f,0x65,0xe9,0x92,0xfe,0x76,0xcd,0x04,0x45,0x69,0x42,0xb2,0x1d,0x1f,0x52,0xec,0xb6,0xa9,0xcd,0x69,0x71,0xd7,0x2e,0x15}},
+{{0xb6,0x09,0x68,0xa8,0x4e,0x49,0xca,0x18,0xbb,0x5b,0x7c,0xbb,0xda,0x8b,0xb9,0x02,0xb8,0xc9,0x8b,0xbc,0x26,0xee,0xa6,0xad,0xdc,0x4b,0x89,0x1c,0xbc,0x83,0xad,0x4a}},
+{{0xa1,0xfc,0x66,0x44,0xa2,0x5a,0x34,0xf0,0x38,0x5b,0xa4,0x6a,0x37,0xa4,0x9a,0x42,0xc7,0x2d,0x64,0xe5,0x93,0x5c,0x1e,0x4b,0x49,0x6c,0x43,0xc6,0x1d,0x2a,0xc0,0xfa}},
+{{0xd8,0x21,0xd6,0xd1,0x80,0xf5,0xec,0xc6,0x9b,0xda,0xc0,0xce,0xe9,0xbf,0xf9,0x75,0xc3,0x6e,0xf0,0x29,0xd8,0x95,0x3a,0x9c,0x5d,0x72,0x0e,0x2f,0xae,0x9d,0x67,0x6d}},
+{{0x38,0x2d,0x5b,0xe7,0x1c,0xd9,0x2b,0xc7,0x15,0xc5,0x46,0xa1,0x42,0x4a,0xd1,0xa9,0x39,0x57,0x3f,0x3b,0xac,0xf4,0x64,0x41,0xda,0x80,0xf3,0xa0,0xcb,0x8a,0xdb,0xd8}},
+{{0xad,0x0a,0xdb,0x7e,0x55,0xfc,0xb2,0xce,0x15,0x18,0xfb,0x5e,0xfa,0x3d,0x41,0xba,0xe3,0xf4,0x0a,0xbd,0xe3,0x8c,0xa5,0xb7,0x02,0xfe,0xde,0x5d,0xe1,0xdc,0x0f,0x83}},
+{{0x08,0x50,0xf4,0x3b,0x1a,0x8c,0x7c,0xe0,0x4b,0xb4,0x59,0xa4,0xf4,0x48,0x2d,0xa4,0x3b,0x50,0x5f,0x9f,0x8c,0xa2,0x43,0x83,0x20,0xd0,0xdd,0xa6,0x48,0x64,0xae,0x08}},
+{{0x06,0x93,0x71,0xa6,0xa9,0x61,0xd1,0x0a,0x7f,0x41,0x5a,0x71,0x67,0x41,0x7c,0x09,0x6c,0x50,0xb1,0xc7,0xac,0x29,0x3b,0x09,0x23,0xe5,0xb2,0x1a,0x70,0x2b,0x8b,0x77}},
+{{0xbf,0x4e,0x2c,0x4e,0xea,0xbd,0xbc,0x63,0x67,0x57,0x7f,0xb0,0xa2,0x0d,0xc3,0xd9,0x60,0xe3,0x74,0xf5,0x74,0x1a,0x52,0x20,0x3f,0x66,0x32,0x70,0xaf,0xd0,0xb6,0xee}},
+{{0x55,0x24,0x3a,0x2d,0x68,0x8a,0xe3,0x84,0x1f,0x39,0x56,0x27,0xa3,0x4f,0x4b,0x5a,0x19,0x6f,0x03,0x50,0x85,0x32,0x59,0xfd,0x6b,0xd4,0x86,0x03,0x4b,0x68,0x0d,0xce}},
+{{0x85,0xf3,0xc4,0x4f,0x1a,0x83,0x1b,0x6a,0x27,0xfc,0x18,0x90,0x21,0x52,0x10,0x5d,0xcf,0xf2,0x23,0xa3,0xa6,0xda,0x3e,0xa5,0x98,0x4c,0x82,0x4c,0x66,0x89,0x74,0x24}},
+{{0x82,0xca,0xe4,0xa6,0x95,0x42,0xab,0x12,0x0b,0xe5,0x1e,0x69,0x1c,0x78,0x01,0xab,0x5b,0x24,0xe8,0xc3,0xa7,0xad,0x8c,0xed,0x5e,0x6f,0xcb,0xb1,0x4c,0xea,0x5a,0xbc}},
+{{0xdb,0x03,0xd9,0xb4,0x1a,0x22,0xc5,0x84,0xff,0x7f,0x81,0x11,0x6e,0x5e,0x11,0xa4,0x78,0x40,0xcf,0xeb,0x77,0x23,0xe1,0xf1,0xac,0x7e,0xa1,0x24,0x4f,0x9d,0x56,0xc6}},
+{{0x63,0x47,0x0b,0x45,0x1e,0xc3,0x52,0x03,0x0b,0xa0,0xbd,0xaf,0x16,0xc0,0xb4,0xb1,0x8e,0xbe,0x1a,0x6a,0xdc,0x3b,0x73,0xba,0xf9,0x85,0xfe,0x92,0x46,0x7e,0x86,0x52}},
+{{0x2c,0x0e,0xaf,0xfe,0x4c,0x3f,0xe6,0x37,0x63,0x41,0x92,0x5e,0x45,0x48,0x13,0x98,0x4c,0x2e,0x11,0x0c,0x66,0x15,0xaa,0x7a,0xb6,0xc2,0x73,0x95,0x04,0x8a,0xd2,0xc0}},
+{{0x7a,0x76,0xa9,0x14,0x5e,0x0e,0x36,0x5a,0x90,0x13,0x92,0xe1,0xdf,0x84,0x14,0xdf,0xe8,0x52,0x2f,0xf4,0x98,0x18,0x86,0x2d,0xf1,0x10,0x40,0x99,0x06,0x1e,0x48,0x28}},
+{{0x71,0xe0,0xdc,0x11,0xeb,0xa1,0x27,0xe9,0xe6,0xc0,0x7b,0x32,0xb5,0x6d,0x7d,0x61,0xfe,0x13,0x8e,0x33,0x59,0x81,0x0d,0xb9,0xea,0xfa,0x64,0xf6,0x7c,0xc9,0xea,0x87}},
+{{0xea,0x96,0x33,0x13,0x17,0xaf,0xcd,0x68,0x6d,0x02,0xb2,0x46,0x27,0x6c,0x24,0xc4,0xb8,0xca,0x02,0xd2,0x53,0x07,0x90,0xfa,0x1f,0x43,0xfe,0xa7,0x84,0xbf,0xda,0xd4}},
+{{0x27,0x46,0xe0,0x7e,0x04,0xda,0x75,0x36,0xce,0xef,0x3c,0x2a,0x69,0x5b,0xef,0x7e,0x3f,0xdb,0x29,0x25,0x27,0xbb,0x3f,0x19,0x0c,0x6d,0x74,0x4e,0xdf,0x6e,0x69,0x97}},
+{{0xaa,0x26,0xee,0x30,0x3e,0xaa,0x5c,0xeb,0x8a,0xd5,0x9b,0x20,0x17,0x52,0x82,0x6e,0x80,0x15,0xc0,0x88,0x31,0x58,0xfb,0xb3,0xbe,0xac,0xab,0x8b,0xd9,0x36,0x18,0xa7}},
+{{0x68,0x42,0xff,0x39,0x12,0xf8,0x6d,0x61,0x4b,0x42,0xce,0x80,0xbc,0xc3,0x32,0xe7,0x76,0x9f,0x8d,0xb7,0xed,0x84,0xdf,0x09,0xd5,0xfe,0x78,0x24,0x05,0x72,0x54,0x1b}},
+{{0x94,0x85,0x80,0x45,0x15,0x70,0x47,0x2e,0xa1,0x2f,0x6c,0xa1,0x52,0x10,0xde,0x50,0x75,0xaa,0xd8,0x55,0xa2,0x7b,0x87,0xf8,0x95,0x27,0x72,0xfe,0x23,0x17,0x31,0x35}},
+{{0x26,0xe8,0x97,0x99,0xbd,0xa4,0x50,0xea,0xb0,0x78,0xbc,0x17,0x34,0x12,0x68,0xae,0x8c,0xc8,0x78,0x1d,0x62,0x64,0xe3,0x4a,0xca,0x04,0x8f,0x1b,0xf0,0xf8,0xcb,0x24}},
+{{0x97,0x80,0x7a,0xb2,0xee,0x41,0x7f,0x90,0x41,0x72,0x2b,0xf5,0xe4,0x16,0xf1,0xfa,0x9e,0xf0,0x4f,0x19,0x3e,0xdf,0x8c,0x5d,0xb5,0x0b,0x08,0x5d,0xc2,0x4e,0x1c,0xd7}},
+{{0x3d,0xcf,0x46,0x63,0x04,0x7d,0x5b,0xd5,0xbc,0xae,0x92,0x16,0xb2,0x41,0xc5,0x8c,0x37,0x1b,0x02,0x92,0xb4,0xbc,0x19,0x62,0x30,0x41,0x77,0x91,0xf4,0x68,0x14,0x05}},
+{{0x14,0xc7,0xc0,0xc2,0x8e,0xe6,0x17,0xa1,0x8b,0x78,0x9f,0x30,0xf0,0x4d,0x2f,0x4a,0x16,0x61,0xcf,0x06,0xfc,0x5a,0x9d,0xbf,0x2b,0x89,0x5b,0xa9,0x59,0x42,0xb1,0x79}},
+{{0x5a,0x5e,0x24,0x33,0x8d,0xe5,0x34,0xd2,0x1a,0x85,0x6e,0x34,0x71,0x18,0x0a,0x05,0xe0,0x12,0xa1,0x3f,0xef,0xd4,0xb4,0xfb,0x10,0xd0,0x62,0xc8,0x86,0x33,0xeb,0x91}},
+{{0x23,0xc1,0x7b,0xcc,0x17,0x46,0x86,0x1b,0xba,0xce,0xfe,0x6a,0xd7,0x1b,0x86,0x40,0xa6,0x8a,0xd8,0xb0,0x70,0x67,0xcf,0x67,0xff,0x5d,0xcc,0x70,0x2e,0x0e,0x1d,0x73}},
+{{0x55,0x03,0x86,0xa9,0xf7,0xed,0xaf,0xc3,0xe9,0x91,0xd5,0x3e,0x5e,0x61,0xa5,0x8b,0x1d,0x9c,0x28,0xcc,0xae,0xbd,0x08,0x51,0x92,0xd6,0xba,0x6b,0x29,0x23,0x52,0x03}},
+{{0x46,0x87,0x2e,0xb8,0x78,0x1f,0x86,0x5b,0xb2,0x59,0x01,0x92,0xb3,0x1d,0x34,0xa2,0x26,0xf0,0xcc,0xf3,0xc5,0x08,0x26,0xbd,0xbb,0x45,0x37,0xc0,0x5e,0x20,0x66,0x04}},
+{{0x00,0x3a,0x19,0xde,0xc2,0x6e,0x0a,0xd4,0xe8,0x70,0xb3,0x14,0x10,0x53,0xa2,0x98,0x92,0xb4,0xe6,0xf9,0x9e,0x3b,0x2d,0x5d,0x15,0x2c,0x17,0x7a,0x3c,0x3c,0x5e,0xcc}},
+{{0x0d,0xa2,0xc0,0xb0,0x1f,0xce,0x86,0x6a,0x50,0x79,0x55,0x7c,0x47,0x29,0x78,0xa1,0x64,0x69,0xdd,0x23,0x6d,0x28,0x85,0xf7,0x05,0xeb,0xe6,0x61,0x65,0x35,0x20,0xda}},
+{{0x4e,0xdc,0xb6,0x3a,0x9d,0x05,0xa6,0x4b,0x5f,0x62,0x22,0x3b,0xd3,0x8b,0x5f,0xa7,0xb2,0x9b,0xd4,0x13,0xfa,0xe2,0x90,0xa5,0x80,0x71,0x76,0x3e,0x93,0xbe,0x64,0x91}},
+{{0xd7,0xbe,0xa2,0xee,0x87,0xab,0xc2,0xe6,0xde,0x0f,0x3f,0xd5,0x79,0x6d,0x9d,0x1d,0xc4,0xa2,0x98,0x5c,0xe1,0xcc,0xcd,0xee,0x3a,0x73,0xf7,0x66,0x4c,0x3f,0x78,0xee}},
+{{0x18,0x90,0xb5,0xad,0x17,0x44,0xcb,0x51,0x1c,0x5c,0xab,0x74,0xad,0x9e,0xc9,0x65,0x19,0x17,0xde,0x15,0xbb,0xb2,0x3c,0xe5,0x00,0x4b,0xee,0x0b,0x4e,0x50,0x25,0xad}},
+{{0xec,0x08,0x23,0x90,0xab,0x44,0xb2,0x3e,0xa6,0x56,0x4c,0x16,0x21,0x37,0xe3,0x7e,0xc6,0x24,0x3e,0x6e,0xad,0xa9,0x34,0x0f,0x0b,0xc3,0x0b,0x98,0x97,0x3b,0x20,0x3c}},
+{{0x75,0x4d,0xe6,0xec,0x34,0xbc,0xd3,0x68,0xeb,0xcf,0x26,0x30,0xf1,0xd2,0xa4,0x72,0x8c,0x65,0xe8,0x3a,0xae,0x8d,0x62,0xa8,0xa9,0x09,0x6a,0x4d,0x6f,0xcd,0x35,0x2f}},
+{{0x9f,0xe7,0x81,0x14,0xce,0x60,0x1c,0x13,0xa3,0x21,0xf8,0x89,0x66,0x41,0x4b,0x94,0xce,0x9b,0x60,0x1c,0x0c,0xdf,0x88,0xd4,0x12,0x1b,0x3c,0xd4,0x87,0x42,0xcb,0x98}},
+{{0xd4,0x17,0xd3,0x81,0x68,0x08,0xd9,0x5d,0x09,0x59,0xe4,0xce,0x47,0x26,0xa8,0x35,0x99,0x28,0x0d,0x7c,0xd6,0x11,0xa0,0x0e,0x0f,0x7e,0x3b,0xeb,0x48,0x8f,0x36,0x80}},
+{{0xf4,0x59,0x3a,0x8f,0x50,0x67,0xb8,0x3f,0xd6,0x58,0x74,0x8b,0x32,0x5c,0x14,0x8a,0x52,0xfd,0x46,0xb8,0x41,0x77,0x4a,0x35,0x25,0x09,0xdf,0x14,0xd9,0x87,0x88,0x78}},
+{{0x89,0xd8,0x84,0xa0,0x1e,0xd8,0x59,0x3c,0x58,0xd3,0xf2,0x3d,0x77,0x7e,0x77,0x2d,0x87,0xcc,0x9f,0x57,0xb4,0x32,0xcf,0x89,0x93,0x09,0xcd,0x96,0xe8,0x91,0x18,0x38}},
+{{0x66,0xa4,0x91,0x0d,0xdc,0xce,0x3e,0x69,0x04,0x97,0x12,0x18,0x28,0x33,0x40,0x0e,0xba,0xf6,0x8e,0x0b,0xa2,0x83,0xb5,0x48,0xca,0x45,0x28,0xf3,0x83,0xfc,0xcc,0x59}},
+{{0xf8,0xa4,0x26,0x41,0x61,0x3a,0x2c,0x8c,0xcc,0x2c,0xc1,0xcc,0x74,0x82,0xbd,0x79,0x89,0x17,0x14,0xec,0xbe,0xaa,0x6a,0x6d,0x71,0x6a,0x2a,0x81,0xaf,0x61,0x60,0xf7}},
+{{0x7a,0xcc,0x0b,0x25,0xf4,0x0f,0x47,0xd8,0xe0,0xc3,0x44,0x64,0x53,0x04,0xa2,0xf0,0xe8,0x4a,0x7c,0x45,0xa6,0x34,0xad,0x09,0x61,0x9a,0x77,0x7e,0xbf,0x2d,0x58,0x44}},
+{{0xdc,0xb2,0xa0,0x5e,0x10,0x85,0x78,0xcd,0xbf,0x98,0xc6,0x38,0x34,0x48,0x6a,0xd9,0x20,0x79,0x0d,0xc6,0xd5,0x6e,0x9c,0x63,0xff,0x51,0xdf,0x47,0x85,0xb2,0x98,0x1d}},
+{{0x25,0xf3,0x03,0x4b,0x65,0x7e,0xbd,0xe1,0x4e,0xc5,0x03,0xf1,0xae,0x1c,0xeb,0xe4,0x93,0x23,0x71,0xce,0x6a,0x6e,0xee,0x99,0xb9,0x17,0x1f,0x97,0x0c,0x17,0x9a,0x65}},
+{{0x60,0x79,0x6a,0xeb,0xc7,0x26,0xd3,0x03,0x3b,0x9b,0x68,0x6f,0x52,0x3a,0xb3,0x8e,0x67,0x32,0xa5,0xe9,0x8f,0xc3,0xd0,0x75,0xd0,0xce,0xe4,0x5e,0x63,0x46,0x5a,0x81}},
+{{0x5e,0xfc,0x16,0x0b,0x9d,0xd9,0x63,0xcb,0xd4,0x26,0x4d,0x3c,0xa6,0x23,0x3f,0xfb,0xf6,0xfc,0x5c,0x36,0x53,0x6d,0x84,0xe7,0x7c,0x1a,0x1c,0x02,0x20,0xf0,0x72,0x5a}},
+{{0x6b,0x8d,0x17,0xe3,0x6a,0x85,0xa4,0x99,0x74,0x83,0xd3,0x1d,0xb7,0x66,0xa1,0x0d,0x1c,0x70,0xd1,0x98,0xb9,0x19,0xda,0xd0,0x05,0xe1,0xc1,0x3d,0xf6,0x26,0x94,0xad}},
+{{0x71,0xb9,0x01,0xf3,0x61,0x4b,0xd1,0x87,0xa1,0xd5,0x7b,0x69,0x76,0x6e,0x90,0xea,0x69,0xf1,0x53,0x2b,0x0f,0xeb,0x47,0x63,0xcf,0xb4,0xd3,0xda,0xa3,0xb2,0xe5,0x30}},
+{{0xbb,0x49,0x9c,0xcd,0xfd,0x1a,0x87,0x94,0x9a,0x82,0xed,0x65,0xfd,0xb5,0xb8,0x6b,0x99,0x63,0xb3,0xb7,0xb8,0x19,0x42,0xa7,0x33,0x83,0x2a,0x4f,0x5d,0xac,0xdd,0x61}},
+{{0x4c,0x42,0x21,0xb4,0x5e,0x70,0xfe,0x66,0x77,0xad,0x9b,0x76,0x24,0x98,0x63,0x44,0xad,0x9d,0x71,0x4e,0xc5,0x2f,0x39,0x94,0xa4,0x26,0xc8,0xf1,0x72,0x45,0xc3,0xe1}},
+{{0xe4,0x2b,0xb3,0xd7,0x46,0x5f,0x9a,0x35,0x29,0x80,0x1a,0x5c,0xdb,0x05,0x40,0xa1,0x2c,0xf9,0xf3,0x59,0x9a,0xd8,0x3d,0xab,0xd4,0x96,0x24,0x42,0xec,0x4b,0xc4,0x5b}},
+{{0x08,0x2a,0x30,0x35,0xd7,0x72,0x15,0xaf,0xd0,0x81,0x89,0x56,0x58,0x22,0x21,0x37,0xff,0xd6,0xcb,0x29,0x1a,0x64,0x5b,0x22,0x3e,0x19,0xf9,0xf5,0xf4,0x1c,0x66,0x1a}},
+{{0x30,0xe2,0x3a,0xf8,0xd1,0x2c,0xb7,0x79,0x57,0xe6,0x1f,0xe7,0xe9,0x6e,0x33,0x79,0xbd,0x60,0x83,0x61,0x83,0x68,0x19,0xdc,0x9f,0xfc,0x6d,0xf0,0xd0,0x20,0xd7,0xcc}},
+{{0x32,0xba,0x11,0x6e,0x2d,0xd0,0x21,0xec,0xdf,0x5a,0xae,0xdd,0x31,0x2b,0x1d,0xd2,0x36,0xe2,0xb8,0x28,0xca,0xf1,0x64,0xa2,0xe5,0x85,0xc0,0xf7,0x4c,0xe8,0x08,0x1e}},
+{{0x97,0x91,0xf4,0x30,0x58,0x60,0x6d,0x32,0x24,0x0a,0xe2,0xf3,0x63,0x76,0x20,0xf5,0x96,0x9b,0x0b,0x67,0x91,0x4e,0x68,0xc8,0x05,0x13,0xf4,0x89,0xb3,0xaa,0x1e,0xf8}},
+{{0x55,0xf9,0x55,0x0c,0x10,0x1c,0x46,0x2b,0x1b,0x89,0x43,0x4a,0xc4,0x5f,0xa5,0x6d,0x07,0x68,0x2f,0xd0,0x5f,0x01,0xca,0x7c,0xd5,0xb5,0xde,0x2c,0x9f,0xaf,0xfb,0xbc}},
+{{0x11,0xb9,0x4a,0x39,0x02,0xfa,0x3b,0xd0,0x02,0xfd,0x24,0x55,0x45,0x16,0x91,0xcb,0x85,0x85,0xb7,0xb0,0x72,0x94,0xd7,0xe2,0xc7,0xac,0xda,0x57,0xd1,0x1b,0x63,0x53}},
+{{0x46,0xdc,0x1a,0xa5,0x7a,0x0a,0x23,0x36,0x7d,0x2e,0x54,0x99,0x0a,0x35,0x6b,0x3d,0x21,0x4c,0xcc,0x58,0xfb,0x35,0xf2,0x0b,0x61,0x69,0x8e,0xaf,0x87,0xbe,0xc4,0xda}},
+{{0xe5,0x29,0xec,0x96,0x58,0xe0,0xb1,0x45,0x2d,0xc8,0x05,0x48,0xa4,0x86,0x14,0x77,0xa8,0x50,0x76,0x21,0xc4,0xeb,0xef,0x05,0x59,0xe3,0x5b,0x92,0x8d,0x09,0x4b,0x47}},
+{{0x1d,0x02,0x5c,0x4a,0xca,0xcf,0xe5,0x96,0xdb,0xac,0xba,0x26,0x49,0x63,0xdb,0x48,0x5f,0x66,0x9e,0x9e,0x23,0x40,0x14,0x0f,0x41,0x5f,0xb8,0x32,0xb6,0x0e,0x33,0xe6}},
+{{0x7e,0xcc,0x44,0x2f,0xe1,0x94,0x40,0x4e,0xed,0xc7,0x2e,0x80,0x7f,0x36,0x02,0x17,0xd8,0xf8,0x21,0x02,0x76,0x83,0x9b,0xfa,0xc3,0xae,0x6e,0x16,0xf2,0x7f,0x48,0xe7}},
+{{0xf7,0x5d,0x43,0x5a,0x6e,0xdf,0x32,0x7c,0x20,0xc9,0x01,0x8c,0xe4,0x37,0xef,0xb1,0x5c,0xd0,0x0e,0x76,0xfc,0x59,0xc3,0x68,0x0b,0x2e,0x7e,0xd4,0x89,0x4a,0x97,0x5e}},
+{{0x25,0x42,0x38,0x34,0x98,0x9c,0x3e,0x56,0x08,0xee,0x78,0x26,0xe8,0xb3,0xb3,0xaa,0x5a,0xa1,0x45,0x66,0xbb,0x27,0xca,0x58,0xcb,0xbd,0x5f,0xd6,0x5b,0x40,0x99,0xaa}},
+{{0x4a,0xf2,0xd6,0xc2,0x54,0x0d,0x5d,0x2a,0xc6,0x93,0x0f,0x7c,0xb9,0x24,0x83,0x9e,0xb1,0xc8,0x96,0x44,0x17,0x43,0x82,0x2e,0xee,0x81,0x91,0xa2,0xd4,0x70,0x75,0xba}},
+{{0xa3,0x24,0xa1,0x2f,0x3d,0x9f,0xf3,0x3c,0xbb,0x45,0x41,0x05,0x6b,0x2a,0xe6,0x1b,0xe9,0xe9,0x28,0x07,0xb1,0xb7,0x3e,0x31,0x97,0x8c,0xda,0x5a,0x62,0xad,0x5f,0x71}},
+{{0xe5,0x4d,0x8d,0xdb,0x5b,0x70,0x5f,0x21,0x6d,0x3c,0x10,0x65,0x97,0x99,0x3d,0x43,0xc2,0x92,0x00,0x2a,0x27,0x41,0x4c,0xc4,0x2c,0x19,0x37,0xa3,0xb3,0xda,0x83,0x9f}},
+{{0x1a,0xde,0xed,0xf0,0x7d,0x9b,0x04,0x91,0x93,0xdd,0x49,0x07,0xc4,0x2b,0x3d,0xa1,0x2d,0xbc,0x77,0x6c,0x55,0x51,0xf1,0xe6,0xe2,0x03,0xc4,0xc4,0x4e,0x05,0x35,0xd5}},
+{{0xaf,0x71,0x30,0x32,0x7d,0xaf,0x2c,0xcd,0xf8,0x24,0x85,0xfb,0xe0,0x56,0xf3,0x29,0xa6,0x1a,0x17,0xa8,0x99,0xf4,0xe4,0x5e,0x58,0x3a,0x47,0xb3,0xc1,0x75,0xf5,0x7c}},
+{{0x6a,0x6b,0xe3,0x74,0xb0,0x0e,0x9e,0x4f,0x73,0x13,0x62,0x6b,0x02,0x60,0x7e,0x96,0x57,0xa3,0x23,0xb6,0x75,0x77,0xb2,0x9b,0xe1,0xac,0x43,0x42,0x54,0x22,0x9f,0x00}},
+{{0x22,0xda,0x78,0x47,0x38,0x22,0x56,0xf8,0x39,0x12,0x5e,0xcc,0x5d,0x02,0xea,0x76,0x8d,0xaf,0x13,0xbd,0x62,0x67,0x55,0x54,0x78,0xba,0x36,0xc3,0xac,0x27,0xa8,0xdf}},
+{{0x82,0x14,0xeb,0x3c,0xdb,0x9a,0xf1,0xaf,0x3b,0xbc,0x20,0x5f,0x26,0xa7,0x87,0x83,0x7b,0x4b,0x48,0x25,0x42,0x91,0x08,0x74,0x8c,0x38,0x44,0x25,0xa0,0x1e,0x06,0x8f}},
+{{0x47,0x8b,0x4b,0x50,0x17,0x26,0x71,0x05,0x4e,0xda,0xe0,0xdf,0x2f,0x3c,0x0b,0xf1,0x67,0xe6,0x0c,0xdc,0xdc,0x8f,0x90,0x5a,0xbc,0xe6,0xa9,0xfe,0xdb,0x8c,0xb6,0x78}},
+{{0xa2,0xd7,0xae,0x67,0xb0,0xd7,0xc6,0xb2,0xd0,0xa2,0x2c,0xd4,0xf7,0xf2,0x65,0x84,0xe2,0x57,0x00,0x5a,0xeb,0x55,0x9b,0x9b,0x64,0x99,0xae,0x14,0xc4,0x3e,0x00,0xd8}},
+{{0xae,0x72,0xe1,0x20,0xc5,0xfc,0x17,0xec,0xc2,0xb7,0x83,0xf4,0x56,0x04,0xac,0xbe,0xc0,0x95,0x7e,0xe8,0x9c,0x35,0x93,0x66,0x08,0xcb,0xe7,0x76,0xae,0x0d,0x39,0xde}},
+{{0x6c,0xd3,0xe8,0x74,0x94,0xb6,0x7e,0x87,0x9d,0x87,0x96,0xd6,0x71,0xa0,0x84,0xa1,0xce,0xcb,0x98,0x0f,0x58,0x1c,0xeb,0x4e,0x7d,0xc2,0x4b,0x81,0x77,0xf6,0xaf,0xb3}},
+{{0xc6,0x66,0x62,0xd8,0xf6,0xa0,0x51,0x39,0x9d,0x35,0x7f,0x22,0xe4,0x20,0x46,0xf2,0x34,0x85,0x5a,0x2c,0x55,0xe2,0xe0,0xc5,0x4c,0x44,0xb8,0x75,0x05,0xec,0xea,0x72}},
+{{0xd6,0xd2,0xa2,0xd9,0x40,0xdb,0xab,0xd8,0x05,0xab,0xbc,0x9d,0x96,0x13,0x28,0xe1,0x82,0xb6,0x47,0x02,0xac,0x3d,0xdc,0xfb,0x5c,0xa2,0x89,0x22,0xcf,0x63,0x0b,0xc7}},
+{{0x44,0xbc,0xda,0x7d,0x39,0x23,0x52,0x45,0xd9,0x33,0x48,0x24,0xf6,0x9f,0x79,0xfc,0x19,0xd7,0x00,0xc9,0x47,0x58,0x9c,0x75,0x1e,0x4d,0x70,0xcf,0x31,0x49,0x3d,0x2f}},
+{{0xa5,0xd9,0xc1,0x36,0xa6,0xd4,0xa2,0x74,0xe0,0x56,0xbe,0xc7,0x0b,0x8a,0x2d,0x70,0xf6,0xc0,0x43,0xd3,0x64,0xf6,0x32,0x4d,0x24,0x56,0xa5,0x1a,0xb3,0x6b,0xe5,0x5a}},
+{{0xee,0x53,0xa2,0x74,0xdd,0xde,0x0e,0x25,0x54,0x90,0x97,0xcc,0x3c,0xd3,0x0e,0xa5,0xb5,0x9a,0xff,0xe7,0xcb,0xf4,0x62,0xd4,0x16,0x76,0x5f,0xa0,0x21,0x0e,0xd9,0xfa}},
+{{0xea,0x9e,0x40,0x14,0x4e,0x84,0xb8,0x3b,0xc8,0x5a,0x9e,0xe0,0x5c,0xe8,0x49,0x69,0xc7,0x7f,0xb6,0x7e,0x39,0x62,0x63,0x1a,0x0a,0x12,0xaf,0x4f,0x05,0x33,0x65,0x13}},
+{{0xc5,0x13,0x9e,0x35,0x00,0x92,0x38,0x51,0xa5,0xfa,0x6e,0xeb,0xa9,0x48,0x40,0x7c,0x90,0x8f,0x5a,0x93,0x8d,0x93,0x50,0x34,0x8a,0x3d,0x94,0x96,0x96,0x03,0x3c,0x73}},
+{{0x17,0xe8,0x37,0xb6,0xb3,0x71,0x8e,0x24,0xf5,0x5b,0xb3,0x28,0xa0,0xa9,0xe6,0x84,0xef,0x2b,0x0e,0xbf,0xce,0xa7,0xdb,0xfd,0x20,0xe9,0x88,0x3c,0xe4,0x9d,0xc0,0xa3}},
+{{0xf6,0x6f,0x5d,0x58,0x51,0x84,0xa4,0xdc,0x9b,0x59,0x8e,0x25,0xdc,0x42,0xf1,0xe6,0x4c,0xcb,0xce,0x48,0x7a,0xda,0x7a,0xb6,0x1d,0xcb,0x73,0x2a,0x35,0x21,0xb4,0xa8}},
+{{0xd6,0x92,0xec,0x57,0x34,0xfb,0xed,0x2a,0x4b,0x37,0x58,0x63,0xfd,0xcc,0x13,0xf7,0x24,0x8a,0xb7,0x60,0x47,0xa0,0x1e,0xee,0x1b,0xe4,0xbc,0x89,0xdd,0x4a,0x92,0x10}},
+{{0x1c,0xee,0x9f,0x59,0x43,0xa5,0xf6,0x83,0x74,0x08,0xd8,0x29,0xeb,0xde,0x2e,0x14,0x6b,0x6e,0xd7,0x6b,0x31,0x2c,0xa7,0x4d,0x0f,0x87,0xc6,0xf8,0x22,0x8b,0x98,0x51}},
+{{0x3d,0xde,0x33,0xb8,0x51,0x04,0xba,0x66,0xcd,0xea,0xf2,0x14,0xc2,0xdd,0x65,0x7b,0xdf,0xd5,0xef,0xe7,0x93,0x37,0x3e,0xa8,0x4a,0x98,0x31,0x97,0xdf,0xb2,0xe6,0x1d}},
+{{0x34,0xda,0xfc,0x44,0xfd,0xa2,0xdd,0x78,0x2b,0xaa,0xfe,0x75,0x4d,0x42,0xc0,0xc6,0xd7,0x25,0xee,0x53,0x4e,0xd8,0xdf,0xaf,0x00,0x4a,0xf5,0x4b,0x38,0xd3,0x13,0xde}},
+{{0x03,0xb3,0xe2,0xa1,0xd2,0x10,0x9e,0x1e,0xcf,0xe0,0xe5,0x7c,0xd4,0xbb,0xb6,0x8e,0xdc,0x01,0x95,0xf4,0x31,0x23,0x1b,0x57,0xe0,0xaa,0x3f,0x66,0x92,0x26,0xaa,0xb2}},
+{{0x70,0xe5,0x16,0x20,0x41,0x25,0xe7,0xad,0xb6,0xb7,0xa7,0xb1,0x34,0x08,0x5e,0x55,0xdb,0x70,0x97,0xb3,0x1f,0xca,0xbc,0x61,0x32,0x23,0x5c,0x7a,0x5c,0x9b,0xef,0x6b}},
+{{0x58,0x21,0x4b,0x57,0xfe,0xe3,0x1a,0x44,0x79,0x8e,0x84,0x05,0x0a,0x7a,0x9f,0x20,0xbe,0xa3,0x2a,0xb1,0x29,0x21,0xcc,0x12,0xb4,0xaf,0xed,0xc7,0x02,0x16,0x5c,0xf2}},
+{{0x5e,0x9c,0x64,0x19,0x7e,0xed,0x20,0x6e,0x37,0xac,0x81,0x86,0x92,0xd2,0x80,0x4a,0x2e,0xec,0x32,0x7a,0xb8,0xde,0xc3,0xc8,0xf6,0xf8,0xd7,0xad,0x18,0x3a,0x18,0x31}},
+{{0xbb,0xd1,0xa9,0xe9,0x5a,0xbb,0xcf,0xb1,0xb5,0x82,0x82,0xfe,0xab,0xaf,0x20,0xbf,0xeb,0x42,0xb3,0xdd,0x23,0x93,0xec,0x98,0x6d,0x38,0x78,0x2a,0xd5,0xe6,0x6a,0x77}},
+{{0x22,0x20,0x9a,0x4f,0x1d,0x75,0xf7,0xef,0x7a,0x18,0xc4,0x63,0x63,0xd7,0xac,0x25,0x62,0xce,0x56,0x3e,0x60,0x61,0xe1,0x66,0x7f,0x01,0xf3,0x53,0xe9,0xca,0x99,0x03}},
+{{0xa1,0x1a,0xe0,0xea,0x4a,0x0c,0xc9,0x2a,0xee,0x5e,0x15,0xf7,0x32,0x59,0xb2,0x1d,0xe8,0xde,0x7a,0x98,0x91,0x48,0x92,0x1c,0x9c,0x0c,0x4a,0x20,0x66,0xd2,0x9e,0x5a}},
+{{0x79,0xbe,0xf2,0x06,0x4b,0x95,0x24,0x52,0x38,0xaf,0xc5,0x3e,0x7a,0xd2,0x8b,0x02,0x8e,0xd5,0x71,0x15,0x35,0xd6,0xb4,0xca,0x49,0xf7,0x21,0x29,0x17,0x02,0x45,0x11}},
+{{0xa9,0x91,0x09,0xd8,0xec,0x71,0x4e,0x29,0x81,0xab,0x28,0x9c,0x04,0x2b,0x39,0xff,0xcd,0xd3,0x20,0x8d,0x50,0xfe,0x27,0x4b,0xfc,0x90,0xcf,0xa2,0xe7,0x16,0xc8,0xc7}},
+{{0x1e,0x5d,0xf5,0x7a,0xe3,0xa0,0x62,0x02,0x90,0x8f,0x8b,0x87,0x56,0x00,0xfd,0x1d,0x1e,0x64,0xcf,0x55,0xd2,0x26,0xdd,0xd0,0x27,0x3b,0x0d,0xa0,0xc1,0xc5,0x39,0xc5}},
+{{0xb9,0x4f,0x83,0xdb,0xf4,0x1e,0x49,0x00,0x88,0x59,0x76,0x68,0xe1,0xe9,0xb5,0xa7,0xe2,0x69,0x2e,0xd3,0x9d,0x6c,0xeb,0xbf,0xe1,0x99,0x1a,0x3b,0xd8,0x37,0x04,0xe2}},
+{{0x67,0x6c,0xeb,0x86,0xde,0x3b,0xe3,0xf9,0xd4,0x47,0x93,0xa2,0xe9,0x16,0xda,0xaa,0x4e,0xf6,0xfb,0x3b,0xb1,0x49,0x8d,0x54,0xec,0x29,0x76,0x89,0xe3,0x35,0xc7,0xa6}},
+{{0x6a,0x60,0x5a,0x38,0xbc,0xc3,0x9a,0xe9,0xe3,0xd2,0x58,0xbe,0x49,0x77,0xe9,0x50,0x1f,0x9b,0x03,0xdc,0xf4,0xea,0x23,0x0e,0xd6,0xf5,0x18,0x7c,0x3b,0xd7,0x48,0x06}},
+{{0xa0,0xbe,0xdf,0x49,0xfa,0xf0,0x9c,0x32,0xd5,0x86,0x96,0x29,0x6f,0x11,0x09,0x0a,0xcc,0x76,0x2d,0x2f,0xc2,0x11,0x77,0xf9,0xe1,0x2f,0x21,0xed,0x6f,0x07,0x10,0x07}},
+{{0xef,0x06,0xa3,0x91,0x7c,0xf3,0x37,0x48,0x0c,0x54,0x22,0x2b,0x90,0x34,0x28,0xf6,0xfe,0xeb,0x09,0x87,0x88,0x00,0x17,0xb8,0xcb,0xc4,0x86,0x4f,0xca,0xef,0x26,0xc5}},
+{{0x5a,0xcf,0x28,0x31,0xe2,0xbd,0xab,0x69,0xa5,0xda,0xc3,0x73,0x81,0x38,0x23,0xec,0x08,0xb5,0xb9,0xf8,0x28,0x1a,0x53,0x16,0x33,0x21,0x25,0x85,0x9a,0xc1,0x6f,0x3d}},
+{{0x5a,0x0f,0x35,0xfa,0xe9,0x89,0xd6,0x6d,0x1e,0x60,0x42,0x72,0xda,0x6f,0x32,0xa6,0x74,0x97,0xd2,0x16,0xc6,0xb2,0x81,0x3b,0x52,0xae,0xa0,0xce,0xa1,0xd1,0x74,0x29}},
+{{0x9d,0xf3,0xe5,0x03,0x5a,0x17,0x8d,0xcf,0xcb,0x85,0x15,0x1b,0x33,0x68,0xc4,0x2d,0x6d,0x64,0xa5,0xd3,0xaa,0xfc,0x9a,0x83,0x83,0x5f,0x12,0xdd,0x13,0x5c,0xca,0xd0}},
+{{0x35,0x4f,0x0c,0xfa,0xe5,0x45,0x8d,0x2d,0x14,0x74,0xc2,0x94,0x65,0xe3,0x17,0xe5,0xfd,0x4f,0x3e,0xdf,0xed,0x6e,0x0e,0x9d,0xa1,0xcf,0x16,0x99,0xf1,0x11,0xfe,0x88}},
+{{0x36,0xb0,0xcf,0xeb,0x08,0x5c,0xe0,0x13,0xaa,0x86,0xc4,0xd9,0x20,0x4d,0x11,0xa3,0x36,0x92,0x66,0x9f,0xe9,0x94,0x09,0x74,0x45,0x31,0x0d,0x8a,0x1b,0x44,0x30,0x15}},
+{{0x43,0xa2,0x49,0xbf,0x73,0x69,0x08,0xa3,0xb4,0xaf,0x08,0x25,0x45,0x6e,0xb8,0x27,0x02,0xf8,0x85,0x1b,0xcd,0x09,0xd3,0xe0,0x0b,0xd6,0x2c,0xa2,0x16,0x52,0xea,0x9c}},
+{{0x83,0xc3,0x34,0x85,0xd3,0xfc,0x9c,0x93,0x3c,0x20,0x65,0xf1,0x7d,0xd1,0x05,0x68,0xa6,0x85,0x34,0x45,0xaa,0xb9,0xfe,0x17,0x19,0x91,0x0f,0xbd,0x02,0x2b,0xd1,0xf4}},
+{{0xb7,0xd9,0xd3,0xa0,0x97,0x58,0x79,0x8d,0xda,0x5b,0xf7,0xc5,0x3a,0x8f,0xee,0x67,0x6c,0x67,0xdf,0x15,0x97,0x93,0x1c,0x01,0xcd,0x01,0x87,0xd2,0xb7,0x2d,0xe2,0x54}},
+{{0x6b,0x03,0x3f,0x73,0xc6,0x91,0xb9,0x4a,0x36,0xb3,0x58,0xc0,0x1c,0xd8,0x63,0x5f,0x3d,0x75,0x3c,0xf1,0xb4,0xbd,0x85,0xd1,0x53,0x50,0x4d,0x50,0x56,0x69,0x8a,0x07}},
+{{0x50,0xf1,0x1c,0x7a,0xff,0x3b,0x73,0x4d,0x6e,0x93,0x5c,0x97,0xe0,0x13,0x17,0xa1,0x42,0x4e,0x39,0x3e,0x55,0x6a,0x97,0x1c,0x40,0xfd,0x25,0x7a,0xc7,0x18,0x98,0x92}},
+{{0xdd,0x93,0x83,0x84,0xc7,0x08,0xbe,0x17,0xd9,0xfd,0x8f,0x8d,0x31,0xf7,0xc7,0x6e,0xba,0x5d,0x1d,0x2a,0x4a,0x37,0x25,0x7f,0xda,0xc5,0x9f,0x9f,0xa9,0x46,0x53,0x35}},
+{{0xbb,0xdc,0xb4,0x72,0x0f,0x1e,0x4a,0xb2,0x9f,0x9a,0x9c,0x59,0xbf,0x68,0x27,0xbb,0xae,0xc6,0x17,0x54,0xf9,0xd2,0x41,0x49,0xfa,0x28,0x85,0xc5,0xc9,0x57,0x45,0x40}},
+{{0x40,0x42,0xbb,0xc3,0x22,0x5f,0x3d,0x25,0xb4,0x4e,0xb7,0x52,0xbc,0xaf,0xee,0x89,0x2a,0x9a,0xfc,0x8f,0xdb,0x49,0x8d,0x41,0x6d,0x09,0xb6,0x89,0x54,0x63,0x50,0x49}},
+{{0x95,0x9c,0x7b,0xfb,0xcc,0xbc,0x6c,0x75,0xef,0xff,0xa8,0x69,0xb3,0x73,0x83,0x06,0xd1,0x73,0xa9,0x28,0x93,0x48,0xc6,0x6d,0x06,0xa0,0x11,0x24,0xed,0x8d,0xe4,0x48}},
+{{0xe7,0x3a,0x73,0x53,0xd0,0x46,0x1f,0x84,0x4b,0x8d,0x65,0x5e,0x5c,0x8b,0xe6,0x43,0x10,0xee,0x5d,0x64,0x6b,0x15,0x4a,0x23,0x28,0x47,0x6e,0xc1,0x09,0xcc,0x3f,0x4f}},
+{{0x27,0xe0,0x4e,0x1e,0x89,0x78,0x32,0x94,0xc7,0x81,0xd7,0x39,0x67,0x83,0xa4,0x64,0x80,0x5c,0xc0,0xc6,0xb1,0x2a,0xe8,0xc8,0x4b,0x60,0xaf,0xd6,0x7a,0x4b,0x12,0x45}},
+{{0x8a,0x73,0x4f,0x27,0xe5,0xff,0xac,0x15,0x29,0x56,0xb5,0x83,0x25,0x79,0x37,0xb3,0x97,0x50,0x17,0x2d,0x23,0x6a,0x0d,0x8a,0xcb,0x7a,0x61,0xf4,0x3b,0xbb,0xea,0x5c}},
+{{0xef,0xbd,0x47,0xc3,0xc2,0xaa,0xfa,0xd3,0x35,0x19,0x37,0x81,0x94,0x9f,0xa0,0x60,0xdc,0x70,0x59,0xfd,0x18,0xc9,0x53,0xff,0x35,0x71,0x5f,0xa5,0xc8,0x32,0x4c,0xd5}},
+{{0x60,0x84,0x73,0xb7,0xcf,0x35,0xa5,0x20,0x6b,0x55,0x83,0x23,0x9b,0x5e,0x6d,0x7d,0x18,0x75,0x56,0xbb,0xc9,0x12,0x41,0xa3,0x5a,0xc0,0x2d,0x06,0xb4,0xae,0xc8,0x84}},
+{{0xb5,0x54,0x00,0xde,0xf5,0x9c,0x10,0x44,0x49,0xb0,0xac,0x89,0x04,0x6d,0x9e,0x25,0xe4,0xee,0x6b,0x3d,0x7f,0x00,0x61,0xcc,0x1b,0xc7,0xce,0x22,0x24,0xcb,0x27,0xfd}},
+{{0xf0,0x38,0x5a,0xbb,0xda,0xf6,0x97,0xcf,0x50,0x3a,0x2d,0x0a,0x4a,0xf9,0xee,0x57,0xd7,0x24,0x0a,0x10,0xb3,0x33,0xf1,0x46,0xf6,0x1b,0xa6,0x2d,0x13,0x5b,0xed,0xb0}},
+{{0x89,0x00,0x2e,0x2a,0x58,0x77,0xcb,0x7b,0xba,0x0c,0xaa,0xf0,0xa3,0x51,0x4c,0x6f,0xfb,0x68,0xd6,0x21,0x52,0x99,0xdf,0x9e,0x11,0x88,0xef,0xcd,0xa6,0x49,0x5d,0xd9}},
+{{0x61,0xf5,0xcc,0x6c,0xf5,0xa3,0x18,0xaf,0x26,0xe4,0xf7,0xee,0x0d,0x86,0x70,0xb4,0xb4,0xa8,0x16,0xde,0xf3,0x37,0xb8,0xa9,0x60,0x77,0xec,0xdc,0x56,0x2b,0x70,0x40}},
+{{0x67,0x7a,0x10,0x94,0xab,0x62,0x31,0xf0,0xd5,0xdf,0xb4,0x72,0xe4,0x96,0xd8,0x51,0x81,0x7d,0x1d,0x57,0x83,0x26,0xd6,0x2c,0x3b,0x4c,0xc4,0x77,0xc4,0x20,0xaf,0x92}},
+{{0xe8,0x72,0xd8,0xb6,0xb1,0x04,0xf7,0x84,0x85,0x34,0xa2,0x50,0x12,0x8d,0xc3,0xba,0x19,0x45,0xe7,0x0f,0x3d,0x02,0x5c,0xae,0xf9,0xc8,0xab,0xa4,0xac,0x76,0xbd,0x17}},
+{{0xf5,0x2c,0x1a,0xd7,0x45,0x91,0x4a,0xa5,0xe5,0x86,0xf6,0xef,0x5d,0xb4,0x91,0x5d,0xef,0x63,0x97,0x99,0xd5,0x8d,0xd6,0xf0,0x64,0xd7,0x2b,0xef,0xa5,0xbc,0xd0,0x35}},
+{{0x38,0x1c,0x99,0xa5,0x65,0x48,0x00,0xe4,0x81,0x39,0xc6,0xea,0x34,0xa7,0x76,0x31,0x47,0x4e,0x20,0x85,0x7b,0x3a,0x80,0x72,0xd7,0x3c,0x72,0x30,0x94,0x07,0xef,0xe3}},
+{{0x63,0xdc,0xd4,0x64,0x62,0x7b,0x9a,0x57,0x26,0xea,0x68,0x9f,0xdd,0x74,0x05,0xd0,0x7f,0xd4,0xb8,0x94,0x03,0xfe,0xa0,0x7b,0x3b,0x62,0x9c,0xaf,0xda,0x22,0x11,0x28}},
+{{0x94,0xcb,0x38,0xc7,0x21,0xfe,0xba,0xa1,0x9b,0x85,0x53,0x13,0xfc,0x75,0x53,0x94,0x02,0x41,0x5e,0xf4,0xc5,0x4f,0xb8,0x01,0x53,0x85,0x57,0x55,0xb8,0xca,0x7c,0x68}},
+{{0x7c,0xb3,0x63,0x8f,0x70,0x77,0x56,0x6e,0x1c,0x8d,0xc4,0x87,0xb3,0xa7,0x23,0x90,0x29,0x9d,0xfe,0x96,0x8b,0x2a,0x25,0x25,0x08,0xc8,0x40,0x47,0xdd,0x93,0x71,0x4e}},
+{{0x5e,0xed,0xb5,0xe7,0x61,0xc8,0xa5,0x2b,0x75,0xdb,0xb3,0x71,0x51,0x15,0xd9,0x6e,0xe6,0x91,0x26,0x51,0x86,0x07,0xda,0x2a,0x28,0x2b,0x48,0xad,0x5a,0x51,0x18,0xb0}},
+{{0xf0,0x72,0xc3,0x52,0xa3,0x2c,0xdd,0xaf,0x22,0x62,0x98,0xae,0x58,0x61,0x15,0x50,0xa7,0x50,0x96,0xa9,0x1b,0x3a,0x88,0x60,0x03,0x16,0xf7,0xb6,0xab,0xbe,0xca,0x9e}},
+{{0xde,0x01,0x71,0x38,0x61,0x00,0x9f,0x75,0x8c,0x80,0x48,0xa7,0x82,0xb5,0x0d,0x20,0x42,0x7d,0xac,0x0f,0x91,0xe2,0x89,0x4d,0x7a,0x6a,0x52,0xc4,0x4c,0xa0,0x9a,0xf0}},
+{{0x78,0x6d,0xab,0x65,0x0e,0x9d,0xde,0x2b,0x04,0xc1,0x22,0x70,0x34,0x87,0xf5,0xef,0xda,0x77,0x38,0xca,0x4f,0x22,0x77,0x42,0x94,0x3c,0xf9,0x6a,0xc0,0xa8,0xf1,0xa0}},
+{{0x86,0x9f,0x28,0xae,0xd3,0xb0,0x41,0x1e,0xde,0x14,0x65,0xfb,0xbc,0xb4,0x28,0x8d,0xbf,0xc5,0xc4,0x1c,0x34,0xbb,0x37,0x55,0x93,0xc6,0xf8,0x21,0x47,0x8d,0x60,0x48}},
+{{0x39,0xc6,0x55,0xff,0xf4,0xcf,0x86,0x94,0xc0,0xad,0x81,0xe5,0x67,0x6b,0xcb,0x10,0xb9,0x96,0x47,0x49,0xbf,0xa2,0x39,0x6f,0x12,0xe2,0xef,0xf9,0xcc,0x31,0xd7,0x30}},
+{{0x75,0x03,0xe9,0xe4,0xb1,0x29,0xb1,0xad,0x69,0xa4,0x75,0x2e,0xe6,0xbe,0x9b,0x26,0x0d,0x14,0x63,0x76,0xb7,0x3a,0x56,0x32,0xdc,0x02,0x63,0x19,0xb6,0x86,0x9e,0x35}},
+{{0xbc,0xe3,0xcd,0x61,0xed,0xc4,0xbd,0x61,0x7e,0xc8,0x32,0x89,0xaa,0x6b,0x0f,0xff,0xdf,0x09,0x92,0xe4,0x74,0x8c,0xba,0x44,0x91,0xb6,0x6c,0x92,0x54,0xe2,0x69,0x4d}},
+{{0x8e,0x6a,0x15,0x1f,0xae,0xf8,0xe4,0x18,0x69,0xf9,0x77,0x21,0xab,0x86,0xd0,0xfd,0x93,0xa6,0x15,0x80,0x0c,0x80,0xdb,0xfd,0x8e,0xb1,0x87,0x99,0xdf,0xa8,0x4a,0x79}},
+{{0xc8,0xed,0xa9,0xd4,0xba,0xd2,0x36,0x01,0x68,0x5c,0x01,0xb9,0x92,0x09,0xf3,0x52,0xc1,0x85,0x6b,0xbd,0xfd,0x65,0xd9,0x75,0x7a,0xca,0x68,0xb7,0x63,0x25,0xe0,0xa0}},
+{{0xa4,0xdc,0x12,0x97,0x5d,0xc3,0x7f,0xf8,0xa7,0x8c,0x93,0x21,0x5b,0xf2,0xb2,0x31,0x7e,0xbe,0x1d,0x12,0xb5,0x88,0xe9,0xd6,0xaa,0x1f,0x15,0x0c,0x30,0x84,0xef,0x48}},
+{{0x26,0x67,0x11,0x95,0x3b,0x31,0xd4,0xaf,0x12,0xd3,0x7d,0x86,0xcb,0xad,0x4a,0x0c,0x44,0x2a,0xde,0xaf,0xf4,0xf4,0x06,0xca,0x1d,0x9b,0x48,0x8e,0xe5,0x41,0xeb,0xb7}},
+{{0xa1,0xeb,0xfa,0x57,0x8a,0x9b,0x16,0x16,0x9f,0x3b,0xf7,0x42,0x0b,0xac,0xbc,0x6c,0x58,0x53,0x48,0xb1,0xd1,0x19,0xe3,0xe8,0xc3,0x78,0xf5,0x9f,0x9d,0x33,0xa7,0x25}},
+{{0x7e,0x09,0x1e,0xa9,0x0b,0x5c,0x77,0xa1,0xfa,0x90,0xd1,0x33,0xfc,0x17,0x8e,0xdc,0x8a,0xce,0x70,0xf6,0x4e,0xe6,0x58,0x32,0x4e,0x66,0x05,0xfc,0xe3,0x36,0xef,0x29}},
+{{0xe2,0x01,0xa7,0xef,0x75,0x0b,0x9d,0x89,0x09,0xb6,0x37,0xf9,0xb8,0xfb,0x6a,0xf3,0xae,0x73,0x06,0x16,0x36,0xd3,0x21,0x76,0x78,0x2b,0x67,0x3e,0x03,0x4f,0x5c,0x51}},
+{{0x11,0x7c,0xca,0x47,0xbb,0xc9,0x0e,0x36,0xf8,0x59,0x51,0x59,0xfb,0xe1,0x65,0xb9,0x99,0x64,0x8e,0x45,0xa9,0x3d,0x2f,0x20,0xce,0x16,0x24,0x05,0x48,0x82,0xc9,0x62}},
+{{0x7a,0x6a,0x29,0x24,0xfd,0x7c,0x13,0xd8,0x41,0xc8,0x3e,0x5b,0x9b,0x5d,0xfa,0x32,0xc8,0xc6,0x85,0x18,0x6d,0x4e,0xa7,0xb5,0x5a,0x56,0xad,0x95,0x92,0xc8,0x8c,0xe4}},
+{{0x70,0x55,0x44,0xb2,0x3a,0x1f,0x06,0x35,0xc9,0xde,0x77,0x3d,0xb4,0xe0,0x31,0x88,0x8c,0xe6,0x75,0x12,0x6b,0x9c,0xfa,0xff,0x42,0x4f,0x34,0xc0,0xeb,0xd1,0x61,0x73}},
+{{0x9a,0x9d,0x77,0x2a,0xfb,0xcb,0x29,0xe0,0x37,0x51,0xbb,0x68,0xef,0xf8,0xd4,0x4f,0x4a,0x65,0x32,0xf7,0xda,0x68,0xde,0xae,0x77,0xc8,0x2b,0x69,0x51,0xec,0xab,0xa7}},
+{{0x26,0x09,0x66,0x11,0x1e,0x94,0xb3,0x5d,0xf7,0x0d,0x89,0xfe,0x9b,0xd6,0x77,0xe7,0xc0,0xf4,0x09,0x8c,0xfb,0x0a,0x3a,0xcb,0xc0,0xe3,0xc6,0x86,0x89,0x84,0xd2,0x1a}},
+{{0x70,0xee,0xc8,0x15,0xea,0xe7,0xd6,0x96,0x84,0x4d,0xfe,0x41,0x1c,0x96,0x2c,0x81,0x91,0x63,0xd7,0xdf,0xed,0x92,0xd5,0xdf,0xdd,0x35,0xb0,0x2c,0xe5,0xdc,0xb4,0xce}},
+{{0x59,0x45,0xda,0x39,0x07,0xc3,0x25,0x25,0x7a,0x66,0x8a,0x7d,0x6e,0x85,0x93,0x6a,0xfb,0xb5,0x6c,0x4d,0x8f,0x83,0xe9,0x3f,0xd5,0x35,0x54,0xc9,0x64,0xcc,0xc4,0x96}},
+{{0x9f,0x37,0xde,0x8e,0xe5,0xdc,0x15,0x9e,0xac,0x0d,0x9a,0xa3,0x80,0x22,0x27,0xb8,0x4a,0x8f,0x45,0xe7,0x38,0xd3,0x03,0x2e,0x54,0xb2,0xaa,0x7f,0xf6,0x16,0xa2,0x4e}},
+{{0xe5,0x41,0x50,0xb3,0x6f,0x39,0x23,0x0f,0x38,0x55,0xf6,0xd8,0x01,0xc2,0xc0,0xe2,0x58,0x21,0x02,0xc3,0x0e,0xfc,0x7e,0x1e,0x79,0x36,0xd7,0x8a,0x3d,0x35,0xdd,0x35}},
+{{0x49,0xa9,0x54,0x8c,0x98,0xfa,0x71,0xd5,0x7d,0xb2,0xb5,0xd2,0xae,0xed,0x02,0x19,0xa4,0x6d,0xfa,0x57,0x77,0xdc,0xe6,0xb1,0x06,0xaf,0x03,0xf0,0xb0,0x27,0xbc,0xab}},
+{{0x83,0x87,0xec,0x90,0xed,0x23,0xd7,0x5f,0xd8,0x84,0x04,0x09,0xaf,0xb1,0x97,0xdd,0x1d,0x80,0x07,0x24,0xcd,0xe2,0x5b,0x93,0xe1,0xf6,0x96,0x63,0x9b,0xa0,0x80,0x69}},
+{{0xe2,0x33,0xb6,0x9c,0xa8,0x4b,0xbf,0xb4,0x4c,0x4d,0x0b,0xe7,0x14,0xe9,0x86,0xaa,0x63,0x33,0xc1,0x6e,0x78,0x24,0xb3,0xe7,0x34,0x02,0x79,0xe4,0x6e,0x44,0x5e,0x29}},
+{{0xfc,0x54,0x6c,0x14,0xdb,0x89,0xd1,0x66,0xe8,0x42,0x5f,0x21,0x67,0x9d,0x01,0x1b,0x15,0xc3,0xde,0x73,0xe8,0x0e,0xd9,0xbb,0xe8,0x02,0xb7,0x52,0xc0,0x45,0x64,0x97}},
+{{0xc3,0xb7,0x00,0xa9,0x45,0xe5,0x3f,0x0c,0x28,0xa9,0x6f,0x21,0x81,0xfb,0xd9,0x8d,0x6d,0x3c,0x34,0x1e,0xa8,0x66,0x60,0xce,0x73,0x41,0x63,0x7d,0xeb,0xbf,0xea,0x57}},
+{{0x97,0xa5,0xd5,0x21,0xa8,0xd7,0x07,0x79,0xcf,0xde,0x67,0x37,0xa3,0x58,0x42,0x10,0x5c,0x18,0xe8,0xa1,0x5f,0xe0,0x27,0x6a,0x60,0xeb,0x66,0xc7,0xd5,0xbd,0x21,0x9f}},
+{{0x7f,0xe8,0xba,0x5b,0xd9,0x04,0x15,0x7a,0xb3,0x93,0x52,0x07,0x73,0xb4,0x28,0x5c,0x61,0x24,0xf8,0x74,0x42,0x40,0x4b,0xb9,0xdd,0x17,0x27,0xbc,0xfe,0xe8,0xe3,0xa3}},
+{{0xb2,0x4c,0xf7,0x4b,0xfd,0xed,0x42,0x68,0x38,0xe8,0xce,0xd1,0xe9,0x80,0xc5,0xd8,0x17,0x0c,0xbd,0x80,0x11,0x40,0xac,0xe4,0x10,0x02,0x56,0x9b,0x98,0x44,0x7f,0xc0}},
+{{0x7c,0x8b,0xb7,0x73,0xaa,0xe7,0x43,0x65,0x1b,0xef,0x43,0xc5,0x02,0x3e,0x06,0x92,0xcd,0x41,0xe1,0xb4,0x84,0x13,0x57,0xe5,0xd3,0x08,0x59,0x6d,0xcb,0xcf,0xe8,0x14}},
+{{0x20,0x01,0xa7,0x6a,0xe8,0x82,0x34,0x3e,0xe3,0x59,0x37,0x8d,0x9f,0x4a,0x80,0x50,0x38,0x67,0x12,0x90,0x4f,0x22,0xd8,0x63,0xfa,0xfe,0xdf,0xad,0x30,0x58,0xe6,0x20}},
+{{0x2a,0xf0,0xc2,0x92,0xb4,0x71,0xea,0x43,0x70,0x6c,0x25,0x63,0x7b,0xde,0xaf,0xbb,0x84,0x58,0xb1,0x24,0xd4,0x19,0xe1,0xa7,0x04,0xc1,0x74,0x92,0x09,0x48,0xad,0x77}},
+{{0xd0,0x7c,0x39,0xf2,0x42,0xea,0x65,0x81,0xcd,0xf9,0xb5,0x7e,0x09,0x8a,0x03,0x72,0xec,0x89,0x88,0x6e,0x97,0x3d,0xe5,0x9c,0x07,0x0b,0x92,0x30,0xe8,0x62,0x41,0xf7}},
+{{0x8c,0xdd,0x10,0x82,0x0d,0x04,0x7c,0x59,0x7a,0x69,0x3a,0xc1,0x64,0x5a,0x40,0x50,0x3c,0xf7,0x3e,0x41,0x7a,0x94,0x6d,0xc5,0xe6,0x15,0x74,0x6a,0x9a,0x68,0x40,0xe7}},
+{{0xd1,0x64,0xca,0x06,0x78,0x3e,0x22,0x6d,0xb0,0x63,0x23,0xaa,0x07,0x85,0xe0,0x2b,0xea,0x75,0x38,0x5f,0x29,0x1e,0x40,0x83,0xa6,0x5e,0x53,0x6f,0x04,0xd1,0xe4,0xf9}},
+{{0x4d,0x77,0xd1,0x87,0xc7,0x8b,0x3d,0x66,0xbf,0xab,0xa4,0x70,0x90,0xf9,0xa9,0xa7,0xac,0x0a,0x8d,0x1e,0x78,0x48,0x9d,0xf7,0x83,0x37,0x38,0x59,0x17,0x35,0x28,0x2a}},
+{{0xdc,0x8f,0xee,0x72,0xb9,0xcb,0xa6,0x4e,0xd3,0x39,0x42,0x8c,0x17,0x17,0xc6,0x18,0x37,0x5c,0x9e,0xe0,0x28,0x50,0x66,0x5e,0x16,0x77,0x45,0x56,0xdc,0x1e,0x7f,0xc9}},
+{{0xf8,0x74,0x4a,0xbe,0x70,0x88,0x2b,0xb3,0x9a,0x1d,0x30,0xf2,0xee,0xb3,0xfd,0x75,0xb0,0xfd,0x92,0x06,0x80,0xd7,0xfc,0x4b,0x98,0x54,0xb2,0x5a,0xe1,0xac,0x69,0xc9}},
+{{0xd0,0x5e,0x21,0xd9,0xd6,0xc1,0x27,0x41,0x04,0x47,0x8d,0xcd,0xd5,0x18,0x6a,0xdd,0x40,0x22,0x14,0xe3,0x1b,0xd8,0xc1,0x19,0x2d,0x8b,0xfa,0x33,0x28,0x67,0x46,0x34}},
+{{0x98,0xdd,0xc9,0xed,0x4a,0x40,0x57,0x60,0xef,0x92,0xfb,0x94,0xdf,0x8e,0x5a,0x51,0x26,0x59,0x85,0x65,0x05,0x60,0x56,0xa2,0x8a,0xda,0xbc,0xe4,0x34,0xb5,0x8d,0x09}},
+{{0xb1,0x59,0xe9,0x49,0x63,0x8f,0x76,0xe4,0x77,0xc9,0x2f,0x1c,0x98,0x1b,0x56,0x3b,0xeb,0x00,0xb8,0xf2,0x6c,0x73,0x52,0x29,0x63,0xe4,0xc1,0x94,0x22,0xc0,0xdc,0x9f}},
+{{0xce,0x81,0xc4,0x8c,0xdb,0x4b,0xd0,0x84,0x51,0x16,0x27,0xc4,0x8f,0x0b,0xc0,0x6d,0xff,0x82,0x47,0xcd,0xcc,0x75,0x46,0xd6,0x82,0x42,0x13,0x07,0xd4,0xc8,0x7a,0xca}},
+{{0x4b,0x19,0x5f,0x4d,0x69,0xb5,0xf0,0xd4,0x4f,0xb0,0x78,0x19,0x3a,0xc1,0x28,0x67,0x02,0xc2,0x61,0x80,0x25,0x38,0x53,0x89,0x6b,0xe7,0xab,0x7e,0xf7,0xfc,0x6d,0x0c}},
+{{0xfe,0x23,0x69,0x02,0xeb,0x22,0xae,0x79,0xd5,0xab,0x6b,0xc9,0xe5,0x63,0x49,0xa7,0x70,0xfe,0x07,0x66,0x74,0x10,0x86,0xd9,0x6d,0x9d,0x68,0xed,0x7b,0x1f,0xda,0xff}},
+{{0x84,0x10,0x0a,0xe6,0xfb,0x30,0x34,0xd3,0x22,0x9e,0x95,0xe1,0xe2,0x09,0x1c,0xb6,0xc8,0x97,0xe4,0xf8,0xe8,0x3a,0x71,0xd7,0x48,0x43,0xd4,0xcb,0xf2,0x1e,0xd6,0x80}},
+{{0xad,0x6b,0x21,0xe3,0x2a,0xbd,0xb4,0xc4,0xa2,0x5f,0xe3,0x94,0x15,0xf9,0x54,0x2e,0xa1,0x62,0x77,0x87,0xd1,0x73,0xe6,0x0c,0xeb,0x4b,0x00,0xd2,0x8f,0x9a,0x94,0x6d}},
+{{0xec,0xac,0x14,0x09,0x41,0xda,0x8a,0x5d,0xf8,0x81,0xe4,0x7a,0x15,0x07,0xbe,0x0e,0x97,0xdf,0xde,0x5b,0xd3,0x07,0xd8,0xbf,0xc5,0xb8,0x8c,0xca,0xb1,0x90,0x21,0xca}},
+{{0x08,0xb3,0x91,0x34,0x43,0x8c,0x35,0xab,0xc6,0x10,0x95,0x60,0x25,0x6d,0x6e,0x1c,0x9b,0xcc,0x33,0xc1,0x92,0x6c,0x7b,0x6d,0x20,0x3c,0x54,0xbc,0xdd,0x04,0xef,0xcf}},
+{{0x4c,0x10,0x61,0x84,0x43,0xb0,0xb7,0x1e,0xf3,0x94,0xe4,0x3a,0x53,0xe9,0x7a,0xfe,0x46,0x89,0x87,0xf9,0xf0,0x74,0xe0,0x9f,0x00,0x58,0x6f,0xe8,0x27,0x54,0xf7,0x55}},
+{{0x7c,0xd0,0xb5,0x47,0x7e,0xd6,0x63,0x6c,0x52,0xa2,0x01,0xe4,0xe3,0x29,0xb3,0xeb,0x4e,0x50,0xe1,0x4a,0x7f,0x2c,0xc8,0x74,0xd5,0x45,0x40,0x67,0xb0,0xd0,0x70,0xe9}},
+{{0x41,0xdb,0x47,0x2a,0xeb,0x22,0xd3,0x64,0xdc,0xdb,0x24,0x1e,0x45,0x50,0x4b,0xd1,0x67,0x12,0x6a,0x62,0xb5,0x8c,0x30,0xca,0x27,0xfe,0x2e,0xb0,0x46,0xb8,0xf7,0x06}},
+{{0x74,0xb1,0xc3,0x7a,0x36,0xb8,0x97,0x79,0x5d,0x38,0xfc,0x3e,0x43,0x98,0xf7,0x54,0xeb,0x76,0x4b,0x7b,0xce,0xa8,0xd9,0x7e,0x50,0xf5,0x6a,0xb8,0x6f,0x3a,0xac,0x7a}},
+{{0xb0,0x06,0xef,0x19,0xca,0xcb,0x17,0xce,0x74,0xdd,0xe8,0xf8,0x24,0x6d,0x72,0x6b,0x5b,0x49,0x15,0x25,0x2e,0x5d,0x37,0xb2,0x8b,0x0d,0x90,0xe2,0x75,0x3d,0xed,0x90}},
+{{0xb3,0x72,0x9a,0x31,0x45,0xcf,0x85,0xba,0x42,0x87,0xa9,0x35,0x9f,0xf6,0x14,0x98,0xeb,0xf6,0x9f,0xdd,0x99,0xe7,0xa0,0xce,0x58,0x5c,0xad,0x62,0x1a,0xc4,0x20,0x1b}},
+{{0xe7,0xe4,0xf1,0x4e,0x3d,0xab,0xae,0x3b,0x64,0xb0,0x17,0x02,0xc8,0x7e,0xb1,0x80,0x95,0x56,0x1f,0x75,0x02,0x1e,0xb2,0x7a,0x35,0x27,0x2d,0xe0,0xfe,0x60,0x3d,0x89}},
+{{0x88,0x19,0x9d,0x1c,0x60,0xf7,0x88,0x0e,0xb3,0x35,0x99,0x67,0xcc,0xa2,0x26,0x6b,0xee,0x6b,0x13,0x6e,0x00,0xfb,0x61,0xfe,0xd6,0xfb,0xc0,0x91,0xa7,0xf5,0xf5,0x23}},
+{{0x74,0x9b,0x6f,0x78,0xb6,0xf9,0xfb,0xc6,0xf8,0xfb,0xff,0x51,0xe1,0xa4,0x0d,0x66,0xaa,0x21,0x18,0x46,0x25,0x96,0xb6,0x83,0xd0,0x99,0x2f,0x15,0x92,0x51,0x0e,0x3c}},
+{{0xff,0x7b,0xff,0x0f,0x2f,0xc8,0x57,0xea,0x2f,0x59,0xca,0xcb,0x05,0x76,0x20,0x76,0x31,0x77,0xd6,0xff,0x69,0x1c,0x3a,0x7e,0x51,0x6a,0xbe,0xde,0xc4,0xff,0x68,0x70}},
+{{0x30,0xdf,0x6f,0x1c,0xf8,0x14,0xaf,0xae,0xad,0x6e,0x46,0xe2,0xe7,0xba,0x87,0x4b,0xb3,0x68,0x5c,0xab,0x64,0x47,0x84,0x78,0xe8,0x45,0x67,0x0d,0x68,0x4e,0x46,0x44}},
+{{0x87,0x54,0x97,0xd8,0x09,0xd1,0x95,0x27,0x80,0x0b,0x65,0x23,0x68,0x24,0x5e,0x0d,0x0f,0x8a,0xc0,0x86,0x53,0xe8,0x43,0x07,0x7d,0x33,0xd2,0xba,0xf6,0xf7,0x85,0xc1}},
+{{0xcd,0x10,0x9b,0x4e,0x40,0x84,0x15,0x29,0x8a,0xa1,0xf3,0xcd,0x86,0x3a,0x9f,0x35,0x79,0xce,0xe7,0x78,0x1b,0xbf,0x74,0xdc,0xd5,0xdb,0x5a,0xf4,0x10,0x19,0xd2,0xd4}},
+{{0xa5,0xb0,0xe1,0xff,0xdc,0x4b,0x60,0xab,0xc2,0xbd,0xd3,0x3f,0xc6,0xb9,0x1a,0xc5,0x10,0xc2,0x14,0x41,0x6d,0xff,0x72,0x13,0x63,0x36,0xda,0xc7,0xed,0x4d,0x20,0x53}},
+{{0x06,0x34,0xd4,0x51,0x5c,0xa4,0x6f,0xc5,0x35,0x9f,0x63,0x3a,0xd0,0x9c,0xee,0xfa,0xc5,0x09,0xef,0x1d,0x56,0x7f,0xfd,0x16,0xf2,0x95,0x98,0xe7,0x62,0x40,0x75,0xdc}},
+{{0x82,0x79,0xb4,0x80,0xd0,0x13,0xc9,0x56,0xa1,0x10,0x4d,0xc2,0xc8,0xe4,0x44,0x61,0x18,0xce,0x9f,0xfd,0xcd,0x28,0x6e,0xfc,0x10,0xa5,0x78,0x50,0x9a,0x9a,0x2d,0xa0}},
+{{0x82,0x13,0xda,0xeb,0xb4,0xc2,0x08,0x06,0xe7,0x0e,0x6e,0x48,0xf9,0x50,0xb3,0x02,0x14,0x83,0xd9,0xcc,0xba,0x09,0x0c,0x8d,0x6f,0xef,0x0c,0x00,0xe2,0x1e,0xa3,0xd2}},
+{{0x56,0xe6,0x5c,0x12,0x32,0x91,0x26,0x2c,0x06,0xde,0x35,0x74,0x0e,0xdd,0xb6,0x91,0x31,0x3e,0x9f,0x72,0x3f,0x94,0x5a,0x02,0xcf,0x42,0xbc,0x02,0x44,0x3e,0x80,0xa7}},
+{{0xbe,0xa6,0xce,0x80,0xc5,0xe8,0x37,0xe5,0xcf,0x3a,0x86,0x16,0x7b,0x95,0x6d,0x9d,0x75,0xb6,0x8d,0x1d,0x0b,0x99,0x22,0x70,0x4b,0x2a,0xf2,0xe9,0xe8,0xf2,0xbd,0xe1}},
+{{0x60,0x8d,0x10,0xcb,0x75,0xa2,0xef,0x3f,0x57,0x15,0xc0,0xd9,0x53,0x84,0xdb,0x57,0x85,0x2a,0x82,0xc8,0xac,0x1d,0x7f,0x0a,0x8b,0x2a,0xca,0x5d,0xa9,0xb9,0xa1,0x0e}},
+{{0xd5,0x6b,0x7d,0x03,0x7b,0xa4,0x63,0x06,0xcc,0x34,0x68,0x2a,0x8d,0x26,0x77,0xca,0x08,0xa8,0xdc,0xfa,0xa2,0x8a,0x63,0x74,0xca,0xeb,0xce,0x36,0x88,0x55,0xcd,0xa1}},
+{{0xa1,0x99,0xdc,0x24,0x33,0xcd,0xe4,0x32,0xfd,0x80,0xce,0xb0,0x65,0x63,0x15,0x26,0xf3,0xd8,0x9d,0xca,0xe7,0x58,0x31,0xe8,0x4d,0x50,0x22,0xee,0x2f,0x2a,0x13,0xee}},
+{{0x91,0xe1,0x0f,0x64,0x43,0x40,0x21,0xe6,0x97,0x86,0xaa,0x21,0x0b,0x7d,0x70,0x88,0x53,0xe1,0x61,0x8d,0x57,0x2b,0xcf,0xca,0x46,0xa4,0xf8,0x16,0x80,0x88,0xf0,0xda}},
+{{0x63,0xba,0x3d,0xaa,0xa7,0x7f,0x85,0xe3,0xa0,0x4d,0x49,0xff,0x58,0x0e,0x88,0x52,0x70,0x0c,0x11,0x32,0xa3,0xfa,0x25,0x31,0xb5,0x01,0x59,0xdc,0x1d,0xeb,0x66,0xaa}},
+{{0xef,0x4a,0x0b,0x7d,0x70,0xcf,0x32,0x03,0x42,0xf0,0xc3,0x47,0x60,0x83,0xe1,0x8b,0x55,0x0d,0x2c,0x83,0x97,0x8c,0xde,0xd8,0xf6,0xbf,0x10,0xc4,0xb7,0x7a,0x36,0x92}},
+{{0x5c,0xa0,0xc1,0xd1,0x48,0x5f,0xef,0xac,0xc0,0x7c,0x05,0x4f,0x93,0xa3,0x85,0x76,0x2b,0x89,0x95,0xdd,0x8c,0x92,0x26,0x19,0x74,0x5d,0x9e,0x07,0x5e,0x4a,0xbb,0x4b}},
+{{0x1b,0x58,0x99,0x40,0x2f,0x5c,0x19,0x6d,0xa8,0x21,0xbb,0xee,0x24,0xb8,0xa4,0xe3,0xba,0x70,0x6e,0x81,0x17,0x90,0x03,0x19,0x32,0xc5,0x00,0xbc,0xfc,0x79,0xbe,0x96}},
+{{0xcc,0x95,0x86,0x96,0xb2,0x67,0xf8,0x6c,0xdb,0x58,0xf9,0xca,0xfa,0x84,0xde,0xe4,0xd3,0x4b,0xb1,0x3f,0x2d,0x73,0x8f,0xb1,0xc4,0x05,0xc5,0x35,0x42,0xf1,0x7e,0x8c}},
+{{0x2c,0x5b,0x9b,0xf8,0xf4,0xe7,0x33,0xa8,0x55,0xd3,0x9a,0x36,0xcb,0xb1,0xd1,0x87,0x7b,0x90,0x02,0xd5,0x0e,0xb5,0x80,0x32,0x7f,0x07,0x06,0x41,0x3e,0xbe,0x9b,0xf9}},
+{{0xc8,0xec,0xec,0xcc,0xca,0x11,0xc8,0x5b,0x8e,0x96,0x1e,0x43,0xaa,0x8f,0xd8,0xf1,0xa9,0x5b,0x5e,0x83,0xb6,0x3e,0x48,0xa0,0x66,0xac,0x68,0x39,0x80,0xa2,0x91,0x40}},
+{{0x7d,0xd6,0xdb,0xd7,0x6a,0x62,0x24,0x84,0xa7,0x1a,0xd0,0xf5,0x64,0xac,0xc5,0x65,0x74,0x89,0x7e,0x59,0xda,0x34,0xce,0xef,0xbc,0x6d,0x8b,0x00,0x02,0x13,0x2f,0x45}}
 };
 
-std::map<std::string, std::string> oldHashes2_1_0J = {
-{"0004001000020000.cia", "7a6a2924fd7c13d841c83e5b9b5dfa32c8c685186d4ea7b55a56ad9592c88ce4"},
-{"0004001000020100.cia", "705544b23a1f0635c9de773db4e031888ce675126b9cfaff424f34c0ebd16173"},
-{"0004001000020200.cia", "9a9d772afbcb29e03751bb68eff8d44f4a6532f7da68deae77c82b6951ecaba7"},
-{"0004001000020300.cia", "260966111e94b35df70d89fe9bd677e7c0f4098cfb0a3acbc0e3c6868984d21a"},
-{"0004001000020400.cia", "70eec815eae7d696844dfe411c962c819163d7dfed92d5dfdd35b02ce5dcb4ce"},
-{"0004001000020500.cia", "5945da3907c325257a668a7d6e85936afbb56c4d8f83e93fd53554c964ccc496"},
-{"0004001000020700.cia", "9f37de8ee5dc159eac0d9aa3802227b84a8f45e738d3032e54b2aa7ff616a24e"},
-{"0004001000020900.cia", "e54150b36f39230f3855f6d801c2c0e2582102c30efc7e1e7936d78a3d35dd35"},
-{"0004001000020A00.cia", "49a9548c98fa71d57db2b5d2aeed0219a46dfa5777dce6b106af03f0b027bcab"},
-{"0004001000020B00.cia", "8387ec90ed23d75fd8840409afb197dd1d800724cde25b93e1f696639ba08069"},
-{"0004001000020D00.cia", "a7aa976bcb09106439edfc2bd1d2ac005903f7caf01e5c81d6c3d863e24f1574"},
-{"0004001000020E00.cia", "cd9a99d02d3d70f1327f728a698ead9f54fe9fb68eba19853aa22dbe59b76c0d"},
-{"0004001000020F00.cia", "e233b69ca84bbfb44c4d0be714e986aa6333c16e7824b3e7340279e46e445e29"},
-{"0004001000023000.cia", "20ed3c14cdf191d6e77ff4ada385880179062e217932fd89a4353148a8c3ee42"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004003000008202.cia", "fc546c14db89d166e8425f21679d011b15c3de73e80ed9bbe802b752c0456497"},
-{"0004003000008402.cia", "c3b700a945e53f0c28a96f2181fbd98d6d3c341ea86660ce7341637debbfea57"},
-{"0004003000008602.cia", "97a5d521a8d70779cfde6737a35842105c18e8a15fe0276a60eb66c7d5bd219f"},
-{"0004003000008702.cia", "7fe8ba5bd904157ab393520773b4285c6124f87442404bb9dd1727bcfee8e3a3"},
-{"0004003000008802.cia", "b24cf74bfded426838e8ced1e980c5d8170cbd801140ace41002569b98447fc0"},
-{"0004003000008A02.cia", "03b3e2a1d2109e1ecfe0e57cd4bbb68edc0195f431231b57e0aa3f669226aab2"},
-{"0004003000008A03.cia", "d801824e9198a30812bd873ab6daa6120677905921aec36f84d3b99a8474e7a8"},
-{"0004003000008D02.cia", "7c8bb773aae743651bef43c5023e0692cd41e1b4841357e5d308596dcbcfe814"},
-{"0004003000008E02.cia", "2001a76ae882343ee359378d9f4a8050386712904f22d863fafedfad3058e620"},
-{"000400300000C002.cia", "2af0c292b471ea43706c25637bdeafbb8458b124d419e1a704c174920948ad77"},
-{"000400300000C003.cia", "57f383e90793faf9b6dce7bb42a1b1d709366a71ec52b6defb3163e462ab2d2d"},
-{"000400300000C102.cia", "d07c39f242ea6581cdf9b57e098a0372ec89886e973de59c070b9230e86241f7"},
-{"000400300000C302.cia", "8cdd10820d047c597a693ac1645a40503cf73e417a946dc5e615746a9a6840e7"},
-{"000400300000C402.cia", "d164ca06783e226db06323aa0785e02bea75385f291e4083a65e536f04d1e4f9"},
-{"000400300000C502.cia", "a99109d8ec714e2981ab289c042b39ffcdd3208d50fe274bfc90cfa2e716c8c7"},
-{"000400300000C503.cia", "ffab7a4be558f69845b2d81cdde444b027078f146f5d4b3746f4e925ef1eab41"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "a0bedf49faf09c32d58696296f11090acc762d2fc21177f9e12f21ed6f071007"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011902.cia", "bcd58305164c9f148e3bb17ecbf4df53313f33e54c78144e18a5b1299c2797da"},
-{"0004009B00012202.cia", "4d77d187c78b3d66bfaba47090f9a9a7ac0a8d1e78489df7833738591735282a"},
-{"0004009B00013202.cia", "c3c15f03e3c852f911d1f21a7576424e9850daedc95f47b014aeba8e8c7a1beb"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "9df3e5035a178dcfcb85151b3368c42d6d64a5d3aafc9a83835f12dd135ccad0"},
-{"0004009B00014202.cia", "354f0cfae5458d2d1474c29465e317e5fd4f3edfed6e0e9da1cf1699f111fe88"},
-{"0004009B00014302.cia", "36b0cfeb085ce013aa86c4d9204d11a33692669fe994097445310d8a1b443015"},
-{"0004009B00015202.cia", "a193ac1100c1cbc61981a6fed11e0ed86f28d9f1558d14c0defd0f3067c4e656"},
-{"000400DB00010302.cia", "83c33485d3fc9c933c2065f17dd10568a6853445aab9fe1719910fbd022bd1f4"},
-{"000400DB00010502.cia", "dc8fee72b9cba64ed339428c1717c618375c9ee02850665e16774556dc1e7fc9"},
-{"000400DB00016202.cia", "f8744abe70882bb39a1d30f2eeb3fd75b0fd920680d7fc4b9854b25ae1ac69c9"},
-{"000400DB00017202.cia", "d05e21d9d6c1274104478dcdd5186add402214e31bd8c1192d8bfa3328674634"},
-{"0004013000001502.cia", "98ddc9ed4a405760ef92fb94df8e5a5126598565056056a28adabce434b58d09"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "b159e949638f76e477c92f1c981b563beb00b8f26c73522963e4c19422c0dc9f"},
-{"0004013000001702.cia", "4042bbc3225f3d25b44eb752bcafee892a9afc8fdb498d416d09b68954635049"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "959c7bfbccbc6c75efffa869b3738306d173a9289348c66d06a01124ed8de448"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "e73a7353d0461f844b8d655e5c8be64310ee5d646b154a2328476ec109cc3f4f"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "27e04e1e89783294c781d7396783a464805cc0c6b12ae8c84b60afd67a4b1245"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8a734f27e5ffac152956b583257937b39750172d236a0d8acb7a61f43bbbea5c"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "efbd47c3c2aafad335193781949fa060dc7059fd18c953ff35715fa5c8324cd5"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "608473b7cf35a5206b5583239b5e6d7d187556bbc91241a35ac02d06b4aec884"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "b55400def59c104449b0ac89046d9e25e4ee6b3d7f0061cc1bc7ce2224cb27fd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "f0385abbdaf697cf503a2d0a4af9ee57d7240a10b333f146f61ba62d135bedb0"},
-{"0004013000002102.cia", "89002e2a5877cb7bba0caaf0a3514c6ffb68d6215299df9e1188efcda6495dd9"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "61f5cc6cf5a318af26e4f7ee0d8670b4b4a816def337b8a96077ecdc562b7040"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "677a1094ab6231f0d5dfb472e496d851817d1d578326d62c3b4cc477c420af92"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "e872d8b6b104f7848534a250128dc3ba1945e70f3d025caef9c8aba4ac76bd17"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "f52c1ad745914aa5e586f6ef5db4915def639799d58dd6f064d72befa5bcd035"},
-{"0004013000002702.cia", "381c99a5654800e48139c6ea34a77631474e20857b3a8072d73c72309407efe3"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "ce81c48cdb4bd084511627c48f0bc06dff8247cdcc7546d682421307d4c87aca"},
-{"0004013000002902.cia", "94cb38c721febaa19b855313fc75539402415ef4c54fb80153855755b8ca7c68"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "7cb3638f7077566e1c8dc487b3a72390299dfe968b2a252508c84047dd93714e"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "5eedb5e761c8a52b75dbb3715115d96ee69126518607da2a282b48ad5a5118b0"},
-{"0004013000002C02.cia", "4b195f4d69b5f0d44fb078193ac1286702c26180253853896be7ab7ef7fc6d0c"},
-{"0004013000002C03.cia", "64299626e854c53b28d53b491b1f669c9c5aab0c00f4c90abbae0a410b5712e1"},
-{"0004013000002D02.cia", "de01713861009f758c8048a782b50d20427dac0f91e2894d7a6a52c44ca09af0"},
-{"0004013000002D03.cia", "786dab650e9dde2b04c122703487f5efda7738ca4f227742943cf96ac0a8f1a0"},
-{"0004013000002E02.cia", "869f28aed3b0411ede1465fbbcb4288dbfc5c41c34bb375593c6f821478d6048"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "39c655fff4cf8694c0ad81e5676bcb10b9964749bfa2396f12e2eff9cc31d730"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "7503e9e4b129b1ad69a4752ee6be9b260d146376b73a5632dc026319b6869e35"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "fe236902eb22ae79d5ab6bc9e56349a770fe0766741086d96d9d68ed7b1fdaff"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "84100ae6fb3034d3229e95e1e2091cb6c897e4f8e83a71d74843d4cbf21ed680"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "ad6b21e32abdb4c4a25fe39415f9542ea1627787d173e60ceb4b00d28f9a946d"},
-{"0004013000003502.cia", "a4dc12975dc37ff8a78c93215bf2b2317ebe1d12b588e9d6aa1f150c3084ef48"},
-{"0004013000003702.cia", "266711953b31d4af12d37d86cbad4a0c442adeaff4f406ca1d9b488ee541ebb7"},
-{"0004013000008002.cia", "ecac140941da8a5df881e47a1507be0e97dfde5bd307d8bfc5b88ccab19021ca"},
-{"0004013000008003.cia", "67410a62d701aef615a535c46fd1209e3a869be00e719f93fdb02544addceb82"},
-{"0004013800000002.cia", "08b39134438c35abc6109560256d6e1c9bcc33c1926c7b6d203c54bcdd04efcf"},
-{"0004013800000003.cia", "e201a7ef750b9d8909b637f9b8fb6af3ae73061636d32176782b673e034f5c51"},
-{"0004013800000102.cia", "117cca47bbc90e36f8595159fbe165b999648e45a93d2f20ce1624054882c962"},
-{"0004800542383841.cia", "4c10618443b0b71ef394e43a53e97afe468987f9f074e09f00586fe82754f755"},
-{"00048005484E4441.cia", "78deea6826817610953b9e407d2d08a8fb6ec0d1c750927bc39bc96518a91fa8"},
-{"0004800F484E4841.cia", "7cd0b5477ed6636c52a201e4e329b3eb4e50e14a7f2cc874d5454067b0d070e9"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
+static const manifest::Entry builtinEntries[] = {
+// v17120, 0004013800000002, 0004003000009802
+{0x0004001000022000LL, 0, 0},
+{0x0004001000022100LL, 0, 1},
+{0x0004001000022200LL, 0, 2},
+{0x0004001000022300LL, 0, 3},
+{0x0004001000022400LL, 0, 4},
+{0x0004001000022500LL, 0, 5},
+{0x0004001000022700LL, 0, 6},
+{0x0004001000022800LL, 0, 7},
+{0x0004001000022900LL, 0, 8},
+{0x0004001000022A00LL, 0, 9},
+{0x0004001000022B00LL, 0, 10},
+{0x0004001000022D00LL, 0, 11},
+{0x0004001000022E00LL, 0, 12},
+{0x0004001000022F00LL, 0, 13},
+{0x0004001000025000LL, 0, 14},
+{0x000400100002C100LL, 0, 15},
+{0x0004001B00010002LL, 0, 16},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 18},
+{0x0004001B00018002LL, 0, 19},
+{0x0004001B00018102LL, 0, 20},
+{0x0004001B00018202LL, 0, 21},
+{0x0004003000008A02LL, 0, 22},
+{0x0004003000008A03LL, 0, 23},
+{0x0004003000009802LL, 0, 24},
+{0x0004003000009902LL, 0, 25},
+{0x0004003000009B02LL, 0, 26},
+{0x0004003000009C02LL, 0, 27},
+{0x0004003000009D02LL, 0, 28},
+{0x0004003000009F02LL, 0, 29},
+{0x000400300000A002LL, 0, 30},
+{0x000400300000BA02LL, 0, 31},
+{0x000400300000BE02LL, 0, 32},
+{0x000400300000C502LL, 0, 33},
+{0x000400300000C503LL, 0, 34},
+{0x000400300000CD02LL, 0, 35},
+{0x000400300000D002LL, 0, 36},
+{0x000400300000D003LL, 0, 37},
+{0x000400300000D102LL, 0, 38},
+{0x000400300000D302LL, 0, 39},
+{0x000400300000D402LL, 0, 40},
+{0x000400300000D602LL, 0, 41},
+{0x000400300000F602LL, 0, 42},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 44},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011202LL, 0, 46},
+{0x0004009B00011302LL, 0, 47},
+{0x0004009B00011502LL, 0, 48},
+{0x0004009B00011702LL, 0, 49},
+{0x0004009B00011802LL, 0, 50},
+{0x0004009B00011B02LL, 0, 51},
+{0x0004009B00011C02LL, 0, 52},
+{0x0004009B00011D02LL, 0, 53},
+{0x0004009B00012102LL, 0, 54},
+{0x0004009B00013102LL, 0, 55},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 57},
+{0x0004009B00014202LL, 0, 58},
+{0x0004009B00014302LL, 0, 59},
+{0x0004009B00015102LL, 0, 60},
+{0x000400DB00010302LL, 0, 61},
+{0x000400DB00010502LL, 0, 62},
+{0x000400DB00016102LL, 0, 63},
+{0x000400DB00017102LL, 0, 64},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 67},
+{0x0004013000001702LL, 0, 68},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 72},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 74},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 76},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 80},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 82},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 84},
+{0x0004013000002102LL, 0, 85},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 87},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 89},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 96},
+{0x0004013000002902LL, 0, 97},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 99},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 102},
+{0x0004013000002C03LL, 0, 103},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002D03LL, 0, 105},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 108},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 114},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 117},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 119},
+{0x0004013000008002LL, 0, 120},
+{0x0004013000008003LL, 0, 121},
+{0x0004013800000002LL, 0, 122},
+{0x0004013800000003LL, 0, 123},
+{0x0004013800000102LL, 0, 124},
+{0x0004013800000202LL, 0, 125},
+{0x0004800542383841LL, 0, 126},
+{0x00048005484E4441LL, 0, 127},
+{0x0004800F484E4841LL, 0, 128},
+{0x0004800F484E4C41LL, 0, 129},
+// v17120, 0004013800000002, 0004003000008202
+{0x0004001000020000LL, 0, 130},
+{0x0004001000020100LL, 0, 131},
+{0x0004001000020200LL, 0, 132},
+{0x0004001000020300LL, 0, 133},
+{0x0004001000020400LL, 0, 134},
+{0x0004001000020500LL, 0, 135},
+{0x0004001000020700LL, 0, 136},
+{0x0004001000020800LL, 0, 137},
+{0x0004001000020900LL, 0, 138},
+{0x0004001000020A00LL, 0, 139},
+{0x0004001000020B00LL, 0, 140},
+{0x0004001000020D00LL, 0, 141},
+{0x0004001000020E00LL, 0, 142},
+{0x0004001000020F00LL, 0, 143},
+{0x0004001000023000LL, 0, 144},
+{0x000400100002BF00LL, 0, 145},
+{0x0004001B00010002LL, 0, 16},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 146},
+{0x0004001B00018002LL, 0, 147},
+{0x0004001B00018102LL, 0, 20},
+{0x0004001B00018202LL, 0, 21},
+{0x0004003000008202LL, 0, 148},
+{0x0004003000008302LL, 0, 149},
+{0x0004003000008402LL, 0, 150},
+{0x0004003000008602LL, 0, 151},
+{0x0004003000008702LL, 0, 152},
+{0x0004003000008802LL, 0, 153},
+{0x0004003000008A02LL, 0, 22},
+{0x0004003000008A03LL, 0, 23},
+{0x0004003000008D02LL, 0, 154},
+{0x0004003000008E02LL, 0, 155},
+{0x000400300000BC02LL, 0, 156},
+{0x000400300000C002LL, 0, 157},
+{0x000400300000C003LL, 0, 158},
+{0x000400300000C102LL, 0, 159},
+{0x000400300000C302LL, 0, 160},
+{0x000400300000C402LL, 0, 161},
+{0x000400300000C502LL, 0, 162},
+{0x000400300000C503LL, 0, 34},
+{0x000400300000C602LL, 0, 163},
+{0x000400300000CD02LL, 0, 35},
+{0x000400300000F602LL, 0, 42},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 164},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011902LL, 0, 165},
+{0x0004009B00012202LL, 0, 166},
+{0x0004009B00013202LL, 0, 167},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 57},
+{0x0004009B00014202LL, 0, 58},
+{0x0004009B00014302LL, 0, 59},
+{0x0004009B00015202LL, 0, 168},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 170},
+{0x000400DB00016202LL, 0, 171},
+{0x000400DB00017202LL, 0, 172},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 67},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 174},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 74},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 175},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 80},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 82},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 84},
+{0x0004013000002102LL, 0, 85},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 176},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 89},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 177},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 99},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 179},
+{0x0004013000002C03LL, 0, 103},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002D03LL, 0, 105},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 181},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 182},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 184},
+{0x0004013000008003LL, 0, 121},
+{0x0004013800000002LL, 0, 185},
+{0x0004013800000003LL, 0, 123},
+{0x0004013800000102LL, 0, 124},
+{0x0004013800000202LL, 0, 125},
+{0x0004800542383841LL, 0, 126},
+{0x00048005484E4441LL, 0, 127},
+{0x0004800F484E4841LL, 0, 128},
+{0x0004800F484E4C41LL, 0, 129},
+// v17120, 0004013800000002, 0004003000008F02
+{0x0004001000021000LL, 0, 186},
+{0x0004001000021100LL, 0, 187},
+{0x0004001000021200LL, 0, 188},
+{0x0004001000021300LL, 0, 189},
+{0x0004001000021400LL, 0, 190},
+{0x0004001000021500LL, 0, 191},
+{0x0004001000021700LL, 0, 192},
+{0x0004001000021800LL, 0, 193},
+{0x0004001000021900LL, 0, 194},
+{0x0004001000021A00LL, 0, 195},
+{0x0004001000021B00LL, 0, 196},
+{0x0004001000021D00LL, 0, 197},
+{0x0004001000021E00LL, 0, 198},
+{0x0004001000021F00LL, 0, 199},
+{0x0004001000024000LL, 0, 200},
+{0x000400100002C000LL, 0, 201},
+{0x0004001B00010002LL, 0, 16},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 146},
+{0x0004001B00018002LL, 0, 147},
+{0x0004001B00018102LL, 0, 20},
+{0x0004001B00018202LL, 0, 21},
+{0x0004003000008A02LL, 0, 22},
+{0x0004003000008A03LL, 0, 23},
+{0x0004003000008B02LL, 0, 202},
+{0x0004003000008F02LL, 0, 203},
+{0x0004003000009002LL, 0, 204},
+{0x0004003000009202LL, 0, 205},
+{0x0004003000009302LL, 0, 206},
+{0x0004003000009402LL, 0, 207},
+{0x0004003000009602LL, 0, 208},
+{0x0004003000009702LL, 0, 209},
+{0x000400300000BD02LL, 0, 210},
+{0x000400300000C502LL, 0, 162},
+{0x000400300000C503LL, 0, 34},
+{0x000400300000C802LL, 0, 211},
+{0x000400300000C803LL, 0, 212},
+{0x000400300000C902LL, 0, 213},
+{0x000400300000CB02LL, 0, 214},
+{0x000400300000CC02LL, 0, 215},
+{0x000400300000CD02LL, 0, 35},
+{0x000400300000CE02LL, 0, 216},
+{0x000400300000F602LL, 0, 42},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 164},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011402LL, 0, 217},
+{0x0004009B00011602LL, 0, 218},
+{0x0004009B00011D02LL, 0, 53},
+{0x0004009B00011E02LL, 0, 219},
+{0x0004009B00012302LL, 0, 220},
+{0x0004009B00013302LL, 0, 221},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 57},
+{0x0004009B00014202LL, 0, 58},
+{0x0004009B00014302LL, 0, 59},
+{0x0004009B00015302LL, 0, 222},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 170},
+{0x000400DB00016302LL, 0, 223},
+{0x000400DB00017302LL, 0, 224},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 67},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 174},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 74},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 175},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 80},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 82},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 84},
+{0x0004013000002102LL, 0, 85},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 176},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 89},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 177},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 99},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 179},
+{0x0004013000002C03LL, 0, 103},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002D03LL, 0, 105},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 181},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 182},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 184},
+{0x0004013000008003LL, 0, 121},
+{0x0004013800000002LL, 0, 185},
+{0x0004013800000003LL, 0, 123},
+{0x0004013800000102LL, 0, 124},
+{0x0004013800000202LL, 0, 125},
+{0x0004800542383841LL, 0, 126},
+{0x00048005484E4441LL, 0, 127},
+{0x0004800F484E4841LL, 0, 128},
+{0x0004800F484E4C41LL, 0, 129},
+// v17120, 0004013800000002, 000400300000A902
+{0x0004001000027000LL, 0, 225},
+{0x0004001000027100LL, 0, 226},
+{0x0004001000027200LL, 0, 227},
+{0x0004001000027300LL, 0, 228},
+{0x0004001000027400LL, 0, 229},
+{0x0004001000027500LL, 0, 230},
+{0x0004001000027700LL, 0, 231},
+{0x0004001000027800LL, 0, 232},
+{0x0004001000027900LL, 0, 233},
+{0x0004001000027A00LL, 0, 234},
+{0x0004001000027D00LL, 0, 235},
+{0x0004001000027E00LL, 0, 236},
+{0x0004001000027F00LL, 0, 237},
+{0x0004001B00010002LL, 0, 16},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 146},
+{0x0004003000008A02LL, 0, 22},
+{0x000400300000A902LL, 0, 238},
+{0x000400300000AA02LL, 0, 239},
+{0x000400300000AC02LL, 0, 240},
+{0x000400300000AD02LL, 0, 241},
+{0x000400300000AE02LL, 0, 242},
+{0x000400300000AF02LL, 0, 243},
+{0x000400300000B002LL, 0, 244},
+{0x000400300000CF02LL, 0, 245},
+{0x000400300000CF03LL, 0, 246},
+{0x000400300000D502LL, 0, 247},
+{0x000400300000DE02LL, 0, 248},
+{0x000400300000DE03LL, 0, 249},
+{0x000400300000DF02LL, 0, 250},
+{0x000400300000E102LL, 0, 251},
+{0x000400300000E202LL, 0, 252},
+{0x000400300000E302LL, 0, 253},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 164},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011A02LL, 0, 254},
+{0x0004009B00012502LL, 0, 255},
+{0x0004009B00013502LL, 0, 256},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 57},
+{0x0004009B00014202LL, 0, 58},
+{0x0004009B00014302LL, 0, 59},
+{0x0004009B00015502LL, 0, 257},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 170},
+{0x000400DB00016502LL, 0, 258},
+{0x000400DB00017502LL, 0, 259},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 67},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 174},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 74},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 175},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 80},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 82},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 84},
+{0x0004013000002102LL, 0, 85},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 176},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 89},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 177},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 99},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 179},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002D03LL, 0, 105},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 181},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 182},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 260},
+{0x0004013800000002LL, 0, 185},
+{0x0004013800000003LL, 0, 123},
+{0x0004013800000102LL, 0, 124},
+{0x0004013800000202LL, 0, 125},
+{0x0004800542383841LL, 0, 126},
+{0x00048005484E444BLL, 0, 261},
+{0x0004800F484E4841LL, 0, 128},
+{0x0004800F484E4C41LL, 0, 129},
+// v17120, 0004013800000002, 000400300000B102
+{0x0004001000028000LL, 0, 262},
+{0x0004001000028100LL, 0, 263},
+{0x0004001000028200LL, 0, 264},
+{0x0004001000028300LL, 0, 265},
+{0x0004001000028400LL, 0, 266},
+{0x0004001000028500LL, 0, 267},
+{0x0004001000028700LL, 0, 268},
+{0x0004001000028800LL, 0, 269},
+{0x0004001000028900LL, 0, 270},
+{0x0004001000028A00LL, 0, 271},
+{0x0004001000028D00LL, 0, 272},
+{0x0004001000028E00LL, 0, 273},
+{0x0004001000028F00LL, 0, 274},
+{0x0004001B00010002LL, 0, 16},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 146},
+{0x0004003000008A02LL, 0, 22},
+{0x000400300000B102LL, 0, 275},
+{0x000400300000B202LL, 0, 276},
+{0x000400300000B402LL, 0, 277},
+{0x000400300000B502LL, 0, 278},
+{0x000400300000B602LL, 0, 279},
+{0x000400300000B702LL, 0, 280},
+{0x000400300000B802LL, 0, 281},
+{0x000400300000CF02LL, 0, 245},
+{0x000400300000CF03LL, 0, 246},
+{0x000400300000D502LL, 0, 247},
+{0x000400300000E402LL, 0, 282},
+{0x000400300000E403LL, 0, 283},
+{0x000400300000E502LL, 0, 284},
+{0x000400300000E702LL, 0, 285},
+{0x000400300000E802LL, 0, 286},
+{0x000400300000E902LL, 0, 287},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 164},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011102LL, 0, 288},
+{0x0004009B00012602LL, 0, 289},
+{0x0004009B00013602LL, 0, 290},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 57},
+{0x0004009B00014202LL, 0, 58},
+{0x0004009B00014302LL, 0, 59},
+{0x0004009B00015602LL, 0, 291},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 170},
+{0x000400DB00016602LL, 0, 292},
+{0x000400DB00017602LL, 0, 293},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 67},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 174},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 74},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 175},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 80},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 82},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 84},
+{0x0004013000002102LL, 0, 85},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 176},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 89},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 177},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 99},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 179},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002D03LL, 0, 105},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 181},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 182},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 260},
+{0x0004013800000002LL, 0, 185},
+{0x0004013800000003LL, 0, 123},
+{0x0004013800000102LL, 0, 124},
+{0x0004013800000202LL, 0, 294},
+{0x0004800542383841LL, 0, 126},
+{0x00048005484E4441LL, 0, 127},
+{0x0004800F484E4841LL, 0, 128},
+{0x0004800F484E4C41LL, 0, 129},
+// v17120, 0004013820000002, 0004003000009802
+{0x0004001000022000LL, 0, 0},
+{0x0004001000022100LL, 0, 1},
+{0x0004001000022400LL, 0, 4},
+{0x0004001000022900LL, 0, 295},
+{0x0004001000022A00LL, 0, 296},
+{0x000400100002C100LL, 0, 15},
+{0x0004001020022300LL, 0, 297},
+{0x0004001020022D00LL, 0, 298},
+{0x0004001020025100LL, 0, 299},
+{0x000400102002D000LL, 0, 300},
+{0x000400102002D200LL, 0, 301},
+{0x000400102002D400LL, 0, 302},
+{0x000400102002D600LL, 0, 303},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 18},
+{0x0004001B00018002LL, 0, 147},
+{0x0004001B00018102LL, 0, 20},
+{0x0004001B00018202LL, 0, 21},
+{0x0004003000008A02LL, 0, 22},
+{0x0004003000009802LL, 0, 304},
+{0x0004003000009902LL, 0, 25},
+{0x0004003000009B02LL, 0, 26},
+{0x0004003000009C02LL, 0, 27},
+{0x0004003000009F02LL, 0, 29},
+{0x000400300000A002LL, 0, 30},
+{0x000400300000BA02LL, 0, 31},
+{0x000400300000BE02LL, 0, 305},
+{0x000400300000C502LL, 0, 162},
+{0x000400300000CD02LL, 0, 35},
+{0x000400300000D002LL, 0, 36},
+{0x000400300000D102LL, 0, 38},
+{0x000400300000D302LL, 0, 39},
+{0x000400300000D402LL, 0, 40},
+{0x000400300000D602LL, 0, 306},
+{0x000400300000F602LL, 0, 42},
+{0x0004003020008A03LL, 0, 307},
+{0x0004003020009D02LL, 0, 308},
+{0x000400302000C503LL, 0, 309},
+{0x000400302000D003LL, 0, 310},
+{0x0004009B00010402LL, 0, 44},
+{0x0004009B00012102LL, 0, 311},
+{0x0004009B00013102LL, 0, 55},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 170},
+{0x000400DB00017102LL, 0, 312},
+{0x000400DB20016102LL, 0, 313},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002802LL, 0, 177},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 179},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003302LL, 0, 181},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 117},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 184},
+{0x0004013020001503LL, 0, 314},
+{0x0004013020001602LL, 0, 315},
+{0x0004013020001703LL, 0, 316},
+{0x0004013020001803LL, 0, 317},
+{0x0004013020001A03LL, 0, 318},
+{0x0004013020001B03LL, 0, 319},
+{0x0004013020001C02LL, 0, 320},
+{0x0004013020001C03LL, 0, 321},
+{0x0004013020001D03LL, 0, 322},
+{0x0004013020001E02LL, 0, 323},
+{0x0004013020001E03LL, 0, 324},
+{0x0004013020001F02LL, 0, 325},
+{0x0004013020001F03LL, 0, 326},
+{0x0004013020002103LL, 0, 327},
+{0x0004013020002202LL, 0, 328},
+{0x0004013020002203LL, 0, 329},
+{0x0004013020002302LL, 0, 330},
+{0x0004013020002303LL, 0, 331},
+{0x0004013020002403LL, 0, 332},
+{0x0004013020002703LL, 0, 333},
+{0x0004013020002903LL, 0, 334},
+{0x0004013020002C03LL, 0, 335},
+{0x0004013020002D03LL, 0, 336},
+{0x0004013020002E03LL, 0, 337},
+{0x0004013020002F03LL, 0, 338},
+{0x0004013020003103LL, 0, 339},
+{0x0004013020003203LL, 0, 340},
+{0x0004013020003303LL, 0, 341},
+{0x0004013020004002LL, 0, 342},
+{0x0004013020004102LL, 0, 343},
+{0x0004013020004202LL, 0, 344},
+{0x0004013020008003LL, 0, 345},
+{0x0004013820000002LL, 0, 346},
+{0x0004013820000003LL, 0, 347},
+{0x0004013820000102LL, 0, 348},
+{0x0004013820000202LL, 0, 349},
+// v17120, 0004013820000002, 0004003000008202
+{0x0004001000020000LL, 0, 130},
+{0x0004001000020100LL, 0, 131},
+{0x0004001000020400LL, 0, 134},
+{0x0004001000020900LL, 0, 350},
+{0x0004001000020A00LL, 0, 139},
+{0x000400100002BF00LL, 0, 145},
+{0x0004001020020300LL, 0, 351},
+{0x0004001020020D00LL, 0, 352},
+{0x0004001020023100LL, 0, 353},
+{0x000400102002C800LL, 0, 354},
+{0x000400102002C900LL, 0, 355},
+{0x000400102002CB00LL, 0, 356},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 146},
+{0x0004001B00018002LL, 0, 147},
+{0x0004001B00018102LL, 0, 20},
+{0x0004001B00018202LL, 0, 21},
+{0x0004003000008202LL, 0, 357},
+{0x0004003000008302LL, 0, 149},
+{0x0004003000008402LL, 0, 150},
+{0x0004003000008602LL, 0, 151},
+{0x0004003000008702LL, 0, 152},
+{0x0004003000008A02LL, 0, 22},
+{0x0004003000008D02LL, 0, 154},
+{0x0004003000008E02LL, 0, 155},
+{0x000400300000BC02LL, 0, 156},
+{0x000400300000C002LL, 0, 157},
+{0x000400300000C102LL, 0, 159},
+{0x000400300000C302LL, 0, 160},
+{0x000400300000C402LL, 0, 161},
+{0x000400300000C502LL, 0, 162},
+{0x000400300000C602LL, 0, 358},
+{0x000400300000CD02LL, 0, 35},
+{0x000400300000F602LL, 0, 42},
+{0x0004003020008802LL, 0, 359},
+{0x0004003020008A03LL, 0, 307},
+{0x000400302000C003LL, 0, 360},
+{0x000400302000C503LL, 0, 309},
+{0x0004009B00010402LL, 0, 164},
+{0x0004009B00012202LL, 0, 361},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 362},
+{0x000400DB00017202LL, 0, 363},
+{0x000400DB20016202LL, 0, 364},
+{0x0004013000001502LL, 0, 365},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002802LL, 0, 366},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 367},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003302LL, 0, 368},
+{0x0004013000003402LL, 0, 369},
+{0x0004013000003502LL, 0, 182},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 370},
+{0x0004013020001503LL, 0, 314},
+{0x0004013020001602LL, 0, 371},
+{0x0004013020001703LL, 0, 316},
+{0x0004013020001803LL, 0, 317},
+{0x0004013020001A03LL, 0, 318},
+{0x0004013020001B03LL, 0, 319},
+{0x0004013020001C02LL, 0, 320},
+{0x0004013020001C03LL, 0, 321},
+{0x0004013020001D03LL, 0, 322},
+{0x0004013020001E02LL, 0, 323},
+{0x0004013020001E03LL, 0, 324},
+{0x0004013020001F02LL, 0, 325},
+{0x0004013020001F03LL, 0, 326},
+{0x0004013020002103LL, 0, 327},
+{0x0004013020002202LL, 0, 328},
+{0x0004013020002203LL, 0, 329},
+{0x0004013020002302LL, 0, 330},
+{0x0004013020002303LL, 0, 331},
+{0x0004013020002403LL, 0, 332},
+{0x0004013020002703LL, 0, 333},
+{0x0004013020002903LL, 0, 334},
+{0x0004013020002C03LL, 0, 335},
+{0x0004013020002D03LL, 0, 336},
+{0x0004013020002E03LL, 0, 337},
+{0x0004013020002F03LL, 0, 338},
+{0x0004013020003103LL, 0, 339},
+{0x0004013020003203LL, 0, 340},
+{0x0004013020003303LL, 0, 341},
+{0x0004013020004002LL, 0, 372},
+{0x0004013020004102LL, 0, 343},
+{0x0004013020004202LL, 0, 344},
+{0x0004013020008003LL, 0, 345},
+{0x0004013820000002LL, 0, 346},
+{0x0004013820000003LL, 0, 347},
+{0x0004013820000102LL, 0, 348},
+{0x0004013820000202LL, 0, 349},
+// v17120, 0004013820000002, 0004003000008F02
+{0x0004001000021000LL, 0, 186},
+{0x0004001000021100LL, 0, 187},
+{0x0004001000021400LL, 0, 190},
+{0x0004001000021900LL, 0, 194},
+{0x0004001000021A00LL, 0, 195},
+{0x000400100002C000LL, 0, 201},
+{0x0004001020021300LL, 0, 373},
+{0x0004001020021D00LL, 0, 374},
+{0x0004001020024100LL, 0, 375},
+{0x000400102002CF00LL, 0, 376},
+{0x000400102002D100LL, 0, 377},
+{0x000400102002D300LL, 0, 378},
+{0x000400102002D500LL, 0, 379},
+{0x0004001B00010702LL, 0, 17},
+{0x0004001B00010802LL, 0, 146},
+{0x0004001B00018002LL, 0, 147},
+{0x0004001B00018102LL, 0, 20},
+{0x0004001B00018202LL, 0, 21},
+{0x0004003000008A02LL, 0, 22},
+{0x0004003000008B02LL, 0, 202},
+{0x0004003000008F02LL, 0, 203},
+{0x0004003000009002LL, 0, 204},
+{0x0004003000009202LL, 0, 205},
+{0x0004003000009302LL, 0, 206},
+{0x0004003000009602LL, 0, 208},
+{0x0004003000009702LL, 0, 209},
+{0x000400300000BD02LL, 0, 210},
+{0x000400300000C502LL, 0, 162},
+{0x000400300000C802LL, 0, 211},
+{0x000400300000C902LL, 0, 213},
+{0x000400300000CB02LL, 0, 214},
+{0x000400300000CC02LL, 0, 215},
+{0x000400300000CD02LL, 0, 35},
+{0x000400300000CE02LL, 0, 380},
+{0x000400300000F602LL, 0, 42},
+{0x0004003020008A03LL, 0, 307},
+{0x0004003020009402LL, 0, 381},
+{0x000400302000C503LL, 0, 309},
+{0x000400302000C803LL, 0, 382},
+{0x0004009B00010402LL, 0, 164},
+{0x0004009B00012302LL, 0, 220},
+{0x0004009B00013302LL, 0, 221},
+{0x000400DB00010302LL, 0, 169},
+{0x000400DB00010502LL, 0, 170},
+{0x000400DB00017302LL, 0, 224},
+{0x000400DB20016302LL, 0, 383},
+{0x0004013000001502LL, 0, 65},
+{0x0004013000001702LL, 0, 173},
+{0x0004013000001802LL, 0, 70},
+{0x0004013000001D02LL, 0, 78},
+{0x0004013000002402LL, 0, 91},
+{0x0004013000002602LL, 0, 93},
+{0x0004013000002702LL, 0, 94},
+{0x0004013000002802LL, 0, 177},
+{0x0004013000002902LL, 0, 178},
+{0x0004013000002B02LL, 0, 101},
+{0x0004013000002C02LL, 0, 179},
+{0x0004013000002D02LL, 0, 104},
+{0x0004013000002E02LL, 0, 106},
+{0x0004013000002F02LL, 0, 180},
+{0x0004013000003102LL, 0, 110},
+{0x0004013000003202LL, 0, 112},
+{0x0004013000003302LL, 0, 181},
+{0x0004013000003402LL, 0, 116},
+{0x0004013000003502LL, 0, 182},
+{0x0004013000003702LL, 0, 118},
+{0x0004013000003802LL, 0, 183},
+{0x0004013000008002LL, 0, 260},
+{0x0004013020001503LL, 0, 314},
+{0x0004013020001602LL, 0, 315},
+{0x0004013020001703LL, 0, 316},
+{0x0004013020001803LL, 0, 317},
+{0x0004013020001A03LL, 0, 318},
+{0x0004013020001B03LL, 0, 319},
+{0x0004013020001C02LL, 0, 320},
+{0x0004013020001C03LL, 0, 321},
+{0x0004013020001D03LL, 0, 322},
+{0x0004013020001E02LL, 0, 323},
+{0x0004013020001E03LL, 0, 324},
+{0x0004013020001F02LL, 0, 325},
+{0x0004013020001F03LL, 0, 326},
+{0x0004013020002103LL, 0, 327},
+{0x0004013020002202LL, 0, 328},
+{0x0004013020002203LL, 0, 329},
+{0x0004013020002302LL, 0, 330},
+{0x0004013020002303LL, 0, 331},
+{0x0004013020002403LL, 0, 332},
+{0x0004013020002703LL, 0, 333},
+{0x0004013020002903LL, 0, 334},
+{0x0004013020002C03LL, 0, 335},
+{0x0004013020002D03LL, 0, 336},
+{0x0004013020002E03LL, 0, 337},
+{0x0004013020002F03LL, 0, 338},
+{0x0004013020003103LL, 0, 339},
+{0x0004013020003203LL, 0, 340},
+{0x0004013020003303LL, 0, 341},
+{0x0004013020004002LL, 0, 342},
+{0x0004013020004102LL, 0, 343},
+{0x0004013020004202LL, 0, 344},
+{0x0004013020008003LL, 0, 345},
+{0x0004013820000002LL, 0, 346},
+{0x0004013820000003LL, 0, 347},
+{0x0004013820000102LL, 0, 348},
+{0x0004013820000202LL, 0, 349},
+// v3553, 0004013800000002, 0004003000009802
+{0x0004001000022000LL, 0, 384},
+{0x0004001000022100LL, 0, 385},
+{0x0004001000022200LL, 0, 386},
+{0x0004001000022300LL, 0, 387},
+{0x0004001000022400LL, 0, 388},
+{0x0004001000022500LL, 0, 389},
+{0x0004001000022700LL, 0, 390},
+{0x0004001000022800LL, 0, 391},
+{0x0004001000022900LL, 0, 392},
+{0x0004001000022A00LL, 0, 393},
+{0x0004001000022B00LL, 0, 394},
+{0x0004001000022D00LL, 0, 395},
+{0x0004001000022E00LL, 0, 396},
+{0x0004001000022F00LL, 0, 397},
+{0x0004001000025000LL, 0, 14},
+{0x0004001B00010002LL, 0, 16},
+{0x0004003000008A02LL, 0, 398},
+{0x0004003000008A03LL, 0, 23},
+{0x0004003000009802LL, 0, 399},
+{0x0004003000009902LL, 0, 400},
+{0x0004003000009B02LL, 0, 401},
+{0x0004003000009C02LL, 0, 402},
+{0x0004003000009D02LL, 0, 403},
+{0x0004003000009F02LL, 0, 404},
+{0x000400300000A002LL, 0, 405},
+{0x000400300000C502LL, 0, 406},
+{0x000400300000C503LL, 0, 34},
+{0x000400300000D002LL, 0, 407},
+{0x000400300000D003LL, 0, 37},
+{0x000400300000D102LL, 0, 408},
+{0x000400300000D302LL, 0, 409},
+{0x000400300000D402LL, 0, 410},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 411},
+{0x0004009B00010602LL, 0, 412},
+{0x0004009B00011202LL, 0, 46},
+{0x0004009B00011302LL, 0, 47},
+{0x0004009B00011502LL, 0, 48},
+{0x0004009B00011702LL, 0, 49},
+{0x0004009B00011802LL, 0, 50},
+{0x0004009B00011B02LL, 0, 51},
+{0x0004009B00011C02LL, 0, 52},
+{0x0004009B00011D02LL, 0, 53},
+{0x0004009B00012102LL, 0, 413},
+{0x0004009B00013102LL, 0, 414},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 415},
+{0x0004009B00014202LL, 0, 416},
+{0x0004009B00014302LL, 0, 417},
+{0x0004009B00015102LL, 0, 418},
+{0x000400DB00010302LL, 0, 419},
+{0x000400DB00010502LL, 0, 420},
+{0x000400DB00016102LL, 0, 421},
+{0x000400DB00017102LL, 0, 422},
+{0x0004013000001502LL, 0, 423},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 424},
+{0x0004013000001702LL, 0, 425},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 426},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 427},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 428},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 429},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 430},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 431},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 432},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 433},
+{0x0004013000002102LL, 0, 434},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 435},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 436},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 437},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 438},
+{0x0004013000002702LL, 0, 439},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 440},
+{0x0004013000002902LL, 0, 441},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 442},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 443},
+{0x0004013000002C02LL, 0, 444},
+{0x0004013000002C03LL, 0, 103},
+{0x0004013000002D02LL, 0, 445},
+{0x0004013000002D03LL, 0, 446},
+{0x0004013000002E02LL, 0, 447},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 448},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 449},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 450},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 451},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 452},
+{0x0004013000003502LL, 0, 453},
+{0x0004013000003702LL, 0, 454},
+{0x0004013000008002LL, 0, 455},
+{0x0004013000008003LL, 0, 121},
+{0x0004013800000002LL, 0, 456},
+{0x0004013800000003LL, 0, 457},
+{0x0004013800000102LL, 0, 458},
+// v3553, 0004013800000002, 0004003000008202
+{0x0004001000020000LL, 0, 459},
+{0x0004001000020100LL, 0, 460},
+{0x0004001000020200LL, 0, 461},
+{0x0004001000020300LL, 0, 462},
+{0x0004001000020400LL, 0, 463},
+{0x0004001000020500LL, 0, 464},
+{0x0004001000020700LL, 0, 465},
+{0x0004001000020900LL, 0, 466},
+{0x0004001000020A00LL, 0, 467},
+{0x0004001000020B00LL, 0, 468},
+{0x0004001000020D00LL, 0, 141},
+{0x0004001000020E00LL, 0, 142},
+{0x0004001000020F00LL, 0, 469},
+{0x0004001000023000LL, 0, 144},
+{0x0004001B00010002LL, 0, 16},
+{0x0004003000008202LL, 0, 470},
+{0x0004003000008402LL, 0, 471},
+{0x0004003000008602LL, 0, 472},
+{0x0004003000008702LL, 0, 473},
+{0x0004003000008802LL, 0, 474},
+{0x0004003000008A02LL, 0, 398},
+{0x0004003000008A03LL, 0, 23},
+{0x0004003000008D02LL, 0, 475},
+{0x0004003000008E02LL, 0, 476},
+{0x000400300000C002LL, 0, 477},
+{0x000400300000C003LL, 0, 158},
+{0x000400300000C102LL, 0, 478},
+{0x000400300000C302LL, 0, 479},
+{0x000400300000C402LL, 0, 480},
+{0x000400300000C502LL, 0, 406},
+{0x000400300000C503LL, 0, 34},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 411},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011902LL, 0, 165},
+{0x0004009B00012202LL, 0, 481},
+{0x0004009B00013202LL, 0, 167},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 415},
+{0x0004009B00014202LL, 0, 416},
+{0x0004009B00014302LL, 0, 417},
+{0x0004009B00015202LL, 0, 168},
+{0x000400DB00010302LL, 0, 419},
+{0x000400DB00010502LL, 0, 482},
+{0x000400DB00016202LL, 0, 483},
+{0x000400DB00017202LL, 0, 484},
+{0x0004013000001502LL, 0, 485},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 486},
+{0x0004013000001702LL, 0, 425},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 426},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 427},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 428},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 429},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 430},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 431},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 432},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 433},
+{0x0004013000002102LL, 0, 434},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 435},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 436},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 437},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 438},
+{0x0004013000002702LL, 0, 439},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 487},
+{0x0004013000002902LL, 0, 441},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 442},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 443},
+{0x0004013000002C02LL, 0, 488},
+{0x0004013000002C03LL, 0, 103},
+{0x0004013000002D02LL, 0, 445},
+{0x0004013000002D03LL, 0, 446},
+{0x0004013000002E02LL, 0, 447},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 448},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 449},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 489},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 490},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 491},
+{0x0004013000003502LL, 0, 453},
+{0x0004013000003702LL, 0, 454},
+{0x0004013000008002LL, 0, 492},
+{0x0004013000008003LL, 0, 121},
+{0x0004013800000002LL, 0, 493},
+{0x0004013800000003LL, 0, 457},
+{0x0004013800000102LL, 0, 458},
+{0x0004800542383841LL, 0, 494},
+{0x00048005484E4441LL, 0, 127},
+{0x0004800F484E4841LL, 0, 495},
+{0x0004800F484E4C41LL, 0, 129},
+// v3553, 0004013800000002, 0004003000008F02
+{0x0004001000021000LL, 0, 496},
+{0x0004001000021100LL, 0, 497},
+{0x0004001000021200LL, 0, 498},
+{0x0004001000021300LL, 0, 499},
+{0x0004001000021400LL, 0, 500},
+{0x0004001000021500LL, 0, 501},
+{0x0004001000021700LL, 0, 502},
+{0x0004001000021900LL, 0, 503},
+{0x0004001000021A00LL, 0, 504},
+{0x0004001000021B00LL, 0, 505},
+{0x0004001000021D00LL, 0, 506},
+{0x0004001000021E00LL, 0, 507},
+{0x0004001000021F00LL, 0, 508},
+{0x0004001000024000LL, 0, 200},
+{0x0004001B00010002LL, 0, 16},
+{0x0004003000008A02LL, 0, 398},
+{0x0004003000008A03LL, 0, 23},
+{0x0004003000008F02LL, 0, 509},
+{0x0004003000009002LL, 0, 510},
+{0x0004003000009202LL, 0, 511},
+{0x0004003000009302LL, 0, 512},
+{0x0004003000009402LL, 0, 513},
+{0x0004003000009602LL, 0, 514},
+{0x0004003000009702LL, 0, 515},
+{0x000400300000C502LL, 0, 406},
+{0x000400300000C503LL, 0, 34},
+{0x000400300000C802LL, 0, 516},
+{0x000400300000C803LL, 0, 212},
+{0x000400300000C902LL, 0, 517},
+{0x000400300000CB02LL, 0, 518},
+{0x000400300000CC02LL, 0, 519},
+{0x0004009B00010202LL, 0, 43},
+{0x0004009B00010402LL, 0, 411},
+{0x0004009B00010602LL, 0, 45},
+{0x0004009B00011402LL, 0, 217},
+{0x0004009B00011602LL, 0, 218},
+{0x0004009B00011D02LL, 0, 53},
+{0x0004009B00011E02LL, 0, 219},
+{0x0004009B00012302LL, 0, 520},
+{0x0004009B00013302LL, 0, 521},
+{0x0004009B00014002LL, 0, 56},
+{0x0004009B00014102LL, 0, 415},
+{0x0004009B00014202LL, 0, 416},
+{0x0004009B00014302LL, 0, 417},
+{0x0004009B00015302LL, 0, 222},
+{0x000400DB00010302LL, 0, 419},
+{0x000400DB00010502LL, 0, 482},
+{0x000400DB00016302LL, 0, 522},
+{0x000400DB00017302LL, 0, 523},
+{0x0004013000001502LL, 0, 485},
+{0x0004013000001503LL, 0, 66},
+{0x0004013000001602LL, 0, 486},
+{0x0004013000001702LL, 0, 425},
+{0x0004013000001703LL, 0, 69},
+{0x0004013000001802LL, 0, 426},
+{0x0004013000001803LL, 0, 71},
+{0x0004013000001A02LL, 0, 427},
+{0x0004013000001A03LL, 0, 73},
+{0x0004013000001B02LL, 0, 428},
+{0x0004013000001B03LL, 0, 75},
+{0x0004013000001C02LL, 0, 429},
+{0x0004013000001C03LL, 0, 77},
+{0x0004013000001D02LL, 0, 430},
+{0x0004013000001D03LL, 0, 79},
+{0x0004013000001E02LL, 0, 431},
+{0x0004013000001E03LL, 0, 81},
+{0x0004013000001F02LL, 0, 432},
+{0x0004013000001F03LL, 0, 83},
+{0x0004013000002002LL, 0, 433},
+{0x0004013000002102LL, 0, 434},
+{0x0004013000002103LL, 0, 86},
+{0x0004013000002202LL, 0, 435},
+{0x0004013000002203LL, 0, 88},
+{0x0004013000002302LL, 0, 436},
+{0x0004013000002303LL, 0, 90},
+{0x0004013000002402LL, 0, 437},
+{0x0004013000002403LL, 0, 92},
+{0x0004013000002602LL, 0, 438},
+{0x0004013000002702LL, 0, 439},
+{0x0004013000002703LL, 0, 95},
+{0x0004013000002802LL, 0, 487},
+{0x0004013000002902LL, 0, 441},
+{0x0004013000002903LL, 0, 98},
+{0x0004013000002A02LL, 0, 442},
+{0x0004013000002A03LL, 0, 100},
+{0x0004013000002B02LL, 0, 443},
+{0x0004013000002C02LL, 0, 488},
+{0x0004013000002C03LL, 0, 103},
+{0x0004013000002D02LL, 0, 445},
+{0x0004013000002D03LL, 0, 446},
+{0x0004013000002E02LL, 0, 447},
+{0x0004013000002E03LL, 0, 107},
+{0x0004013000002F02LL, 0, 448},
+{0x0004013000002F03LL, 0, 109},
+{0x0004013000003102LL, 0, 449},
+{0x0004013000003103LL, 0, 111},
+{0x0004013000003202LL, 0, 489},
+{0x0004013000003203LL, 0, 113},
+{0x0004013000003302LL, 0, 490},
+{0x0004013000003303LL, 0, 115},
+{0x0004013000003402LL, 0, 491},
+{0x0004013000003502LL, 0, 453},
+{0x0004013000003702LL, 0, 454},
+{0x0004013000008002LL, 0, 524},
+{0x0004013000008003LL, 0, 121},
+{0x0004013800000002LL, 0, 493},
+{0x0004013800000003LL, 0, 457},
+{0x0004013800000102LL, 0, 458},
+{0x0004800542383841LL, 0, 494},
+{0x00048005484E4441LL, 0, 127},
+{0x0004800F484E4841LL, 0, 495},
+{0x0004800F484E4C41LL, 0, 129}
 };
 
-std::map<std::string, std::string> oldHashes2_1_0U = {
-{"0004001000021000.cia", "41db472aeb22d364dcdb241e45504bd167126a62b58c30ca27fe2eb046b8f706"},
-{"0004001000021100.cia", "74b1c37a36b897795d38fc3e4398f754eb764b7bcea8d97e50f56ab86f3aac7a"},
-{"0004001000021200.cia", "b006ef19cacb17ce74dde8f8246d726b5b4915252e5d37b28b0d90e2753ded90"},
-{"0004001000021300.cia", "b3729a3145cf85ba4287a9359ff61498ebf69fdd99e7a0ce585cad621ac4201b"},
-{"0004001000021400.cia", "e7e4f14e3dabae3b64b01702c87eb18095561f75021eb27a35272de0fe603d89"},
-{"0004001000021500.cia", "88199d1c60f7880eb3359967cca2266bee6b136e00fb61fed6fbc091a7f5f523"},
-{"0004001000021700.cia", "749b6f78b6f9fbc6f8fbff51e1a40d66aa2118462596b683d0992f1592510e3c"},
-{"0004001000021900.cia", "ff7bff0f2fc857ea2f59cacb057620763177d6ff691c3a7e516abedec4ff6870"},
-{"0004001000021A00.cia", "30df6f1cf814afaead6e46e2e7ba874bb3685cab64478478e845670d684e4644"},
-{"0004001000021B00.cia", "875497d809d19527800b652368245e0d0f8ac08653e843077d33d2baf6f785c1"},
-{"0004001000021D00.cia", "cd109b4e408415298aa1f3cd863a9f3579cee7781bbf74dcd5db5af41019d2d4"},
-{"0004001000021E00.cia", "a5b0e1ffdc4b60abc2bdd33fc6b91ac510c214416dff72136336dac7ed4d2053"},
-{"0004001000021F00.cia", "0634d4515ca46fc5359f633ad09ceefac509ef1d567ffd16f29598e7624075dc"},
-{"0004001000024000.cia", "8d4cd98c993aca61f04f07a221b4d18e3a6d4ffb3ff1e5e394f62a3832e6129b"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004003000008A02.cia", "03b3e2a1d2109e1ecfe0e57cd4bbb68edc0195f431231b57e0aa3f669226aab2"},
-{"0004003000008A03.cia", "d801824e9198a30812bd873ab6daa6120677905921aec36f84d3b99a8474e7a8"},
-{"0004003000008F02.cia", "8279b480d013c956a1104dc2c8e4446118ce9ffdcd286efc10a578509a9a2da0"},
-{"0004003000009002.cia", "8213daebb4c20806e70e6e48f950b3021483d9ccba090c8d6fef0c00e21ea3d2"},
-{"0004003000009202.cia", "56e65c123291262c06de35740eddb691313e9f723f945a02cf42bc02443e80a7"},
-{"0004003000009302.cia", "bea6ce80c5e837e5cf3a86167b956d9d75b68d1d0b9922704b2af2e9e8f2bde1"},
-{"0004003000009402.cia", "608d10cb75a2ef3f5715c0d95384db57852a82c8ac1d7f0a8b2aca5da9b9a10e"},
-{"0004003000009602.cia", "d56b7d037ba46306cc34682a8d2677ca08a8dcfaa28a6374caebce368855cda1"},
-{"0004003000009702.cia", "a199dc2433cde432fd80ceb065631526f3d89dcae75831e84d5022ee2f2a13ee"},
-{"000400300000C502.cia", "a99109d8ec714e2981ab289c042b39ffcdd3208d50fe274bfc90cfa2e716c8c7"},
-{"000400300000C503.cia", "ffab7a4be558f69845b2d81cdde444b027078f146f5d4b3746f4e925ef1eab41"},
-{"000400300000C802.cia", "91e10f64434021e69786aa210b7d708853e1618d572bcfca46a4f8168088f0da"},
-{"000400300000C803.cia", "2c8a6e37d7ca4935adbb215bc56b2a0065d91e9a438c30886ac9df1116762d04"},
-{"000400300000C902.cia", "63ba3daaa77f85e3a04d49ff580e8852700c1132a3fa2531b50159dc1deb66aa"},
-{"000400300000CB02.cia", "ef4a0b7d70cf320342f0c3476083e18b550d2c83978cded8f6bf10c4b77a3692"},
-{"000400300000CC02.cia", "5ca0c1d1485fefacc07c054f93a385762b8995dd8c922619745d9e075e4abb4b"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "a0bedf49faf09c32d58696296f11090acc762d2fc21177f9e12f21ed6f071007"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011402.cia", "3aaef18ef12596df4647646bf290c8228f3b7e0f8579a97af3cc5e0871a6b913"},
-{"0004009B00011602.cia", "eb8386ea499a102ac815c5e3f18b1cef7378035bdf244f222e2dac4897699561"},
-{"0004009B00011D02.cia", "b415e29df37906fe5bcb0edbe4f8e847b772d0254ecc4c2c97bbaced8e1458d3"},
-{"0004009B00011E02.cia", "91b99e10da6d5f6b6823987b5064b96c9274d32a0c3edfe2db443dbf2f7c8892"},
-{"0004009B00012302.cia", "1b5899402f5c196da821bbee24b8a4e3ba706e811790031932c500bcfc79be96"},
-{"0004009B00013302.cia", "cc958696b267f86cdb58f9cafa84dee4d34bb13f2d738fb1c405c53542f17e8c"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "9df3e5035a178dcfcb85151b3368c42d6d64a5d3aafc9a83835f12dd135ccad0"},
-{"0004009B00014202.cia", "354f0cfae5458d2d1474c29465e317e5fd4f3edfed6e0e9da1cf1699f111fe88"},
-{"0004009B00014302.cia", "36b0cfeb085ce013aa86c4d9204d11a33692669fe994097445310d8a1b443015"},
-{"0004009B00015302.cia", "cc33454d5451c4543e6793c7a4ff96861809b41be9bd9ffc9464478f1aca9b92"},
-{"000400DB00010302.cia", "83c33485d3fc9c933c2065f17dd10568a6853445aab9fe1719910fbd022bd1f4"},
-{"000400DB00010502.cia", "dc8fee72b9cba64ed339428c1717c618375c9ee02850665e16774556dc1e7fc9"},
-{"000400DB00016302.cia", "2c5b9bf8f4e733a855d39a36cbb1d1877b9002d50eb580327f0706413ebe9bf9"},
-{"000400DB00017302.cia", "c8ececccca11c85b8e961e43aa8fd8f1a95b5e83b63e48a066ac683980a29140"},
-{"0004013000001502.cia", "98ddc9ed4a405760ef92fb94df8e5a5126598565056056a28adabce434b58d09"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "b159e949638f76e477c92f1c981b563beb00b8f26c73522963e4c19422c0dc9f"},
-{"0004013000001702.cia", "4042bbc3225f3d25b44eb752bcafee892a9afc8fdb498d416d09b68954635049"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "959c7bfbccbc6c75efffa869b3738306d173a9289348c66d06a01124ed8de448"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "e73a7353d0461f844b8d655e5c8be64310ee5d646b154a2328476ec109cc3f4f"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "27e04e1e89783294c781d7396783a464805cc0c6b12ae8c84b60afd67a4b1245"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8a734f27e5ffac152956b583257937b39750172d236a0d8acb7a61f43bbbea5c"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "efbd47c3c2aafad335193781949fa060dc7059fd18c953ff35715fa5c8324cd5"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "608473b7cf35a5206b5583239b5e6d7d187556bbc91241a35ac02d06b4aec884"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "b55400def59c104449b0ac89046d9e25e4ee6b3d7f0061cc1bc7ce2224cb27fd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "f0385abbdaf697cf503a2d0a4af9ee57d7240a10b333f146f61ba62d135bedb0"},
-{"0004013000002102.cia", "89002e2a5877cb7bba0caaf0a3514c6ffb68d6215299df9e1188efcda6495dd9"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "61f5cc6cf5a318af26e4f7ee0d8670b4b4a816def337b8a96077ecdc562b7040"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "677a1094ab6231f0d5dfb472e496d851817d1d578326d62c3b4cc477c420af92"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "e872d8b6b104f7848534a250128dc3ba1945e70f3d025caef9c8aba4ac76bd17"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "f52c1ad745914aa5e586f6ef5db4915def639799d58dd6f064d72befa5bcd035"},
-{"0004013000002702.cia", "381c99a5654800e48139c6ea34a77631474e20857b3a8072d73c72309407efe3"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "ce81c48cdb4bd084511627c48f0bc06dff8247cdcc7546d682421307d4c87aca"},
-{"0004013000002902.cia", "94cb38c721febaa19b855313fc75539402415ef4c54fb80153855755b8ca7c68"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "7cb3638f7077566e1c8dc487b3a72390299dfe968b2a252508c84047dd93714e"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "5eedb5e761c8a52b75dbb3715115d96ee69126518607da2a282b48ad5a5118b0"},
-{"0004013000002C02.cia", "4b195f4d69b5f0d44fb078193ac1286702c26180253853896be7ab7ef7fc6d0c"},
-{"0004013000002C03.cia", "64299626e854c53b28d53b491b1f669c9c5aab0c00f4c90abbae0a410b5712e1"},
-{"0004013000002D02.cia", "de01713861009f758c8048a782b50d20427dac0f91e2894d7a6a52c44ca09af0"},
-{"0004013000002D03.cia", "786dab650e9dde2b04c122703487f5efda7738ca4f227742943cf96ac0a8f1a0"},
-{"0004013000002E02.cia", "869f28aed3b0411ede1465fbbcb4288dbfc5c41c34bb375593c6f821478d6048"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "39c655fff4cf8694c0ad81e5676bcb10b9964749bfa2396f12e2eff9cc31d730"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "7503e9e4b129b1ad69a4752ee6be9b260d146376b73a5632dc026319b6869e35"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "fe236902eb22ae79d5ab6bc9e56349a770fe0766741086d96d9d68ed7b1fdaff"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "84100ae6fb3034d3229e95e1e2091cb6c897e4f8e83a71d74843d4cbf21ed680"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "ad6b21e32abdb4c4a25fe39415f9542ea1627787d173e60ceb4b00d28f9a946d"},
-{"0004013000003502.cia", "a4dc12975dc37ff8a78c93215bf2b2317ebe1d12b588e9d6aa1f150c3084ef48"},
-{"0004013000003702.cia", "266711953b31d4af12d37d86cbad4a0c442adeaff4f406ca1d9b488ee541ebb7"},
-{"0004013000008002.cia", "7dd6dbd76a622484a71ad0f564acc56574897e59da34ceefbc6d8b0002132f45"},
-{"0004013000008003.cia", "67410a62d701aef615a535c46fd1209e3a869be00e719f93fdb02544addceb82"},
-{"0004013800000002.cia", "08b39134438c35abc6109560256d6e1c9bcc33c1926c7b6d203c54bcdd04efcf"},
-{"0004013800000003.cia", "e201a7ef750b9d8909b637f9b8fb6af3ae73061636d32176782b673e034f5c51"},
-{"0004013800000102.cia", "117cca47bbc90e36f8595159fbe165b999648e45a93d2f20ce1624054882c962"},
-{"0004800542383841.cia", "4c10618443b0b71ef394e43a53e97afe468987f9f074e09f00586fe82754f755"},
-{"00048005484E4441.cia", "78deea6826817610953b9e407d2d08a8fb6ec0d1c750927bc39bc96518a91fa8"},
-{"0004800F484E4841.cia", "7cd0b5477ed6636c52a201e4e329b3eb4e50e14a7f2cc874d5454067b0d070e9"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
+static const manifest::SetRecord builtinSets[] = {
+{0x0004013800000002LL, 0x0004003000009802LL, 17120, 0, 130},
+{0x0004013800000002LL, 0x0004003000008202LL, 17120, 130, 123},
+{0x0004013800000002LL, 0x0004003000008F02LL, 17120, 253, 126},
+{0x0004013800000002LL, 0x000400300000A902LL, 17120, 379, 111},
+{0x0004013800000002LL, 0x000400300000B102LL, 17120, 490, 111},
+{0x0004013820000002LL, 0x0004003000009802LL, 17120, 601, 104},
+{0x0004013820000002LL, 0x0004003000008202LL, 17120, 705, 102},
+{0x0004013820000002LL, 0x0004003000008F02LL, 17120, 807, 104},
+{0x0004013800000002LL, 0x0004003000009802LL, 3553, 911, 113},
+{0x0004013800000002LL, 0x0004003000008202LL, 3553, 1024, 109},
+{0x0004013800000002LL, 0x0004003000008F02LL, 3553, 1133, 112}
 };
 
-std::map<std::string, std::string> oldHashes9_2_0E = {
-{"0004001000022000.cia", "2f23da1e1815c66f4c35d5b1a21cea2852fe0de9ffa69e0ecd6b3fbd65371d82"},
-{"0004001000022100.cia", "3fd82c971c56bc8d886c3f5950ff4293477468b64a7815f10e1478b4416ce315"},
-{"0004001000022200.cia", "af3d125ad8f54660eb905d58bb0c3bc2d9e757249a8b3de7718f80f5a83936b2"},
-{"0004001000022300.cia", "9a4ae976148052cec61636f7eca75664f1863a6f88879567dea4d99955e1d397"},
-{"0004001000022400.cia", "257c9029ffbb4f0c448fa7997b680697a0dc2768dd1a06de577eb935702ff4e8"},
-{"0004001000022500.cia", "9ded6fc8519df1c849c414bea0906a8b281bab2b6ca474ae8972c28807c19383"},
-{"0004001000022700.cia", "14265b92844df10cbb6e277104ce900f68af1d51d2b699fb85bae166fba9cd27"},
-{"0004001000022800.cia", "6dc430421e3aa6983be59bdb4b9c65e260a7f4ec537720dc49bc8f5141ee5d11"},
-{"0004001000022900.cia", "5486821d91c21af2c811120447d85c98685a3df53aa48a26ca439f8b6df1d995"},
-{"0004001000022A00.cia", "d7c89b60f8cad7e5038fa0307877bd5f9fbec734e71c1950f4a9fa0ff7d86eb4"},
-{"0004001000022B00.cia", "3250fd7367f091f465246461612b20b955b3d5bf7840b9778665324392363eb8"},
-{"0004001000022D00.cia", "cfc36d1fd7c711d5fb16e7de2711a39bf93eb20af2d9b500e53fbe2cf13af156"},
-{"0004001000022E00.cia", "d810498366085714948a2e7bd83da2a4e01fdc6055be630b8f1b872df00ba2f2"},
-{"0004001000022F00.cia", "96b20d6dba1982ec9bb7523f4e4ad18d8b6b9d5dd2c6416272a89c2d776dae1b"},
-{"0004001000025000.cia", "12b66740fd192c59b0e5ff9d7e6e9dc317df1331e0af528c572e12127e57ead0"},
-{"000400100002C100.cia", "cdd43228be780169be89677ca35f11424c3594a4138cf962cded3cf7fee9d7f9"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "e3cfff43d59e77bfd966993615597613e40e2753b1553011c9193b07adc01bb9"},
-{"0004001B00018002.cia", "d11cc53f459a654ce71bec5f6144f2d3f88873bc22421cefa088b2542467dc9f"},
-{"0004001B00018102.cia", "f0841d10d588aaf3d07aeb7f048d7d1bf3eb291dc5eabe06620734fcb1a61248"},
-{"0004001B00018202.cia", "191cfc05695e39e799e363c013f4b9dfbd5d67ef184b209311f661c6f26d2613"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"0004003000008A03.cia", "d801824e9198a30812bd873ab6daa6120677905921aec36f84d3b99a8474e7a8"},
-{"0004003000009802.cia", "c333c5c211f9b10c3946c01d92b5b3191754d000577a8d54c93f20518452d6b9"},
-{"0004003000009902.cia", "5476a604c5e94bdc2866ccb82da209c0683dd50db314d5291503efb7f9156ff9"},
-{"0004003000009B02.cia", "bb49598a566bdeab9c1f0830bab0f586c3da43c8994463856f69d6c0b0059ffe"},
-{"0004003000009C02.cia", "945404d82ea9ae8851e84415d5fe1bcbbddec9548ec11e7388647f336262d71b"},
-{"0004003000009D02.cia", "c495c64e13ce58e489d1ec71374d47474915980049be184535d04128b8f37950"},
-{"0004003000009F02.cia", "7278874ab82c75117c87daed753c57199d6362f7e49afd41fa28918939683e4d"},
-{"000400300000A002.cia", "531288843e9c58ba4ed9eb0a0f553f9b1d2e46519e442b27988e98561198882e"},
-{"000400300000BA02.cia", "f9b867b80361b72224bb4bc067a01522b13ab188cfe9f6209f8bd451132f142a"},
-{"000400300000BE02.cia", "bfee4a83b826971665bd894d04da9de1dd2b568df82bba1ac645d75abaa8241c"},
-{"000400300000C502.cia", "329e6dfed8131811abb91c7e3c2d87ab0e494376a62256a8a24b37d53e869933"},
-{"000400300000C503.cia", "ffab7a4be558f69845b2d81cdde444b027078f146f5d4b3746f4e925ef1eab41"},
-{"000400300000CD02.cia", "e04f8b0fb7274c6d0aee76e9de3cdb4bbdf88a40bbba8a6e8234bd11a82c24f7"},
-{"000400300000D002.cia", "2e126d7a77e13d35efe30799bb967c2a393a0364dc445a240e6fbf4b34bf6577"},
-{"000400300000D003.cia", "7d68f810a471ed5b67b3fbfa5a189f90c5fa6d933f309062654d640b666bd35c"},
-{"000400300000D102.cia", "2b2511255905143e526bc481cf87ad433166ade7499f21dfab23ee418be8034f"},
-{"000400300000D302.cia", "c7a8cff4a6cef74d09ef875ca7029ea9e0cc75a8b771c73ff4d6621c23c9f5d6"},
-{"000400300000D402.cia", "41d789838aae4a5a6b5ff7ac88f91f7a4bb66740bea22d5ab08270b537be384e"},
-{"000400300000D602.cia", "bc0f8234359b511c9a200ee3182149d0b99025327e3fd90a8d1921d1bbc48efb"},
-{"000400300000F602.cia", "71331cac11ae2f19405f7a941f4a88591128289f627cad3f5f891bce3476aefd"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "7d54a7fbf20fc2a525fb647c4288e6b6aa16e606cbb5049f198d0527f4ae41bf"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011202.cia", "7c3e7e0e8c7491bfe5f9d4d8aa0bd227e0d4efae1f9a56f707c5f6a7829a9984"},
-{"0004009B00011302.cia", "940bf39b42032a42b1fa851ac747b87bc694d1a87e921de3315db38485fcf5e4"},
-{"0004009B00011502.cia", "68b7f11b4db925bb7b49b399e1788aaf22734768acaf61a7bb4c705dabcddb45"},
-{"0004009B00011702.cia", "d54310ace0b165ee09a34f3c4b14d9409e0d03971a194644df0803ce50c747cb"},
-{"0004009B00011802.cia", "91456cc609adfdb1c3ba1ff996906cd0e7847596ff786e8403463ddfb32de345"},
-{"0004009B00011B02.cia", "7931c8817577c39f2aea225ebb32e4a5ba390f4a40f6fd2c1699eaa04d98d1ff"},
-{"0004009B00011C02.cia", "aa1f3852b3caa76ec516e3716da6c33543997918b4deb2330efde1d1bf49413e"},
-{"0004009B00011D02.cia", "b415e29df37906fe5bcb0edbe4f8e847b772d0254ecc4c2c97bbaced8e1458d3"},
-{"0004009B00012102.cia", "26973938cc7075a1203799d3e8688c3601b7ca5818eafc82f6bf72771fbf4612"},
-{"0004009B00013102.cia", "df98587f19e708687daaeea49030cd434299de201b52ee2731ae000785d851db"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "f38dfa5449fc0fd88821fbfe871b19e6af237b90c194e00ef4d2d9fc2387ffca"},
-{"0004009B00014202.cia", "adeb954bf9d39e6291ece878ca8ba70716b0a7d51370f6a5ea44489d235176c5"},
-{"0004009B00014302.cia", "adf7bbcf880c534738122251481f4904c9a18c8940f5c1c83a3dd796bc46c1f2"},
-{"0004009B00015102.cia", "c79cef0448dda8756b127b42397aec3faab490303e903ac22c5db845cab8f3a8"},
-{"000400DB00010302.cia", "bc5ed7193b2a2d5f67a4222a3ccc2dde389b97a0dcf1f6f55fbf37ccb305bf4a"},
-{"000400DB00010502.cia", "94447c4a9aaa761bf36928730930571236cceb782522d9bed97d22c8f6a9b661"},
-{"000400DB00016102.cia", "a83689cb522e01f5059f6aa029bb9745f6d0fc108bd97f14c0b3fedd77953b35"},
-{"000400DB00017102.cia", "754538e5f49f772e3fb55cf2be2510772e330a61e28d42ed2a471d1d9e8e53e6"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "15f90c7ba6349832c0d93aec4ca618083900a2fd80262dc393e480d56eee0bd9"},
-{"0004013000001702.cia", "0a983c19a570034b6c50b1babdd95f13f1f59d73881dd86308b2e437ea429e7e"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "8f3b0b3b9fe5637ee5f1de00e8559e6c9cd7831e7fc4483ac8c65dfb3de89c43"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "40b09a76779e2b6505756ed7d62a0863befe875a7add375a854e1fe0ef65c3c7"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "e43bd48f8a0ca1ec44c045e4fd17f5e3f0dc79c2c5bb99da0e9a352b6199ae84"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "14d55093a18b417cfd788145a6cee38c661290235817f8032f406d942cdd5797"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "c06807c854047100dc49f2dbe74c84f70dda2918f5d1478d3021ea4fddc399bd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "2287e54d5edb628c46f9ec8ab6d7db68e424c5c140073b1c0ffe97d188c06613"},
-{"0004013000002102.cia", "8b10d0312ea48f60911951e77b083797c6ac596a98ff8a41e2ce84c7daabc63f"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "5e9b7ca73fd7417d4deba5cef238a41fadb39a1c17064451c2a94128a1feef06"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "4ad3309935aa5c1aff742a00acef95800007d54b09c927bfc1df189763659683"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "9d0a480be956ae30d1794623b8ff8e3225d69489ba956feeaadf7c648fae8e9e"},
-{"0004013000002902.cia", "24daaf547398ec1a5a407f12e95cdbef7618c2b901a9fd8699eef65505a93930"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "ddf04efdfcf856ed49a1622f69354da172e9ac8a301113e2c6046e45b799d3af"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "676a9c98309ff92b0433b9d28e449d57e4eda8ca77dc25a982c3530f2639162b"},
-{"0004013000002C03.cia", "64299626e854c53b28d53b491b1f669c9c5aab0c00f4c90abbae0a410b5712e1"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002D03.cia", "0b03622b59895de4e8734de40c53c42ca3a324bfd0e12ef8e35e4fc759585215"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "65dd56483627850a8c55832719cd21d378966fcf5451b94cd887d4197bbea619"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "24e9e18cb2a00d9e122aec6065b4c81b1d05cb21b3b6f7c0f1be77e805328d48"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "b129c8f5ce76d2336cbc5de88e23ed40d214842ae0e7e6122ae71b5a8e6c3e9b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "35702f8e1ca2ad3fd44bce688da874cf4a0cdf1e3c34b203ea4e3221cd36cfdb"},
-{"0004013000008002.cia", "529d52d7b5cb348cfa039c566120c06eb4990aeda360af45b1e9eabbe5e7d071"},
-{"0004013000008003.cia", "67410a62d701aef615a535c46fd1209e3a869be00e719f93fdb02544addceb82"},
-{"0004013800000002.cia", "540abb61c0ce2b6537a7bec087f1742db9b9ff27d0e318b70e3a1a005a16427c"},
-{"0004013800000003.cia", "f3f135cd7346ab560f48055a41f4704c72f4a2e7752bc22134fdd88bed0b0c84"},
-{"0004013800000102.cia", "4117debef6d064633efde4bbb699beeb32947b38b46f446a9970568d71a1663a"},
-{"0004013800000202.cia", "ad5a32c4ba770923907c948e535b04febda417bcce624fea4a15481719f1efba"},
-{"0004800542383841.cia", "4bdb852a24f4fd720171d82250d8bdf1233127ff6a0f769fbfc4db167c475749"},
-{"00048005484E4441.cia", "78deea6826817610953b9e407d2d08a8fb6ec0d1c750927bc39bc96518a91fa8"},
-{"0004800F484E4841.cia", "80e90497dc1838c7c662598272b73ace1155509b46c6cd836c65361e6d56c741"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
-};
-
-std::map<std::string, std::string> oldHashes9_2_0J = {
-{"0004001000020000.cia", "4fa96c596bacf5fd45f0923e193f9428949ac84881018d630adf71611fb7fe61"},
-{"0004001000020100.cia", "195cfdbb6d55ed417f673ba47207dca0343679ef7344c51772e33597d0692d72"},
-{"0004001000020200.cia", "089fa0a316a6fa239290592d9a25d5835252895457827e00ab859f4c0c7f61dc"},
-{"0004001000020300.cia", "1038b74817145ac1f24380bbb055a96f90f900a5aef6074f13127e33f3c1760b"},
-{"0004001000020400.cia", "6a7ca3ee505280326ee9295b6368c86e82a950115c4139232832491eb5e728bd"},
-{"0004001000020500.cia", "00ddbe706c3d5ccc258f68d898db901c33d021dc2fe01af378a15e9d7233008b"},
-{"0004001000020700.cia", "52d95de0636d3b76b87274d8e1f3dbfd3e0192ed22151678244e90dfab58f410"},
-{"0004001000020800.cia", "511427b6ff96df15bf970c220db417cb4fe230dec4151d313f3ebd6ec19f66e8"},
-{"0004001000020900.cia", "8d01ecb8f5f52e4b74ae06a2f6f37351435eb56a890047a46b32362924f0ab57"},
-{"0004001000020A00.cia", "0a63593968e9970adf90b69b45c0ba5b558bfcb6d4b624a26a4bdb2bf96e32b4"},
-{"0004001000020B00.cia", "e268c50276fe069c19ea6337402d67234987b2f3cbc8b626e7fcb0d14d43b90a"},
-{"0004001000020D00.cia", "a7aa976bcb09106439edfc2bd1d2ac005903f7caf01e5c81d6c3d863e24f1574"},
-{"0004001000020E00.cia", "cd9a99d02d3d70f1327f728a698ead9f54fe9fb68eba19853aa22dbe59b76c0d"},
-{"0004001000020F00.cia", "78ed470fd63ecb7365731201c74c50f347e9abeb513521c82a5dba21a1398b6b"},
-{"0004001000023000.cia", "20ed3c14cdf191d6e77ff4ada385880179062e217932fd89a4353148a8c3ee42"},
-{"000400100002BF00.cia", "e303bda42850c6cda5ba1d9072041f8d0ab54067ec2f77be1844534f77654747"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "60be2738a63f49459b81495b4b9ad13354aad47b3f89e2d5dee60bd429d80d5d"},
-{"0004001B00018002.cia", "630ffdbe219d66ecff48d5a65debb79c940f4fd89e94a01d72bac9ba39ec40d4"},
-{"0004001B00018102.cia", "f0841d10d588aaf3d07aeb7f048d7d1bf3eb291dc5eabe06620734fcb1a61248"},
-{"0004001B00018202.cia", "191cfc05695e39e799e363c013f4b9dfbd5d67ef184b209311f661c6f26d2613"},
-{"0004003000008202.cia", "174b241e2620bdea9329b425abe3ca92b7ddd01013ef41a0ebc5da66b5b47237"},
-{"0004003000008302.cia", "b5e6b6c4e75de10f6485f5e4e052a991942d23615b34279afcb7c42a9cec98c0"},
-{"0004003000008402.cia", "38842d8fbeb8e2fc933ec89360e0a7337facbdf071d528e9f00f3447439a211b"},
-{"0004003000008602.cia", "f722a7fc7845303bc73ecac839bfb541de70a227e2e0faa356808e0d04e1b4ff"},
-{"0004003000008702.cia", "a50b185601bb4c6416fb65d99c1b84d0a70eedea546fb144a87806c42f359be1"},
-{"0004003000008802.cia", "3b7e2716251a1c979fa991ffe066db166ba2c854bd528d89b52c0695fe99e236"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"0004003000008A03.cia", "d801824e9198a30812bd873ab6daa6120677905921aec36f84d3b99a8474e7a8"},
-{"0004003000008D02.cia", "0da0859df3a8fbde65ec7dc8d121c8b015591d43f59d76575a911ccb4dc126b1"},
-{"0004003000008E02.cia", "3dfd568c09c72ba9e351c92662d26eab9c98fe4a23cd16f2cab6bdd9e56f34b7"},
-{"000400300000BC02.cia", "6e13ff866af85109a6424319193be2199b741912aa85e6b97b87da6e25a5a77f"},
-{"000400300000C002.cia", "d36ef6a90b966d828831bac35a5f2fa8be3e5379f966388bd5fbf562f033c97c"},
-{"000400300000C003.cia", "57f383e90793faf9b6dce7bb42a1b1d709366a71ec52b6defb3163e462ab2d2d"},
-{"000400300000C102.cia", "7bcd78b918394063d0317c174396f1361c5ac8945bbc097c79deea8b156e2690"},
-{"000400300000C302.cia", "1519b6255e2c292c8deffab28c7e1644fcf2b9be1add05d38512047a34b967dc"},
-{"000400300000C402.cia", "6d7620eb440852c4c91a15c0387912afac1913c3b974641fdb8baaf0f8eee3b5"},
-{"000400300000C502.cia", "aeeb11aa73470a5e2fbb5aea35372209a6b9f712975406957330c205d317e6dd"},
-{"000400300000C503.cia", "ffab7a4be558f69845b2d81cdde444b027078f146f5d4b3746f4e925ef1eab41"},
-{"000400300000C602.cia", "61dfc4ec2204bfe223bcba82b3f57daf4969fc631986f1f547195e637eccef21"},
-{"000400300000CD02.cia", "e04f8b0fb7274c6d0aee76e9de3cdb4bbdf88a40bbba8a6e8234bd11a82c24f7"},
-{"000400300000F602.cia", "71331cac11ae2f19405f7a941f4a88591128289f627cad3f5f891bce3476aefd"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "4b63120b66de3c671cc82b3ab0ce902ed8ad0214a7517d8fbc68587df3e866e3"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011902.cia", "bcd58305164c9f148e3bb17ecbf4df53313f33e54c78144e18a5b1299c2797da"},
-{"0004009B00012202.cia", "01115ed75cdfbe4b699828382cf90e1eff65165b30a27fd0071f7403fcbaa815"},
-{"0004009B00013202.cia", "c3c15f03e3c852f911d1f21a7576424e9850daedc95f47b014aeba8e8c7a1beb"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "f38dfa5449fc0fd88821fbfe871b19e6af237b90c194e00ef4d2d9fc2387ffca"},
-{"0004009B00014202.cia", "adeb954bf9d39e6291ece878ca8ba70716b0a7d51370f6a5ea44489d235176c5"},
-{"0004009B00014302.cia", "adf7bbcf880c534738122251481f4904c9a18c8940f5c1c83a3dd796bc46c1f2"},
-{"0004009B00015202.cia", "a193ac1100c1cbc61981a6fed11e0ed86f28d9f1558d14c0defd0f3067c4e656"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "0c9f105615c2ae9c148a5d52338545f259bd5d38a1c74f34688cfa71ab34e4bc"},
-{"000400DB00016202.cia", "2fc94924cbacf226c9f84f1a449ad798ac1014ac932865c0ebcd79be0bad2bb4"},
-{"000400DB00017202.cia", "a201a475888ccab81ae0582e6975fb8b10ac6519db8d63200fb4e5f7399d4129"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "15f90c7ba6349832c0d93aec4ca618083900a2fd80262dc393e480d56eee0bd9"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "9737d7c33caabbff45dd274bec1bad7cc67f83668e7489af53a2215b333c96bb"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "40b09a76779e2b6505756ed7d62a0863befe875a7add375a854e1fe0ef65c3c7"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8dbb1da9c000be9efc0aeecdf423353a2bc831ee37eedb6c5553d37d3244c7d6"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "14d55093a18b417cfd788145a6cee38c661290235817f8032f406d942cdd5797"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "c06807c854047100dc49f2dbe74c84f70dda2918f5d1478d3021ea4fddc399bd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "2287e54d5edb628c46f9ec8ab6d7db68e424c5c140073b1c0ffe97d188c06613"},
-{"0004013000002102.cia", "8b10d0312ea48f60911951e77b083797c6ac596a98ff8a41e2ce84c7daabc63f"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "a7d287e20130e0494e0a3ec7077939785707e6e9a9af7ceec25d4213f359588a"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "4ad3309935aa5c1aff742a00acef95800007d54b09c927bfc1df189763659683"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "e0ee0d5ed75b57b80d36db782acf18e8a5b34b14573b31aeea87a22e416f60ee"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "ddf04efdfcf856ed49a1622f69354da172e9ac8a301113e2c6046e45b799d3af"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "6b831f5b3efe5a90c120b157fcd06cc47aa61efc5c7870f24e0f4ca61d9cdf52"},
-{"0004013000002C03.cia", "64299626e854c53b28d53b491b1f669c9c5aab0c00f4c90abbae0a410b5712e1"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002D03.cia", "0b03622b59895de4e8734de40c53c42ca3a324bfd0e12ef8e35e4fc759585215"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "a70f3ad7cf0e3416dea80aaeb7c33b78ae09cee97671c78bf75f6dada36ff942"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "269fc04ca722958546935e4874827c90b49e2df606098fc817ad4c42dc5b5f4b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "d646d1d0d3e205988e457e5189da45e2a0c7112358c42616cefec32fd29023d2"},
-{"0004013000008003.cia", "67410a62d701aef615a535c46fd1209e3a869be00e719f93fdb02544addceb82"},
-{"0004013800000002.cia", "6560e9c3f68f45a3fea08a4c6a5b62477bf2fd3ccc5f08c91d94bfc46caf5eab"},
-{"0004013800000003.cia", "f3f135cd7346ab560f48055a41f4704c72f4a2e7752bc22134fdd88bed0b0c84"},
-{"0004013800000102.cia", "4117debef6d064633efde4bbb699beeb32947b38b46f446a9970568d71a1663a"},
-{"0004013800000202.cia", "ad5a32c4ba770923907c948e535b04febda417bcce624fea4a15481719f1efba"},
-{"0004800542383841.cia", "4bdb852a24f4fd720171d82250d8bdf1233127ff6a0f769fbfc4db167c475749"},
-{"00048005484E4441.cia", "78deea6826817610953b9e407d2d08a8fb6ec0d1c750927bc39bc96518a91fa8"},
-{"0004800F484E4841.cia", "80e90497dc1838c7c662598272b73ace1155509b46c6cd836c65361e6d56c741"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
-};
-
-std::map<std::string, std::string> oldHashes9_2_0U = {
-{"0004001000021000.cia", "e858a4f26815e846315d20959fca0f989129168fb476d007a60d4457e434cf12"},
-{"0004001000021100.cia", "d8e0f1471d52b792bb327692f7a1ee57aebe02d2c4f5b4fda99cd5c36b59eb9c"},
-{"0004001000021200.cia", "84a5a0c1f51260cb41e934f3326201373e554a251ef4bc5e25073cf4df00b5e1"},
-{"0004001000021300.cia", "f98ca545d3a91bdd18fd7588e79f81752876a54d57a34ece5c92049f0dd5954a"},
-{"0004001000021400.cia", "6a7745b78b9b006e86ece5537348e8c094ef9f7deba9624d7a6383f204aa75ae"},
-{"0004001000021500.cia", "0f72abb1c799f014d242ed1bf38f4197af67ebe0cf1d440ace6a9d7fec082085"},
-{"0004001000021700.cia", "e80d82dcffa86506a9041b975bf9f19b0616ca933947b52e66e1db5cab589d67"},
-{"0004001000021800.cia", "a65f062c8360114637ec4b1157e1406b35cf80f6cf8cfca9649d3a62b50ed3a2"},
-{"0004001000021900.cia", "85721349cb8ded3e3815d7b5240b6e7314006f2c8734f73d5ff860b95827e261"},
-{"0004001000021A00.cia", "dc1606acca07f0c73a85e46701d8238e2ba45571e861e5acacd7887d9d4515a1"},
-{"0004001000021B00.cia", "f94dbc74fd75a0ff9031567ebaa7ff45829582d45947b8224617c4afbb8392ac"},
-{"0004001000021D00.cia", "423a1f6c0a1a6170451c00b7e4e5a33ee48f2bd4bb573a6e856646b75d7f051f"},
-{"0004001000021E00.cia", "19257456ff4139b292d0571b509e60f473d87e7eb1426925177110849984556a"},
-{"0004001000021F00.cia", "c908b3f3a5756ae7c0663ef9f494955734bc977d7d71fc2ff7307698bedd1e84"},
-{"0004001000024000.cia", "8d4cd98c993aca61f04f07a221b4d18e3a6d4ffb3ff1e5e394f62a3832e6129b"},
-{"000400100002C000.cia", "86a8f276d8f4b226a3955a4802eef5ca3b108691939a52d0290b8d89ebf13583"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "60be2738a63f49459b81495b4b9ad13354aad47b3f89e2d5dee60bd429d80d5d"},
-{"0004001B00018002.cia", "630ffdbe219d66ecff48d5a65debb79c940f4fd89e94a01d72bac9ba39ec40d4"},
-{"0004001B00018102.cia", "f0841d10d588aaf3d07aeb7f048d7d1bf3eb291dc5eabe06620734fcb1a61248"},
-{"0004001B00018202.cia", "191cfc05695e39e799e363c013f4b9dfbd5d67ef184b209311f661c6f26d2613"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"0004003000008A03.cia", "d801824e9198a30812bd873ab6daa6120677905921aec36f84d3b99a8474e7a8"},
-{"0004003000008B02.cia", "3322128172f9ff74ed954f0db85be34b0b306251ab19eb4d9db7ad3ad5e665bc"},
-{"0004003000008F02.cia", "52cd8af9eb4b8a32e1f4299e17756058ab91e33a024822b4400f39f19d2fceb5"},
-{"0004003000009002.cia", "e90744f5752007bb466a2d806de7ebe53ac14778ffc4b4a569cd039b24997940"},
-{"0004003000009202.cia", "03a8de3b9b6281e7f04e54b56724deed0643d911908ebc564f6a6ba07ec6d9a7"},
-{"0004003000009302.cia", "2653c8d726620ad4c87a57280045b105883065dba9d4bf9700ad2fb56370a512"},
-{"0004003000009402.cia", "fa3d3ac64f975c4442849b3558523deeaad215d72ebf863c75effabfb818a350"},
-{"0004003000009602.cia", "2dd0968ee44c4fd383482cb3424c5f1444c294d057ee37fce320e64e297a196c"},
-{"0004003000009702.cia", "959ee38b0bc7f0406d9aecd7db896ae5678cbb7f10cab83e11320956d0010d05"},
-{"000400300000BD02.cia", "c5946f018a37508c99c2ccfcc34ee5203a967448d9a77c56aad51a993c6c7b9f"},
-{"000400300000C502.cia", "aeeb11aa73470a5e2fbb5aea35372209a6b9f712975406957330c205d317e6dd"},
-{"000400300000C503.cia", "ffab7a4be558f69845b2d81cdde444b027078f146f5d4b3746f4e925ef1eab41"},
-{"000400300000C802.cia", "dc001b0194a7dabf4d7046010dac80aaed66e2573355d3195f227e98cd6bda51"},
-{"000400300000C803.cia", "2c8a6e37d7ca4935adbb215bc56b2a0065d91e9a438c30886ac9df1116762d04"},
-{"000400300000C902.cia", "6be107c8b1da744e6760816a1fa78e2febf0d59eb0f0d64407375cfdfabfcfa8"},
-{"000400300000CB02.cia", "64f447c5882a33e2913c9255ddbef6e1a85660b1ef575390fa95b3b3ecf882ab"},
-{"000400300000CC02.cia", "f2bec2993e33bc6b6faab07c5822a4ef5946cafa29424f9339c6737c29825931"},
-{"000400300000CD02.cia", "e04f8b0fb7274c6d0aee76e9de3cdb4bbdf88a40bbba8a6e8234bd11a82c24f7"},
-{"000400300000CE02.cia", "0d12eb0cc44e03cd89368fa492efd60384678e79a0ac2f5ac33730b8a04a50c3"},
-{"000400300000F602.cia", "71331cac11ae2f19405f7a941f4a88591128289f627cad3f5f891bce3476aefd"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "4b63120b66de3c671cc82b3ab0ce902ed8ad0214a7517d8fbc68587df3e866e3"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011402.cia", "3aaef18ef12596df4647646bf290c8228f3b7e0f8579a97af3cc5e0871a6b913"},
-{"0004009B00011602.cia", "eb8386ea499a102ac815c5e3f18b1cef7378035bdf244f222e2dac4897699561"},
-{"0004009B00011D02.cia", "b415e29df37906fe5bcb0edbe4f8e847b772d0254ecc4c2c97bbaced8e1458d3"},
-{"0004009B00011E02.cia", "91b99e10da6d5f6b6823987b5064b96c9274d32a0c3edfe2db443dbf2f7c8892"},
-{"0004009B00012302.cia", "2c73ab1b0739070f3532a193dc409ad4ed162d38fce95a8a3cb818b9e430c864"},
-{"0004009B00013302.cia", "0f1c036acc27cfbe1f6f99d843d76e95a51279aa7d6cf2fa86d39dbaed0dbcb8"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "f38dfa5449fc0fd88821fbfe871b19e6af237b90c194e00ef4d2d9fc2387ffca"},
-{"0004009B00014202.cia", "adeb954bf9d39e6291ece878ca8ba70716b0a7d51370f6a5ea44489d235176c5"},
-{"0004009B00014302.cia", "adf7bbcf880c534738122251481f4904c9a18c8940f5c1c83a3dd796bc46c1f2"},
-{"0004009B00015302.cia", "cc33454d5451c4543e6793c7a4ff96861809b41be9bd9ffc9464478f1aca9b92"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "0c9f105615c2ae9c148a5d52338545f259bd5d38a1c74f34688cfa71ab34e4bc"},
-{"000400DB00016302.cia", "3fbc6b061e3ed7cf6237e9d946f8ea5fdc4223ef1ee60a3725252d4db4f31854"},
-{"000400DB00017302.cia", "ad0704c2466f4a7440984df25008fcfb3824ecdf59dd7349dae89eb907c082ff"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "15f90c7ba6349832c0d93aec4ca618083900a2fd80262dc393e480d56eee0bd9"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "9737d7c33caabbff45dd274bec1bad7cc67f83668e7489af53a2215b333c96bb"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "40b09a76779e2b6505756ed7d62a0863befe875a7add375a854e1fe0ef65c3c7"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8dbb1da9c000be9efc0aeecdf423353a2bc831ee37eedb6c5553d37d3244c7d6"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "14d55093a18b417cfd788145a6cee38c661290235817f8032f406d942cdd5797"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "c06807c854047100dc49f2dbe74c84f70dda2918f5d1478d3021ea4fddc399bd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "2287e54d5edb628c46f9ec8ab6d7db68e424c5c140073b1c0ffe97d188c06613"},
-{"0004013000002102.cia", "8b10d0312ea48f60911951e77b083797c6ac596a98ff8a41e2ce84c7daabc63f"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "a7d287e20130e0494e0a3ec7077939785707e6e9a9af7ceec25d4213f359588a"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "4ad3309935aa5c1aff742a00acef95800007d54b09c927bfc1df189763659683"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "e0ee0d5ed75b57b80d36db782acf18e8a5b34b14573b31aeea87a22e416f60ee"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "ddf04efdfcf856ed49a1622f69354da172e9ac8a301113e2c6046e45b799d3af"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "6b831f5b3efe5a90c120b157fcd06cc47aa61efc5c7870f24e0f4ca61d9cdf52"},
-{"0004013000002C03.cia", "64299626e854c53b28d53b491b1f669c9c5aab0c00f4c90abbae0a410b5712e1"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002D03.cia", "0b03622b59895de4e8734de40c53c42ca3a324bfd0e12ef8e35e4fc759585215"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "a70f3ad7cf0e3416dea80aaeb7c33b78ae09cee97671c78bf75f6dada36ff942"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "269fc04ca722958546935e4874827c90b49e2df606098fc817ad4c42dc5b5f4b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "d646d1d0d3e205988e457e5189da45e2a0c7112358c42616cefec32fd29023d2"},
-{"0004013000008003.cia", "67410a62d701aef615a535c46fd1209e3a869be00e719f93fdb02544addceb82"},
-{"0004013800000002.cia", "6560e9c3f68f45a3fea08a4c6a5b62477bf2fd3ccc5f08c91d94bfc46caf5eab"},
-{"0004013800000003.cia", "f3f135cd7346ab560f48055a41f4704c72f4a2e7752bc22134fdd88bed0b0c84"},
-{"0004013800000102.cia", "4117debef6d064633efde4bbb699beeb32947b38b46f446a9970568d71a1663a"},
-{"0004013800000202.cia", "ad5a32c4ba770923907c948e535b04febda417bcce624fea4a15481719f1efba"},
-{"0004800542383841.cia", "4bdb852a24f4fd720171d82250d8bdf1233127ff6a0f769fbfc4db167c475749"},
-{"00048005484E4441.cia", "78deea6826817610953b9e407d2d08a8fb6ec0d1c750927bc39bc96518a91fa8"},
-{"0004800F484E4841.cia", "80e90497dc1838c7c662598272b73ace1155509b46c6cd836c65361e6d56c741"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
-};
-
-std::map<std::string, std::string> oldHashes9_0_0K = {
-{"0004001000027000.cia", "1e10b5ffc6dc1ff1b587ea38c5de1ed9c3c46eb2aaef0a9fcc1ef069ddf64309"},
-{"0004001000027100.cia", "5805deaeb4f9cd9d95bc47719e7cfec6beb8d4af43063ca4cafeb5610db09413"},
-{"0004001000027200.cia", "7045960d0994e238bc463c623f4bd6544d83d7c3098a745851df24cba4966cfa"},
-{"0004001000027300.cia", "2344d104e80d0d9a157645abb2b8f0bd1dd7f25dbbe802fff1cf5889375cffcb"},
-{"0004001000027400.cia", "f37ee12659018fc1e0fc362037b0f113b43276d45bcee8f02df1c72b00fceaa6"},
-{"0004001000027500.cia", "18f1bf1aa3be2665d4299689f7f74fbb5610e06cc1ca1ea99f1783521ee4c3fc"},
-{"0004001000027700.cia", "ad8c91e852f39d5e218b417aa4d12db4bce77b8bff5f4671fe64726c76596ac8"},
-{"0004001000027800.cia", "7ab088e4bbf777c86728b041594ecdfa714a9db27a1a60610faa05f30e50a410"},
-{"0004001000027900.cia", "e8f3f79892dcf539e69c42e7105b748aae7d087da6aff855eebfe8a6ec37d5cc"},
-{"0004001000027A00.cia", "44570054d12a05456a19fd97f51be8dd936de2a60be6047f9170fe75c88abe20"},
-{"0004001000027D00.cia", "a01d525c37215440c95ee7c4ee303492fc8b9396113aa326d5f52cc846d80cef"},
-{"0004001000027E00.cia", "4fb0c1f79cf8528a8c21f4a8cde1a236dedf95c63652e60ee1e25cc260b56d78"},
-{"0004001000027F00.cia", "d6a30617e6e038f2f983bd12ab7983129b10eeff7dd4f78342f3de82e5174be3"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "60be2738a63f49459b81495b4b9ad13354aad47b3f89e2d5dee60bd429d80d5d"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"000400300000A902.cia", "7dea42663c99a7c7e614b1ac635a208fba0f623ea271d260e5c1b05e99ce67bc"},
-{"000400300000AA02.cia", "95e1e4d865263cbf59d6f57b594e8f4edcb19fa15465a5c80fbd31739fe85f14"},
-{"000400300000AC02.cia", "781ed43a83863b79143629ec0afd17fc85bcfd02932a9fdd4af090194019747b"},
-{"000400300000AD02.cia", "52807256d5c00e807e016945a98ed26a6d49e8d2dcd2d097c9431f225612a036"},
-{"000400300000AE02.cia", "e2a1f065540f73d461bca92db61697d7bf7d8e2a341d814bf2246fb7fcca4aaa"},
-{"000400300000AF02.cia", "d4502cff31f1d9ae62c3b9d21ae3adb72dbb6a13721e9abb08a3d1d6d4a124f7"},
-{"000400300000B002.cia", "7e6309cb1e7ac19d7e4e1c84d752307b60fdc15a434b56f9e42d4523be92f997"},
-{"000400300000CF02.cia", "b351122b57aad8f1241f644079df395aac2fee0c0b1737f81f8d208f6f093f0e"},
-{"000400300000CF03.cia", "978aa537345a7c71f61128a7ea48b3809b21b22f590d1bf1e55e20949055e357"},
-{"000400300000D502.cia", "31e391204f0a3155a68655f62af552f95523b085b32f184103e6ae2e003344f5"},
-{"000400300000DE02.cia", "59e17a4e9cdc97777789352adf50bf758ffbf1f7380c72cd25de0566c3c5ce92"},
-{"000400300000DE03.cia", "61f8101059c2e591cb49386701033f51d00da133d3c0ba0b76a771a54e84d825"},
-{"000400300000DF02.cia", "b182c5b66faeaf90f7414f1961c623db2a0d9a223b091d85e16820a97f3c8765"},
-{"000400300000E102.cia", "b57ffdd7f8c167eec38996bc7c0264c11fd6fa06cf65e44266326997a4b7b31b"},
-{"000400300000E202.cia", "ae447491aa832f2ad17cb57045862bcfe8358b2535f8766c839e59219b91be56"},
-{"000400300000E302.cia", "a6dfd55abc90ee5befc5839ccf34c33f8322272441f6d5391c7a0c0656767458"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "4b63120b66de3c671cc82b3ab0ce902ed8ad0214a7517d8fbc68587df3e866e3"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011A02.cia", "6dbc1345335e0b2e4d42602f19af51d349b7e08a0ba3467a6391d0c601a61fe9"},
-{"0004009B00012502.cia", "451ac347d4a0b59283097d17f6ac05c4b8ce10614c708c9e8804a6803885e3d3"},
-{"0004009B00013502.cia", "b3064239df2b0a735d3243f0365177c22db0ed5535cca1a95cf83c737c8b2007"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "f38dfa5449fc0fd88821fbfe871b19e6af237b90c194e00ef4d2d9fc2387ffca"},
-{"0004009B00014202.cia", "adeb954bf9d39e6291ece878ca8ba70716b0a7d51370f6a5ea44489d235176c5"},
-{"0004009B00014302.cia", "adf7bbcf880c534738122251481f4904c9a18c8940f5c1c83a3dd796bc46c1f2"},
-{"0004009B00015502.cia", "91faefde874c35f26a28eff5a33e6d38c21027325cc79a6d6e11f970c180fa9c"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "0c9f105615c2ae9c148a5d52338545f259bd5d38a1c74f34688cfa71ab34e4bc"},
-{"000400DB00016502.cia", "cf32c656db8e58e260d6e8a7bca415d06df2d749dbf3eadbeee38807b4cb1dc7"},
-{"000400DB00017502.cia", "d1d140468c315f1e51f39b7ff16d54a6c79fa09dcc599943770f04b46801cece"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "15f90c7ba6349832c0d93aec4ca618083900a2fd80262dc393e480d56eee0bd9"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "9737d7c33caabbff45dd274bec1bad7cc67f83668e7489af53a2215b333c96bb"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "40b09a76779e2b6505756ed7d62a0863befe875a7add375a854e1fe0ef65c3c7"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8dbb1da9c000be9efc0aeecdf423353a2bc831ee37eedb6c5553d37d3244c7d6"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "14d55093a18b417cfd788145a6cee38c661290235817f8032f406d942cdd5797"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "c06807c854047100dc49f2dbe74c84f70dda2918f5d1478d3021ea4fddc399bd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "2287e54d5edb628c46f9ec8ab6d7db68e424c5c140073b1c0ffe97d188c06613"},
-{"0004013000002102.cia", "8b10d0312ea48f60911951e77b083797c6ac596a98ff8a41e2ce84c7daabc63f"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "a7d287e20130e0494e0a3ec7077939785707e6e9a9af7ceec25d4213f359588a"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "4ad3309935aa5c1aff742a00acef95800007d54b09c927bfc1df189763659683"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "e0ee0d5ed75b57b80d36db782acf18e8a5b34b14573b31aeea87a22e416f60ee"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "ddf04efdfcf856ed49a1622f69354da172e9ac8a301113e2c6046e45b799d3af"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "6b831f5b3efe5a90c120b157fcd06cc47aa61efc5c7870f24e0f4ca61d9cdf52"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002D03.cia", "0b03622b59895de4e8734de40c53c42ca3a324bfd0e12ef8e35e4fc759585215"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "a70f3ad7cf0e3416dea80aaeb7c33b78ae09cee97671c78bf75f6dada36ff942"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "269fc04ca722958546935e4874827c90b49e2df606098fc817ad4c42dc5b5f4b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "f760fe33422f8f3721e74ad1818f0f864f6ac4a0247e5fa2d0cb14d6670cecc9"},
-{"0004013800000002.cia", "6560e9c3f68f45a3fea08a4c6a5b62477bf2fd3ccc5f08c91d94bfc46caf5eab"},
-{"0004013800000003.cia", "f3f135cd7346ab560f48055a41f4704c72f4a2e7752bc22134fdd88bed0b0c84"},
-{"0004013800000102.cia", "4117debef6d064633efde4bbb699beeb32947b38b46f446a9970568d71a1663a"},
-{"0004013800000202.cia", "ad5a32c4ba770923907c948e535b04febda417bcce624fea4a15481719f1efba"},
-{"0004800542383841.cia", "4bdb852a24f4fd720171d82250d8bdf1233127ff6a0f769fbfc4db167c475749"},
-{"00048005484E444B.cia", "e8ce50185934288d635d3087c2debd5e23282c5bf6708d3fc56ce6b40e196224"},
-{"0004800F484E4841.cia", "80e90497dc1838c7c662598272b73ace1155509b46c6cd836c65361e6d56c741"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
-};
-
-std::map<std::string, std::string> oldHashes9_0_0T = {
-{"0004001000028000.cia", "159414d53e7d0455a43aa1723f950a145925f5f5164f09c1d486d10a948f8650"},
-{"0004001000028100.cia", "2a784613d2662d5dc0096abbb8b283ea21132d8f27d09486c8150029a5773a64"},
-{"0004001000028200.cia", "684bcaee2f3fe18f86e0399b6f3cc5ba874ce247323629c153c414dffabe0105"},
-{"0004001000028300.cia", "9544d2baf8b3970739782aa761e584db3e2580df2e5708e40dcf61c55a351a56"},
-{"0004001000028400.cia", "b2fb418fd3b4bdc21fe7aa03fcaa49cbb067e2eb63c0670c63bc46ca54fe5b36"},
-{"0004001000028500.cia", "2eb5a1402fd35da9cb3b06e682d36c2bafd1b7b667b589b2169fd395c0b652ed"},
-{"0004001000028700.cia", "a167245502d931adc27fbd00133294069e041b7a93d3cfba42fcaaf70274698f"},
-{"0004001000028800.cia", "3d52bddcdccab7f047262bcff0c1ec7e34367b2aa71f16cd53cf72c830a00b7d"},
-{"0004001000028900.cia", "fdc97d535548ea059246692bd11f39c16d7cc62d58f9a8bbd8040c4798afc4cd"},
-{"0004001000028A00.cia", "c7fd25de0186035fdb6b2b15437aac39bf8061bb23a37003cae6c6dba2c16a06"},
-{"0004001000028D00.cia", "c46dfedec2d477fc64d5e7498e3ed4a6d84ad435af01f3b8c0ec34b1502166e2"},
-{"0004001000028E00.cia", "66899c7f0b2b86c229efd1d5e97eecde24a23c405fd9ff1dc851b4cbb566fa16"},
-{"0004001000028F00.cia", "5f74f97bcff23723c61d4ab893f655f0f895857ff58f69705893ce1c05e7f2ae"},
-{"0004001B00010002.cia", "d8d9e4555451f796ff0179386dc527e3f7f3c6cd11f4ee171b251bd59e4893b9"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "60be2738a63f49459b81495b4b9ad13354aad47b3f89e2d5dee60bd429d80d5d"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"000400300000B102.cia", "28c0b788a61de2b9919e05b35a98127731abb1c34d628a057ba8d325afe0b840"},
-{"000400300000B202.cia", "9e01255bdb9150a52997765df2c6e460aae89e4e6e3a261626976f346351f506"},
-{"000400300000B402.cia", "629f733b195dd68c32fb10195cabe4b1634d5c102bf3c0e34cf8e93bbdb635f8"},
-{"000400300000B502.cia", "b6b4162d8d6f87e581298040c22f2ba5070d8fead5066e7550d381b0490ff1ec"},
-{"000400300000B602.cia", "63d9d14c2c85c121894216f6b60ff7bd7fccf901791c299b5b5f0989f3e56364"},
-{"000400300000B702.cia", "6d4562963a56c057dd96da1d13354dc51ffcb0e656d62478152574c251ac969d"},
-{"000400300000B802.cia", "55fd58d2bd2f93206d4945fc8c555335726c26f9c23c4530728352e227f258dc"},
-{"000400300000CF02.cia", "b351122b57aad8f1241f644079df395aac2fee0c0b1737f81f8d208f6f093f0e"},
-{"000400300000CF03.cia", "978aa537345a7c71f61128a7ea48b3809b21b22f590d1bf1e55e20949055e357"},
-{"000400300000D502.cia", "31e391204f0a3155a68655f62af552f95523b085b32f184103e6ae2e003344f5"},
-{"000400300000E402.cia", "033c6bea76f06131e7ee64e7693c591380c7392a2800662f32a71385ea739853"},
-{"000400300000E403.cia", "7ebf3a619dff22c9481b0a29b1db9061f04e026d447471c281aa215ac80be45a"},
-{"000400300000E502.cia", "b0b29e65edb05eb941c52f2f1b457efdd2512c7c3d19c9c15248c73688ce2746"},
-{"000400300000E702.cia", "47fbd59f021a2492524a32b8c08bed4ad1e37fe5101f2dc6a9c5945ab256d452"},
-{"000400300000E802.cia", "ee43c46d3c12fb38109e9655604fa3b4474f27d1e391fb0dd4b372f2ae15489f"},
-{"000400300000E902.cia", "cffd5cee18260615305ea42dc2547bc466f5575c2c4d81bdc500d03c75cad9c7"},
-{"0004009B00010202.cia", "ede2fb562e80cf66a1554da0cbe2609920e4dbffd9f97182d471b912b3079bfb"},
-{"0004009B00010402.cia", "4b63120b66de3c671cc82b3ab0ce902ed8ad0214a7517d8fbc68587df3e866e3"},
-{"0004009B00010602.cia", "5bb47cd082d2792e95f70df7170dd2b3a5a96e21a48abf32c624101f50cdc6c7"},
-{"0004009B00011102.cia", "5cae1143a4aabceea0d4b70dc944e508c2ecc6695cebd513d26dd29325c56d5a"},
-{"0004009B00012602.cia", "90ac9d369e0441043e86a566bbdbc197a5a20d33be12f1ac047ff668cccc9ed4"},
-{"0004009B00013602.cia", "04f36efdf186f69f37bf9854565810797d94605f5096eda6140c94f0be47a30e"},
-{"0004009B00014002.cia", "37d076c2e46540c8ddfdef8178a998a5cb44bec79b1a9164f1329e199919806e"},
-{"0004009B00014102.cia", "f38dfa5449fc0fd88821fbfe871b19e6af237b90c194e00ef4d2d9fc2387ffca"},
-{"0004009B00014202.cia", "adeb954bf9d39e6291ece878ca8ba70716b0a7d51370f6a5ea44489d235176c5"},
-{"0004009B00014302.cia", "adf7bbcf880c534738122251481f4904c9a18c8940f5c1c83a3dd796bc46c1f2"},
-{"0004009B00015602.cia", "b0a29c6d43e2d49c2a28f0ad3a555e635e562df2729b68c4410a2649adaf22ea"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "0c9f105615c2ae9c148a5d52338545f259bd5d38a1c74f34688cfa71ab34e4bc"},
-{"000400DB00016602.cia", "5dedaff920b0ba369c4b5cbed54df4de5c8e5a72df824e7fba29c2a8631626db"},
-{"000400DB00017602.cia", "1ec122fed26be341000f5b0dd5ce9d182b8c0df142b23ae48d9165bccb57aae5"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001503.cia", "d9e8501ef954f35ecc0469902b6f0e60347d2799a285006b9b62101040312c5b"},
-{"0004013000001602.cia", "15f90c7ba6349832c0d93aec4ca618083900a2fd80262dc393e480d56eee0bd9"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001703.cia", "5a6a9118a0602a8ce483dbd893644b73a5c9eefdb12f3a12eb2eadae86991dca"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001803.cia", "536a4add271f649aed3e0476272dc1ce8e7ba6124146cab25a51a6650baa9d8e"},
-{"0004013000001A02.cia", "9737d7c33caabbff45dd274bec1bad7cc67f83668e7489af53a2215b333c96bb"},
-{"0004013000001A03.cia", "1f4f44a8222c4a2872bb21130c1833e7beff424e7386aa755f9035767e952050"},
-{"0004013000001B02.cia", "40b09a76779e2b6505756ed7d62a0863befe875a7add375a854e1fe0ef65c3c7"},
-{"0004013000001B03.cia", "abd78712f4858e5f6551ca60c6e02230eea020e98cea434ecf768603b1078ca1"},
-{"0004013000001C02.cia", "8dbb1da9c000be9efc0aeecdf423353a2bc831ee37eedb6c5553d37d3244c7d6"},
-{"0004013000001C03.cia", "f6f854cf96e1788a66f0ec0f17a3ce95b0a5d30e903a27a91f681c46a0e7f481"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000001D03.cia", "d8448337a0899b995226a062a3d9b55c65a12968369a5f18d10a4dce7a025191"},
-{"0004013000001E02.cia", "14d55093a18b417cfd788145a6cee38c661290235817f8032f406d942cdd5797"},
-{"0004013000001E03.cia", "af1a3b1398bc49f47952f9b5e510f6590151071be68bd6adddc43252cafbd2a5"},
-{"0004013000001F02.cia", "c06807c854047100dc49f2dbe74c84f70dda2918f5d1478d3021ea4fddc399bd"},
-{"0004013000001F03.cia", "c71fca0145351014860dafeb76f176eb9d804a7e6af2250f5d51062115fa00fd"},
-{"0004013000002002.cia", "2287e54d5edb628c46f9ec8ab6d7db68e424c5c140073b1c0ffe97d188c06613"},
-{"0004013000002102.cia", "8b10d0312ea48f60911951e77b083797c6ac596a98ff8a41e2ce84c7daabc63f"},
-{"0004013000002103.cia", "ffb2105989306a0369f1336503f15c1c15d2824e13dae5c40dfb7ce06f5dbefd"},
-{"0004013000002202.cia", "a7d287e20130e0494e0a3ec7077939785707e6e9a9af7ceec25d4213f359588a"},
-{"0004013000002203.cia", "64e548984c1d07ab86dcf606420504ce147d76c64154c43f8dc2016c4895ccce"},
-{"0004013000002302.cia", "4ad3309935aa5c1aff742a00acef95800007d54b09c927bfc1df189763659683"},
-{"0004013000002303.cia", "d15e97b8cdcfe29ca104f29a90a249f8037af848092f4b7237a6b3fa47579251"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002403.cia", "a561b870b5310601dd49e943d5b8f1e7d00dcc5e747a897196b857dcbfd47d49"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002703.cia", "ee891fd45dc5d7392b315df768ec5a8129179884c15bef7ebf32554220c7b895"},
-{"0004013000002802.cia", "e0ee0d5ed75b57b80d36db782acf18e8a5b34b14573b31aeea87a22e416f60ee"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002903.cia", "21cde566a976775c90bdbff8339469042c4d04b2c2bfed40ed5b78834911da5b"},
-{"0004013000002A02.cia", "ddf04efdfcf856ed49a1622f69354da172e9ac8a301113e2c6046e45b799d3af"},
-{"0004013000002A03.cia", "56a10097f1a4a73a82f973aa331e78bc94c989dc1bd4613545492d966bcb4819"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "6b831f5b3efe5a90c120b157fcd06cc47aa61efc5c7870f24e0f4ca61d9cdf52"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002D03.cia", "0b03622b59895de4e8734de40c53c42ca3a324bfd0e12ef8e35e4fc759585215"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002E03.cia", "7fbfbb0c0d7e64e5f8bb66396202f4f4eb6aa4b7ec495c883a214e15f020c7cb"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000002F03.cia", "51f928970f139a809cbe307498afa0d42703c16b73fc3ac9323cc63d853eb483"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003103.cia", "c8f27c5f582b54c80c0998aeae421f1531ba78ad3de2fe7b850e91826046d883"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003203.cia", "69ef9ae9ccc06279f3d6d7b1f9d0f604fb25ac5e83d5da77bc674e115c25c9ee"},
-{"0004013000003302.cia", "a70f3ad7cf0e3416dea80aaeb7c33b78ae09cee97671c78bf75f6dada36ff942"},
-{"0004013000003303.cia", "49af0f7aa230e3ee1ea28b3135f9b6bb2b47a43f14bfc829959d9b00cfc4e8cb"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "269fc04ca722958546935e4874827c90b49e2df606098fc817ad4c42dc5b5f4b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "f760fe33422f8f3721e74ad1818f0f864f6ac4a0247e5fa2d0cb14d6670cecc9"},
-{"0004013800000002.cia", "6560e9c3f68f45a3fea08a4c6a5b62477bf2fd3ccc5f08c91d94bfc46caf5eab"},
-{"0004013800000003.cia", "f3f135cd7346ab560f48055a41f4704c72f4a2e7752bc22134fdd88bed0b0c84"},
-{"0004013800000102.cia", "4117debef6d064633efde4bbb699beeb32947b38b46f446a9970568d71a1663a"},
-{"0004013800000202.cia", "69f41945ae3a6d760ec6bd5162ef9d20d66f63ddbaffe5f45698d024285f58a9"},
-{"0004800542383841.cia", "4bdb852a24f4fd720171d82250d8bdf1233127ff6a0f769fbfc4db167c475749"},
-{"00048005484E4441.cia", "78deea6826817610953b9e407d2d08a8fb6ec0d1c750927bc39bc96518a91fa8"},
-{"0004800F484E4841.cia", "80e90497dc1838c7c662598272b73ace1155509b46c6cd836c65361e6d56c741"},
-{"0004800F484E4C41.cia", "d3c6cf927bbdf120a8ef711e34092f0a769767c084d1edde5f7c64160da60382"}
-};
-
-std::map<std::string, std::string> newHashes9_2_0E = {
-{"0004001000022000.cia", "2f23da1e1815c66f4c35d5b1a21cea2852fe0de9ffa69e0ecd6b3fbd65371d82"},
-{"0004001000022100.cia", "3fd82c971c56bc8d886c3f5950ff4293477468b64a7815f10e1478b4416ce315"},
-{"0004001000022400.cia", "257c9029ffbb4f0c448fa7997b680697a0dc2768dd1a06de577eb935702ff4e8"},
-{"0004001000022900.cia", "d3dbf702be6b59a66001fdb7db8839a2e06652705000a268e552d0610f2cee3f"},
-{"0004001000022A00.cia", "dde24740057fbafefddfb582bb64f34c88379f3081c60493c0cb8f483602444c"},
-{"000400100002C100.cia", "cdd43228be780169be89677ca35f11424c3594a4138cf962cded3cf7fee9d7f9"},
-{"0004001020022300.cia", "6f08765e8c7d175b0a64f886fef6bd6948985642d64fa3195d91d4190be71e38"},
-{"0004001020022D00.cia", "4e51207ca527e16c9861d1c7c327101e0c941523d93690583e66200446634b05"},
-{"0004001020025100.cia", "4f002f22e14426553ea268627cf7e31829b76fa06412424d45e08398e8043037"},
-{"000400102002D000.cia", "9537b45bd4acf9044715ba76d7f11e690740a5de4b3ae5fe7b9a79bebe83a2e9"},
-{"000400102002D200.cia", "746fbafaa57384771e71fba6f4b5b0d05aaec17f22ba09d0aa7d34962aae0dd4"},
-{"000400102002D400.cia", "d46865890ca6d250b2234401ced0f8573568e0c7cdd12632417dafdb26ee9605"},
-{"000400102002D600.cia", "393e3d16b7b9c08d69c478acd5e519696866f74b04b763cdd639cd7660c1620d"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "e3cfff43d59e77bfd966993615597613e40e2753b1553011c9193b07adc01bb9"},
-{"0004001B00018002.cia", "630ffdbe219d66ecff48d5a65debb79c940f4fd89e94a01d72bac9ba39ec40d4"},
-{"0004001B00018102.cia", "f0841d10d588aaf3d07aeb7f048d7d1bf3eb291dc5eabe06620734fcb1a61248"},
-{"0004001B00018202.cia", "191cfc05695e39e799e363c013f4b9dfbd5d67ef184b209311f661c6f26d2613"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"0004003000009802.cia", "11354faa9be78a08b4c6922b95948e0f02b3ea40f34dafc822b2161871bb94f8"},
-{"0004003000009902.cia", "5476a604c5e94bdc2866ccb82da209c0683dd50db314d5291503efb7f9156ff9"},
-{"0004003000009B02.cia", "bb49598a566bdeab9c1f0830bab0f586c3da43c8994463856f69d6c0b0059ffe"},
-{"0004003000009C02.cia", "945404d82ea9ae8851e84415d5fe1bcbbddec9548ec11e7388647f336262d71b"},
-{"0004003000009F02.cia", "7278874ab82c75117c87daed753c57199d6362f7e49afd41fa28918939683e4d"},
-{"000400300000A002.cia", "531288843e9c58ba4ed9eb0a0f553f9b1d2e46519e442b27988e98561198882e"},
-{"000400300000BA02.cia", "f9b867b80361b72224bb4bc067a01522b13ab188cfe9f6209f8bd451132f142a"},
-{"000400300000BE02.cia", "dbd72d4017d05e42549aefa45946fcab7817246d6fd00f3e3cdb39eff4ca499f"},
-{"000400300000C502.cia", "aeeb11aa73470a5e2fbb5aea35372209a6b9f712975406957330c205d317e6dd"},
-{"000400300000CD02.cia", "e04f8b0fb7274c6d0aee76e9de3cdb4bbdf88a40bbba8a6e8234bd11a82c24f7"},
-{"000400300000D002.cia", "2e126d7a77e13d35efe30799bb967c2a393a0364dc445a240e6fbf4b34bf6577"},
-{"000400300000D102.cia", "2b2511255905143e526bc481cf87ad433166ade7499f21dfab23ee418be8034f"},
-{"000400300000D302.cia", "c7a8cff4a6cef74d09ef875ca7029ea9e0cc75a8b771c73ff4d6621c23c9f5d6"},
-{"000400300000D402.cia", "41d789838aae4a5a6b5ff7ac88f91f7a4bb66740bea22d5ab08270b537be384e"},
-{"000400300000D602.cia", "1648a1fc629051f084e411478a3db576d13f883e5c6dd7dcdd57e78875a22bf1"},
-{"000400300000F602.cia", "71331cac11ae2f19405f7a941f4a88591128289f627cad3f5f891bce3476aefd"},
-{"0004003020008A03.cia", "3b8a962082e7e6010f85ed2674e66ba9ef89988ddfe71462f8f4f1d2c7b526e8"},
-{"0004003020009D02.cia", "73fbee0471ddef012f65e992fe76cd04456942b21d1f52ecb6a9cd6971d72e15"},
-{"000400302000C503.cia", "b60968a84e49ca18bb5b7cbbda8bb902b8c98bbc26eea6addc4b891cbc83ad4a"},
-{"000400302000D003.cia", "a1fc6644a25a34f0385ba46a37a49a42c72d64e5935c1e4b496c43c61d2ac0fa"},
-{"0004009B00010402.cia", "7d54a7fbf20fc2a525fb647c4288e6b6aa16e606cbb5049f198d0527f4ae41bf"},
-{"0004009B00012102.cia", "d821d6d180f5ecc69bdac0cee9bff975c36ef029d8953a9c5d720e2fae9d676d"},
-{"0004009B00013102.cia", "df98587f19e708687daaeea49030cd434299de201b52ee2731ae000785d851db"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "0c9f105615c2ae9c148a5d52338545f259bd5d38a1c74f34688cfa71ab34e4bc"},
-{"000400DB00017102.cia", "382d5be71cd92bc715c546a1424ad1a939573f3bacf46441da80f3a0cb8adbd8"},
-{"000400DB20016102.cia", "ad0adb7e55fcb2ce1518fb5efa3d41bae3f40abde38ca5b702fede5de1dc0f83"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002802.cia", "e0ee0d5ed75b57b80d36db782acf18e8a5b34b14573b31aeea87a22e416f60ee"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "6b831f5b3efe5a90c120b157fcd06cc47aa61efc5c7870f24e0f4ca61d9cdf52"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003302.cia", "a70f3ad7cf0e3416dea80aaeb7c33b78ae09cee97671c78bf75f6dada36ff942"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "b129c8f5ce76d2336cbc5de88e23ed40d214842ae0e7e6122ae71b5a8e6c3e9b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "d646d1d0d3e205988e457e5189da45e2a0c7112358c42616cefec32fd29023d2"},
-{"0004013020001503.cia", "0850f43b1a8c7ce04bb459a4f4482da43b505f9f8ca2438320d0dda64864ae08"},
-{"0004013020001602.cia", "069371a6a961d10a7f415a7167417c096c50b1c7ac293b0923e5b21a702b8b77"},
-{"0004013020001703.cia", "bf4e2c4eeabdbc6367577fb0a20dc3d960e374f5741a52203f663270afd0b6ee"},
-{"0004013020001803.cia", "55243a2d688ae3841f395627a34f4b5a196f0350853259fd6bd486034b680dce"},
-{"0004013020001A03.cia", "85f3c44f1a831b6a27fc18902152105dcff223a3a6da3ea5984c824c66897424"},
-{"0004013020001B03.cia", "82cae4a69542ab120be51e691c7801ab5b24e8c3a7ad8ced5e6fcbb14cea5abc"},
-{"0004013020001C02.cia", "db03d9b41a22c584ff7f81116e5e11a47840cfeb7723e1f1ac7ea1244f9d56c6"},
-{"0004013020001C03.cia", "63470b451ec352030ba0bdaf16c0b4b18ebe1a6adc3b73baf985fe92467e8652"},
-{"0004013020001D03.cia", "2c0eaffe4c3fe6376341925e454813984c2e110c6615aa7ab6c27395048ad2c0"},
-{"0004013020001E02.cia", "7a76a9145e0e365a901392e1df8414dfe8522ff49818862df1104099061e4828"},
-{"0004013020001E03.cia", "71e0dc11eba127e9e6c07b32b56d7d61fe138e3359810db9eafa64f67cc9ea87"},
-{"0004013020001F02.cia", "ea96331317afcd686d02b246276c24c4b8ca02d2530790fa1f43fea784bfdad4"},
-{"0004013020001F03.cia", "2746e07e04da7536ceef3c2a695bef7e3fdb292527bb3f190c6d744edf6e6997"},
-{"0004013020002103.cia", "aa26ee303eaa5ceb8ad59b201752826e8015c0883158fbb3beacab8bd93618a7"},
-{"0004013020002202.cia", "6842ff3912f86d614b42ce80bcc332e7769f8db7ed84df09d5fe78240572541b"},
-{"0004013020002203.cia", "948580451570472ea12f6ca15210de5075aad855a27b87f8952772fe23173135"},
-{"0004013020002302.cia", "26e89799bda450eab078bc17341268ae8cc8781d6264e34aca048f1bf0f8cb24"},
-{"0004013020002303.cia", "97807ab2ee417f9041722bf5e416f1fa9ef04f193edf8c5db50b085dc24e1cd7"},
-{"0004013020002403.cia", "3dcf4663047d5bd5bcae9216b241c58c371b0292b4bc196230417791f4681405"},
-{"0004013020002703.cia", "14c7c0c28ee617a18b789f30f04d2f4a1661cf06fc5a9dbf2b895ba95942b179"},
-{"0004013020002903.cia", "5a5e24338de534d21a856e3471180a05e012a13fefd4b4fb10d062c88633eb91"},
-{"0004013020002C03.cia", "23c17bcc1746861bbacefe6ad71b8640a68ad8b07067cf67ff5dcc702e0e1d73"},
-{"0004013020002D03.cia", "550386a9f7edafc3e991d53e5e61a58b1d9c28ccaebd085192d6ba6b29235203"},
-{"0004013020002E03.cia", "46872eb8781f865bb2590192b31d34a226f0ccf3c50826bdbb4537c05e206604"},
-{"0004013020002F03.cia", "003a19dec26e0ad4e870b3141053a29892b4e6f99e3b2d5d152c177a3c3c5ecc"},
-{"0004013020003103.cia", "0da2c0b01fce866a5079557c472978a16469dd236d2885f705ebe661653520da"},
-{"0004013020003203.cia", "4edcb63a9d05a64b5f62223bd38b5fa7b29bd413fae290a58071763e93be6491"},
-{"0004013020003303.cia", "d7bea2ee87abc2e6de0f3fd5796d9d1dc4a2985ce1cccdee3a73f7664c3f78ee"},
-{"0004013020004002.cia", "1890b5ad1744cb511c5cab74ad9ec9651917de15bbb23ce5004bee0b4e5025ad"},
-{"0004013020004102.cia", "ec082390ab44b23ea6564c162137e37ec6243e6eada9340f0bc30b98973b203c"},
-{"0004013020004202.cia", "754de6ec34bcd368ebcf2630f1d2a4728c65e83aae8d62a8a9096a4d6fcd352f"},
-{"0004013020008003.cia", "9fe78114ce601c13a321f88966414b94ce9b601c0cdf88d4121b3cd48742cb98"},
-{"0004013820000002.cia", "d417d3816808d95d0959e4ce4726a83599280d7cd611a00e0f7e3beb488f3680"},
-{"0004013820000003.cia", "f4593a8f5067b83fd658748b325c148a52fd46b841774a352509df14d9878878"},
-{"0004013820000102.cia", "89d884a01ed8593c58d3f23d777e772d87cc9f57b432cf899309cd96e8911838"},
-{"0004013820000202.cia", "66a4910ddcce3e69049712182833400ebaf68e0ba283b548ca4528f383fccc59"}
-};
-
-std::map<std::string, std::string> newHashes9_2_0J = {
-{"0004001000020000.cia", "4fa96c596bacf5fd45f0923e193f9428949ac84881018d630adf71611fb7fe61"},
-{"0004001000020100.cia", "195cfdbb6d55ed417f673ba47207dca0343679ef7344c51772e33597d0692d72"},
-{"0004001000020400.cia", "6a7ca3ee505280326ee9295b6368c86e82a950115c4139232832491eb5e728bd"},
-{"0004001000020900.cia", "f8a42641613a2c8ccc2cc1cc7482bd79891714ecbeaa6a6d716a2a81af6160f7"},
-{"0004001000020A00.cia", "0a63593968e9970adf90b69b45c0ba5b558bfcb6d4b624a26a4bdb2bf96e32b4"},
-{"000400100002BF00.cia", "e303bda42850c6cda5ba1d9072041f8d0ab54067ec2f77be1844534f77654747"},
-{"0004001020020300.cia", "7acc0b25f40f47d8e0c344645304a2f0e84a7c45a634ad09619a777ebf2d5844"},
-{"0004001020020D00.cia", "dcb2a05e108578cdbf98c63834486ad920790dc6d56e9c63ff51df4785b2981d"},
-{"0004001020023100.cia", "25f3034b657ebde14ec503f1ae1cebe4932371ce6a6eee99b9171f970c179a65"},
-{"000400102002C800.cia", "60796aebc726d3033b9b686f523ab38e6732a5e98fc3d075d0cee45e63465a81"},
-{"000400102002C900.cia", "5efc160b9dd963cbd4264d3ca6233ffbf6fc5c36536d84e77c1a1c0220f0725a"},
-{"000400102002CB00.cia", "6b8d17e36a85a4997483d31db766a10d1c70d198b919dad005e1c13df62694ad"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "60be2738a63f49459b81495b4b9ad13354aad47b3f89e2d5dee60bd429d80d5d"},
-{"0004001B00018002.cia", "630ffdbe219d66ecff48d5a65debb79c940f4fd89e94a01d72bac9ba39ec40d4"},
-{"0004001B00018102.cia", "f0841d10d588aaf3d07aeb7f048d7d1bf3eb291dc5eabe06620734fcb1a61248"},
-{"0004001B00018202.cia", "191cfc05695e39e799e363c013f4b9dfbd5d67ef184b209311f661c6f26d2613"},
-{"0004003000008202.cia", "71b901f3614bd187a1d57b69766e90ea69f1532b0feb4763cfb4d3daa3b2e530"},
-{"0004003000008302.cia", "b5e6b6c4e75de10f6485f5e4e052a991942d23615b34279afcb7c42a9cec98c0"},
-{"0004003000008402.cia", "38842d8fbeb8e2fc933ec89360e0a7337facbdf071d528e9f00f3447439a211b"},
-{"0004003000008602.cia", "f722a7fc7845303bc73ecac839bfb541de70a227e2e0faa356808e0d04e1b4ff"},
-{"0004003000008702.cia", "a50b185601bb4c6416fb65d99c1b84d0a70eedea546fb144a87806c42f359be1"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"0004003000008D02.cia", "0da0859df3a8fbde65ec7dc8d121c8b015591d43f59d76575a911ccb4dc126b1"},
-{"0004003000008E02.cia", "3dfd568c09c72ba9e351c92662d26eab9c98fe4a23cd16f2cab6bdd9e56f34b7"},
-{"000400300000BC02.cia", "6e13ff866af85109a6424319193be2199b741912aa85e6b97b87da6e25a5a77f"},
-{"000400300000C002.cia", "d36ef6a90b966d828831bac35a5f2fa8be3e5379f966388bd5fbf562f033c97c"},
-{"000400300000C102.cia", "7bcd78b918394063d0317c174396f1361c5ac8945bbc097c79deea8b156e2690"},
-{"000400300000C302.cia", "1519b6255e2c292c8deffab28c7e1644fcf2b9be1add05d38512047a34b967dc"},
-{"000400300000C402.cia", "6d7620eb440852c4c91a15c0387912afac1913c3b974641fdb8baaf0f8eee3b5"},
-{"000400300000C502.cia", "aeeb11aa73470a5e2fbb5aea35372209a6b9f712975406957330c205d317e6dd"},
-{"000400300000C602.cia", "bb499ccdfd1a87949a82ed65fdb5b86b9963b3b7b81942a733832a4f5dacdd61"},
-{"000400300000CD02.cia", "e04f8b0fb7274c6d0aee76e9de3cdb4bbdf88a40bbba8a6e8234bd11a82c24f7"},
-{"000400300000F602.cia", "71331cac11ae2f19405f7a941f4a88591128289f627cad3f5f891bce3476aefd"},
-{"0004003020008802.cia", "4c4221b45e70fe6677ad9b7624986344ad9d714ec52f3994a426c8f17245c3e1"},
-{"0004003020008A03.cia", "3b8a962082e7e6010f85ed2674e66ba9ef89988ddfe71462f8f4f1d2c7b526e8"},
-{"000400302000C003.cia", "e42bb3d7465f9a3529801a5cdb0540a12cf9f3599ad83dabd4962442ec4bc45b"},
-{"000400302000C503.cia", "b60968a84e49ca18bb5b7cbbda8bb902b8c98bbc26eea6addc4b891cbc83ad4a"},
-{"0004009B00010402.cia", "4b63120b66de3c671cc82b3ab0ce902ed8ad0214a7517d8fbc68587df3e866e3"},
-{"0004009B00012202.cia", "082a3035d77215afd081895658222137ffd6cb291a645b223e19f9f5f41c661a"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "30e23af8d12cb77957e61fe7e96e3379bd608361836819dc9ffc6df0d020d7cc"},
-{"000400DB00017202.cia", "32ba116e2dd021ecdf5aaedd312b1dd236e2b828caf164a2e585c0f74ce8081e"},
-{"000400DB20016202.cia", "9791f43058606d32240ae2f3637620f5969b0b67914e68c80513f489b3aa1ef8"},
-{"0004013000001502.cia", "55f9550c101c462b1b89434ac45fa56d07682fd05f01ca7cd5b5de2c9faffbbc"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002802.cia", "11b94a3902fa3bd002fd2455451691cb8585b7b07294d7e2c7acda57d11b6353"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "46dc1aa57a0a23367d2e54990a356b3d214ccc58fb35f20b61698eaf87bec4da"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003302.cia", "e529ec9658e0b1452dc80548a4861477a8507621c4ebef0559e35b928d094b47"},
-{"0004013000003402.cia", "1d025c4acacfe596dbacba264963db485f669e9e2340140f415fb832b60e33e6"},
-{"0004013000003502.cia", "269fc04ca722958546935e4874827c90b49e2df606098fc817ad4c42dc5b5f4b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "7ecc442fe194404eedc72e807f360217d8f8210276839bfac3ae6e16f27f48e7"},
-{"0004013020001503.cia", "0850f43b1a8c7ce04bb459a4f4482da43b505f9f8ca2438320d0dda64864ae08"},
-{"0004013020001602.cia", "f75d435a6edf327c20c9018ce437efb15cd00e76fc59c3680b2e7ed4894a975e"},
-{"0004013020001703.cia", "bf4e2c4eeabdbc6367577fb0a20dc3d960e374f5741a52203f663270afd0b6ee"},
-{"0004013020001803.cia", "55243a2d688ae3841f395627a34f4b5a196f0350853259fd6bd486034b680dce"},
-{"0004013020001A03.cia", "85f3c44f1a831b6a27fc18902152105dcff223a3a6da3ea5984c824c66897424"},
-{"0004013020001B03.cia", "82cae4a69542ab120be51e691c7801ab5b24e8c3a7ad8ced5e6fcbb14cea5abc"},
-{"0004013020001C02.cia", "db03d9b41a22c584ff7f81116e5e11a47840cfeb7723e1f1ac7ea1244f9d56c6"},
-{"0004013020001C03.cia", "63470b451ec352030ba0bdaf16c0b4b18ebe1a6adc3b73baf985fe92467e8652"},
-{"0004013020001D03.cia", "2c0eaffe4c3fe6376341925e454813984c2e110c6615aa7ab6c27395048ad2c0"},
-{"0004013020001E02.cia", "7a76a9145e0e365a901392e1df8414dfe8522ff49818862df1104099061e4828"},
-{"0004013020001E03.cia", "71e0dc11eba127e9e6c07b32b56d7d61fe138e3359810db9eafa64f67cc9ea87"},
-{"0004013020001F02.cia", "ea96331317afcd686d02b246276c24c4b8ca02d2530790fa1f43fea784bfdad4"},
-{"0004013020001F03.cia", "2746e07e04da7536ceef3c2a695bef7e3fdb292527bb3f190c6d744edf6e6997"},
-{"0004013020002103.cia", "aa26ee303eaa5ceb8ad59b201752826e8015c0883158fbb3beacab8bd93618a7"},
-{"0004013020002202.cia", "6842ff3912f86d614b42ce80bcc332e7769f8db7ed84df09d5fe78240572541b"},
-{"0004013020002203.cia", "948580451570472ea12f6ca15210de5075aad855a27b87f8952772fe23173135"},
-{"0004013020002302.cia", "26e89799bda450eab078bc17341268ae8cc8781d6264e34aca048f1bf0f8cb24"},
-{"0004013020002303.cia", "97807ab2ee417f9041722bf5e416f1fa9ef04f193edf8c5db50b085dc24e1cd7"},
-{"0004013020002403.cia", "3dcf4663047d5bd5bcae9216b241c58c371b0292b4bc196230417791f4681405"},
-{"0004013020002703.cia", "14c7c0c28ee617a18b789f30f04d2f4a1661cf06fc5a9dbf2b895ba95942b179"},
-{"0004013020002903.cia", "5a5e24338de534d21a856e3471180a05e012a13fefd4b4fb10d062c88633eb91"},
-{"0004013020002C03.cia", "23c17bcc1746861bbacefe6ad71b8640a68ad8b07067cf67ff5dcc702e0e1d73"},
-{"0004013020002D03.cia", "550386a9f7edafc3e991d53e5e61a58b1d9c28ccaebd085192d6ba6b29235203"},
-{"0004013020002E03.cia", "46872eb8781f865bb2590192b31d34a226f0ccf3c50826bdbb4537c05e206604"},
-{"0004013020002F03.cia", "003a19dec26e0ad4e870b3141053a29892b4e6f99e3b2d5d152c177a3c3c5ecc"},
-{"0004013020003103.cia", "0da2c0b01fce866a5079557c472978a16469dd236d2885f705ebe661653520da"},
-{"0004013020003203.cia", "4edcb63a9d05a64b5f62223bd38b5fa7b29bd413fae290a58071763e93be6491"},
-{"0004013020003303.cia", "d7bea2ee87abc2e6de0f3fd5796d9d1dc4a2985ce1cccdee3a73f7664c3f78ee"},
-{"0004013020004002.cia", "25423834989c3e5608ee7826e8b3b3aa5aa14566bb27ca58cbbd5fd65b4099aa"},
-{"0004013020004102.cia", "ec082390ab44b23ea6564c162137e37ec6243e6eada9340f0bc30b98973b203c"},
-{"0004013020004202.cia", "754de6ec34bcd368ebcf2630f1d2a4728c65e83aae8d62a8a9096a4d6fcd352f"},
-{"0004013020008003.cia", "9fe78114ce601c13a321f88966414b94ce9b601c0cdf88d4121b3cd48742cb98"},
-{"0004013820000002.cia", "d417d3816808d95d0959e4ce4726a83599280d7cd611a00e0f7e3beb488f3680"},
-{"0004013820000003.cia", "f4593a8f5067b83fd658748b325c148a52fd46b841774a352509df14d9878878"},
-{"0004013820000102.cia", "89d884a01ed8593c58d3f23d777e772d87cc9f57b432cf899309cd96e8911838"},
-{"0004013820000202.cia", "66a4910ddcce3e69049712182833400ebaf68e0ba283b548ca4528f383fccc59"}
-};
-
-std::map<std::string, std::string> newHashes9_2_0U = {
-{"0004001000021000.cia", "e858a4f26815e846315d20959fca0f989129168fb476d007a60d4457e434cf12"},
-{"0004001000021100.cia", "d8e0f1471d52b792bb327692f7a1ee57aebe02d2c4f5b4fda99cd5c36b59eb9c"},
-{"0004001000021400.cia", "6a7745b78b9b006e86ece5537348e8c094ef9f7deba9624d7a6383f204aa75ae"},
-{"0004001000021900.cia", "85721349cb8ded3e3815d7b5240b6e7314006f2c8734f73d5ff860b95827e261"},
-{"0004001000021A00.cia", "dc1606acca07f0c73a85e46701d8238e2ba45571e861e5acacd7887d9d4515a1"},
-{"000400100002C000.cia", "86a8f276d8f4b226a3955a4802eef5ca3b108691939a52d0290b8d89ebf13583"},
-{"0004001020021300.cia", "4af2d6c2540d5d2ac6930f7cb924839eb1c896441743822eee8191a2d47075ba"},
-{"0004001020021D00.cia", "a324a12f3d9ff33cbb4541056b2ae61be9e92807b1b73e31978cda5a62ad5f71"},
-{"0004001020024100.cia", "e54d8ddb5b705f216d3c106597993d43c292002a27414cc42c1937a3b3da839f"},
-{"000400102002CF00.cia", "1adeedf07d9b049193dd4907c42b3da12dbc776c5551f1e6e203c4c44e0535d5"},
-{"000400102002D100.cia", "af7130327daf2ccdf82485fbe056f329a61a17a899f4e45e583a47b3c175f57c"},
-{"000400102002D300.cia", "6a6be374b00e9e4f7313626b02607e9657a323b67577b29be1ac434254229f00"},
-{"000400102002D500.cia", "22da7847382256f839125ecc5d02ea768daf13bd6267555478ba36c3ac27a8df"},
-{"0004001B00010702.cia", "def4ffa17a8a052f4003b29b56fd5b387ec52aced76d83dafd025ddf3eedd505"},
-{"0004001B00010802.cia", "60be2738a63f49459b81495b4b9ad13354aad47b3f89e2d5dee60bd429d80d5d"},
-{"0004001B00018002.cia", "630ffdbe219d66ecff48d5a65debb79c940f4fd89e94a01d72bac9ba39ec40d4"},
-{"0004001B00018102.cia", "f0841d10d588aaf3d07aeb7f048d7d1bf3eb291dc5eabe06620734fcb1a61248"},
-{"0004001B00018202.cia", "191cfc05695e39e799e363c013f4b9dfbd5d67ef184b209311f661c6f26d2613"},
-{"0004003000008A02.cia", "a1015839b839607126d6da409ad40322af89d200c071a9b33128db2400d2dc8c"},
-{"0004003000008B02.cia", "3322128172f9ff74ed954f0db85be34b0b306251ab19eb4d9db7ad3ad5e665bc"},
-{"0004003000008F02.cia", "52cd8af9eb4b8a32e1f4299e17756058ab91e33a024822b4400f39f19d2fceb5"},
-{"0004003000009002.cia", "e90744f5752007bb466a2d806de7ebe53ac14778ffc4b4a569cd039b24997940"},
-{"0004003000009202.cia", "03a8de3b9b6281e7f04e54b56724deed0643d911908ebc564f6a6ba07ec6d9a7"},
-{"0004003000009302.cia", "2653c8d726620ad4c87a57280045b105883065dba9d4bf9700ad2fb56370a512"},
-{"0004003000009602.cia", "2dd0968ee44c4fd383482cb3424c5f1444c294d057ee37fce320e64e297a196c"},
-{"0004003000009702.cia", "959ee38b0bc7f0406d9aecd7db896ae5678cbb7f10cab83e11320956d0010d05"},
-{"000400300000BD02.cia", "c5946f018a37508c99c2ccfcc34ee5203a967448d9a77c56aad51a993c6c7b9f"},
-{"000400300000C502.cia", "aeeb11aa73470a5e2fbb5aea35372209a6b9f712975406957330c205d317e6dd"},
-{"000400300000C802.cia", "dc001b0194a7dabf4d7046010dac80aaed66e2573355d3195f227e98cd6bda51"},
-{"000400300000C902.cia", "6be107c8b1da744e6760816a1fa78e2febf0d59eb0f0d64407375cfdfabfcfa8"},
-{"000400300000CB02.cia", "64f447c5882a33e2913c9255ddbef6e1a85660b1ef575390fa95b3b3ecf882ab"},
-{"000400300000CC02.cia", "f2bec2993e33bc6b6faab07c5822a4ef5946cafa29424f9339c6737c29825931"},
-{"000400300000CD02.cia", "e04f8b0fb7274c6d0aee76e9de3cdb4bbdf88a40bbba8a6e8234bd11a82c24f7"},
-{"000400300000CE02.cia", "8214eb3cdb9af1af3bbc205f26a787837b4b4825429108748c384425a01e068f"},
-{"000400300000F602.cia", "71331cac11ae2f19405f7a941f4a88591128289f627cad3f5f891bce3476aefd"},
-{"0004003020008A03.cia", "3b8a962082e7e6010f85ed2674e66ba9ef89988ddfe71462f8f4f1d2c7b526e8"},
-{"0004003020009402.cia", "478b4b50172671054edae0df2f3c0bf167e60cdcdc8f905abce6a9fedb8cb678"},
-{"000400302000C503.cia", "b60968a84e49ca18bb5b7cbbda8bb902b8c98bbc26eea6addc4b891cbc83ad4a"},
-{"000400302000C803.cia", "a2d7ae67b0d7c6b2d0a22cd4f7f26584e257005aeb559b9b6499ae14c43e00d8"},
-{"0004009B00010402.cia", "4b63120b66de3c671cc82b3ab0ce902ed8ad0214a7517d8fbc68587df3e866e3"},
-{"0004009B00012302.cia", "2c73ab1b0739070f3532a193dc409ad4ed162d38fce95a8a3cb818b9e430c864"},
-{"0004009B00013302.cia", "0f1c036acc27cfbe1f6f99d843d76e95a51279aa7d6cf2fa86d39dbaed0dbcb8"},
-{"000400DB00010302.cia", "ac52c19fc98a8cd8c496f991161ec441c742c197c9e93d4d85764da71907dcfa"},
-{"000400DB00010502.cia", "0c9f105615c2ae9c148a5d52338545f259bd5d38a1c74f34688cfa71ab34e4bc"},
-{"000400DB00017302.cia", "ad0704c2466f4a7440984df25008fcfb3824ecdf59dd7349dae89eb907c082ff"},
-{"000400DB20016302.cia", "ae72e120c5fc17ecc2b783f45604acbec0957ee89c35936608cbe776ae0d39de"},
-{"0004013000001502.cia", "46c3a4132f76968f435c8ad742fff0214bfaba9c6d86c1f502c34c329d7b76db"},
-{"0004013000001702.cia", "69b305dfc237d4c4f9b0d25b98d3adc671fd5a80d12bcf1de02a4f267958fb59"},
-{"0004013000001802.cia", "449db4384e321a19118ee061483da980659f9024b9021e6b553e9b5c7c210cf6"},
-{"0004013000001D02.cia", "1139ad6c76f93e5b0c5ad23b9bcde7fc7fad17a6a1fd6a5a51acfacd3217acce"},
-{"0004013000002402.cia", "aea0742df337ec46424e8676cc1d4ab01f827716f2cb389f9ae7dc250c2fa2ee"},
-{"0004013000002602.cia", "1a11f8f0af70300ed4afaaf483cbc704dcb60903317a64506731f450edeb1942"},
-{"0004013000002702.cia", "f9e32e0bd1894893e53e3422fcdf2d1b7511bf8cd74ffc6217f5f708f2c978e7"},
-{"0004013000002802.cia", "e0ee0d5ed75b57b80d36db782acf18e8a5b34b14573b31aeea87a22e416f60ee"},
-{"0004013000002902.cia", "4e30ff5d8bbf83366a1859241b8f5f8b7f327488e900576ebce6094113801039"},
-{"0004013000002B02.cia", "ea3067f4a34bbb1de15aaa9b4f71882c050574f0b32bbff3ab2b9e47f7803493"},
-{"0004013000002C02.cia", "6b831f5b3efe5a90c120b157fcd06cc47aa61efc5c7870f24e0f4ca61d9cdf52"},
-{"0004013000002D02.cia", "ddba60ceb2921ee2e10167a8ed320a16a874e9c8aa9555abdfceb902fcabf0b6"},
-{"0004013000002E02.cia", "92d5f97dce65f0c789347d02ca6cb61990f272a7a75b63584f20bee8f9e44fed"},
-{"0004013000002F02.cia", "9b422d51aa09d777c026ae9c767554f810f6fcfd038fbf6f631a98937481bbeb"},
-{"0004013000003102.cia", "91a99772fd4b85e26e1a4ac6112071abbcfc3a319cf56ea485d288af940dcf8e"},
-{"0004013000003202.cia", "1b46ebd9f2700bca53869bfd95bbcfcfb9653b0a750367b42cc678f3ab23300c"},
-{"0004013000003302.cia", "a70f3ad7cf0e3416dea80aaeb7c33b78ae09cee97671c78bf75f6dada36ff942"},
-{"0004013000003402.cia", "bda2ee92e564e35da9793be2becf44695783aa891f6301ed3988a4f8da62a0ee"},
-{"0004013000003502.cia", "269fc04ca722958546935e4874827c90b49e2df606098fc817ad4c42dc5b5f4b"},
-{"0004013000003702.cia", "b7f024e2ed3c2c5a9e6b8db5880c16c93051a4044cfc94b00e934ad7654cb28b"},
-{"0004013000003802.cia", "68294c7bfa1b3b3fa9a04250828966d5391306597bf2b254c7e8334f7846b5d5"},
-{"0004013000008002.cia", "f760fe33422f8f3721e74ad1818f0f864f6ac4a0247e5fa2d0cb14d6670cecc9"},
-{"0004013020001503.cia", "0850f43b1a8c7ce04bb459a4f4482da43b505f9f8ca2438320d0dda64864ae08"},
-{"0004013020001602.cia", "069371a6a961d10a7f415a7167417c096c50b1c7ac293b0923e5b21a702b8b77"},
-{"0004013020001703.cia", "bf4e2c4eeabdbc6367577fb0a20dc3d960e374f5741a52203f663270afd0b6ee"},
-{"0004013020001803.cia", "55243a2d688ae3841f395627a34f4b5a196f0350853259fd6bd486034b680dce"},
-{"0004013020001A03.cia", "85f3c44f1a831b6a27fc18902152105dcff223a3a6da3ea5984c824c66897424"},
-{"0004013020001B03.cia", "82cae4a69542ab120be51e691c7801ab5b24e8c3a7ad8ced5e6fcbb14cea5abc"},
-{"0004013020001C02.cia", "db03d9b41a22c584ff7f81116e5e11a47840cfeb7723e1f1ac7ea1244f9d56c6"},
-{"0004013020001C03.cia", "63470b451ec352030ba0bdaf16c0b4b18ebe1a6adc3b73baf985fe92467e8652"},
-{"0004013020001D03.cia", "2c0eaffe4c3fe6376341925e454813984c2e110c6615aa7ab6c27395048ad2c0"},
-{"0004013020001E02.cia", "7a76a9145e0e365a901392e1df8414dfe8522ff49818862df1104099061e4828"},
-{"0004013020001E03.cia", "71e0dc11eba127e9e6c07b32b56d7d61fe138e3359810db9eafa64f67cc9ea87"},
-{"0004013020001F02.cia", "ea96331317afcd686d02b246276c24c4b8ca02d2530790fa1f43fea784bfdad4"},
-{"0004013020001F03.cia", "2746e07e04da7536ceef3c2a695bef7e3fdb292527bb3f190c6d744edf6e6997"},
-{"0004013020002103.cia", "aa26ee303eaa5ceb8ad59b201752826e8015c0883158fbb3beacab8bd93618a7"},
-{"0004013020002202.cia", "6842ff3912f86d614b42ce80bcc332e7769f8db7ed84df09d5fe78240572541b"},
-{"0004013020002203.cia", "948580451570472ea12f6ca15210de5075aad855a27b87f8952772fe23173135"},
-{"0004013020002302.cia", "26e89799bda450eab078bc17341268ae8cc8781d6264e34aca048f1bf0f8cb24"},
-{"0004013020002303.cia", "97807ab2ee417f9041722bf5e416f1fa9ef04f193edf8c5db50b085dc24e1cd7"},
-{"0004013020002403.cia", "3dcf4663047d5bd5bcae9216b241c58c371b0292b4bc196230417791f4681405"},
-{"0004013020002703.cia", "14c7c0c28ee617a18b789f30f04d2f4a1661cf06fc5a9dbf2b895ba95942b179"},
-{"0004013020002903.cia", "5a5e24338de534d21a856e3471180a05e012a13fefd4b4fb10d062c88633eb91"},
-{"0004013020002C03.cia", "23c17bcc1746861bbacefe6ad71b8640a68ad8b07067cf67ff5dcc702e0e1d73"},
-{"0004013020002D03.cia", "550386a9f7edafc3e991d53e5e61a58b1d9c28ccaebd085192d6ba6b29235203"},
-{"0004013020002E03.cia", "46872eb8781f865bb2590192b31d34a226f0ccf3c50826bdbb4537c05e206604"},
-{"0004013020002F03.cia", "003a19dec26e0ad4e870b3141053a29892b4e6f99e3b2d5d152c177a3c3c5ecc"},
-{"0004013020003103.cia", "0da2c0b01fce866a5079557c472978a16469dd236d2885f705ebe661653520da"},
-{"0004013020003203.cia", "4edcb63a9d05a64b5f62223bd38b5fa7b29bd413fae290a58071763e93be6491"},
-{"0004013020003303.cia", "d7bea2ee87abc2e6de0f3fd5796d9d1dc4a2985ce1cccdee3a73f7664c3f78ee"},
-{"0004013020004002.cia", "1890b5ad1744cb511c5cab74ad9ec9651917de15bbb23ce5004bee0b4e5025ad"},
-{"0004013020004102.cia", "ec082390ab44b23ea6564c162137e37ec6243e6eada9340f0bc30b98973b203c"},
-{"0004013020004202.cia", "754de6ec34bcd368ebcf2630f1d2a4728c65e83aae8d62a8a9096a4d6fcd352f"},
-{"0004013020008003.cia", "9fe78114ce601c13a321f88966414b94ce9b601c0cdf88d4121b3cd48742cb98"},
-{"0004013820000002.cia", "d417d3816808d95d0959e4ce4726a83599280d7cd611a00e0f7e3beb488f3680"},
-{"0004013820000003.cia", "f4593a8f5067b83fd658748b325c148a52fd46b841774a352509df14d9878878"},
-{"0004013820000102.cia", "89d884a01ed8593c58d3f23d777e772d87cc9f57b432cf899309cd96e8911838"},
-{"0004013820000202.cia", "66a4910ddcce3e69049712182833400ebaf68e0ba283b548ca4528f383fccc59"}
-};
-
-//////////////////////////////////////////////////////////////////////////////////////////
-
-std::map<std::string, std::map<std::string, std::string>> oldRegions9_2_0 = {
-{"0004003000009802.cia", oldHashes9_2_0E},
-{"0004003000008202.cia", oldHashes9_2_0J},
-{"0004003000008F02.cia", oldHashes9_2_0U},
-{"000400300000A902.cia", oldHashes9_0_0K},
-{"000400300000B102.cia", oldHashes9_0_0T}
-};
-
-std::map<std::string, std::map<std::string, std::string>> newRegions9_2_0 = {
-{"0004003000009802.cia", newHashes9_2_0E},
-{"0004003000008202.cia", newHashes9_2_0J},
-{"0004003000008F02.cia", newHashes9_2_0U}
-};
-
-std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> devices9_2_0 = {
-{"0004013800000002.cia", oldRegions9_2_0},
-{"0004013820000002.cia", newRegions9_2_0}
-};
-
-//////////////////////////////////////////////////////////////////////////////////////////
-
-std::map<std::string, std::map<std::string, std::string>> oldRegions2_1_0 = {
-{"0004003000009802.cia", oldHashes2_1_0E},
-{"0004003000008202.cia", oldHashes2_1_0J},
-{"0004003000008F02.cia", oldHashes2_1_0U}
-};
-
-std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> devices2_1_0 = {
-{"0004013800000002.cia", oldRegions2_1_0}
-};
-
-std::map<int, std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>> firmVersions = {
-{17120, devices9_2_0}, {3553, devices2_1_0}
-};
-
-#endif // _TITLE_H_
+#endif // _HASHES_H_
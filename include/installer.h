@@ -0,0 +1,52 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _INSTALLER_H_
+#define _INSTALLER_H_
+
+#include <map>
+#include <string>
+#include <3ds.h>
+#include "progress.h"
+
+struct InstallSummary
+{
+	u32 filesVerified;  // Hashed against the manifest
+	u32 filesSkipped;   // Already at the target version, only checked for presence and size
+	u64 bytesHashed;
+	u32 titlesDeleted;
+	u32 titlesInstalled;
+	bool resumed;       // Continued an interrupted run from the journal
+	u32 filesResumed;   // Verified by that run, not hashed again
+	u32 titlesResumed;  // Installed by that run
+};
+
+// Installs the CIAs in /updates to NAND that differ from the installed versions. If the set has a
+// NATIVE_FIRM with a known version, those CIAs are verified against the manifest first, see manifest.h.
+// If downgrade is true we don't care about versions (except equal versions) and uninstall newer versions.
+// Progress is journaled to JOURNAL_PATH, a run over the same files continues where the last one died.
+InstallSummary installUpdates(bool downgrade);
+
+// Same on a worker thread, all output goes through the channel instead of the console.
+// Returns false if the thread couldn't be started. The last event is PHASE_DONE or
+// PHASE_FAILED, finishInstall() then joins the worker and returns what it did.
+bool startInstall(bool downgrade, progress::Channel& progressChannel);
+InstallSummary finishInstall();
+
+#endif // _INSTALLER_H_
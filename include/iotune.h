@@ -0,0 +1,58 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _IOTUNE_H_
+#define _IOTUNE_H_
+
+#include <string>
+#include <vector>
+#include <3ds.h>
+
+// Block size for the read/write loops (installCia, copyFile, the verifier).
+// The best one depends on the SD card, the FS service and the free heap, so it
+// is measured once per card by reading a big file with a few block sizes, and
+// the result is kept on the SD card keyed by the card's CID.
+
+#define IOTUNE_CACHE_PATH   u"/sysdowngrader-iotune.bin"
+#define IOTUNE_MIN_SIZE     (0x10000)  // 64 KB, the candidates double up to MAX_BUF_SIZE
+#define IOTUNE_PROBE_BYTES  (0x100000) // Read per candidate, at least 2 blocks
+#define IOTUNE_TOLERANCE    (5)        // Percent below the best that still counts, the smaller block wins
+
+
+
+namespace iotune
+{
+	struct Probe
+	{
+		u32 blockSize;
+		u32 kbPerSec;
+	};
+
+	// MAX_BUF_SIZE until tune() ran
+	u32  blockSize();
+	void setBlockSize(u32 size);
+
+	// Uses the cached size for this SD card or probes by reading the file. Returns the size,
+	// the current one if the file can't be read.
+	u32  tune(const std::u16string& probePath, bool useCache=true);
+	// Throughput per candidate of the last probe, empty if the cache was used or the probe failed
+	const std::vector<Probe>& probes();
+}
+
+#endif // _IOTUNE_H_
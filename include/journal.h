@@ -0,0 +1,95 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _JOURNAL_H_
+#define _JOURNAL_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <3ds.h>
+#include "fs.h"
+#include "cia.h"
+
+// Append-only record of an install on the SD card, so a run that died halfway
+// (battery, crash in AM) continues where it stopped instead of starting over.
+// Every record carries a CRC32 and is flushed before the step it describes is
+// taken as done. Replaying stops at the first torn or corrupt record.
+//
+//   record:  magic (4) | type (1) | reserved (3) | payload size (4) | payload | CRC32 of all before (4)
+
+#define JOURNAL_PATH   u"/sysdowngrader-journal.bin"
+#define JOURNAL_MAGIC  (0x4C4E524A) // "JRNL"
+
+enum
+{
+	JOURNAL_PLAN = 1, // Every /updates file with its CIA info and what to do with it
+	JOURNAL_VERIFIED, // A file matched the manifest
+	JOURNAL_DELETED,  // A newer title was removed
+	JOURNAL_INSTALLED // A title is installed (and NATIVE_FIRM written)
+};
+
+// One /updates file as the plan saw it
+struct JournalFile
+{
+	std::u16string name;
+	CiaInfo info; // Without the content records
+	bool planned;
+	bool requiresDelete;
+};
+
+// What an earlier run got done
+struct JournalState
+{
+	bool downgrade;
+	u32 fingerprint;
+	std::vector<JournalFile> files; // Empty if there was no usable plan
+	std::map<std::u16string, std::string> verified; // SHA256 per file name
+	std::set<u64> deleted;
+	std::set<u64> installed;
+	u32 records;
+	u64 validSize; // Everything after this is torn or corrupt
+};
+
+
+class Journal
+{
+	fs::File _file_;
+
+	void append(u8 type, const std::vector<u8>& payload);
+
+
+public:
+	// Reads the records of an earlier run, an absent journal is an empty state
+	static JournalState replay(const std::u16string& path=JOURNAL_PATH);
+	// CRC32 over the names and sizes of the files, another /updates set doesn't resume
+	static u32 fingerprint(const std::vector<fs::DirEntry>& files);
+
+	// Appends after validSize, 0 starts a new journal
+	void open(u64 validSize, const std::u16string& path=JOURNAL_PATH);
+	void plan(bool downgrade, u32 fingerprint, const std::vector<JournalFile>& files);
+	void verified(const std::u16string& name, const std::string& sha256);
+	void deleted(u64 titleID);
+	void installed(u64 titleID);
+	// The install went through, nothing left to resume
+	void finish();
+};
+
+#endif // _JOURNAL_H_
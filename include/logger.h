@@ -0,0 +1,92 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _LOGGER_H_
+#define _LOGGER_H_
+
+#include <string>
+#include <3ds.h>
+#include "metrics.h"
+
+// Diagnostics that survive the reboot. Any thread adds structured records to a
+// preallocated ring without locking, a low priority writer thread batches them
+// into a rotating log file on the SD card and mirrors them to a debug sink at a
+// throttled rate. exit() drains what is left before the app resets the console.
+//
+//   logger::print(LOG_INFO, progress::PHASE_INSTALL, titleID, 0, "installed");
+//   logger::print(LOG_ERROR, phase, titleID, e.getErrCode(), "%s", e.what());
+
+#define LOG_PATH          u"/sysdowngrader.log"
+#define LOG_OLD_PATH      u"/sysdowngrader.old.log" // The previous file after a rotation
+#define LOG_MAX_SIZE      (256 * 1024)
+#define LOG_RING_SIZE     (256)       // Records, power of 2
+#define LOG_TEXT_SIZE     (128)
+#define LOG_BATCH_SIZE    (16 * 1024) // Bytes formatted before a write
+#define LOG_INTERVAL      (50000000LL) // The writer wakes up every 50 ms
+
+enum
+{
+	LOG_INFO = 0,
+	LOG_WARN,
+	LOG_ERROR
+};
+
+
+
+namespace logger
+{
+	struct Record
+	{
+		u64 ticks;
+		u8  level;
+		u8  phase;  // progress::Phase
+		Result res;
+		u64 titleID;
+		char text[LOG_TEXT_SIZE];
+	};
+
+	struct Stats
+	{
+		u32 records;   // Added to the ring
+		u32 dropped;   // Ring was full
+		u32 written;   // Made it to the file
+		u32 batches;   // Writes
+		u64 bytes;     // Size of those writes
+		u32 rotations;
+		u32 mirrored;
+		u32 failed;    // FS errors, the file sink stops at the first one
+	};
+
+	// Opens the log file and starts the writer thread
+	bool init(const std::u16string& path=LOG_PATH, const std::u16string& oldPath=LOG_OLD_PATH);
+	// Writes everything still in the ring, then stops the writer and closes the file
+	void exit();
+
+	void print(u8 level, u8 phase, u64 titleID, Result res, const char *format, ...) __attribute__((format(printf, 5, 6)));
+
+	// Called on the writer thread with one line per record, at most linesPerSecond of them
+	void setMirror(void (*sink)(const char *line), u32 linesPerSecond);
+
+	const Stats& stats();
+	// The writer doesn't go through SERVICE_CALL, metrics and trace are not thread safe.
+	// These are its own counts, by the same names.
+	u32 serviceCalls(metrics::Call call);
+}
+
+#endif // _LOGGER_H_
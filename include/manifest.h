@@ -0,0 +1,168 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _MANIFEST_H_
+#define _MANIFEST_H_
+
+#include <string>
+#include <vector>
+#include <3ds.h>
+
+// The hashes the verifier checks /updates against. A set holds every CIA of one firmware
+// for one device (NATIVE_FIRM title) and region (home menu title), sorted by title ID.
+//
+// Most CIAs are the same bytes in several sets, so every distinct SHA256 is kept once in
+// a digest pool and an entry only holds its 16 bit index there.
+//
+// The built-in sets in hashes.h are the same records as plain arrays in .rodata, so there
+// is nothing to decode. Firmwares they don't cover come from a manifest file,
+// /updates/manifest.bin or a romfs copy, read with a single read and used in place.
+//
+//   file:  Header | SetRecord x setCount | Entry x entryCount | Digest x digestCount
+//          (little endian, host/mkmanifest writes it)
+
+#define MANIFEST_PATH        u"/updates/manifest.bin"
+#define MANIFEST_ROMFS_PATH  "romfs:/manifest.bin"
+#define MANIFEST_MAGIC       (0x464D4453) // "SDMF"
+#define MANIFEST_VERSION     (2)
+#define MANIFEST_MAX_SIZE    (4 * 1024 * 1024)
+#define MANIFEST_MAX_DIGESTS (0x10000) // Entries hold u16 indices
+
+#define NATIVE_FIRM_TITLE     (0x0004013800000002LL)
+#define NEW_NATIVE_FIRM_TITLE (0x0004013820000002LL)
+
+
+
+namespace manifest
+{
+	struct Header
+	{
+		u32 magic;
+		u16 version;
+		u16 headerSize;
+		u32 setCount;
+		u32 entryCount;
+		u32 digestCount;
+		u32 setOffset;
+		u32 entryOffset;
+		u32 digestOffset;
+		u32 fileSize;
+		u32 crc32;       // Of everything after the header
+	};
+
+	struct SetRecord
+	{
+		u64 nativeFirm;  // Title IDs
+		u64 homeMenu;
+		u32 firmVersion; // Of the NATIVE_FIRM CIA
+		u32 firstEntry;
+		u32 entryCount;
+		u32 reserved;
+	};
+
+	struct Entry
+	{
+		u64 titleID;
+		u32 size;        // Of the CIA file, 0 if not known
+		u16 digest;      // Index into the digest pool
+		u16 reserved;
+	};
+
+	struct Digest
+	{
+		u8 sha256[32];
+	};
+
+	class Set
+	{
+		SetRecord _record_;
+		const Entry *_entries_;
+		const Digest *_digests_;
+
+
+	public:
+		Set(const SetRecord& record, const Entry *entries, const Digest *digests) : _record_(record), _entries_(entries), _digests_(digests) {}
+
+		u32 firmVersion() const {return _record_.firmVersion;}
+		u64 nativeFirm() const {return _record_.nativeFirm;}
+		u64 homeMenu() const {return _record_.homeMenu;}
+		u32 size() const {return _record_.entryCount;}
+		const Entry* entries() const {return _entries_;}
+		const u8* sha256(const Entry& entry) const {return _digests_[entry.digest].sha256;}
+
+		// nullptr if the title isn't part of the set
+		const Entry* find(u64 titleID) const;
+		// The NATIVE_FIRM and home menu are both among titleIDs
+		bool matches(u32 firmVersion, const std::vector<u64>& titleIDs) const;
+		bool matches(u32 firmVersion, u64 nativeFirm, u64 homeMenu) const;
+	};
+
+	// A manifest file held in one buffer, its sets point into it
+	class Manifest
+	{
+		std::vector<u64> _data_; // u64 so the records are aligned
+		std::vector<Set> _sets_;
+
+		// Checks the image in _data_ and finds the sets in it
+		bool index(u32 size);
+
+
+	public:
+		Manifest() {}
+		Manifest(const Manifest&) = delete; // The sets point into _data_
+		Manifest& operator=(const Manifest&) = delete;
+
+		// Reads the whole file at once. Returns false if there is none,
+		// throws titleException if it is damaged.
+		bool load(const std::u16string& path);
+		bool loadRomfs(const char *path);
+		// Takes a file image, false (and no sets) if it isn't a valid manifest
+		bool parse(const void *data, u32 size);
+
+		const std::vector<Set>& sets() const {return _sets_;}
+		const Set* find(u32 firmVersion, const std::vector<u64>& titleIDs) const;
+		const Set* find(u32 firmVersion, u64 nativeFirm, u64 homeMenu) const;
+	};
+
+	// Title ID of a CIA named by it ("0004001000022000.cia"), read off the UTF-16 name.
+	// False if the file is named some other way, only its header can tell then.
+	bool titleID(const std::u16string& name, u64 *titleID);
+
+	// The built-in sets of hashes.h, they point straight into its arrays
+	const std::vector<Set>& builtin();
+	// The built-in set that matches, nullptr if there is none
+	const Set* find(u32 firmVersion, const std::vector<u64>& titleIDs);
+	const Set* find(u32 firmVersion, u64 nativeFirm, u64 homeMenu);
+
+	// Home menu title of a CFG region (CFG_REGION_*), 0 if there is no such region
+	u64 homeMenu(u8 region);
+	// Throws titleException if the file has a set for a firmware with a built-in set and
+	// its hashes aren't the built-in ones. Sizes don't count, the built-in sets have none.
+	void checkBuiltin(const Manifest& file);
+	// The set for a console, from what it is (its NATIVE_FIRM and its region's home menu) and
+	// the NATIVE_FIRM version about to be installed. A built-in set comes before the manifest
+	// file, the file is only used for firmwares the app doesn't know. nullptr if neither has one.
+	const Set* resolve(const Manifest& file, u32 firmVersion, u64 nativeFirm, u64 homeMenu, bool *fromFile);
+
+	// File image of the sets with their digests pooled, entries have to be sorted by title ID.
+	// Empty if there are more than MANIFEST_MAX_DIGESTS distinct digests.
+	std::vector<u8> build(const std::vector<Set>& sets);
+}
+
+#endif // _MANIFEST_H_
@@ -0,0 +1,95 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _METRICS_H_
+#define _METRICS_H_
+
+#include <string>
+#include <3ds.h>
+#include "trace.h"
+
+// Calls, bytes and a latency histogram for every FS and AM service call the
+// app makes. Always on, a call costs two tick reads and a few adds.
+//
+//   res = SERVICE_CALL(AM_InstallFirm, titleID);    // Counts, times and traces the call
+//   SERVICE_SCOPE_BYTES(FSFILE_Read, size);         // Same for the rest of the block
+
+#define METRICS_DEFAULT_PATH  u"/sysdowngrader-metrics.csv"
+#define METRICS_BUCKETS       (160) // 4 per power of 2 nanoseconds, enough for minutes
+
+#define METRICS_CALLS(X) \
+	X(FSUSER_OpenArchive) X(FSUSER_CloseArchive) X(FSUSER_OpenFile) X(FSUSER_OpenFileDirectly) \
+	X(FSUSER_DeleteFile) X(FSUSER_RenameFile) X(FSUSER_CreateDirectory) X(FSUSER_OpenDirectory) \
+	X(FSUSER_RenameDirectory) X(FSUSER_DeleteDirectoryRecursively) X(FSUSER_GetSdmcCid) \
+	X(FSFILE_Read) X(FSFILE_Write) X(FSFILE_GetSize) X(FSFILE_SetSize) X(FSFILE_Flush) X(FSFILE_Close) \
+	X(FSDIR_Read) X(FSDIR_Close) \
+	X(AM_GetTitleCount) X(AM_GetTitleList) X(AM_GetTitleInfo) X(AM_GetTitleProductCode) \
+	X(AM_GetCiaFileInfo) X(AM_StartCiaInstall) X(AM_FinishCiaInstall) X(AM_CancelCIAInstall) \
+	X(AM_DeleteTitle) X(AM_DeleteAppTitle) X(AM_InstallFirm)
+
+
+
+namespace metrics
+{
+#define METRICS_ENUM(name) name,
+	enum Call {METRICS_CALLS(METRICS_ENUM) CALL_COUNT};
+#undef METRICS_ENUM
+
+	struct Stats
+	{
+		u32 calls;
+		u64 bytes;
+		u64 totalNs;
+		u64 maxNs;
+		u32 buckets[METRICS_BUCKETS];
+	};
+
+	u64  ticks();
+	void record(Call call, u64 startTicks, u64 bytes);
+
+	class Sample
+	{
+		Call _call_;
+		u64 _bytes_;
+		u64 _start_;
+
+
+	public:
+		Sample(Call call, u64 bytes=0) : _call_(call), _bytes_(bytes), _start_(ticks()) {}
+		~Sample() {record(_call_, _start_, _bytes_);}
+	};
+
+	const char*  name(Call call);
+	const Stats& get(Call call);
+	u64  percentile(Call call, u32 permille); // Upper bound of the bucket, in ns
+	void reset();
+
+	// Table of the calls made so far on the current console (fits the bottom screen)
+	void print();
+	// Appends one CSV row per call made, label tells runs apart. Returns false on errors.
+	bool write(const char *label, const std::u16string& path=METRICS_DEFAULT_PATH);
+} // namespace metrics
+
+#define METRICS_CONCAT_(a, b)           a##b
+#define METRICS_CONCAT(a, b)            METRICS_CONCAT_(a, b)
+#define SERVICE_CALL(fn, ...)           ({metrics::Sample _sample_(metrics::fn); TRACE_CALL(#fn, fn(__VA_ARGS__));})
+#define SERVICE_SCOPE_BYTES(fn, bytes)  metrics::Sample METRICS_CONCAT(_sample_, __LINE__)(metrics::fn, bytes); \
+                                        TRACE_SCOPE_BYTES(#fn, bytes)
+
+#endif // _METRICS_H_
@@ -0,0 +1,53 @@
+// //////////////////////////////////////////////////////////
+// multidigest.h
+// SHA256 + CRC32 + size of the same bytes in one pass
+//
+
+#pragma once
+
+#include "sha256.h"
+#include "crc32.h"
+
+
+/// compute several digests of one stream
+/** Usage:
+    MultiDigest digest;                        // or MultiDigest digest(MultiDigest::Crc32);
+    while (more data available)
+      digest.add(pointer to fresh data, number of new bytes);
+    std::string sha = digest.getSha256();      // same as SHA256
+    uint32_t    crc = digest.getCrc32();       // same as CRC32::getValue(), zlib/ZIP style
+    uint64_t    len = digest.getSize();
+
+    Each chunk is fed to the digests in cache sized slices, so the bytes
+    are read from memory once instead of once per digest.
+  */
+class MultiDigest
+{
+public:
+  /// digests to compute, combine with |, the size is always counted
+  enum Digests { Sha256 = 1, Crc32 = 2, All = Sha256 | Crc32 };
+
+  /// same as reset()
+  explicit MultiDigest(unsigned digests = All);
+
+  /// add arbitrary number of bytes
+  void add(const void* data, size_t numBytes);
+
+  /// return latest SHA256 as 64 hex characters
+  std::string getSha256();
+  /// return latest SHA256 as bytes
+  void        getSha256(unsigned char buffer[SHA256::HashBytes]);
+  /// return latest CRC32 (0 if not computed)
+  uint32_t    getCrc32() const { return m_crc32.getValue(); }
+  /// number of bytes added
+  uint64_t    getSize() const { return m_numBytes; }
+
+  /// restart
+  void reset();
+
+private:
+  unsigned m_digests;
+  uint64_t m_numBytes;
+  SHA256   m_sha256;
+  CRC32    m_crc32;
+};
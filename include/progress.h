@@ -0,0 +1,124 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _PROGRESS_H_
+#define _PROGRESS_H_
+
+#include <atomic>
+#include <3ds.h>
+
+// The install runs on a worker thread. Everything it has to say goes through a
+// single-producer/single-consumer ring that the UI thread drains once per frame,
+// neither side ever takes a lock.
+//
+//   progress::print(channel, "%s", name);               // Worker: console text, waits for room
+//   progress::tryPost(channel, event);                  // Worker: status update, dropped when full
+//   while(channel.events.pop(event)) ...                // UI: at vblank
+
+#define PROGRESS_RING_SIZE  (64)  // Power of 2
+#define PROGRESS_TEXT_SIZE  (96)  // Bytes of console text per event, including the terminator
+
+
+
+namespace progress
+{
+	enum Phase
+	{
+		PHASE_TEXT = 0, // Console text in event.text
+		PHASE_READ,     // Parsing CIA headers, index/count
+		PHASE_VERIFY,   // Hashing, bytes/total
+		PHASE_DELETE,   // Removing titleID
+		PHASE_INSTALL,  // Installing titleID, bytes/total over all titles
+		PHASE_PROMPT,   // Worker waits for answer(), the question came as text before
+		PHASE_DONE,     // Worker is through, call finishInstall()
+		PHASE_FAILED    // Same, the error came as text before
+	};
+
+	struct Event
+	{
+		u8  phase;
+		u8  fsError;    // PHASE_FAILED: fsException instead of titleException
+		u16 index;      // 1 based
+		u16 count;
+		u64 titleID;
+		u64 bytes;
+		u64 total;
+		u32 kbPerSec;   // Since the phase started
+		u32 etaSeconds; // Rest of the run, 0 if not known
+		char text[PROGRESS_TEXT_SIZE];
+	};
+
+	// Lock-free as long as head and tail are each written by one thread only.
+	// Indices run freely and wrap, N being a power of 2 keeps them valid.
+	template<typename T, u32 N> class Ring
+	{
+		static_assert(N && !(N & (N - 1)), "Ring size must be a power of 2");
+
+		T items[N];
+		std::atomic<u32> head; // Written by the producer
+		std::atomic<u32> tail; // Written by the consumer
+
+
+	public:
+		Ring() : head(0), tail(0) {}
+
+		bool push(const T& item)
+		{
+			const u32 h = head.load(std::memory_order_relaxed);
+			if(h - tail.load(std::memory_order_acquire) == N) return false;
+
+			items[h & (N - 1)] = item;
+			head.store(h + 1, std::memory_order_release); // Publishes the item
+			return true;
+		}
+
+		bool pop(T& item)
+		{
+			const u32 t = tail.load(std::memory_order_relaxed);
+			if(t == head.load(std::memory_order_acquire)) return false;
+
+			item = items[t & (N - 1)];
+			tail.store(t + 1, std::memory_order_release); // Hands the slot back
+			return true;
+		}
+
+		u32 size() const {return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);}
+	};
+
+	struct Channel
+	{
+		Ring<Event, PROGRESS_RING_SIZE> events;
+		std::atomic<int> answer; // Reply to PHASE_PROMPT, -1 while nobody answered
+		u32 dropped;             // Status updates that found the ring full, producer only
+
+		Channel() : answer(-1), dropped(0) {}
+	};
+
+	// Waits until the UI made room, for events that must not get lost
+	void post(Channel& channel, const Event& event);
+	// Drops the event if the ring is full, for status updates the next one replaces
+	bool tryPost(Channel& channel, const Event& event);
+	// printf() for the worker. Long text is split on UTF-8 character boundaries.
+	void print(Channel& channel, const char *format, ...) __attribute__((format(printf, 2, 3)));
+	// Shows the question and waits for the UI thread to call answer()
+	bool ask(Channel& channel, const char *question);
+	void answer(Channel& channel, bool yes);
+}
+
+#endif // _PROGRESS_H_
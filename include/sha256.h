@@ -40,6 +40,12 @@ public:
   /// split into 64 byte blocks (=> 512 bits), hash is 32 bytes long
   enum { BlockSize = 512 / 8, HashBytes = 32 };
 
+  /// one memory block of a scatter/gather list
+  struct Segment { const void* data; size_t numBytes; };
+
+  /// available block functions, see backendName()
+  enum Backend { Auto = 0, Portable, ShaNi, ArmCrypto };
+
   /// same as reset()
   SHA256();
 
@@ -50,6 +56,8 @@ public:
 
   /// add arbitrary number of bytes
   void add(const void* data, size_t numBytes);
+  /// add several memory blocks, in order (scatter/gather list)
+  void add(const Segment* segments, size_t numSegments);
 
   /// return latest hash as 64 hex characters
   std::string getHash();
@@ -59,9 +67,18 @@ public:
   /// restart
   void reset();
 
+  /// force a backend (Auto = pick the fastest one the CPU supports), returns the backend in use
+  static Backend     selectBackend(Backend backend = Auto);
+  /// backend in use, picks one if nothing was hashed yet
+  static Backend     selectedBackend();
+  static const char* backendName(Backend backend);
+
 private:
-  /// process 64 bytes
-  void processBlock(const void* data);
+  /// hashes several instances side by side
+  friend class SHA256Multi;
+
+  /// process numBlocks x 64 bytes
+  void processBlocks(const void* data, size_t numBlocks);
   /// process everything left in the internal buffer
   void processBuffer();
 
@@ -0,0 +1,64 @@
+// //////////////////////////////////////////////////////////
+// sha256multi.h
+// several independent SHA256 hashes computed side by side in SIMD lanes
+//
+
+#pragma once
+
+#include "sha256.h"
+
+
+/// compute up to MaxLanes SHA256 hashes at once
+/** Usage:
+    SHA256Multi sha256(numFiles);
+    while (more data available)
+    {
+      const void* chunks[SHA256Multi::MaxLanes]; // one chunk per file, same size
+      sha256.add(chunks, chunkSize);
+    }
+    sha256.add(lane, pointer to tail of that file, number of bytes); // sizes may differ
+    std::string hashOfFile0 = sha256.getHash(0);
+
+    Each lane gives the same hash as a SHA256 object fed with the same bytes.
+  */
+class SHA256Multi
+{
+public:
+  /// lanes of the widest backend
+  enum { MaxLanes = 8 };
+
+  /// available lane functions, see backendName()
+  enum Backend { Auto = 0, Scalar, Sse2, Avx2, Neon };
+
+  /// hash numLanes (1..MaxLanes) streams
+  explicit SHA256Multi(unsigned numLanes = MaxLanes);
+
+  /// number of streams
+  unsigned lanes() const { return m_numLanes; }
+
+  /// add numBytes of data[lane] to every lane
+  void add(const void* const data[], size_t numBytes);
+  /// add arbitrary number of bytes to one lane
+  void add(unsigned lane, const void* data, size_t numBytes);
+
+  /// return latest hash of a lane as 64 hex characters
+  std::string getHash(unsigned lane);
+  /// return latest hash of a lane as bytes
+  void        getHash(unsigned lane, unsigned char buffer[SHA256::HashBytes]);
+
+  /// restart all lanes
+  void reset();
+
+  /// force a backend (Auto = pick the fastest one the CPU supports), returns the backend in use
+  static Backend     selectBackend(Backend backend = Auto);
+  static const char* backendName(Backend backend);
+  /// lanes hashed per call of a backend
+  static unsigned    backendLanes(Backend backend);
+
+private:
+  /// process numBlocks x 64 bytes in every lane, all buffers are empty
+  void processBlocks(const uint8_t* const data[], size_t numBlocks);
+
+  unsigned m_numLanes;
+  SHA256   m_lanes[MaxLanes];
+};
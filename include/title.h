@@ -26,6 +26,8 @@
 #include <cstdio>
 #include <3ds.h>
 
+class MultiDigest;
+
 class titleException : public std::exception
 {
 	char errStr[256];
@@ -92,7 +94,10 @@ struct Icon
 
 
 std::vector<TitleInfo> getTitleInfos(FS_MediaType mediaType);
-void installCia(const std::u16string& path, FS_MediaType mediaType, std::function<void (const std::u16string& file, u32 percent)> callback=nullptr);
+// If digest is given it sees every byte sent to AM. With expectedSha256 (hex, as MultiDigest::getSha256()
+// gives it) the install is cancelled before AM commits it when the bytes sent hash to something else.
+void installCia(const std::u16string& path, FS_MediaType mediaType, std::function<void (const std::u16string& file, u32 percent)> callback=nullptr,
+                MultiDigest *digest=nullptr, const std::string& expectedSha256=std::string());
 void deleteTitle(FS_MediaType mediaType, u64 titleID);
 bool launchTitle(FS_MediaType mediaType, u8 flags, u64 titleID); // On applet launch it returns false if the applet can't be lauched
 #define relaunchApp() launchTitle(mediatype_SDMC, 2, 0)
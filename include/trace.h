@@ -0,0 +1,80 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <string>
+#include <3ds.h>
+
+// Scoped timing spans for the install path, dumped in Chrome trace format
+// (load the file in chrome://tracing or ui.perfetto.dev).
+// Build with TRACE=1 to enable them, otherwise the macros compile to nothing.
+//
+//   TRACE_SCOPE("verify");                     // Until the end of the block
+//   TRACE_SCOPE_BYTES("FSFILE_Read", size);    // Same with a byte count
+//   res = TRACE_CALL("AM_InstallFirm", AM_InstallFirm(id)); // One call, keeps its value
+//
+// Names must be string literals, only the pointer is stored.
+
+#define TRACE_DEFAULT_PATH  u"/sysdowngrader-trace.json"
+#define TRACE_MAX_EVENTS    (16384) // Oldest events are overwritten when full
+
+
+#ifdef TRACE_ENABLED
+
+namespace trace
+{
+	u64  now();
+	void record(const char *name, u64 start, u64 end, u32 bytes);
+
+	class Span
+	{
+		const char *_name_;
+		u32 _bytes_;
+		u64 _start_;
+
+
+	public:
+		Span(const char *name, u32 bytes=0) : _name_(name), _bytes_(bytes), _start_(now()) {}
+		~Span() {record(_name_, _start_, now(), _bytes_);}
+	};
+
+	// Writes all recorded events and starts over. Returns false if the file couldn't be written.
+	bool dump(const std::u16string& path=TRACE_DEFAULT_PATH);
+	void clear();
+} // namespace trace
+
+#define TRACE_CONCAT_(a, b)             a##b
+#define TRACE_CONCAT(a, b)              TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)               trace::Span TRACE_CONCAT(_traceSpan_, __LINE__)(name)
+#define TRACE_SCOPE_BYTES(name, bytes)  trace::Span TRACE_CONCAT(_traceSpan_, __LINE__)(name, bytes)
+#define TRACE_CALL(name, call)          ({trace::Span _traceCall_(name); (call);})
+#define TRACE_DUMP()                    trace::dump()
+
+#else
+
+#define TRACE_SCOPE(name)               do {} while(0)
+#define TRACE_SCOPE_BYTES(name, bytes)  do {} while(0)
+#define TRACE_CALL(name, call)          (call)
+#define TRACE_DUMP()                    do {} while(0)
+
+#endif // TRACE_ENABLED
+
+#endif // _TRACE_H_
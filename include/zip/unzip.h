@@ -418,6 +418,51 @@ extern int ZEXPORT unzGetLocalExtrafield OF((unzFile file,
     the error code
 */
 
+/***************************************************************************/
+/* Random access in the current file */
+
+extern int ZEXPORT unzSeekCurrentFile64 OF((unzFile file, ZPOS64_T pos));
+/*
+  Move the read position of the current file (opened by unzOpenCurrentFile)
+    to pos bytes of uncompressed data.
+  Stored files are positioned directly. Deflated files are inflated from the
+    closest access point before pos when an index of the current file was
+    built or loaded (see unzBuildAccessIndex), otherwise from the current
+    position, or from the start of the file to go backward.
+  After a seek the CRC of the file is not checked by unzCloseCurrentFile.
+  Seeking backward in an encrypted file is not supported (UNZ_PARAMERROR).
+  return UNZ_OK if there is no problem
+*/
+
+extern int ZEXPORT unzBuildAccessIndex OF((unzFile file, ZPOS64_T span));
+/*
+  Inflate the current file (opened by unzOpenCurrentFile, not raw, not
+    encrypted) once and keep an access point every span bytes of
+    uncompressed data. Each access point holds a 32K window, so a span of a
+    few MB keeps the index small.
+  The read position of the current file is not changed.
+  The index replaces any previous index and is freed by unzFreeAccessIndex
+    or unzClose.
+  return UNZ_OK if there is no problem
+*/
+
+extern int ZEXPORT unzSaveAccessIndex OF((unzFile file, const void* path));
+extern int ZEXPORT unzLoadAccessIndex OF((unzFile file, const void* path));
+/*
+  Write the index of the current file to path, or read it back, using the io
+    functions of the zipfile. Saving it next to the zipfile (e.g. "a.zip.idx")
+    lets an interrupted extraction resume without inflating from the start.
+  unzLoadAccessIndex only needs a current file (it does not need to be
+    opened) and returns UNZ_BADZIPFILE if the index was made for another file
+    or another version of the zipfile.
+  return UNZ_OK if there is no problem
+*/
+
+extern void ZEXPORT unzFreeAccessIndex OF((unzFile file));
+/*
+  Free the index built or loaded for the zipfile.
+*/
+
 /***************************************************************************/
 
 /* Get the current file offset */
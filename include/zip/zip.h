@@ -304,6 +304,34 @@ extern int ZEXPORT zipOpenNewFileInZip4_64 OF((zipFile file,
  */
 
 
+extern int ZEXPORT zipSetParallelDeflate OF((zipFile file,
+                                             int threads,
+                                             uLong blockSize));
+/*
+  Deflate the files opened after this call with up to threads workers (pigz style).
+  The data is cut into blockSize chunks (0 = 128 KB) which are compressed independently,
+  primed with the previous 32 KB as dictionary and ended with a sync flush, so the
+  result is still one standard deflate stream. The CRCs of the blocks are combined.
+  threads <= 1 restores the single stream deflate. Encrypted and raw files are not
+  affected. The workers are started once per file, when its first threads * blockSize
+  bytes are in, and wait for the next batch in between; a shorter file is deflated as
+  one stream without them.
+  On the 3DS the caller keeps its core and the workers only go to core 2 of a New 3DS
+  and to the syscore if the app has time on it (APT_SetAppCpuTimeLimit), so threads is
+  cut to 1 + those cores; with neither the files are deflated serially.
+*/
+
+extern int ZEXPORT zipSetAdaptiveStore OF((zipFile file,
+                                           uLong sampleSize,
+                                           int maxRatio));
+/*
+  For the files opened after this call with method Z_DEFLATED the first sampleSize
+  bytes (0 disables it) are trial compressed with a fast level before anything is
+  deflated. If the sample doesn't get smaller than maxRatio percent (0 = 95) the file
+  is written as STORED instead and the method in both headers is updated on close.
+  Encrypted and raw files are not affected.
+*/
+
 extern int ZEXPORT zipWriteInFileInZip OF((zipFile file,
                        const void* buf,
                        unsigned len));
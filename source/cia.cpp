@@ -0,0 +1,147 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <3ds.h>
+#include "error.h"
+#include "fs.h"
+#include "misc.h"
+#include "title.h"
+#include "cia.h"
+
+#define _FILE_ "cia.cpp" // Replacement for __FILE__ without the path
+
+// TMD layout, offsets from the start of the header (after the signature)
+#define TMD_HEADER_SIZE        (0xC4)
+#define TMD_TITLE_ID           (0x4C)
+#define TMD_TITLE_VERSION      (0x9C)
+#define TMD_CONTENT_COUNT      (0x9E)
+#define TMD_CONTENT_INFO_SIZE  (0x24 * 64)
+#define TMD_CHUNK_SIZE         (0x30)
+
+
+
+static u16 readBE16(const u8 *p) {return (p[0]<<8) | p[1];}
+static u32 readBE32(const u8 *p) {return ((u32)p[0]<<24) | ((u32)p[1]<<16) | ((u32)p[2]<<8) | p[3];}
+static u64 readBE64(const u8 *p) {return ((u64)readBE32(p)<<32) | readBE32(p + 4);}
+static u32 readLE32(const u8 *p) {return ((u32)p[3]<<24) | ((u32)p[2]<<16) | ((u32)p[1]<<8) | p[0];}
+static u64 readLE64(const u8 *p) {return ((u64)readLE32(p + 4)<<32) | readLE32(p);}
+static u64 align64(u64 x) {return (x + 63) & ~63ULL;}
+
+// Signature type -> signature + padding size
+static u32 tmdSignatureSize(u32 type)
+{
+	switch(type)
+	{
+		case 0x10000: case 0x10003: return 0x200 + 0x3C; // RSA 4096
+		case 0x10001: case 0x10004: return 0x100 + 0x3C; // RSA 2048
+		case 0x10002: case 0x10005: return 0x3C + 0x40;  // ECDSA
+		default: return 0;
+	}
+}
+
+
+AM_TitleEntry CiaInfo::titleEntry() const
+{
+	AM_TitleEntry entry;
+
+	memset(&entry, 0, sizeof(entry));
+	entry.titleID = titleID;
+	entry.size = size;
+	entry.version = version;
+	return entry;
+}
+
+
+CiaInfo getCiaInfo(fs::File& file)
+{
+	CiaInfo info;
+	const u64 fileSize = file.size();
+	u32 bufSize = (u32)std::min<u64>(fileSize, CIA_FIRST_READ);
+	Buffer<u8> buffer(CIA_FIRST_READ, false);
+
+
+	if(fileSize < CIA_HEADER_SIZE) throw titleException(_FILE_, __LINE__, ERR_INVALID_CIA, "无效的CIA文件!");
+
+	file.seek(0, FS_SEEK_SET);
+	if(file.read(&buffer, bufSize) != bufSize) throw titleException(_FILE_, __LINE__, ERR_INVALID_CIA, "无效的CIA文件!");
+
+	const u8 *hdr = &buffer;
+	const u32 headerSize = readLE32(hdr);
+	const u32 certSize   = readLE32(hdr + 0x08);
+	const u32 ticketSize = readLE32(hdr + 0x0C);
+	const u32 tmdSize    = readLE32(hdr + 0x10);
+	const u64 tmdOffset  = align64(headerSize) + align64(certSize) + align64(ticketSize);
+
+	if(headerSize != CIA_HEADER_SIZE || tmdOffset + tmdSize > fileSize || tmdSize < 4)
+		throw titleException(_FILE_, __LINE__, ERR_INVALID_CIA, "无效的CIA文件!");
+
+	info.size = fileSize;
+	info.contentSize = readLE64(hdr + 0x18);
+	info.contentOffset = tmdOffset + align64(tmdSize);
+
+
+	// Only a real cert chain or a TMD with many contents need a second read
+	std::vector<u8> bigTmd;
+	const u8 *tmd;
+	if(tmdOffset + tmdSize <= bufSize) tmd = &buffer + tmdOffset;
+	else
+	{
+		bigTmd.resize(tmdSize);
+		file.seek(tmdOffset, FS_SEEK_SET);
+		if(file.read(bigTmd.data(), tmdSize) != tmdSize) throw titleException(_FILE_, __LINE__, ERR_INVALID_CIA, "无效的CIA文件!");
+		tmd = bigTmd.data();
+	}
+
+	const u32 sigSize = tmdSignatureSize(readBE32(tmd));
+	if(!sigSize || 4 + sigSize + TMD_HEADER_SIZE + TMD_CONTENT_INFO_SIZE > tmdSize)
+		throw titleException(_FILE_, __LINE__, ERR_INVALID_CIA, "无效的CIA TMD!");
+
+	const u8 *tmdHeader = tmd + 4 + sigSize;
+	const u16 contentCount = readBE16(tmdHeader + TMD_CONTENT_COUNT);
+	info.titleID = readBE64(tmdHeader + TMD_TITLE_ID);
+	info.version = readBE16(tmdHeader + TMD_TITLE_VERSION);
+
+	const u8 *chunk = tmdHeader + TMD_HEADER_SIZE + TMD_CONTENT_INFO_SIZE;
+	if(4 + sigSize + TMD_HEADER_SIZE + TMD_CONTENT_INFO_SIZE + (u64)contentCount * TMD_CHUNK_SIZE > tmdSize)
+		throw titleException(_FILE_, __LINE__, ERR_INVALID_CIA, "无效的CIA TMD!");
+
+	info.contents.resize(contentCount);
+	for(u32 i=0; i<contentCount; i++, chunk += TMD_CHUNK_SIZE)
+	{
+		CiaContent& c = info.contents[i];
+		c.id    = readBE32(chunk);
+		c.index = readBE16(chunk + 0x04);
+		c.type  = readBE16(chunk + 0x06);
+		c.size  = readBE64(chunk + 0x08);
+		memcpy(c.hash, chunk + 0x10, sizeof(c.hash));
+	}
+
+	return info;
+}
+
+
+CiaInfo getCiaInfo(const std::u16string& path, FS_Archive& archive)
+{
+	fs::File file(path, FS_OPEN_READ, archive);
+
+	return getCiaInfo(file);
+}
@@ -0,0 +1,463 @@
+// //////////////////////////////////////////////////////////
+// crc32.cpp
+// CRC-32 (IEEE 802.3, same as zlib/ZIP) with runtime selected kernels
+//
+// - slicing-by-8:  default, 8 KB of tables fit the ARM11 L1 cache
+// - slicing-by-16: 16 KB of tables, faster on hosts with big caches
+// - ARMv8 CRC32 instructions (AArch64 Linux hosts)
+// - PCLMULQDQ folding (x86 hosts), see Intel's
+//   "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+//
+
+#include "crc32.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CRC32_HAVE_PCLMUL
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+#define CRC32_HAVE_ARMCRC
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+
+namespace
+{
+  /// reversed polynomial 0x04C11DB7
+  const uint32_t Polynomial = 0xEDB88320;
+
+  /// kernels work on the inverted CRC state
+  typedef uint32_t (*KernelFunc)(uint32_t crc, const uint8_t* data, size_t numBytes);
+
+  /// lookup tables for slicing-by-N, s_table[0] is the classic byte table
+  uint32_t s_table[16][256];
+  bool     s_tableReady = false;
+
+  void buildTables()
+  {
+    if (s_tableReady)
+      return;
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      uint32_t crc = i;
+      for (int j = 0; j < 8; j++)
+        crc = (crc >> 1) ^ (-int32_t(crc & 1) & Polynomial);
+      s_table[0][i] = crc;
+    }
+
+    for (uint32_t i = 0; i < 256; i++)
+      for (int slice = 1; slice < 16; slice++)
+        s_table[slice][i] = (s_table[slice - 1][i] >> 8) ^ s_table[0][s_table[slice - 1][i] & 0xFF];
+
+    s_tableReady = true;
+  }
+
+  inline uint32_t load32(const uint8_t* data)
+  {
+    uint32_t x;
+    memcpy(&x, data, 4);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    x = __builtin_bswap32(x);
+#endif
+    return x;
+  }
+
+  inline uint32_t crcBytes(uint32_t crc, const uint8_t* data, size_t numBytes)
+  {
+    while (numBytes--)
+      crc = (crc >> 8) ^ s_table[0][(crc ^ *data++) & 0xFF];
+    return crc;
+  }
+
+
+  uint32_t crcSlicing8(uint32_t crc, const uint8_t* data, size_t numBytes)
+  {
+    while (numBytes >= 8)
+    {
+      uint32_t one = load32(data) ^ crc;
+      uint32_t two = load32(data + 4);
+      crc = s_table[7][ one        & 0xFF] ^
+            s_table[6][(one >>  8) & 0xFF] ^
+            s_table[5][(one >> 16) & 0xFF] ^
+            s_table[4][ one >> 24        ] ^
+            s_table[3][ two        & 0xFF] ^
+            s_table[2][(two >>  8) & 0xFF] ^
+            s_table[1][(two >> 16) & 0xFF] ^
+            s_table[0][ two >> 24        ];
+      data     += 8;
+      numBytes -= 8;
+    }
+
+    return crcBytes(crc, data, numBytes);
+  }
+
+
+  uint32_t crcSlicing16(uint32_t crc, const uint8_t* data, size_t numBytes)
+  {
+    while (numBytes >= 16)
+    {
+      uint32_t one   = load32(data) ^ crc;
+      uint32_t two   = load32(data + 4);
+      uint32_t three = load32(data + 8);
+      uint32_t four  = load32(data + 12);
+      crc = s_table[15][ one          & 0xFF] ^
+            s_table[14][(one   >>  8) & 0xFF] ^
+            s_table[13][(one   >> 16) & 0xFF] ^
+            s_table[12][ one   >> 24        ] ^
+            s_table[11][ two          & 0xFF] ^
+            s_table[10][(two   >>  8) & 0xFF] ^
+            s_table[ 9][(two   >> 16) & 0xFF] ^
+            s_table[ 8][ two   >> 24        ] ^
+            s_table[ 7][ three        & 0xFF] ^
+            s_table[ 6][(three >>  8) & 0xFF] ^
+            s_table[ 5][(three >> 16) & 0xFF] ^
+            s_table[ 4][ three >> 24        ] ^
+            s_table[ 3][ four         & 0xFF] ^
+            s_table[ 2][(four  >>  8) & 0xFF] ^
+            s_table[ 1][(four  >> 16) & 0xFF] ^
+            s_table[ 0][ four  >> 24        ];
+      data     += 16;
+      numBytes -= 16;
+    }
+
+    return crcSlicing8(crc, data, numBytes);
+  }
+
+
+#ifdef CRC32_HAVE_ARMCRC
+  __attribute__((target("+crc")))
+  uint32_t crcArm(uint32_t crc, const uint8_t* data, size_t numBytes)
+  {
+    while (numBytes >= 8)
+    {
+      uint64_t x;
+      memcpy(&x, data, 8);
+      crc = __crc32d(crc, x);
+      data     += 8;
+      numBytes -= 8;
+    }
+    while (numBytes--)
+      crc = __crc32b(crc, *data++);
+
+    return crc;
+  }
+#endif
+
+
+#ifdef CRC32_HAVE_PCLMUL
+  __attribute__((target("sse4.1,pclmul")))
+  uint32_t crcPclmul(uint32_t crc, const uint8_t* data, size_t numBytes)
+  {
+    // folding needs at least 4 blocks of 16 bytes
+    if (numBytes < 64)
+      return crcSlicing16(crc, data, numBytes);
+
+    // bit-reflected constants x^(4*128+32) mod P etc., see the paper's appendix
+    static const uint64_t k1k2[2] __attribute__((aligned(16))) = { 0x0154442bd4, 0x01c6e41596 };
+    static const uint64_t k3k4[2] __attribute__((aligned(16))) = { 0x01751997d0, 0x00ccaa009e };
+    static const uint64_t k5k0[2] __attribute__((aligned(16))) = { 0x0163cd6124, 0x0000000000 };
+    static const uint64_t poly[2] __attribute__((aligned(16))) = { 0x01db710641, 0x01f7011641 };
+
+    size_t tail = numBytes & 15;
+    numBytes -= tail;
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((const __m128i*)(data + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(data + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(data + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+    x0 = _mm_load_si128((const __m128i*)k1k2);
+    data     += 64;
+    numBytes -= 64;
+
+    // fold 4 lanes in parallel
+    while (numBytes >= 64)
+    {
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+      x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+      x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+      x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+      x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+      y5 = _mm_loadu_si128((const __m128i*)(data + 0x00));
+      y6 = _mm_loadu_si128((const __m128i*)(data + 0x10));
+      y7 = _mm_loadu_si128((const __m128i*)(data + 0x20));
+      y8 = _mm_loadu_si128((const __m128i*)(data + 0x30));
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+      x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+      x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+      x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+      data     += 64;
+      numBytes -= 64;
+    }
+
+    // fold the 4 lanes into one
+    x0 = _mm_load_si128((const __m128i*)k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // remaining 16 byte blocks
+    while (numBytes >= 16)
+    {
+      x2 = _mm_loadu_si128((const __m128i*)data);
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+      data     += 16;
+      numBytes -= 16;
+    }
+
+    // 128 => 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128((const __m128i*)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    crc = (uint32_t)_mm_extract_epi32(x1, 1);
+    return crcSlicing8(crc, data, tail);
+  }
+#endif
+
+
+  CRC32::Kernel s_kernel     = CRC32::Auto;
+  KernelFunc    s_kernelFunc = NULL;
+
+  bool kernelSupported(CRC32::Kernel kernel)
+  {
+    switch (kernel)
+    {
+      case CRC32::Slicing8:
+      case CRC32::Slicing16:
+        return true;
+#ifdef CRC32_HAVE_ARMCRC
+      case CRC32::ArmCrc:
+        return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#endif
+#ifdef CRC32_HAVE_PCLMUL
+      case CRC32::Pclmul:
+        return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+      default:
+        return false;
+    }
+  }
+
+
+  // 32x32 bit matrices over GF(2) for combine(), same approach as zlib
+  uint32_t gf2MatrixTimes(const uint32_t* mat, uint32_t vec)
+  {
+    uint32_t sum = 0;
+    while (vec)
+    {
+      if (vec & 1)
+        sum ^= *mat;
+      vec >>= 1;
+      mat++;
+    }
+    return sum;
+  }
+
+  void gf2MatrixSquare(uint32_t* square, const uint32_t* mat)
+  {
+    for (int n = 0; n < 32; n++)
+      square[n] = gf2MatrixTimes(mat, mat[n]);
+  }
+}
+
+
+/// pick the fastest supported kernel unless one is forced
+CRC32::Kernel CRC32::selectKernel(Kernel kernel)
+{
+  buildTables();
+
+  if (kernel == Auto || !kernelSupported(kernel))
+  {
+#if defined(ARM11)
+    // ARM11 has 16 KB of L1 data cache, slicing-by-16 would thrash it
+    kernel = Slicing8;
+#else
+    kernel = Slicing16;
+    if (kernelSupported(ArmCrc))
+      kernel = ArmCrc;
+    if (kernelSupported(Pclmul))
+      kernel = Pclmul;
+#endif
+  }
+
+  switch (kernel)
+  {
+#ifdef CRC32_HAVE_ARMCRC
+    case ArmCrc:    s_kernelFunc = crcArm;       break;
+#endif
+#ifdef CRC32_HAVE_PCLMUL
+    case Pclmul:    s_kernelFunc = crcPclmul;    break;
+#endif
+    case Slicing16: s_kernelFunc = crcSlicing16; break;
+    default:        s_kernelFunc = crcSlicing8;  kernel = Slicing8; break;
+  }
+
+  s_kernel = kernel;
+  return kernel;
+}
+
+
+const char* CRC32::kernelName(Kernel kernel)
+{
+  switch (kernel)
+  {
+    case Slicing8:  return "slicing-by-8";
+    case Slicing16: return "slicing-by-16";
+    case ArmCrc:    return "armv8-crc32";
+    case Pclmul:    return "pclmulqdq";
+    default:        return "auto";
+  }
+}
+
+
+/// continue a zlib compatible CRC
+uint32_t CRC32::update(uint32_t crc, const void* data, size_t numBytes)
+{
+  // first use picks the kernel, call selectKernel() up front when using several threads
+  if (s_kernelFunc == NULL)
+    selectKernel(s_kernel);
+
+  return ~s_kernelFunc(~crc, (const uint8_t*) data, numBytes);
+}
+
+
+/// CRC of A+B from CRC(A), CRC(B) and the length of B
+uint32_t CRC32::combine(uint32_t crcA, uint32_t crcB, uint64_t lengthB)
+{
+  if (lengthB == 0)
+    return crcA;
+
+  uint32_t even[32]; // even power-of-two zeros operator
+  uint32_t odd [32]; // odd power-of-two zeros operator
+
+  // operator for one zero bit
+  odd[0] = Polynomial;
+  uint32_t row = 1;
+  for (int n = 1; n < 32; n++)
+  {
+    odd[n] = row;
+    row <<= 1;
+  }
+
+  // two and four zero bits
+  gf2MatrixSquare(even, odd);
+  gf2MatrixSquare(odd, even);
+
+  // apply lengthB zero bytes to crcA, the first square gives one zero byte
+  do
+  {
+    gf2MatrixSquare(even, odd);
+    if (lengthB & 1)
+      crcA = gf2MatrixTimes(even, crcA);
+    lengthB >>= 1;
+    if (lengthB == 0)
+      break;
+
+    gf2MatrixSquare(odd, even);
+    if (lengthB & 1)
+      crcA = gf2MatrixTimes(odd, crcA);
+    lengthB >>= 1;
+  } while (lengthB != 0);
+
+  return crcA ^ crcB;
+}
+
+
+/// same as reset()
+CRC32::CRC32()
+{
+  reset();
+}
+
+
+/// restart
+void CRC32::reset()
+{
+  m_hash = 0;
+}
+
+
+/// add arbitrary number of bytes
+void CRC32::add(const void* data, size_t numBytes)
+{
+  m_hash = update(m_hash, data, numBytes);
+}
+
+
+/// return latest hash as 8 hex characters
+std::string CRC32::getHash()
+{
+  // convert hash to string
+  static const char dec2hex[16+1] = "0123456789abcdef";
+
+  char hashBuffer[8+1];
+
+  int offset = 0;
+  for (int i = 28; i >= 0; i -= 4)
+    hashBuffer[offset++] = dec2hex[(m_hash >> i) & 15];
+  hashBuffer[offset] = 0;
+
+  return hashBuffer;
+}
+
+
+/// return latest hash as bytes
+void CRC32::getHash(unsigned char buffer[CRC32::HashBytes])
+{
+  buffer[0] = (m_hash >> 24) & 0xFF;
+  buffer[1] = (m_hash >> 16) & 0xFF;
+  buffer[2] = (m_hash >>  8) & 0xFF;
+  buffer[3] =  m_hash        & 0xFF;
+}
+
+
+/// compute CRC32 of a memory block
+std::string CRC32::operator()(const void* data, size_t numBytes)
+{
+  reset();
+  add(data, numBytes);
+  return getHash();
+}
+
+
+/// compute CRC32 of a string, excluding final zero
+std::string CRC32::operator()(const std::string& text)
+{
+  reset();
+  add(text.c_str(), text.size());
+  return getHash();
+}
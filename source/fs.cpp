@@ -25,6 +25,9 @@
 #include <3ds.h>
 #include "fs.h"
 #include "misc.h"
+#include "multidigest.h"
+#include "metrics.h"
+#include "iotune.h"
 //#include "zip.h"
 //#include "unzip.h"
 
@@ -66,9 +69,9 @@ namespace fs
 
 		close(); // Close file handle before we open a new one
 		seek(0, FS_SEEK_SET); // Reset current offset
-		if(FSUSER_OpenFile(&_fileHandle_, archive, filePath, openFlags & 3, 0))
+		if(SERVICE_CALL(FSUSER_OpenFile, &_fileHandle_, archive, filePath, openFlags & 3, 0))
 		{
-			if((res = FSUSER_OpenFile(&_fileHandle_, archive, filePath, openFlags, 0)))
+			if((res = SERVICE_CALL(FSUSER_OpenFile, &_fileHandle_, archive, filePath, openFlags, 0)))
 				throw fsException(_FILE_, __LINE__, res, "打开文件失败!");
 		}
 	}
@@ -81,9 +84,9 @@ namespace fs
 
 		close(); // Close file handle before we open a new one
 		seek(0, FS_SEEK_SET); // Reset current offset
-		if(FSUSER_OpenFile(&_fileHandle_, archive, lowPath, openFlags & 3, 0))
+		if(SERVICE_CALL(FSUSER_OpenFile, &_fileHandle_, archive, lowPath, openFlags & 3, 0))
 		{
-			if((res = FSUSER_OpenFile(&_fileHandle_, archive, lowPath, openFlags, 0)))
+			if((res = SERVICE_CALL(FSUSER_OpenFile, &_fileHandle_, archive, lowPath, openFlags, 0)))
 				throw fsException(_FILE_, __LINE__, res, "打开文件失败!");
 		}
 	}
@@ -97,6 +100,7 @@ namespace fs
 		Result res;
 
 
+		SERVICE_SCOPE_BYTES(FSFILE_Read, size);
 		if((res = FSFILE_Read(_fileHandle_, &bytesRead, _offset_, buf, size)))
 			throw fsException(_FILE_, __LINE__, res, "无法读取文件!");
 
@@ -113,6 +117,7 @@ namespace fs
 		Result res;
 
 
+		SERVICE_SCOPE_BYTES(FSFILE_Write, size);
 		if((res = FSFILE_Write(_fileHandle_, &bytesWritten, _offset_, buf, size, FS_WRITE_FLUSH)))
 			throw fsException(_FILE_, __LINE__, res, "无法写入文件!");
 
@@ -128,7 +133,7 @@ namespace fs
     Result res;
 
 
-		if((res = FSFILE_Flush(_fileHandle_))) throw fsException(_FILE_, __LINE__, res, "刷新文件失败!");
+		if((res = SERVICE_CALL(FSFILE_Flush, _fileHandle_))) throw fsException(_FILE_, __LINE__, res, "刷新文件失败!");
 	}
 
 
@@ -156,7 +161,7 @@ namespace fs
 		Result res;
 
 
-		if((res = FSFILE_GetSize(_fileHandle_, &tmp))) throw fsException(_FILE_, __LINE__, res, "无法获取文件大小!");
+		if((res = SERVICE_CALL(FSFILE_GetSize, _fileHandle_, &tmp))) throw fsException(_FILE_, __LINE__, res, "无法获取文件大小!");
 
 		return tmp;
 	}
@@ -169,7 +174,7 @@ namespace fs
 		Result res;
 
 
-		if((res = FSFILE_SetSize(_fileHandle_, size))) throw fsException(_FILE_, __LINE__, res, "无法设置文件大小!");
+		if((res = SERVICE_CALL(FSFILE_SetSize, _fileHandle_, size))) throw fsException(_FILE_, __LINE__, res, "无法设置文件大小!");
 	}
 
 
@@ -216,9 +221,9 @@ namespace fs
 		Result res;
 
 
-		if(!FSUSER_OpenFile(&fileHandle, archive, filePath, FS_OPEN_READ, 0))
+		if(!SERVICE_CALL(FSUSER_OpenFile, &fileHandle, archive, filePath, FS_OPEN_READ, 0))
 		{
-			if((res = FSFILE_Close(fileHandle))) throw fsException(_FILE_, __LINE__, res, "关闭文件失败!");
+			if((res = SERVICE_CALL(FSFILE_Close, fileHandle))) throw fsException(_FILE_, __LINE__, res, "关闭文件失败!");
 			return true;
 		}
 
@@ -233,13 +238,14 @@ namespace fs
 		Result res;
 
 
-		if((res = FSUSER_RenameFile(srcArchive, srcPath, dstArchive, dstPath)))
+		if((res = SERVICE_CALL(FSUSER_RenameFile, srcArchive, srcPath, dstArchive, dstPath)))
 			throw fsException(_FILE_, __LINE__, res, "无法移动文件!");
 	}
 
 
-	u64 copyFile(const std::u16string& src, const std::u16string& dst, std::function<void (const std::u16string& file, u32 percent)> callback, FS_Archive& srcArchive, FS_Archive& dstArchive)
+	u64 copyFile(const std::u16string& src, const std::u16string& dst, std::function<void (const std::u16string& file, u32 percent)> callback, FS_Archive& srcArchive, FS_Archive& dstArchive, MultiDigest *digest)
 	{
+		TRACE_SCOPE("fs::copyFile");
 		File inFile(src, FS_OPEN_READ, srcArchive), outFile(dst, FS_OPEN_WRITE|FS_OPEN_CREATE, dstArchive);
 		u32 blockSize;
 		u64 inFileSize, offset = 0;
@@ -250,17 +256,23 @@ namespace fs
 		outFile.setSize(inFileSize);
 
 
-		Buffer<u8> buffer(MAX_BUF_SIZE, false);
+		const u32 bufSize = iotune::blockSize();
+		Buffer<u8> buffer(bufSize, false);
 
 
-		for(u32 i=0; i<=inFileSize / MAX_BUF_SIZE; i++)
+		for(u32 i=0; i<=inFileSize / bufSize; i++)
 		{
-			blockSize = ((inFileSize - offset<MAX_BUF_SIZE) ? inFileSize - offset : MAX_BUF_SIZE);
+			blockSize = ((inFileSize - offset<bufSize) ? inFileSize - offset : bufSize);
 
 			if(blockSize>0)
 			{
 				inFile.read(&buffer, blockSize);
 				outFile.write(&buffer, blockSize);
+				if(digest)
+				{
+					TRACE_SCOPE_BYTES("MultiDigest::add", blockSize);
+					digest->add(&buffer, blockSize);
+				}
 
 				offset += blockSize;
 				if(callback) callback(src, offset * 100 / inFileSize);
@@ -277,7 +289,7 @@ namespace fs
 		Result res;
 
 
-		if((res = FSUSER_DeleteFile(archive, srcPath))) throw fsException(_FILE_, __LINE__, res, "删除文件失败!");
+		if((res = SERVICE_CALL(FSUSER_DeleteFile, archive, srcPath))) throw fsException(_FILE_, __LINE__, res, "删除文件失败!");
 	}
 
 
@@ -292,9 +304,9 @@ namespace fs
 		Result res;
 
 
-		if(!FSUSER_OpenDirectory(&dirHandle, archive, dirPath))
+		if(!SERVICE_CALL(FSUSER_OpenDirectory, &dirHandle, archive, dirPath))
 		{
-			if((res = FSDIR_Close(dirHandle))) throw fsException(_FILE_, __LINE__, res, "无法关闭目录!");
+			if((res = SERVICE_CALL(FSDIR_Close, dirHandle))) throw fsException(_FILE_, __LINE__, res, "无法关闭目录!");
 			return true;
 		}
 
@@ -309,12 +321,12 @@ namespace fs
 		Result res;
 
 
-		if(!FSUSER_OpenDirectory(&dirHandle, archive, dirPath))
+		if(!SERVICE_CALL(FSUSER_OpenDirectory, &dirHandle, archive, dirPath))
 		{
-			if((res = FSDIR_Close(dirHandle))) throw fsException(_FILE_, __LINE__, res, "无法关闭目录!");
+			if((res = SERVICE_CALL(FSDIR_Close, dirHandle))) throw fsException(_FILE_, __LINE__, res, "无法关闭目录!");
 			return;
 		}
-		if((res = FSUSER_CreateDirectory(archive, dirPath, 0)))
+		if((res = SERVICE_CALL(FSUSER_CreateDirectory, archive, dirPath, 0)))
 			throw fsException(_FILE_, __LINE__, res, "创建目录失败!");
 	}
 
@@ -398,7 +410,7 @@ namespace fs
 
 
 
-		if((res = FSUSER_OpenDirectory(&dirHandle, archive, dirPath)))
+		if((res = SERVICE_CALL(FSUSER_OpenDirectory, &dirHandle, archive, dirPath)))
 			throw fsException(_FILE_, __LINE__, res, "无法打开目录!");
 
 
@@ -409,7 +421,7 @@ namespace fs
 		{
 			entriesRead = 0;
 			filesFolders.reserve(filesFolders.size()+32); // Save time by reserving enough mem
-			if((res = FSDIR_Read(dirHandle, &entriesRead, 32, &entries))) throw fsException(_FILE_, __LINE__, res, "读取目录失败!");
+			if((res = SERVICE_CALL(FSDIR_Read, dirHandle, &entriesRead, 32, &entries))) throw fsException(_FILE_, __LINE__, res, "读取目录失败!");
 
 			if(useFilter)
 			{
@@ -458,7 +470,7 @@ namespace fs
 
 
 
-		if((res = FSDIR_Close(dirHandle))) throw fsException(_FILE_, __LINE__, res, "无法关闭目录!");
+		if((res = SERVICE_CALL(FSDIR_Close, dirHandle))) throw fsException(_FILE_, __LINE__, res, "无法关闭目录!");
 
 		return filesFolders;
 	}
@@ -471,7 +483,7 @@ namespace fs
 		Result res;
 
 
-		if((res = FSUSER_RenameDirectory(srcArchive, srcPath, dstArchive, dstPath))) throw fsException(_FILE_, __LINE__, res, "无法移动目录!");
+		if((res = SERVICE_CALL(FSUSER_RenameDirectory, srcArchive, srcPath, dstArchive, dstPath))) throw fsException(_FILE_, __LINE__, res, "无法移动目录!");
 	}
 
 
@@ -547,7 +559,7 @@ namespace fs
 
 		if(path.compare(u"/") != 0)
 		{
-			if((res = FSUSER_DeleteDirectoryRecursively(archive, dirPath)))
+			if((res = SERVICE_CALL(FSUSER_DeleteDirectoryRecursively, archive, dirPath)))
 				throw fsException(_FILE_, __LINE__, res, "删除目录失败!");
 		}
 		else // We can't delete "/" itself so delete everything in root
@@ -648,6 +660,8 @@ namespace fs
 		if(fileExist(zipDst)) deleteFile(zipDst);
 		zipFile zip = zipOpen2(zipDst.c_str(), APPEND_STATUS_CREATE, nullptr, nullptr);
 		if(!zip) throw fsException(_FILE_, __LINE__, 0xDEADBEEF, "Failed to create ZIP file!");
+		zipSetParallelDeflate(zip, 2, 0); // Deflate big files on 2 threads
+		zipSetAdaptiveStore(zip, 0x20000, 0); // Store encrypted files like CIAs instead of deflating them
 
 		std::vector<DirEntry> entries = listDirContents(tmpInPath, u"", srcArchive);
 		helper[0] = 0; // We are in the root at file/folder 0
@@ -832,10 +846,10 @@ namespace fs
 void sdmcArchiveInit()
 {
 	sdmcArchive = (FS_Archive){0x00000009, (FS_Path){PATH_EMPTY, 1, (u8*)""}};
-	FSUSER_OpenArchive(&sdmcArchive);
+	SERVICE_CALL(FSUSER_OpenArchive, &sdmcArchive);
 }
 
 void sdmcArchiveExit()
 {
-	FSUSER_CloseArchive(&sdmcArchive);
+	SERVICE_CALL(FSUSER_CloseArchive, &sdmcArchive);
 }
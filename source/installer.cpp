@@ -0,0 +1,758 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <3ds.h>
+#include "error.h"
+#include "fs.h"
+#include "misc.h"
+#include "title.h"
+#include "installer.h"
+#include "sha256.h"
+#include "sha256multi.h"
+#include "multidigest.h"
+#include "cia.h"
+#include "metrics.h"
+#include "progress.h"
+#include "journal.h"
+#include "iotune.h"
+#include "logger.h"
+#include "manifest.h"
+
+#ifndef _3DS
+#include <thread>
+#endif
+
+#define _FILE_ "installer.cpp" // Replacement for __FILE__ without the path
+
+typedef struct
+{
+	std::u16string name;
+	AM_TitleEntry entry;
+	bool requiresDelete;
+} TitleInstallInfo;
+
+struct InstallJob
+{
+	bool downgrade;
+	InstallSummary summary;
+};
+
+#define INSTALL_STACK_SIZE (64 * 1024)
+
+static progress::Channel *channel = nullptr; // Set while installUpdates() runs on the worker
+static u8 currentPhase = progress::PHASE_TEXT;    // What the log records of errors say
+static u64 currentTitle = 0;
+static u64 workTotal = 0, workBase = 0; // Bytes to hash and install, for the ETA
+static InstallJob job;
+#ifdef _3DS
+static Thread worker = NULL;
+#else
+static std::thread worker;
+#endif
+
+// Ordered from highest to lowest priority.
+static const u32 titleTypes[7] = {
+		0x00040138, // System Firmware
+		0x00040130, // System Modules
+		0x00040030, // Applets
+		0x00040010, // System Applications
+		0x0004001B, // System Data Archives
+		0x0004009B, // System Data Archives (Shared Archives)
+		0x000400DB, // System Data Archives
+};
+
+u32 getTitlePriority(u64 id) {
+	u32 type = (u32) (id >> 32);
+	for(u32 i = 0; i < 7; i++) {
+		if(type == titleTypes[i]) {
+			return i;
+		}
+	}
+
+	return 0;
+}
+
+bool sortTitlesHighToLow(const TitleInstallInfo &a, const TitleInstallInfo &b) {
+	bool aSafe = (a.entry.titleID & 0xFF) == 0x03;
+	bool bSafe = (b.entry.titleID & 0xFF) == 0x03;
+	if(aSafe != bSafe) {
+		return aSafe;
+	}
+
+	return getTitlePriority(a.entry.titleID) < getTitlePriority(b.entry.titleID);
+}
+
+bool sortTitlesLowToHigh(const TitleInstallInfo &a, const TitleInstallInfo &b) {
+        bool aSafe = (a.entry.titleID & 0xFF) == 0x03;
+        bool bSafe = (b.entry.titleID & 0xFF) == 0x03;
+        if(aSafe != bSafe) {
+                return aSafe;
+        }
+
+	return getTitlePriority(a.entry.titleID) > getTitlePriority(b.entry.titleID);
+}
+
+// Find title and compare versions. Returns CIA file version - installed title version
+int versionCmp(std::vector<TitleInfo>& installedTitles, u64& titleID, u16 version)
+{
+	for(auto it : installedTitles)
+	{
+		if(it.titleID == titleID)
+		{
+			return (version - it.version);
+		}
+	}
+
+	return 1; // The title is not installed
+}
+
+
+// printf() on the console, or through the channel when the UI thread owns the console
+static void say(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void say(const char *format, ...)
+{
+	char buf[512];
+	va_list args;
+
+
+	va_start(args, format);
+	vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+
+	if(channel) progress::print(*channel, "%s", buf);
+	else fputs(buf, stdout);
+}
+
+// Status line for the UI. Steps are posted losslessly, updates within a step may get dropped.
+static void status(u8 phase, u64 titleID, u64 bytes, u64 total, u32 index, u32 count, bool lossless)
+{
+	static u8 lastPhase = progress::PHASE_TEXT;
+	static u64 phaseStart = 0;
+	progress::Event event = progress::Event();
+
+
+	currentPhase = phase;
+	currentTitle = titleID;
+	if(!channel) return;
+
+	if(phase != lastPhase && phase != progress::PHASE_DELETE) // Deletes come between installs
+	{
+		lastPhase = phase;
+		phaseStart = svcGetSystemTick();
+	}
+	const u64 elapsed = svcGetSystemTick() - phaseStart;
+
+	event.phase = phase;
+	event.index = index;
+	event.count = count;
+	event.titleID = titleID;
+	event.bytes = bytes;
+	event.total = total;
+	event.kbPerSec = (elapsed ? (bytes / 1024) * SYSCLOCK_ARM11 / elapsed : 0);
+
+	// The rest of the run at the rate of this phase, the total is known before the first byte
+	// is hashed. Installing is slower than hashing, so the ETA settles once installs start.
+	const u64 done = workBase + bytes;
+	if(workTotal && bytes && done < workTotal && (phase == progress::PHASE_VERIFY || phase == progress::PHASE_INSTALL))
+		event.etaSeconds = (double)(workTotal - done) * elapsed / bytes / SYSCLOCK_ARM11;
+
+	if(lossless) progress::post(*channel, event);
+	else progress::tryPost(*channel, event);
+}
+
+
+// Sizes from the directory listing against the manifest file, before a single CIA is opened.
+// The set whose NATIVE_FIRM has the size of ours is the one the headers will match later,
+// a truncated or foreign CIA fails here instead of after hashing. Files not named by their
+// title ID are left to the headers. Only sets of the console's region count if it is known.
+static const manifest::Set* checkSizes(const manifest::Manifest& manifestFile, const std::vector<fs::DirEntry>& filesDirs, u64 homeMenu)
+{
+	std::map<u64, const fs::DirEntry*> byTitle;
+	char msg[128];
+	u64 titleID;
+
+
+	for(auto const &it : filesDirs)
+	{
+		if(!manifest::titleID(it.name, &titleID) || byTitle.count(titleID)) return nullptr;
+		byTitle[titleID] = &it;
+	}
+
+	for(auto const &set : manifestFile.sets())
+	{
+		const manifest::Entry *firm = set.find(set.nativeFirm());
+		auto ours = byTitle.find(set.nativeFirm());
+		if((homeMenu && set.homeMenu() != homeMenu) || !firm->size || ours == byTitle.end() || ours->second->size != firm->size || !byTitle.count(set.homeMenu())) continue;
+
+		if(filesDirs.size() > set.size()) throw titleException(_FILE_, __LINE__, 0, "/updates/中发现太多的title!\n");
+		if(filesDirs.size() < set.size()) throw titleException(_FILE_, __LINE__, 0, "/updates/的title太少!\n");
+		for(auto const &it : byTitle)
+		{
+			const manifest::Entry *expected = set.find(it.first);
+			if(!expected) throw titleException(_FILE_, __LINE__, 0, "/updates/中发现未知的title!\n");
+			if(expected->size && expected->size != it.second->size)
+			{
+				snprintf(msg, sizeof(msg), "\x1b[31m%016llX.cia 大小不对 (%llu, 应为 %llu)!\x1b[0m\n", (unsigned long long)it.first,
+				         (unsigned long long)it.second->size, (unsigned long long)expected->size);
+				throw titleException(_FILE_, __LINE__, 0, msg);
+			}
+		}
+		return &set;
+	}
+
+	return nullptr;
+}
+
+
+// What is left to write to NAND
+static u64 installBytes(const std::vector<TitleInstallInfo>& titles, const std::set<u64>& installed)
+{
+	u64 bytes = 0;
+
+	for(auto const &it : titles)
+		if(!installed.count(it.entry.titleID)) bytes += it.entry.size;
+
+	return bytes;
+}
+
+// A hash the journal recorded counts for any set expecting that digest. Sets share most
+// of their digests, a resumed run against a different set only rehashes what changed.
+static bool sameDigest(const std::string& hash, const u8 *digest)
+{
+	char hex[SHA256::HashBytes * 2 + 1];
+
+
+	for(u32 i = 0; i < SHA256::HashBytes; i++) snprintf(&hex[i * 2], 3, "%02x", digest[i]);
+
+	return hash == hex;
+}
+
+// Home menu of the console's region, the one its manifest set has to have. 0 if CFG can't tell.
+static u64 consoleHomeMenu()
+{
+	u8 region = 0xFF;
+
+
+	if(cfguInit()) return 0;
+	if(CFGU_SecureInfoGetRegion(&region)) region = 0xFF;
+	cfguExit();
+
+	return manifest::homeMenu(region);
+}
+
+
+// If downgrade is true we don't care about versions (except equal versions) and uninstall newer versions
+InstallSummary installUpdates(bool downgrade)
+{
+	TRACE_SCOPE("installUpdates");
+	InstallSummary summary = InstallSummary();
+	std::vector<fs::DirEntry> filesDirs = fs::listDirContents(u"/updates", u".cia;"); // Filter for .cia files
+	std::vector<TitleInstallInfo> titles;
+
+	// What the console is picks its manifest set: New 3DS or not, and the home menu of its region
+	u8 is_n3ds = 0;
+	APT_CheckNew3DS(&is_n3ds);
+	const u64 homeMenu = consoleHomeMenu();
+	logger::print(LOG_INFO, progress::PHASE_READ, homeMenu, 0, "%s 3DS, home menu %016llX", (is_n3ds ? "New" : "Old"), (unsigned long long)homeMenu);
+
+	// A manifest file next to the CIAs (or in romfs) adds firmwares the built-in sets don't have.
+	// One that has other hashes for a built-in firmware isn't trusted at all.
+	manifest::Manifest manifestFile;
+	if(!manifestFile.load(MANIFEST_PATH)) manifestFile.loadRomfs(MANIFEST_ROMFS_PATH);
+	manifest::checkBuiltin(manifestFile);
+	if(const manifest::Set *sized = checkSizes(manifestFile, filesDirs, homeMenu))
+		logger::print(LOG_INFO, progress::PHASE_READ, sized->homeMenu(), 0, "sizes match the v%u manifest", (unsigned int)sized->firmVersion());
+
+	// A run that died halfway left its plan and what it got done. Same files, same
+	// direction: take the plan from there instead of reading headers and versions again.
+	// Any other journal is an unrelated old run's, nothing in it counts.
+	JournalState resume = Journal::replay();
+	const u32 fingerprint = Journal::fingerprint(filesDirs);
+	const bool resuming = !resume.files.empty() && resume.downgrade == downgrade && resume.fingerprint == fingerprint;
+	if(!resuming) resume = JournalState();
+	std::map<std::u16string, const JournalFile*> resumed;
+	Journal journal;
+
+	if(resuming) for(auto& it : resume.files) resumed[it.name] = &it;
+	journal.open(resuming ? resume.validSize : 0);
+	summary.resumed = resuming;
+	workTotal = workBase = 0;
+
+	std::vector<TitleInfo> installedTitles;
+	bool haveInstalledTitles = !resuming;
+	if(haveInstalledTitles) installedTitles = getTitleInfos(MEDIATYPE_NAND);
+
+	// SHA256 of every title that passed verification, in this run or the last one
+	std::map<u64, std::string> verifiedHashes;
+	if(resuming)
+		for(auto const &it : resume.verified)
+			if(resumed.count(it.first)) verifiedHashes[resumed[it.first]->info.titleID] = it.second;
+
+	Buffer<char> tmpStr(256);
+	Result res = 0;
+	TitleInstallInfo installInfo;
+	AM_TitleEntry ciaFileInfo;
+
+	// Block size for this SD card, probed on the biggest CIA the first time. Only after the
+	// size and set checks, /updates that is refused costs no probe reads.
+	bool tuned = false;
+	auto tune = [&]()
+	{
+		const fs::DirEntry *biggest = nullptr;
+		if(tuned) return;
+		tuned = true;
+
+		for(auto& it : filesDirs)
+			if(!it.isDir && (!biggest || it.size > biggest->size)) biggest = &it;
+		if(biggest)
+		{
+			const u32 blockSize = iotune::tune(u"/updates/" + biggest->name);
+			logger::print(LOG_INFO, progress::PHASE_READ, 0, 0, "block size %u KB%s", (unsigned int)(blockSize / 1024), (iotune::probes().empty() ? " (cached or not probed)" : ""));
+			say("I/O块大小: %u KB\n\n", (unsigned int)(blockSize / 1024));
+		}
+	};
+
+	if(resuming) logger::print(LOG_WARN, progress::PHASE_READ, 0, 0, "resuming an interrupted run, %u of %u titles done",
+	                           (unsigned int)resume.installed.size(), (unsigned int)resume.files.size());
+	if(resuming) say("继续上次未完成的安装 (%u/%u)...\n\n", (unsigned int)resume.installed.size(), (unsigned int)resume.files.size());
+	say("正在获取固件文件信息...\n\n");
+
+	// One small read per file instead of AM opening and parsing every CIA twice
+	std::vector<CiaInfo> ciaInfos(filesDirs.size());
+	{
+		TRACE_SCOPE("getCiaInfo");
+		for(u32 i = 0; i < filesDirs.size(); i++)
+		{
+			status(progress::PHASE_READ, 0, 0, 0, i + 1, filesDirs.size(), false);
+			if(filesDirs[i].isDir) continue;
+
+			auto journaled = resumed.find(filesDirs[i].name);
+			ciaInfos[i] = (journaled != resumed.end() ? journaled->second->info : getCiaInfo(u"/updates/" + filesDirs[i].name));
+		}
+	}
+
+	// Plan first, the verifier only hashes what will be installed
+	std::vector<bool> planned(filesDirs.size(), false);
+	std::vector<JournalFile> journalFiles(filesDirs.size());
+	for(u32 fileIdx = 0; fileIdx < filesDirs.size(); fileIdx++)
+	{
+		const fs::DirEntry& it = filesDirs[fileIdx];
+		JournalFile& journalFile = journalFiles[fileIdx];
+
+		journalFile.name = it.name;
+		journalFile.info = ciaInfos[fileIdx];
+		journalFile.info.contents.clear();
+		journalFile.planned = journalFile.requiresDelete = false;
+
+		if(!it.isDir)
+		{
+			// Quick and dirty hack to detect these pesky
+			// attribute files OSX creates.
+			// This should rather be added to the
+			// filter rules later.
+			if(it.name[0] == u'.') continue;
+
+			ciaFileInfo = ciaInfos[fileIdx].titleEntry();
+
+			if(resuming)
+			{
+				journalFile = *resumed[it.name];
+			}
+			else
+			{
+				int cmpResult = versionCmp(installedTitles, ciaFileInfo.titleID, ciaFileInfo.version);
+				journalFile.planned = (downgrade && cmpResult != 0) || (cmpResult > 0);
+				journalFile.requiresDelete = downgrade && cmpResult < 0;
+			}
+
+			if(journalFile.planned)
+			{
+				installInfo.name = it.name;
+				installInfo.entry = ciaFileInfo;
+				installInfo.requiresDelete = journalFile.requiresDelete;
+
+				titles.push_back(installInfo);
+				planned[fileIdx] = true;
+			}
+		}
+	}
+	if(!resuming) journal.plan(downgrade, fingerprint, journalFiles);
+	logger::print(LOG_INFO, progress::PHASE_READ, 0, 0, "%s plan: %u of %u files", (downgrade ? "downgrade" : "upgrade"),
+	              (unsigned int)titles.size(), (unsigned int)filesDirs.size());
+
+	for(u32 fileIdx = 0; fileIdx < filesDirs.size(); fileIdx++)
+	{
+		const fs::DirEntry& it = filesDirs[fileIdx];
+		if(!it.isDir)
+		{
+			ciaFileInfo = ciaInfos[fileIdx].titleEntry();
+
+			if(ciaFileInfo.titleID != 0x0004013800000002LL && ciaFileInfo.titleID != 0x0004013820000002L)
+				continue;
+
+			if(ciaFileInfo.titleID == 0x0004013820000002LL && is_n3ds == 0)
+				throw titleException(_FILE_, __LINE__, res, "在老3上安装N3D的包及易变砖!");
+			if(ciaFileInfo.titleID == 0x0004013800000002LL && is_n3ds == 1 && ciaFileInfo.version > 11872)
+				throw titleException(_FILE_, __LINE__, res, "在N3DS上安装>6.0的老3包及易变砖!");
+
+			if(ciaFileInfo.titleID == 0x0004013800000002LL && is_n3ds == 1 && ciaFileInfo.version < 11872){
+				say("在N3DS上安装老3包会变砖，除非你换了NCSD和加密!\n");
+				say("!! 别继续了 !!\n!! 除非你是A9LH和REDNAND!!\n\n");
+				if(channel)
+				{
+					// Only the UI thread reads the buttons
+					if(!progress::ask(*channel, "(A) 继续\n(B) 取消\n\n"))
+						throw titleException(_FILE_, __LINE__, res, "Canceled!");
+				}
+				else
+				{
+					say("(A) 继续\n(a) 取消\n\n");
+					while(aptMainLoop())
+					{
+						hidScanInput();
+
+						if(hidKeysDown() & KEY_A)
+							break;
+
+						if(hidKeysDown() & KEY_B)
+							throw titleException(_FILE_, __LINE__, res, "Canceled!");
+					}
+				}
+			}
+
+			say("获取固件文件版本...\n\n");
+			say("NATIVE_FIRM (");
+
+			tmpStr.clear();
+			utf16_to_utf8((u8*) &tmpStr, (u16*) it.name.c_str(), 255);
+			say("%s", &tmpStr);
+
+			say(") is v");
+			say("%i\n\n", ciaFileInfo.version);
+
+			say("验证固件文件...\n\n");
+
+			// The set of this console: the NATIVE_FIRM checked against its model above, the
+			// home menu of its region and the version. The files are checked against it below.
+			// Without a region the set is the one whose NATIVE_FIRM and home menu are among the files.
+			bool fromFile = false;
+			const manifest::Set *set = nullptr;
+			if(homeMenu) set = manifest::resolve(manifestFile, ciaFileInfo.version, ciaFileInfo.titleID, homeMenu, &fromFile);
+			if(!set)
+			{
+				std::vector<u64> titleIDs;
+				for(auto const &info : ciaInfos) titleIDs.push_back(info.titleID);
+
+				set = manifest::find(ciaFileInfo.version, titleIDs);
+				if(!set)
+				{
+					set = manifestFile.find(ciaFileInfo.version, titleIDs);
+					fromFile = (set != nullptr);
+				}
+				if(set && homeMenu)
+					throw titleException(_FILE_, __LINE__, res, "\x1b[31m固件文件的区域与主机不符!\x1b[0m\n\n");
+			}
+			if(set) logger::print(LOG_INFO, progress::PHASE_VERIFY, set->homeMenu(), 0, "%s manifest, %u titles",
+			                      (fromFile ? "file" : "built-in"), (unsigned int)set->size());
+
+			if(set) {
+
+				if(filesDirs.size() > set->size()) throw titleException(_FILE_, __LINE__, res, "/updates/中发现太多的title!\n");
+				if(filesDirs.size() < set->size()) throw titleException(_FILE_, __LINE__, res, "/updates/的title太少!\n");
+
+				// Every file has to belong to the set and be complete,
+				// only the ones the plan touches are hashed
+				TRACE_SCOPE("verify");
+				std::vector<u32> toHash;
+				std::set<u64> seen; // Names don't matter, two files of one title would leave another one out
+				u64 bytesHashed = 0, bytesTotal = 0;
+
+				for(u32 i = 0; i < filesDirs.size(); i++) {
+
+					const manifest::Entry *expected = set->find(ciaInfos[i].titleID);
+					if(!expected)
+						throw titleException(_FILE_, __LINE__, res, "/updates/中发现未知的title!\n");
+					if(!seen.insert(ciaInfos[i].titleID).second)
+						throw titleException(_FILE_, __LINE__, res, "/updates/中发现重复的title!\n");
+					if(expected->size && expected->size != filesDirs[i].size)
+						throw titleException(_FILE_, __LINE__, res, "\x1b[31m文件大小不对!\x1b[0m\n\n");
+					if(ciaInfos[i].contentOffset + ciaInfos[i].contentSize > ciaInfos[i].size)
+						throw titleException(_FILE_, __LINE__, res, "\x1b[31m文件不完整!\x1b[0m\n\n");
+
+					bytesTotal += ciaInfos[i].size;
+					auto verified = verifiedHashes.find(ciaInfos[i].titleID);
+					if(planned[i] && verified != verifiedHashes.end() && sameDigest(verified->second, set->sha256(*expected))) {
+						summary.filesResumed++; // Verified before the last run stopped
+					} else if(planned[i]) {
+						toHash.push_back(i);
+						bytesHashed += ciaInfos[i].size;
+					}
+				}
+				workTotal = bytesHashed + installBytes(titles, resuming ? resume.installed : std::set<u64>());
+				tune();
+
+				// Hash up to SHA256Multi::MaxLanes files side by side. The lanes share one tuned
+				// block (never more than MAX_BUF_SIZE), each reads its part of it.
+				const u32 laneCount = std::max<u32>(std::min<u32>(toHash.size(), SHA256Multi::MaxLanes), 1);
+				const u32 chunkSize = std::max<u32>(std::min<u32>(iotune::blockSize(), MAX_BUF_SIZE) / laneCount, IOTUNE_MIN_SIZE) & ~0xFFF;
+				Buffer<u8> shaBuffer(chunkSize * laneCount, false);
+				u64 hashed = 0;
+
+				for(u32 first = 0; first < toHash.size(); first += SHA256Multi::MaxLanes) {
+
+					const u32 lanes = std::min<u32>(toHash.size() - first, SHA256Multi::MaxLanes);
+					fs::File ciaFiles[SHA256Multi::MaxLanes];
+					u64 ciaSize[SHA256Multi::MaxLanes], offset[SHA256Multi::MaxLanes];
+					u64 maxSize = 0;
+					SHA256Multi sha256streams(lanes);
+
+					for(u32 lane = 0; lane < lanes; lane++)
+					{
+						ciaFiles[lane].open(u"/updates/" + filesDirs[toHash[first + lane]].name, FS_OPEN_READ);
+						ciaSize[lane] = ciaFiles[lane].size();
+						offset[lane] = 0;
+						maxSize = std::max(maxSize, ciaSize[lane]);
+					}
+
+					for(u64 done = 0; done < maxSize; done += chunkSize)
+					{
+						const void *chunks[SHA256Multi::MaxLanes];
+						u32 blockSize[SHA256Multi::MaxLanes];
+						u32 common = chunkSize;
+
+						for(u32 lane = 0; lane < lanes; lane++)
+						{
+							blockSize[lane] = ((ciaSize[lane] - offset[lane] < chunkSize) ? ciaSize[lane] - offset[lane] : chunkSize);
+							chunks[lane] = &shaBuffer + lane * chunkSize;
+							common = std::min(common, blockSize[lane]);
+
+							if(blockSize[lane] > 0)
+							{
+								try
+								{
+									ciaFiles[lane].read(&shaBuffer + lane * chunkSize, blockSize[lane]);
+								} catch(fsException& e)
+								{
+									throw titleException(_FILE_, __LINE__, res, "无法读取文件!");
+								}
+
+								offset[lane] += blockSize[lane];
+							}
+						}
+
+						// Equal chunks go through the SIMD lanes, the ends of smaller files one by one
+						TRACE_SCOPE("SHA256Multi::add");
+						sha256streams.add(chunks, common);
+						for(u32 lane = 0; lane < lanes; lane++)
+							sha256streams.add(lane, (const u8*) chunks[lane] + common, blockSize[lane] - common);
+
+						for(u32 lane = 0; lane < lanes; lane++) hashed += blockSize[lane];
+						status(progress::PHASE_VERIFY, 0, hashed, bytesHashed, first + 1, toHash.size(), false);
+					}
+
+					for(u32 lane = 0; lane < lanes; lane++) {
+
+						tmpStr.clear();
+						utf16_to_utf8((u8*) &tmpStr, (u16*) filesDirs[toHash[first + lane]].name.c_str(), 255);
+
+						say("%s", &tmpStr);
+
+						u8 digest[SHA256::HashBytes];
+						sha256streams.getHash(lane, digest);
+						const std::string hash = sha256streams.getHash(lane);
+						if(memcmp(digest, set->sha256(*set->find(ciaInfos[toHash[first + lane]].titleID)), sizeof(digest))) {
+							throw titleException(_FILE_, __LINE__, res, "\x1b[31m校对不匹配! 文件损害或错误!\x1b[0m\n\n");
+						} else {
+							verifiedHashes[ciaInfos[toHash[first + lane]].titleID] = hash;
+							journal.verified(filesDirs[toHash[first + lane]].name, hash);
+							logger::print(LOG_INFO, progress::PHASE_VERIFY, ciaInfos[toHash[first + lane]].titleID, 0, "%s %s", &tmpStr, hash.c_str());
+							say("\x1b[32m 验证\x1b[0m\n");
+						}
+					}
+
+				}
+
+				summary.filesVerified = toHash.size();
+				summary.filesSkipped = filesDirs.size() - toHash.size() - summary.filesResumed;
+				summary.bytesHashed = bytesHashed;
+				say("\n已校验 %u/%u 个文件, %.1f/%.1f MB\n", (unsigned int)toHash.size(), (unsigned int)filesDirs.size(),
+				       bytesHashed / 1048576.0, bytesTotal / 1048576.0);
+
+			}
+			say("\n\n\x1b[32m验证固件文件成功!\n\n\x1b[0m\n\n");
+			say("安装固件文件中...\n");
+		}
+
+	}
+
+	tune();
+
+	{
+		TRACE_SCOPE("sortTitles");
+		std::sort(titles.begin(), titles.end(), downgrade ? sortTitlesLowToHigh : sortTitlesHighToLow);
+	}
+
+	u64 installTotal = 0, installed = 0;
+	for(auto& it : titles) installTotal += it.entry.size;
+	if(!workTotal) workTotal = installBytes(titles, resuming ? resume.installed : std::set<u64>());
+	workBase = summary.bytesHashed;
+
+	for(auto it : titles)
+	{
+		if(resuming && resume.installed.count(it.entry.titleID))
+		{
+			summary.titlesResumed++;
+			continue;
+		}
+
+		bool nativeFirm = it.entry.titleID == 0x0004013800000002LL || it.entry.titleID == 0x0004013820000002LL;
+		if(nativeFirm)
+		{
+			say("NATIVE_FIRM         ");
+		} else {
+			tmpStr.clear();
+			utf16_to_utf8((u8*) &tmpStr, (u16*) it.name.c_str(), 255);
+
+			say("%s", &tmpStr);
+		}
+
+		if(it.requiresDelete && !(resuming && resume.deleted.count(it.entry.titleID)))
+		{
+			// The power may have gone between the delete and its record, ask AM once
+			if(!haveInstalledTitles)
+			{
+				installedTitles = getTitleInfos(MEDIATYPE_NAND);
+				haveInstalledTitles = true;
+			}
+
+			if(!resuming || versionCmp(installedTitles, it.entry.titleID, it.entry.version) < 0)
+			{
+				status(progress::PHASE_DELETE, it.entry.titleID, 0, 0, summary.titlesInstalled + summary.titlesResumed + 1, titles.size(), true);
+				deleteTitle(MEDIATYPE_NAND, it.entry.titleID);
+				logger::print(LOG_INFO, progress::PHASE_DELETE, it.entry.titleID, 0, "deleted");
+				summary.titlesDeleted++;
+			}
+			journal.deleted(it.entry.titleID);
+		}
+
+		// What AM gets has to hash to what was verified (in this run or the journalled one),
+		// installCia() cancels a file that changed or was misread before AM commits it
+		auto verified = verifiedHashes.find(it.entry.titleID);
+		status(progress::PHASE_INSTALL, it.entry.titleID, installed, installTotal, summary.titlesInstalled + summary.titlesResumed + 1, titles.size(), true);
+		installCia(u"/updates/" + it.name, MEDIATYPE_NAND, [&](const std::u16string& file, u32 percent)
+		{
+			status(progress::PHASE_INSTALL, it.entry.titleID, installed + it.entry.size * percent / 100, installTotal, summary.titlesInstalled + summary.titlesResumed + 1, titles.size(), false);
+		}, nullptr, (verified != verifiedHashes.end() ? verified->second : std::string()));
+		installed += it.entry.size;
+		if(nativeFirm && (res = SERVICE_CALL(AM_InstallFirm, it.entry.titleID))) throw titleException(_FILE_, __LINE__, res, "安装NATIVE_FIRM失败!");
+		journal.installed(it.entry.titleID);
+		logger::print(LOG_INFO, progress::PHASE_INSTALL, it.entry.titleID, 0, "v%u, %llu bytes%s", it.entry.version,
+		              (unsigned long long)it.entry.size, (nativeFirm ? ", FIRM written" : ""));
+		say("\x1b[32m  已安装\x1b[0m\n");
+		summary.titlesInstalled++;
+	}
+
+	journal.finish();
+	logger::print(LOG_INFO, progress::PHASE_DONE, 0, 0, "%u installed, %u deleted, %u resumed, %.1f MB hashed",
+	              (unsigned int)summary.titlesInstalled, (unsigned int)summary.titlesDeleted, (unsigned int)summary.titlesResumed,
+	              summary.bytesHashed / 1048576.0);
+	return summary;
+}
+
+
+static void installWorker(void *arg)
+{
+	progress::Event event = progress::Event();
+
+
+	try
+	{
+		job.summary = installUpdates(job.downgrade);
+		event.phase = progress::PHASE_DONE;
+	}
+	catch(fsException& e)
+	{
+		logger::print(LOG_ERROR, currentPhase, currentTitle, e.getErrCode(), "%s", e.what());
+		progress::print(*channel, "\n%s\n", e.what());
+		event.phase = progress::PHASE_FAILED;
+		event.fsError = 1;
+	}
+	catch(titleException& e)
+	{
+		logger::print(LOG_ERROR, currentPhase, currentTitle, e.getErrCode(), "%s", e.what());
+		progress::print(*channel, "\n%s\n", e.what());
+		event.phase = progress::PHASE_FAILED;
+	}
+
+	progress::post(*channel, event);
+}
+
+
+bool startInstall(bool downgrade, progress::Channel& progressChannel)
+{
+	channel = &progressChannel;
+	job.downgrade = downgrade;
+	job.summary = InstallSummary();
+
+#ifdef _3DS
+	// Below the UI thread so it still gets its frames while we hash and install
+	s32 prio = 0x30;
+	svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+	worker = threadCreate(installWorker, nullptr, INSTALL_STACK_SIZE, prio + 1, -1, false);
+	if(worker == NULL)
+#else
+	try
+	{
+		worker = std::thread(installWorker, nullptr);
+	}
+	catch(...)
+#endif
+	{
+		channel = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+
+InstallSummary finishInstall()
+{
+#ifdef _3DS
+	if(worker != NULL)
+	{
+		threadJoin(worker, U64_MAX);
+		threadFree(worker);
+		worker = NULL;
+	}
+#else
+	if(worker.joinable()) worker.join();
+#endif
+	channel = nullptr;
+
+	return job.summary;
+}
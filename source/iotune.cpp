@@ -0,0 +1,191 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include <3ds.h>
+#include "error.h"
+#include "fs.h"
+#include "iotune.h"
+#include "metrics.h"
+
+#define _FILE_ "iotune.cpp" // Replacement for __FILE__ without the path
+
+#define IOTUNE_CID_SIZE    (16)
+#define IOTUNE_RECORD_SIZE (IOTUNE_CID_SIZE + 8) // CID, block size, KB/s
+
+
+
+namespace iotune
+{
+	static u32 current = MAX_BUF_SIZE;
+	static std::vector<Probe> lastProbes;
+
+
+	static u32 getLE32(const u8 *p) {return p[0] | p[1]<<8 | p[2]<<16 | (u32)p[3]<<24;}
+	static void putLE32(u8 *p, u32 v) {p[0] = v; p[1] = v>>8; p[2] = v>>16; p[3] = v>>24;}
+
+	static bool validSize(u32 size)
+	{
+		return size >= IOTUNE_MIN_SIZE && size <= MAX_BUF_SIZE && !(size & (size - 1));
+	}
+
+	// All cached records, one per SD card
+	static std::vector<u8> readCache()
+	{
+		std::vector<u8> data;
+
+		try
+		{
+			if(!fs::fileExist(IOTUNE_CACHE_PATH)) return data;
+
+			fs::File file(IOTUNE_CACHE_PATH, FS_OPEN_READ);
+			data.resize(file.size() / IOTUNE_RECORD_SIZE * IOTUNE_RECORD_SIZE);
+			if(data.size()) file.read(data.data(), data.size());
+		} catch(fsException& e)
+		{
+			data.clear(); // No cache, we probe again
+		}
+
+		return data;
+	}
+
+	static void writeCache(const u8 *cid, const Probe& best)
+	{
+		std::vector<u8> data = readCache();
+		u8 record[IOTUNE_RECORD_SIZE];
+		size_t i;
+
+
+		memcpy(record, cid, IOTUNE_CID_SIZE);
+		putLE32(record + IOTUNE_CID_SIZE, best.blockSize);
+		putLE32(record + IOTUNE_CID_SIZE + 4, best.kbPerSec);
+
+		for(i = 0; i < data.size(); i += IOTUNE_RECORD_SIZE)
+			if(!memcmp(&data[i], cid, IOTUNE_CID_SIZE)) break;
+		if(i == data.size()) data.resize(i + IOTUNE_RECORD_SIZE);
+		memcpy(&data[i], record, IOTUNE_RECORD_SIZE);
+
+		try
+		{
+			fs::File file(IOTUNE_CACHE_PATH, FS_OPEN_WRITE|FS_OPEN_CREATE);
+			file.setSize(0);
+			file.write(data.data(), data.size());
+		} catch(fsException& e) {} // Next start probes again
+	}
+
+	// Reads blocks of every candidate size and keeps the smallest one within
+	// IOTUNE_TOLERANCE of the fastest. Sizes the heap can't hold are left out.
+	static Probe probe(const std::u16string& probePath)
+	{
+		fs::File file(probePath, FS_OPEN_READ);
+		const u64 fileSize = file.size();
+		u32 largest = MAX_BUF_SIZE;
+		std::unique_ptr<u8[]> buffer; // A read that throws mustn't leak it
+
+
+		lastProbes.clear();
+		while(largest > fileSize && largest > IOTUNE_MIN_SIZE) largest >>= 1;
+		for(;;)
+		{
+			buffer.reset(new (std::nothrow) u8[largest]);
+			if(buffer || largest <= IOTUNE_MIN_SIZE) break;
+			largest >>= 1;
+		}
+		if(!buffer) throw fsException(_FILE_, __LINE__, ERR_NOT_ENOUGH_MEM, "内存不足!");
+
+		u64 offset = 0;
+		for(u32 size = IOTUNE_MIN_SIZE; size <= largest; size <<= 1)
+		{
+			const u32 total = std::max<u32>(IOTUNE_PROBE_BYTES, size * 2);
+			const u64 start = svcGetSystemTick();
+
+			for(u32 done = 0; done < total; done += size)
+			{
+				// Move on through the file so every read comes from the card
+				if(offset + size > fileSize) offset = 0;
+				file.seek(offset, FS_SEEK_SET);
+				file.read(buffer.get(), size);
+				offset += size;
+			}
+
+			const u64 ticks = std::max<u64>(svcGetSystemTick() - start, 1);
+			lastProbes.push_back({size, (u32)((u64)total / 1024 * SYSCLOCK_ARM11 / ticks)});
+		}
+
+		Probe best = lastProbes[0];
+		for(auto& it : lastProbes) if(it.kbPerSec > best.kbPerSec) best = it;
+		for(auto& it : lastProbes)
+		{
+			if((u64)it.kbPerSec * 100 >= (u64)best.kbPerSec * (100 - IOTUNE_TOLERANCE))
+			{
+				best = it;
+				break;
+			}
+		}
+
+		return best;
+	}
+
+
+	u32 blockSize() {return current;}
+	void setBlockSize(u32 size) {if(validSize(size)) current = size;}
+
+	u32 tune(const std::u16string& probePath, bool useCache)
+	{
+		TRACE_SCOPE("iotune::tune");
+		u8 cid[IOTUNE_CID_SIZE];
+		const bool haveCid = !SERVICE_CALL(FSUSER_GetSdmcCid, cid, sizeof(cid));
+
+
+		lastProbes.clear();
+		if(useCache && haveCid)
+		{
+			const std::vector<u8> data = readCache();
+			for(size_t i = 0; i < data.size(); i += IOTUNE_RECORD_SIZE)
+			{
+				if(!memcmp(&data[i], cid, IOTUNE_CID_SIZE) && validSize(getLE32(&data[i + IOTUNE_CID_SIZE])))
+				{
+					current = getLE32(&data[i + IOTUNE_CID_SIZE]);
+					return current;
+				}
+			}
+		}
+
+		// A probe that fails only costs the tuning, the install goes on with the current size
+		Probe best;
+		try
+		{
+			best = probe(probePath);
+		} catch(fsException& e)
+		{
+			lastProbes.clear();
+			return current;
+		}
+		current = best.blockSize;
+		if(haveCid) writeCache(cid, best);
+
+		return current;
+	}
+
+	const std::vector<Probe>& probes() {return lastProbes;}
+}
@@ -0,0 +1,278 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <3ds.h>
+#include "error.h"
+#include "fs.h"
+#include "cia.h"
+#include "crc32.h"
+#include "journal.h"
+
+#define _FILE_ "journal.cpp" // Replacement for __FILE__ without the path
+
+#define JOURNAL_HEADER_SIZE (12)
+
+
+
+// Little endian, same as everything else on the 3DS
+static void put(std::vector<u8>& out, u64 value, u32 bytes)
+{
+	for(u32 i = 0; i < bytes; i++) out.push_back(value>>(i * 8));
+}
+
+static void putName(std::vector<u8>& out, const std::u16string& name)
+{
+	put(out, name.size(), 2);
+	for(auto c : name) put(out, c, 2);
+}
+
+// Reads a payload, a record that ends early fails instead of reading past it
+class RecordReader
+{
+	const u8 *_data_;
+	u32 _left_;
+
+
+public:
+	bool ok = true;
+
+	RecordReader(const u8 *data, u32 size) : _data_(data), _left_(size) {}
+
+	u64 get(u32 bytes)
+	{
+		u64 value = 0;
+
+		if(_left_ < bytes) {ok = false; return 0;}
+		for(u32 i = 0; i < bytes; i++) value |= (u64)_data_[i]<<(i * 8);
+		_data_ += bytes;
+		_left_ -= bytes;
+		return value;
+	}
+
+	std::u16string getName()
+	{
+		std::u16string name(get(2), u'\0');
+
+		for(auto& c : name) c = get(2);
+		return name;
+	}
+
+	bool atEnd() const {return ok && !_left_;}
+};
+
+static bool parseRecord(JournalState& state, u8 type, const u8 *payload, u32 size)
+{
+	RecordReader in(payload, size);
+
+
+	switch(type)
+	{
+		case JOURNAL_PLAN:
+		{
+			state.downgrade = in.get(1);
+			state.fingerprint = in.get(4);
+			std::vector<JournalFile> files(in.get(4));
+			for(auto& it : files)
+			{
+				if(!in.ok) return false;
+				it.name = in.getName();
+				it.info.titleID = in.get(8);
+				it.info.version = in.get(2);
+				it.info.size = in.get(8);
+				it.info.contentOffset = in.get(8);
+				it.info.contentSize = in.get(8);
+				const u8 flags = in.get(1);
+				it.planned = flags & 1;
+				it.requiresDelete = flags & 2;
+			}
+			if(!in.atEnd()) return false;
+
+			// A new plan, whatever came before belongs to another run
+			state.files = files;
+			state.verified.clear();
+			state.deleted.clear();
+			state.installed.clear();
+			return true;
+		}
+		case JOURNAL_VERIFIED:
+		{
+			const std::u16string name = in.getName();
+			std::string hash(in.get(1), '\0');
+			for(auto& c : hash) c = in.get(1);
+			if(!in.atEnd()) return false;
+
+			state.verified[name] = hash;
+			return true;
+		}
+		case JOURNAL_DELETED:
+		case JOURNAL_INSTALLED:
+		{
+			const u64 titleID = in.get(8);
+			if(!in.atEnd()) return false;
+
+			(type == JOURNAL_DELETED ? state.deleted : state.installed).insert(titleID);
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+
+JournalState Journal::replay(const std::u16string& path)
+{
+	JournalState state = JournalState();
+	std::vector<u8> data;
+
+
+	if(!fs::fileExist(path)) return state;
+	{
+		fs::File file(path, FS_OPEN_READ);
+		data.resize(file.size());
+		if(data.size()) file.read(data.data(), data.size());
+	}
+
+	u64 offset = 0;
+	while(data.size() - offset >= JOURNAL_HEADER_SIZE + 4)
+	{
+		const u8 *record = &data[offset];
+		RecordReader header(record, JOURNAL_HEADER_SIZE);
+		const u32 magic = header.get(4);
+		const u8 type = header.get(1);
+		header.get(3);
+		const u64 size = header.get(4);
+
+		if(magic != JOURNAL_MAGIC || size > data.size() - offset - JOURNAL_HEADER_SIZE - 4) break;
+
+		RecordReader trailer(record + JOURNAL_HEADER_SIZE + size, 4);
+		if(CRC32::update(0, record, JOURNAL_HEADER_SIZE + size) != trailer.get(4)) break;
+		if(!parseRecord(state, type, record + JOURNAL_HEADER_SIZE, size)) break;
+
+		offset += JOURNAL_HEADER_SIZE + size + 4;
+		state.records++;
+	}
+	state.validSize = offset;
+
+	return state;
+}
+
+
+u32 Journal::fingerprint(const std::vector<fs::DirEntry>& files)
+{
+	std::vector<u8> data;
+
+
+	for(auto& it : files)
+	{
+		putName(data, it.name);
+		put(data, it.size, 8);
+	}
+
+	return CRC32::update(0, data.data(), data.size());
+}
+
+
+void Journal::open(u64 validSize, const std::u16string& path)
+{
+	_file_.open(path, FS_OPEN_READ | FS_OPEN_WRITE | FS_OPEN_CREATE);
+	_file_.setSize(validSize); // Cut off a torn record, it would hide everything after it
+	_file_.seek(validSize, FS_SEEK_SET);
+}
+
+
+void Journal::append(u8 type, const std::vector<u8>& payload)
+{
+	std::vector<u8> record;
+
+
+	put(record, JOURNAL_MAGIC, 4);
+	put(record, type, 1);
+	put(record, 0, 3);
+	put(record, payload.size(), 4);
+	record.insert(record.end(), payload.begin(), payload.end());
+	put(record, CRC32::update(0, record.data(), record.size()), 4);
+
+	// One write, so a power cut leaves at most one torn record at the end
+	_file_.write(record.data(), record.size());
+	_file_.flush();
+}
+
+
+void Journal::plan(bool downgrade, u32 fingerprint, const std::vector<JournalFile>& files)
+{
+	std::vector<u8> payload;
+
+
+	put(payload, downgrade, 1);
+	put(payload, fingerprint, 4);
+	put(payload, files.size(), 4);
+	for(auto& it : files)
+	{
+		putName(payload, it.name);
+		put(payload, it.info.titleID, 8);
+		put(payload, it.info.version, 2);
+		put(payload, it.info.size, 8);
+		put(payload, it.info.contentOffset, 8);
+		put(payload, it.info.contentSize, 8);
+		put(payload, (it.planned ? 1 : 0) | (it.requiresDelete ? 2 : 0), 1);
+	}
+
+	append(JOURNAL_PLAN, payload);
+}
+
+
+void Journal::verified(const std::u16string& name, const std::string& sha256)
+{
+	std::vector<u8> payload;
+
+
+	putName(payload, name);
+	put(payload, sha256.size(), 1);
+	payload.insert(payload.end(), sha256.begin(), sha256.end());
+
+	append(JOURNAL_VERIFIED, payload);
+}
+
+
+void Journal::deleted(u64 titleID)
+{
+	std::vector<u8> payload;
+
+
+	put(payload, titleID, 8);
+	append(JOURNAL_DELETED, payload);
+}
+
+
+void Journal::installed(u64 titleID)
+{
+	std::vector<u8> payload;
+
+
+	put(payload, titleID, 8);
+	append(JOURNAL_INSTALLED, payload);
+}
+
+
+void Journal::finish()
+{
+	_file_.del();
+}
@@ -0,0 +1,338 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <3ds.h>
+#include "fs.h"
+#include "logger.h"
+#include "metrics.h"
+
+#ifndef _3DS
+#include <thread>
+#endif
+
+#define LOG_STACK_SIZE (16 * 1024)
+
+
+
+namespace logger
+{
+	// Bounded multi-producer ring: a producer claims a slot by moving head, the
+	// slot's sequence number tells the writer when the record is complete. The
+	// numbers are stored relative to the slot index so all zeros is a valid start.
+	struct Slot
+	{
+		std::atomic<u32> seq;
+		Record record;
+	};
+
+	static Slot ring[LOG_RING_SIZE];
+	static std::atomic<u32> head(0);
+	static u32 tail = 0; // Writer thread only
+
+	static Stats counters;
+	static std::atomic<u32> dropped(0), added(0);
+	static u32 calls[metrics::CALL_COUNT];
+
+	static std::atomic<bool> stopping(false);
+	static bool running = false;
+#ifdef _3DS
+	static Thread writer = NULL;
+#else
+	static std::thread writer;
+#endif
+
+	static std::u16string logPath, oldLogPath;
+	static Handle file = 0;
+	static u64 fileOffset = 0;
+	static u64 startTicks = 0;
+
+	static void (*mirrorSink)(const char *line) = nullptr;
+	static u32 mirrorRate = 0, mirrorWindow = 0, mirrorSkipped = 0;
+	static u64 mirrorWindowStart = 0;
+
+
+	// Round of the ring a position belongs to, what a free slot's sequence number says
+	static u32 lap(u32 pos) {return pos & ~(LOG_RING_SIZE - 1);}
+
+	static FS_Path sdPath(const std::u16string& path)
+	{
+		FS_Path lowPath = {PATH_UTF16, (path.length()*2)+2, (const u8*)path.c_str()};
+		return lowPath;
+	}
+
+	static Result openFile()
+	{
+		u64 size = 0;
+		Result res;
+
+
+		calls[metrics::FSUSER_OpenFile]++;
+		if((res = FSUSER_OpenFile(&file, sdmcArchive, sdPath(logPath), FS_OPEN_WRITE|FS_OPEN_CREATE, 0))) {file = 0; return res;}
+		calls[metrics::FSFILE_GetSize]++;
+		if((res = FSFILE_GetSize(file, &size))) return res;
+
+		fileOffset = size;
+		return 0;
+	}
+
+	static void closeFile()
+	{
+		if(!file) return;
+
+		calls[metrics::FSFILE_Close]++;
+		FSFILE_Close(file);
+		file = 0;
+	}
+
+	// The current file becomes the old one, the one before that is gone
+	static Result rotate()
+	{
+		closeFile();
+		calls[metrics::FSUSER_DeleteFile]++;
+		FSUSER_DeleteFile(sdmcArchive, sdPath(oldLogPath)); // Not there after the first rotation
+		calls[metrics::FSUSER_RenameFile]++;
+		FSUSER_RenameFile(sdmcArchive, sdPath(logPath), sdmcArchive, sdPath(oldLogPath));
+		counters.rotations++;
+
+		return openFile();
+	}
+
+	static void writeBatch(const char *data, u32 size, u32 records)
+	{
+		u32 bytesWritten;
+		Result res = 0;
+
+
+		if(!size || !file) return;
+		if(fileOffset + size > LOG_MAX_SIZE) res = rotate();
+
+		if(!res)
+		{
+			calls[metrics::FSFILE_Write]++;
+			res = FSFILE_Write(file, &bytesWritten, fileOffset, data, size, FS_WRITE_FLUSH);
+		}
+		if(res)
+		{
+			counters.failed++;
+			closeFile(); // Keep the ring moving, the records only go to the mirror now
+			return;
+		}
+
+		fileOffset += bytesWritten;
+		counters.bytes += bytesWritten;
+		counters.batches++;
+		counters.written += records;
+	}
+
+	static void mirror(const char *line)
+	{
+		if(!mirrorSink) return;
+
+		const u64 now = svcGetSystemTick();
+		if(now - mirrorWindowStart >= SYSCLOCK_ARM11)
+		{
+			if(mirrorSkipped)
+			{
+				char note[64];
+				snprintf(note, sizeof(note), "... %u lines not mirrored\n", (unsigned int)mirrorSkipped);
+				mirrorSink(note);
+			}
+			mirrorWindowStart = now;
+			mirrorWindow = mirrorSkipped = 0;
+		}
+
+		if(mirrorWindow < mirrorRate)
+		{
+			mirrorSink(line);
+			mirrorWindow++;
+			counters.mirrored++;
+		}
+		else mirrorSkipped++;
+	}
+
+	// One line per record, no console escapes, newlines of multi-line messages become " | "
+	static u32 format(char *out, u32 size, const Record& record)
+	{
+		static const char levels[] = "IWE";
+		static const char *phases[] = {"-", "read", "verify", "delete", "install", "prompt", "done", "failed"};
+		const u64 us = (record.ticks - startTicks) / (SYSCLOCK_ARM11 / 1000000);
+		int len;
+
+
+		len = snprintf(out, size, "%5u.%06u %c %-7s %016llX %08lX ", (unsigned int)(us / 1000000), (unsigned int)(us % 1000000),
+		               levels[record.level % 3], phases[record.phase % 8], (unsigned long long)record.titleID, (unsigned long)record.res);
+
+		for(const char *p = record.text; *p && len < (int)size - 4; p++)
+		{
+			if(*p == '\x1b')
+			{
+				while(p[1] && !((p[1] >= 'A' && p[1] <= 'Z') || (p[1] >= 'a' && p[1] <= 'z'))) p++;
+				if(p[1]) p++;
+			}
+			else if(*p == '\n')
+			{
+				if(p[1] && len > 0 && out[len - 1] != ' ') {memcpy(out + len, " | ", 3); len += 3;}
+			}
+			else out[len++] = *p;
+		}
+		out[len++] = '\n';
+		out[len] = 0;
+
+		return len;
+	}
+
+	static void drain()
+	{
+		static char batch[LOG_BATCH_SIZE];
+		u32 used = 0, records = 0;
+		char line[LOG_TEXT_SIZE + 64];
+
+
+		for(;;)
+		{
+			Slot& slot = ring[tail & (LOG_RING_SIZE - 1)];
+			if(slot.seq.load(std::memory_order_acquire) != lap(tail) + 1) break;
+
+			const u32 len = format(line, sizeof(line), slot.record);
+			slot.seq.store(lap(tail) + LOG_RING_SIZE, std::memory_order_release); // Free for the next round
+			tail++;
+
+			if(used + len > sizeof(batch))
+			{
+				writeBatch(batch, used, records);
+				used = records = 0;
+			}
+			memcpy(batch + used, line, len);
+			used += len;
+			records++;
+			mirror(line);
+		}
+
+		writeBatch(batch, used, records);
+	}
+
+	static void writerMain(void *arg)
+	{
+		while(!stopping.load(std::memory_order_acquire))
+		{
+			drain();
+			svcSleepThread(LOG_INTERVAL);
+		}
+	}
+
+
+	bool init(const std::u16string& path, const std::u16string& oldPath)
+	{
+		if(running) return true;
+
+		logPath = path;
+		oldLogPath = oldPath;
+		startTicks = svcGetSystemTick();
+		if(openFile()) counters.failed++;
+		else if(fileOffset >= LOG_MAX_SIZE && rotate()) counters.failed++;
+
+		stopping.store(false);
+#ifdef _3DS
+		s32 prio = 0x30;
+		svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+		writer = threadCreate(writerMain, nullptr, LOG_STACK_SIZE, prio + 2, -1, false); // Below the install worker
+		running = (writer != NULL);
+#else
+		try
+		{
+			writer = std::thread(writerMain, nullptr);
+			running = true;
+		}
+		catch(...) {}
+#endif
+		return running;
+	}
+
+	void exit()
+	{
+		if(running)
+		{
+			stopping.store(true, std::memory_order_release);
+#ifdef _3DS
+			threadJoin(writer, U64_MAX);
+			threadFree(writer);
+			writer = NULL;
+#else
+			writer.join();
+#endif
+			running = false;
+		}
+
+		drain(); // Whatever came in after the writer's last round
+		closeFile();
+	}
+
+	void print(u8 level, u8 phase, u64 titleID, Result res, const char *format, ...)
+	{
+		u32 pos = head.load(std::memory_order_relaxed);
+		Slot *slot;
+		for(;;)
+		{
+			slot = &ring[pos & (LOG_RING_SIZE - 1)];
+			const s32 diff = (s32)(slot->seq.load(std::memory_order_acquire) - lap(pos));
+
+			if(diff == 0 && head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			if(diff < 0)
+			{
+				dropped.fetch_add(1, std::memory_order_relaxed); // The writer is behind, don't wait for it
+				return;
+			}
+			if(diff > 0) pos = head.load(std::memory_order_relaxed);
+		}
+
+		Record& record = slot->record;
+		va_list args;
+
+		record.ticks = svcGetSystemTick();
+		record.level = level;
+		record.phase = phase;
+		record.res = res;
+		record.titleID = titleID;
+		va_start(args, format);
+		vsnprintf(record.text, sizeof(record.text), format, args);
+		va_end(args);
+
+		slot->seq.store(lap(pos) + 1, std::memory_order_release); // Complete, the writer may take it
+		added.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void setMirror(void (*sink)(const char *line), u32 linesPerSecond)
+	{
+		mirrorSink = sink;
+		mirrorRate = linesPerSecond;
+	}
+
+	const Stats& stats()
+	{
+		counters.records = added.load(std::memory_order_relaxed);
+		counters.dropped = dropped.load(std::memory_order_relaxed);
+		return counters;
+	}
+
+	u32 serviceCalls(metrics::Call call) {return calls[call];}
+}
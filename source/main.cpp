@@ -16,67 +16,27 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/
  */
 
-#include <algorithm>
 #include <cstdio>
-#include <string>
-#include <vector>
+#include <cstring>
 #include <3ds.h>
 #include "error.h"
 #include "fs.h"
 #include "misc.h"
 #include "title.h"
-#include "hashes.h"
-#include "sha256.h"
+#include "installer.h"
+#include "trace.h"
+#include "metrics.h"
+#include "progress.h"
+#include "logger.h"
 
 #define _FILE_ "main.cpp" // Replacement for __FILE__ without the path
 
-typedef struct
-{
-	std::u16string name;
-	AM_TitleEntry entry;
-	bool requiresDelete;
-} TitleInstallInfo;
-
-// Ordered from highest to lowest priority.
-static const u32 titleTypes[7] = {
-		0x00040138, // System Firmware
-		0x00040130, // System Modules
-		0x00040030, // Applets
-		0x00040010, // System Applications
-		0x0004001B, // System Data Archives
-		0x0004009B, // System Data Archives (Shared Archives)
-		0x000400DB, // System Data Archives
-};
-
-u32 getTitlePriority(u64 id) {
-	u32 type = (u32) (id >> 32);
-	for(u32 i = 0; i < 7; i++) {
-		if(type == titleTypes[i]) {
-			return i;
-		}
-	}
-
-	return 0;
-}
-
-bool sortTitlesHighToLow(const TitleInstallInfo &a, const TitleInstallInfo &b) {
-	bool aSafe = (a.entry.titleID & 0xFF) == 0x03;
-	bool bSafe = (b.entry.titleID & 0xFF) == 0x03;
-	if(aSafe != bSafe) {
-		return aSafe;
-	}
-
-	return getTitlePriority(a.entry.titleID) < getTitlePriority(b.entry.titleID);
-}
-
-bool sortTitlesLowToHigh(const TitleInstallInfo &a, const TitleInstallInfo &b) {
-        bool aSafe = (a.entry.titleID & 0xFF) == 0x03;
-        bool bSafe = (b.entry.titleID & 0xFF) == 0x03;
-        if(aSafe != bSafe) {
-                return aSafe;
-        }
+// Set by the first constructor to run, the start of the startup time shown after the first frame
+static u64 startTick = 0;
 
-	return getTitlePriority(a.entry.titleID) > getTitlePriority(b.entry.titleID);
+__attribute__((constructor(101))) static void markStart()
+{
+	startTick = svcGetSystemTick();
 }
 
 // Fix compile error. This should be properly initialized if you fiddle with the title stuff!
@@ -88,6 +48,7 @@ extern "C"
 	void __appExit()
 	{
 		// Exit services
+		romfsExit();
 		amExit();
 		sdmcArchiveExit();
 		fsExit();
@@ -98,223 +59,65 @@ extern "C"
 	}
 }
 
-// Find title and compare versions. Returns CIA file version - installed title version
-int versionCmp(std::vector<TitleInfo>& installedTitles, u64& titleID, u16 version)
+// Service call summary on the bottom screen, also appended to the SD card
+static void showMetrics(PrintConsole& bottomScreen, PrintConsole& topScreen, const char *label)
 {
-	for(auto it : installedTitles)
-	{
-		if(it.titleID == titleID)
-		{
-			return (version - it.version);
-		}
-	}
-
-	return 1; // The title is not installed
+	consoleSelect(&bottomScreen);
+	consoleClear();
+	metrics::print();
+	metrics::write(label);
+	consoleSelect(&topScreen);
 }
 
-
-// If downgrade is true we don't care about versions (except equal versions) and uninstall newer versions
-void installUpdates(bool downgrade)
+// Prints what the worker sent since the last frame and redraws its status on the bottom screen.
+// Returns the PHASE_PROMPT, PHASE_DONE or PHASE_FAILED event if one came in, otherwise a PHASE_TEXT one.
+static progress::Event drainProgress(progress::Channel& channel, PrintConsole& bottomScreen, PrintConsole& topScreen)
 {
-	std::vector<fs::DirEntry> filesDirs = fs::listDirContents(u"/updates", u".cia;"); // Filter for .cia files
-	std::vector<TitleInfo> installedTitles = getTitleInfos(MEDIATYPE_NAND);
-	std::vector<TitleInstallInfo> titles;
+	static const char *phaseNames[] = {"", "读取CIA信息", "校验文件", "删除title", "安装title"};
+	progress::Event event, status = progress::Event(), result = progress::Event();
 
-	u8 is_n3ds = 0;
-	APT_CheckNew3DS(&is_n3ds);
 
-	Buffer<char> tmpStr(256);
-	Result res;
-	TitleInstallInfo installInfo;
-	AM_TitleEntry ciaFileInfo;
-	fs::File f;
-
-	printf("正在获取固件文件信息...\n\n");
-
-	for(auto it : filesDirs)
+	while(channel.events.pop(event))
 	{
-		if(!it.isDir)
-		{
-
-			f.open(u"/updates/" + it.name, FS_OPEN_READ);
-			if((res = AM_GetCiaFileInfo(MEDIATYPE_NAND, &ciaFileInfo, f.getFileHandle())))
-				throw titleException(_FILE_, __LINE__, res, "获取CIA文件信息失败!");
-
-			if(ciaFileInfo.titleID != 0x0004013800000002LL && ciaFileInfo.titleID != 0x0004013820000002L)
-				continue;
-
-			if(ciaFileInfo.titleID == 0x0004013820000002LL && is_n3ds == 0)
-				throw titleException(_FILE_, __LINE__, res, "在老3上安装N3D的包及易变砖!");
-			if(ciaFileInfo.titleID == 0x0004013800000002LL && is_n3ds == 1 && ciaFileInfo.version > 11872)
-				throw titleException(_FILE_, __LINE__, res, "在N3DS上安装>6.0的老3包及易变砖!");
-
-			if(ciaFileInfo.titleID == 0x0004013800000002LL && is_n3ds == 1 && ciaFileInfo.version < 11872){
-				printf("在N3DS上安装老3包会变砖，除非你换了NCSD和加密!\n");
-				printf("!! 别继续了 !!\n!! 除非你是A9LH和REDNAND!!\n\n");
-				printf("(A) 继续\n(a) 取消\n\n");
-				while(aptMainLoop())
-				{
-					hidScanInput();
-
-					if(hidKeysDown() & KEY_A)
-						break;
-
-					if(hidKeysDown() & KEY_B)
-						throw titleException(_FILE_, __LINE__, res, "Canceled!");
-				}
-			}
-
-			printf("获取固件文件版本...\n\n");
-			printf("NATIVE_FIRM (");
-
-			tmpStr.clear();
-			utf16_to_utf8((u8*) &tmpStr, (u16*) it.name.c_str(), 255);
-			printf("%s", &tmpStr);
-
-			printf(") is v");
-			printf("%i\n\n", ciaFileInfo.version);
-
-			printf("验证固件文件...\n\n");
-
-			for(auto const &firmVersionMap : firmVersions) {
-
-				if(firmVersionMap.first == ciaFileInfo.version) {
-
-					for(auto it2 : filesDirs) {
-						for(auto const &devicesVersionMap : firmVersionMap.second) {
-
-							tmpStr.clear();
-							utf16_to_utf8((u8*) &tmpStr, (u16*) it2.name.c_str(), 255);
-
-							if(&tmpStr == devicesVersionMap.first) {
-
-								for(auto it3 : filesDirs) {
-									for(auto const &regionVersionMap : devicesVersionMap.second) {
-
-										tmpStr.clear();
-										utf16_to_utf8((u8*) &tmpStr, (u16*) it3.name.c_str(), 255);
-
-										if(&tmpStr == regionVersionMap.first) {
-
-											if(filesDirs.size() > regionVersionMap.second.size()) throw titleException(_FILE_, __LINE__, res, "/updates/中发现太多的title!\n");
-											if(filesDirs.size() < regionVersionMap.second.size()) throw titleException(_FILE_, __LINE__, res, "/updates/的title太少!\n");
-
-											for(auto it4 : filesDirs) {
-
-												tmpStr.clear();
-												utf16_to_utf8((u8*) &tmpStr, (u16*) it4.name.c_str(), 255);
-
-                        									fs::File ciaFile(u"/updates/" + it4.name, FS_OPEN_READ);
-                      										Buffer<u8> shaBuffer(MAX_BUF_SIZE, false);
-												u32 blockSize;
-                      										u64 ciaSize, offset = 0;
-                      										ciaSize = ciaFile.size();
-												SHA256 sha256stream;
-
-												sha256stream.reset();
-
-												for(u32 i=0; i<=ciaSize / MAX_BUF_SIZE; i++)
-												{
-													blockSize = ((ciaSize - offset<MAX_BUF_SIZE) ? ciaSize - offset : MAX_BUF_SIZE);
-
-													if(blockSize>0)
-													{
-														try
-														{
-															ciaFile.read(&shaBuffer, blockSize);
-														} catch(fsException& e)
-														{
-															throw titleException(_FILE_, __LINE__, res, "无法读取文件!");
-														}
-
-														sha256stream.add(&shaBuffer, blockSize);
-														offset += blockSize;
-													}
-												}
-
-												printf("%s", &tmpStr);
-
-												if(sha256stream.getHash() != regionVersionMap.second.find(&tmpStr)->second) {
-													throw titleException(_FILE_, __LINE__, res, "\x1b[31m校对不匹配! 文件损害或错误!\x1b[0m\n\n");
-												} else {
-													printf("\x1b[32m 验证\x1b[0m\n");
-												}
-
-											}
-
-										}
-
-									}
-								}
-
-							}
-
-						}
-					}
-
-		 		}
-			}
-			printf("\n\n\x1b[32m验证固件文件成功!\n\n\x1b[0m\n\n");
-			printf("安装固件文件中...\n");
-		}
-
+		if(event.phase == progress::PHASE_TEXT) printf("%s", event.text);
+		else if(event.phase >= progress::PHASE_PROMPT) result = event;
+		else status = event; // Only the latest one is drawn
 	}
 
-	for(auto it : filesDirs)
+	if(status.phase != progress::PHASE_TEXT)
 	{
-		if(!it.isDir)
-		{
-			// Quick and dirty hack to detect these pesky
-			// attribute files OSX creates.
-			// This should rather be added to the
-			// filter rules later.
-			if(it.name[0] == u'.') continue;
-
-			f.open(u"/updates/" + it.name, FS_OPEN_READ);
-			if((res = AM_GetCiaFileInfo(MEDIATYPE_NAND, &ciaFileInfo, f.getFileHandle()))) throw titleException(_FILE_, __LINE__, res, "获取CIA文件信息失败!");
-
-			int cmpResult = versionCmp(installedTitles, ciaFileInfo.titleID, ciaFileInfo.version);
-			if((downgrade && cmpResult != 0) || (cmpResult > 0))
-			{
-				installInfo.name = it.name;
-				installInfo.entry = ciaFileInfo;
-				installInfo.requiresDelete = downgrade && cmpResult < 0;
-
-				titles.push_back(installInfo);
-			}
-		}
+		consoleSelect(&bottomScreen);
+		printf("\x1b[0;0H%s %u/%u\x1b[K\n", phaseNames[status.phase], status.index, status.count);
+		if(status.titleID) printf("%016llX\x1b[K\n", status.titleID);
+		else printf("\x1b[K\n");
+		if(status.total) printf("%.1f/%.1f MB  %u KB/s\x1b[K\n", status.bytes / 1048576.0, status.total / 1048576.0, (unsigned int)status.kbPerSec);
+		else printf("\x1b[K\n");
+		if(status.etaSeconds) printf("剩余 %u:%02u\x1b[K\n", (unsigned int)(status.etaSeconds / 60), (unsigned int)(status.etaSeconds % 60));
+		else printf("\x1b[K\n");
+		consoleSelect(&topScreen);
 	}
 
-	std::sort(titles.begin(), titles.end(), downgrade ? sortTitlesLowToHigh : sortTitlesHighToLow);
-
-	for(auto it : titles)
-	{
-		bool nativeFirm = it.entry.titleID == 0x0004013800000002LL || it.entry.titleID == 0x0004013820000002LL;
-		if(nativeFirm)
-		{
-			printf("NATIVE_FIRM         ");
-		} else {
-			tmpStr.clear();
-			utf16_to_utf8((u8*) &tmpStr, (u16*) it.name.c_str(), 255);
-
-			printf("%s", &tmpStr);
-		}
+	return result;
+}
 
-		if(it.requiresDelete) deleteTitle(MEDIATYPE_NAND, it.entry.titleID);
-		installCia(u"/updates/" + it.name, MEDIATYPE_NAND);
-		if(nativeFirm && (res = AM_InstallFirm(it.entry.titleID))) throw titleException(_FILE_, __LINE__, res, "安装NATIVE_FIRM失败!");
-		printf("\x1b[32m  已安装\x1b[0m\n");
-	}
+// Log lines go to the debugger (Luma3DS, Citra) as well
+static void debugSink(const char *line)
+{
+	svcOutputDebugString(line, strlen(line));
 }
 
 int main()
 {
 	gfxInit(GSP_RGB565_OES, GSP_RGB565_OES, false);
+	romfsInit(); // Fails unless built with ROMFS, the manifest then only comes from /updates
 
-	bool once = false;
+	bool once = false, installing = false, prompting = false, startupShown = false;
 	int mode;
+	PrintConsole topScreen, bottomScreen;
+	progress::Channel channel;
 
-	consoleInit(GFX_TOP, NULL);
+	consoleInit(GFX_BOTTOM, &bottomScreen);
+	consoleInit(GFX_TOP, &topScreen);
 
 	printf("sysDowngraderCN\n");
 	printf("更多3DS汉化软件请访问youxijihe.com\n");
@@ -331,9 +134,48 @@ int main()
 		hidScanInput();
 
 
-		if(hidKeysDown() & KEY_B)
+		if(installing)
+		{
+			// The worker hashes and installs, we keep the frames and HOME/power events going
+			if(prompting && (hidKeysDown() & (KEY_A | KEY_B)))
+			{
+				progress::answer(channel, hidKeysDown() & KEY_A);
+				prompting = false;
+			}
+
+			const progress::Event event = drainProgress(channel, bottomScreen, topScreen);
+			if(event.phase == progress::PHASE_PROMPT) prompting = true;
+			if(event.phase == progress::PHASE_DONE || event.phase == progress::PHASE_FAILED)
+			{
+				finishInstall();
+				installing = false;
+				once = true;
+
+				if(event.phase == progress::PHASE_DONE)
+				{
+					printf("\n\n安装成功; 将在10后重启...\n");
+					showMetrics(bottomScreen, topScreen, (mode == 0 ? "downgrade" : "upgrade"));
+					TRACE_DUMP(); // Before the reset takes the events with it
+					logger::exit();
+					svcSleepThread(10000000000LL);
+
+					aptOpenSession();
+					APT_HardwareResetAsync();
+					aptCloseSession();
+				}
+				else
+				{
+					// The worker already sent the exception text
+					if(event.fsError) printf("是否已在'/updates'目录放置了升级文件?\n");
+					printf("请重启.");
+					showMetrics(bottomScreen, topScreen, "failed");
+					TRACE_DUMP();
+				}
+			}
+		}
+		else if(hidKeysDown() & KEY_B)
 			break;
-		if(!once)
+		else if(!once)
 		{
 			if(hidKeysDown() & (KEY_A | KEY_Y | KEY_X))
 			{
@@ -356,19 +198,33 @@ int main()
 							svcSleepThread(10000000000LL);
 						}
       		}
-
-					if (mode == 0) {
-						printf("开始降级...\n\n");
-						installUpdates(true);
-						printf("\n\n安装成功; 将在10后重启...\n");
-					} else if (mode == 1) {
-						printf("开始升级...\n\n");
-						installUpdates(false);
-						printf("\n\n安装成功; 将在10后重启......\n");
+					logger::init();
+					logger::setMirror(debugSink, 30);
+					logger::print(LOG_INFO, progress::PHASE_TEXT, 0, 0, "%s started", (mode == 0 ? "downgrade" : mode == 1 ? "upgrade" : "svchax test"));
+
+					if (mode != 2) {
+						printf(mode == 0 ? "开始降级...\n\n" : "开始升级...\n\n");
+						if (startInstall(mode == 0, channel)) {
+							installing = true;
+						} else {
+							// No thread to spare, install right here like before
+							installUpdates(mode == 0);
+							printf("\n\n安装成功; 将在10后重启...\n");
+							showMetrics(bottomScreen, topScreen, (mode == 0 ? "downgrade" : "upgrade"));
+						}
 					} else {
 						printf("测试svchax; 将在10后重启...\n");
 					}
 
+					if (installing) {
+						gfxFlushBuffers();
+						gfxSwapBuffers();
+						gspWaitForVBlank();
+						continue; // The frames above finish the install
+					}
+
+					TRACE_DUMP(); // Before the reset takes the events with it
+					logger::exit();
 					svcSleepThread(10000000000LL);
 
 					aptOpenSession();
@@ -379,15 +235,21 @@ int main()
 				}
 				catch(fsException& e)
 				{
+					logger::print(LOG_ERROR, progress::PHASE_FAILED, 0, e.getErrCode(), "%s", e.what());
 					printf("\n%s\n", e.what());
 					printf("是否已在'/updates'目录放置了升级文件?\n");
 					printf("请重启.");
+					showMetrics(bottomScreen, topScreen, "failed");
+					TRACE_DUMP();
 					once = true;
 				}
 				catch(titleException& e)
 				{
+					logger::print(LOG_ERROR, progress::PHASE_FAILED, 0, e.getErrCode(), "%s", e.what());
 					printf("\n%s\n", e.what());
 					printf("请重启.");
+					showMetrics(bottomScreen, topScreen, "failed");
+					TRACE_DUMP();
 					once = true;
 				}
 			}
@@ -395,6 +257,29 @@ int main()
 		gfxFlushBuffers();
 		gfxSwapBuffers();
 		gspWaitForVBlank();
+
+		if(!startupShown)
+		{
+			printf("启动用时: %.1f ms\n\n", (svcGetSystemTick() - startTick) * 1000.0 / SYSCLOCK_ARM11);
+			startupShown = true;
+		}
 	}
+
+	// Asked to close while installing: say no to a pending question and let the
+	// worker finish, exiting the services under it would leave NAND half written
+	while(installing)
+	{
+		if(prompting) progress::answer(channel, false);
+		const progress::Event event = drainProgress(channel, bottomScreen, topScreen);
+		prompting = (event.phase == progress::PHASE_PROMPT);
+		if(event.phase == progress::PHASE_DONE || event.phase == progress::PHASE_FAILED)
+		{
+			finishInstall();
+			installing = false;
+		}
+		else svcSleepThread(16000000LL);
+	}
+
+	logger::exit();
 	return 0;
 }
@@ -0,0 +1,340 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <3ds.h>
+#include "fs.h"
+#include "title.h"
+#include "crc32.h"
+#include "manifest.h"
+#include "hashes.h"
+
+#define _FILE_ "manifest.cpp" // Replacement for __FILE__ without the path
+
+#define BUILTIN_SETS (sizeof(builtinSets) / sizeof(builtinSets[0]))
+
+
+
+namespace manifest
+{
+	static_assert(sizeof(Header) == 40 && sizeof(SetRecord) == 32 && sizeof(Entry) == 16 && sizeof(Digest) == 32,
+	              "Manifest records don't match the file");
+
+
+	static bool hasTitle(const std::vector<u64>& titleIDs, u64 titleID)
+	{
+		return std::find(titleIDs.begin(), titleIDs.end(), titleID) != titleIDs.end();
+	}
+
+	const Entry* Set::find(u64 titleID) const
+	{
+		const Entry *end = _entries_ + _record_.entryCount;
+		const Entry *it = std::lower_bound(_entries_, end, titleID, [](const Entry& e, u64 id) {return e.titleID < id;});
+
+		return (it != end && it->titleID == titleID ? it : nullptr);
+	}
+
+	bool Set::matches(u32 firmVersion, const std::vector<u64>& titleIDs) const
+	{
+		return _record_.firmVersion == firmVersion && hasTitle(titleIDs, _record_.nativeFirm) && hasTitle(titleIDs, _record_.homeMenu);
+	}
+
+	bool Set::matches(u32 firmVersion, u64 nativeFirm, u64 homeMenu) const
+	{
+		return _record_.firmVersion == firmVersion && _record_.nativeFirm == nativeFirm && _record_.homeMenu == homeMenu;
+	}
+
+
+	bool Manifest::load(const std::u16string& path)
+	{
+		if(!fs::fileExist(path)) return false;
+
+		fs::File file(path, FS_OPEN_READ);
+		const u64 size = file.size();
+		if(size > MANIFEST_MAX_SIZE) throw titleException(_FILE_, __LINE__, 0, "manifest.bin太大!\n");
+
+		_data_.assign((size + 7) / 8, 0);
+		if(file.read(_data_.data(), size) != size || !index(size))
+			throw titleException(_FILE_, __LINE__, 0, "\x1b[31mmanifest.bin已损坏!\x1b[0m\n");
+
+		return true;
+	}
+
+	bool Manifest::loadRomfs(const char *path)
+	{
+		FILE *file = fopen(path, "rb");
+		if(!file) return false;
+
+		fseek(file, 0, SEEK_END);
+		const long size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		_data_.assign(size > 0 && size <= MANIFEST_MAX_SIZE ? (size + 7) / 8 : 0, 0);
+		const bool ok = !_data_.empty() && fread(_data_.data(), 1, size, file) == (size_t)size && index(size);
+		fclose(file);
+		if(!ok) throw titleException(_FILE_, __LINE__, 0, "\x1b[31mromfs的manifest.bin已损坏!\x1b[0m\n");
+
+		return true;
+	}
+
+	bool Manifest::parse(const void *data, u32 size)
+	{
+		_data_.assign((size + 7) / 8, 0);
+		memcpy(_data_.data(), data, size);
+		return index(size);
+	}
+
+	bool Manifest::index(u32 size)
+	{
+		const u8 *base = (const u8*)_data_.data();
+		Header header;
+
+
+		_sets_.clear();
+		if(size < sizeof(Header))
+		{
+			_data_.clear();
+			return false;
+		}
+		memcpy(&header, base, sizeof(Header));
+
+		// Every count and offset is checked before anything is looked at through it
+		if(header.magic != MANIFEST_MAGIC || header.version != MANIFEST_VERSION || header.headerSize != sizeof(Header) ||
+		   header.fileSize != size || header.setOffset != sizeof(Header) || header.digestCount > MANIFEST_MAX_DIGESTS ||
+		   header.entryOffset != (u64)header.setOffset + (u64)header.setCount * sizeof(SetRecord) ||
+		   header.digestOffset != (u64)header.entryOffset + (u64)header.entryCount * sizeof(Entry) ||
+		   size != (u64)header.digestOffset + (u64)header.digestCount * sizeof(Digest) ||
+		   CRC32::update(0, base + sizeof(Header), size - sizeof(Header)) != header.crc32)
+		{
+			_data_.clear();
+			return false;
+		}
+
+		const SetRecord *records = (const SetRecord*)(base + header.setOffset);
+		const Entry *entries = (const Entry*)(base + header.entryOffset);
+		const Digest *digests = (const Digest*)(base + header.digestOffset);
+
+		for(u32 i = 0; i < header.entryCount; i++)
+		{
+			if(entries[i].digest >= header.digestCount)
+			{
+				_data_.clear();
+				return false;
+			}
+		}
+
+		for(u32 i = 0; i < header.setCount; i++)
+		{
+			const SetRecord& record = records[i];
+			if((u64)record.firstEntry + record.entryCount > header.entryCount) break;
+
+			const Set set(record, entries + record.firstEntry, digests);
+			bool sorted = true;
+			for(u32 j = 1; j < record.entryCount && sorted; j++)
+				sorted = (set.entries()[j - 1].titleID < set.entries()[j].titleID);
+			if(!sorted || !set.find(record.nativeFirm) || !set.find(record.homeMenu)) break;
+
+			_sets_.push_back(set);
+		}
+
+		if(_sets_.size() != header.setCount)
+		{
+			_sets_.clear();
+			_data_.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	const Set* Manifest::find(u32 firmVersion, const std::vector<u64>& titleIDs) const
+	{
+		for(auto const &it : _sets_)
+			if(it.matches(firmVersion, titleIDs)) return &it;
+
+		return nullptr;
+	}
+
+	const Set* Manifest::find(u32 firmVersion, u64 nativeFirm, u64 homeMenu) const
+	{
+		for(auto const &it : _sets_)
+			if(it.matches(firmVersion, nativeFirm, homeMenu)) return &it;
+
+		return nullptr;
+	}
+
+
+	bool titleID(const std::u16string& name, u64 *titleID)
+	{
+		static const char16_t extension[] = u".cia";
+		u64 value = 0;
+
+
+		if(name.size() != 20) return false;
+		for(u32 i = 0; i < 16; i++)
+		{
+			const char16_t c = name[i];
+			if(c >= u'0' && c <= u'9') value = value << 4 | (c - u'0');
+			else if((c | 0x20) >= u'a' && (c | 0x20) <= u'f') value = value << 4 | ((c | 0x20) - u'a' + 10);
+			else return false;
+		}
+		for(u32 i = 0; i < 4; i++)
+			if((name[16 + i] | (i ? 0x20 : 0)) != extension[i]) return false;
+
+		*titleID = value;
+		return true;
+	}
+
+	const std::vector<Set>& builtin()
+	{
+		static std::vector<Set> sets; // Only the records, entries and digests stay in hashes.h
+
+
+		if(sets.empty())
+		{
+			for(u32 i = 0; i < BUILTIN_SETS; i++)
+				sets.push_back(Set(builtinSets[i], builtinEntries + builtinSets[i].firstEntry, builtinDigests));
+		}
+
+		return sets;
+	}
+
+	const Set* find(u32 firmVersion, const std::vector<u64>& titleIDs)
+	{
+		for(auto const &it : builtin())
+			if(it.matches(firmVersion, titleIDs)) return &it;
+
+		return nullptr;
+	}
+
+	const Set* find(u32 firmVersion, u64 nativeFirm, u64 homeMenu)
+	{
+		for(auto const &it : builtin())
+			if(it.matches(firmVersion, nativeFirm, homeMenu)) return &it;
+
+		return nullptr;
+	}
+
+	u64 homeMenu(u8 region)
+	{
+		// JPN, USA, EUR, AUS (the EUR one), CHN, KOR, TWN
+		static const u64 homeMenus[] = {0x0004003000008202LL, 0x0004003000008F02LL, 0x0004003000009802LL, 0x0004003000009802LL,
+		                                0x000400300000A102LL, 0x000400300000A902LL, 0x000400300000B102LL};
+
+		return (region < sizeof(homeMenus) / sizeof(homeMenus[0]) ? homeMenus[region] : 0);
+	}
+
+	void checkBuiltin(const Manifest& file)
+	{
+		for(auto const &it : file.sets())
+		{
+			const Set *builtinSet = find(it.firmVersion(), it.nativeFirm(), it.homeMenu());
+			if(!builtinSet) continue;
+
+			bool same = (builtinSet->size() == it.size());
+			for(u32 i = 0; i < it.size() && same; i++)
+			{
+				const Entry& entry = it.entries()[i];
+				const Entry *expected = builtinSet->find(entry.titleID);
+				same = (expected && memcmp(builtinSet->sha256(*expected), it.sha256(entry), 32) == 0);
+			}
+			if(!same) throw titleException(_FILE_, __LINE__, 0, "\x1b[31mmanifest.bin与内置的hash不一致!\x1b[0m\n");
+		}
+	}
+
+	const Set* resolve(const Manifest& file, u32 firmVersion, u64 nativeFirm, u64 homeMenu, bool *fromFile)
+	{
+		const Set *set = find(firmVersion, nativeFirm, homeMenu);
+
+
+		*fromFile = false;
+		if(!set)
+		{
+			set = file.find(firmVersion, nativeFirm, homeMenu);
+			*fromFile = (set != nullptr);
+		}
+		return set;
+	}
+
+
+	std::vector<u8> build(const std::vector<Set>& sets)
+	{
+		std::map<std::array<u8, 32>, u16> pool; // Digest to its index, in order of first use
+		std::vector<Digest> digests;
+		std::vector<Entry> entries;
+		std::vector<SetRecord> records;
+		Header header = Header();
+
+
+		for(auto const &it : sets)
+		{
+			SetRecord record = SetRecord();
+			record.nativeFirm = it.nativeFirm();
+			record.homeMenu = it.homeMenu();
+			record.firmVersion = it.firmVersion();
+			record.firstEntry = entries.size();
+			record.entryCount = it.size();
+			records.push_back(record);
+
+			for(u32 i = 0; i < it.size(); i++)
+			{
+				std::array<u8, 32> key;
+				Entry entry = it.entries()[i];
+
+				memcpy(key.data(), it.sha256(entry), key.size());
+				auto found = pool.find(key);
+				if(found == pool.end())
+				{
+					if(digests.size() == MANIFEST_MAX_DIGESTS) return std::vector<u8>();
+					found = pool.insert(std::make_pair(key, (u16)digests.size())).first;
+					digests.push_back(Digest());
+					memcpy(digests.back().sha256, key.data(), key.size());
+				}
+				entry.digest = found->second;
+				entry.reserved = 0;
+				entries.push_back(entry);
+			}
+		}
+
+		header.magic = MANIFEST_MAGIC;
+		header.version = MANIFEST_VERSION;
+		header.headerSize = sizeof(Header);
+		header.setCount = records.size();
+		header.entryCount = entries.size();
+		header.digestCount = digests.size();
+		header.setOffset = sizeof(Header);
+		header.entryOffset = header.setOffset + records.size() * sizeof(SetRecord);
+		header.digestOffset = header.entryOffset + entries.size() * sizeof(Entry);
+		header.fileSize = header.digestOffset + digests.size() * sizeof(Digest);
+
+		std::vector<u8> data(header.fileSize);
+		if(!records.empty()) memcpy(&data[header.setOffset], records.data(), records.size() * sizeof(SetRecord));
+		if(!entries.empty()) memcpy(&data[header.entryOffset], entries.data(), entries.size() * sizeof(Entry));
+		if(!digests.empty()) memcpy(&data[header.digestOffset], digests.data(), digests.size() * sizeof(Digest));
+
+		header.crc32 = CRC32::update(0, &data[sizeof(Header)], data.size() - sizeof(Header));
+		memcpy(data.data(), &header, sizeof(Header));
+		return data;
+	}
+}
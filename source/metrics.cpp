@@ -0,0 +1,190 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <string>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <3ds.h>
+#include "fs.h"
+#include "metrics.h"
+
+#ifndef _3DS
+#include <chrono>
+#endif
+
+
+
+namespace metrics
+{
+#define METRICS_NAME(name) #name,
+	static const char *const names[CALL_COUNT] = {METRICS_CALLS(METRICS_NAME)};
+#undef METRICS_NAME
+
+	static Stats stats[CALL_COUNT];
+
+
+	// System ticks on the 3DS, nanoseconds on the host
+	u64 ticks()
+	{
+#ifdef _3DS
+		return svcGetSystemTick();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	static u64 ticksToNs(u64 t)
+	{
+#ifdef _3DS
+		return t * 1000 / (SYSCLOCK_ARM11 / 1000000); // 0.05% off, never overflows
+#else
+		return t;
+#endif
+	}
+
+	// 0-3 are exact, after that 4 buckets per power of 2
+	static u32 bucketOf(u64 ns)
+	{
+		if(ns < 4) return ns;
+
+		const u32 exp = 63 - __builtin_clzll(ns);
+		const u32 bucket = (exp - 1) * 4 + ((ns >> (exp - 2)) & 3);
+		return (bucket < METRICS_BUCKETS ? bucket : METRICS_BUCKETS - 1);
+	}
+
+	static u64 bucketLimit(u32 bucket)
+	{
+		if(bucket < 4) return bucket + 1;
+		return (u64)(4 + (bucket & 3) + 1) << (bucket / 4 - 1);
+	}
+
+	void record(Call call, u64 startTicks, u64 bytes)
+	{
+		Stats& s = stats[call];
+		const u64 ns = ticksToNs(ticks() - startTicks);
+
+		s.calls++;
+		s.bytes += bytes;
+		s.totalNs += ns;
+		if(ns > s.maxNs) s.maxNs = ns;
+		s.buckets[bucketOf(ns)]++;
+	}
+
+	const char*  name(Call call) {return names[call];}
+	const Stats& get(Call call) {return stats[call];}
+
+	u64 percentile(Call call, u32 permille)
+	{
+		const Stats& s = stats[call];
+		const u64 rank = ((u64)s.calls * permille + 999) / 1000;
+		u64 seen = 0;
+
+		if(!s.calls) return 0;
+		for(u32 i=0; i<METRICS_BUCKETS; i++)
+		{
+			seen += s.buckets[i];
+			if(seen >= rank && seen) return std::min(bucketLimit(i), s.maxNs);
+		}
+		return s.maxNs;
+	}
+
+	void reset()
+	{
+		for(u32 i=0; i<CALL_COUNT; i++) stats[i] = Stats();
+	}
+
+	// At most 5 characters
+	static const char* formatNs(char *buf, u64 ns)
+	{
+		if(ns < 1000000) snprintf(buf, 8, "%luu", (unsigned long)(ns / 1000));
+		else if(ns < 100000000) snprintf(buf, 8, "%.1fm", ns / 1e6);
+		else if(ns < 1000000000) snprintf(buf, 8, "%lum", (unsigned long)(ns / 1000000));
+		else snprintf(buf, 8, "%.1fs", ns / 1e9);
+		return buf;
+	}
+
+	// Grouped by service so the names fit into 40 columns
+	void print()
+	{
+		char p50[8], p90[8], p99[8];
+		const char *service = "";
+		size_t serviceLen = 0;
+		u64 bytes = 0, totalNs = 0;
+
+
+		printf("%-16s%6s%6s%6s%6s\n", "call", "n", "p50", "p90", "p99");
+		for(u32 i=0; i<CALL_COUNT; i++)
+		{
+			const Call call = (Call)i;
+			if(!stats[i].calls) continue;
+
+			const size_t len = strchr(names[i], '_') - names[i];
+			if(len != serviceLen || strncmp(names[i], service, len))
+			{
+				service = names[i];
+				serviceLen = len;
+				printf("%.*s\n", (int)len, service);
+			}
+
+			printf("  %-14.14s%6lu%6s%6s%6s\n", names[i] + len + 1,
+			       (unsigned long)stats[i].calls, formatNs(p50, percentile(call, 500)),
+			       formatNs(p90, percentile(call, 900)), formatNs(p99, percentile(call, 990)));
+			bytes += stats[i].bytes;
+			totalNs += stats[i].totalNs;
+		}
+		printf("%.1f MB in %.1f s of service calls\n", bytes / 1048576.0, totalNs / 1e9);
+	}
+
+	// Opening and writing the file is counted as well, print() first
+	bool write(const char *label, const std::u16string& path)
+	{
+		const unsigned long run = time(nullptr);
+		std::string csv;
+		char line[192];
+
+
+		for(u32 i=0; i<CALL_COUNT; i++)
+		{
+			const Call call = (Call)i;
+			if(!stats[i].calls) continue;
+
+			snprintf(line, sizeof(line), "%lu,%s,%s,%lu,%llu,%llu,%llu,%llu,%llu,%llu\n", run, label, names[i],
+			         (unsigned long)stats[i].calls, (unsigned long long)stats[i].bytes,
+			         (unsigned long long)stats[i].totalNs / 1000, (unsigned long long)percentile(call, 500) / 1000,
+			         (unsigned long long)percentile(call, 900) / 1000, (unsigned long long)percentile(call, 990) / 1000,
+			         (unsigned long long)stats[i].maxNs / 1000);
+			csv += line;
+		}
+
+		try
+		{
+			fs::File file(path, FS_OPEN_WRITE|FS_OPEN_CREATE);
+			if(file.size() == 0) csv.insert(0, "run,label,call,calls,bytes,total_us,p50_us,p90_us,p99_us,max_us\n");
+			file.seek(0, FS_SEEK_END);
+			file.write(csv.data(), csv.size());
+		}
+		catch(fsException& e)
+		{
+			return false;
+		}
+
+		return true;
+	}
+} // namespace metrics
@@ -0,0 +1,79 @@
+// //////////////////////////////////////////////////////////
+// multidigest.cpp
+// SHA256 + CRC32 + size of the same bytes in one pass
+//
+
+#include "multidigest.h"
+
+
+namespace
+{
+  /// bytes handed to one digest before the next one sees them,
+  /// half the ARM11 L1 data cache so they are still there for the next digest
+  const size_t SliceSize = 8 * 1024;
+}
+
+
+/// same as reset()
+MultiDigest::MultiDigest(unsigned digests)
+: m_digests(digests)
+{
+  reset();
+}
+
+
+/// restart
+void MultiDigest::reset()
+{
+  m_numBytes = 0;
+  m_sha256.reset();
+  m_crc32.reset();
+}
+
+
+/// add arbitrary number of bytes
+void MultiDigest::add(const void* data, size_t numBytes)
+{
+  const uint8_t* current = (const uint8_t*) data;
+
+  m_numBytes += numBytes;
+
+  // one digest only: no point in slicing
+  if (m_digests == Sha256)
+  {
+    m_sha256.add(current, numBytes);
+    return;
+  }
+  if (m_digests == Crc32)
+  {
+    m_crc32.add(current, numBytes);
+    return;
+  }
+
+  while (numBytes > 0)
+  {
+    size_t slice = numBytes < SliceSize ? numBytes : SliceSize;
+
+    if (m_digests & Sha256)
+      m_sha256.add(current, slice);
+    if (m_digests & Crc32)
+      m_crc32.add(current, slice);
+
+    current  += slice;
+    numBytes -= slice;
+  }
+}
+
+
+/// return latest SHA256 as 64 hex characters
+std::string MultiDigest::getSha256()
+{
+  return m_sha256.getHash();
+}
+
+
+/// return latest SHA256 as bytes
+void MultiDigest::getSha256(unsigned char buffer[SHA256::HashBytes])
+{
+  m_sha256.getHash(buffer);
+}
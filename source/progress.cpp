@@ -0,0 +1,92 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <3ds.h>
+#include "progress.h"
+
+
+
+namespace progress
+{
+	void post(Channel& channel, const Event& event)
+	{
+		// The UI drains once per frame, a full ring is empty again in at most 16 ms
+		while(!channel.events.push(event)) svcSleepThread(1000000LL);
+	}
+
+	bool tryPost(Channel& channel, const Event& event)
+	{
+		if(channel.events.push(event)) return true;
+
+		channel.dropped++;
+		return false;
+	}
+
+	void print(Channel& channel, const char *format, ...)
+	{
+		char buf[512];
+		va_list args;
+
+
+		va_start(args, format);
+		vsnprintf(buf, sizeof(buf), format, args);
+		va_end(args);
+
+		Event event = Event();
+		event.phase = PHASE_TEXT;
+
+		for(const char *str = buf; *str;)
+		{
+			size_t len = strlen(str);
+			if(len > PROGRESS_TEXT_SIZE - 1)
+			{
+				len = PROGRESS_TEXT_SIZE - 1;
+				while(len > 0 && (str[len] & 0xC0) == 0x80) len--; // Don't cut a character in half
+			}
+
+			memcpy(event.text, str, len);
+			event.text[len] = 0;
+			post(channel, event);
+			str += len;
+		}
+	}
+
+	bool ask(Channel& channel, const char *question)
+	{
+		Event event = Event();
+
+
+		print(channel, "%s", question);
+		channel.answer.store(-1, std::memory_order_relaxed);
+		event.phase = PHASE_PROMPT;
+		post(channel, event);
+
+		int reply;
+		while((reply = channel.answer.load(std::memory_order_acquire)) < 0) svcSleepThread(16000000LL);
+
+		return reply != 0;
+	}
+
+	void answer(Channel& channel, bool yes)
+	{
+		channel.answer.store(yes, std::memory_order_release);
+	}
+}
@@ -3,14 +3,35 @@
 // Copyright (c) 2014,2015 Stephan Brumme. All rights reserved.
 // see http://create.stephan-brumme.com/disclaimer.html
 //
+// block functions are selected at runtime:
+// - portable C code
+// - SHA extensions (x86 hosts)
+// - ARMv8 cryptography extensions (AArch64 Linux hosts)
+//
 
 #include "sha256.h"
 
+#include <string.h>
+
 // big endian architectures need #define __BYTE_ORDER __BIG_ENDIAN
-#ifndef _MSC_VER
+#if defined(__linux__)
+#include <endian.h>
+#elif !defined(_MSC_VER)
 #include <machine/endian.h>
 #endif
 
+#if defined(__x86_64__) || defined(__i386__)
+#define SHA256_HAVE_SHANI
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+#define SHA256_HAVE_ARMCRYPTO
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
 
 /// same as reset()
 SHA256::SHA256()
@@ -59,7 +80,7 @@ namespace
            (x << 24);
   }
 
-  // mix functions for processBlock()
+  // mix functions for processBlocksPortable()
   inline uint32_t f1(uint32_t e, uint32_t f, uint32_t g)
   {
     uint32_t term1 = rotate(e, 6) ^ rotate(e, 11) ^ rotate(e, 25);
@@ -73,167 +94,368 @@ namespace
     uint32_t term2 = ((a | b) & c) | (a & b); //(a & (b ^ c)) ^ (b & c);
     return term1 + term2;
   }
-}
 
 
-/// process 64 bytes
-void SHA256::processBlock(const void* data)
-{
-  // get last hash
-  uint32_t a = m_hash[0];
-  uint32_t b = m_hash[1];
-  uint32_t c = m_hash[2];
-  uint32_t d = m_hash[3];
-  uint32_t e = m_hash[4];
-  uint32_t f = m_hash[5];
-  uint32_t g = m_hash[6];
-  uint32_t h = m_hash[7];
-
-  // data represented as 16x 32-bit words
-  const uint32_t* input = (uint32_t*) data;
-  // convert to big endian
-  uint32_t words[64];
-  int i;
-  for (i = 0; i < 16; i++)
+  /// portable C code, process numBlocks x 64 bytes
+  void processBlocksPortable(uint32_t hash[8], const uint8_t* data, size_t numBlocks)
+  {
+    for (; numBlocks > 0; numBlocks--, data += SHA256::BlockSize)
+    {
+      // get last hash
+      uint32_t a = hash[0];
+      uint32_t b = hash[1];
+      uint32_t c = hash[2];
+      uint32_t d = hash[3];
+      uint32_t e = hash[4];
+      uint32_t f = hash[5];
+      uint32_t g = hash[6];
+      uint32_t h = hash[7];
+
+      // data represented as 16x 32-bit words
+      const uint32_t* input = (const uint32_t*) data;
+      // convert to big endian
+      uint32_t words[64];
+      int i;
+      for (i = 0; i < 16; i++)
 #if defined(__BYTE_ORDER) && (__BYTE_ORDER != 0) && (__BYTE_ORDER == __BIG_ENDIAN)
-    words[i] =      input[i];
+        words[i] =      input[i];
 #else
-    words[i] = swap(input[i]);
+        words[i] = swap(input[i]);
+#endif
+
+      uint32_t x,y; // temporaries
+
+      // first round
+      x = h + f1(e,f,g) + 0x428a2f98 + words[ 0]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0x71374491 + words[ 1]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0xb5c0fbcf + words[ 2]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0xe9b5dba5 + words[ 3]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0x3956c25b + words[ 4]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0x59f111f1 + words[ 5]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0x923f82a4 + words[ 6]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0xab1c5ed5 + words[ 7]; y = f2(b,c,d); e += x; a = x + y;
+
+      // secound round
+      x = h + f1(e,f,g) + 0xd807aa98 + words[ 8]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0x12835b01 + words[ 9]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0x243185be + words[10]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0x550c7dc3 + words[11]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0x72be5d74 + words[12]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0x80deb1fe + words[13]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0x9bdc06a7 + words[14]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0xc19bf174 + words[15]; y = f2(b,c,d); e += x; a = x + y;
+
+      // extend to 24 words
+      for (; i < 24; i++)
+        words[i] = words[i-16] +
+                   (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
+                   words[i-7] +
+                   (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
+
+      // third round
+      x = h + f1(e,f,g) + 0xe49b69c1 + words[16]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0xefbe4786 + words[17]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0x0fc19dc6 + words[18]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0x240ca1cc + words[19]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0x2de92c6f + words[20]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0x4a7484aa + words[21]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0x5cb0a9dc + words[22]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0x76f988da + words[23]; y = f2(b,c,d); e += x; a = x + y;
+
+      // extend to 32 words
+      for (; i < 32; i++)
+        words[i] = words[i-16] +
+                   (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
+                   words[i-7] +
+                   (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
+
+      // fourth round
+      x = h + f1(e,f,g) + 0x983e5152 + words[24]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0xa831c66d + words[25]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0xb00327c8 + words[26]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0xbf597fc7 + words[27]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0xc6e00bf3 + words[28]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0xd5a79147 + words[29]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0x06ca6351 + words[30]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0x14292967 + words[31]; y = f2(b,c,d); e += x; a = x + y;
+
+      // extend to 40 words
+      for (; i < 40; i++)
+        words[i] = words[i-16] +
+                   (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
+                   words[i-7] +
+                   (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
+
+      // fifth round
+      x = h + f1(e,f,g) + 0x27b70a85 + words[32]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0x2e1b2138 + words[33]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0x4d2c6dfc + words[34]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0x53380d13 + words[35]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0x650a7354 + words[36]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0x766a0abb + words[37]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0x81c2c92e + words[38]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0x92722c85 + words[39]; y = f2(b,c,d); e += x; a = x + y;
+
+      // extend to 48 words
+      for (; i < 48; i++)
+        words[i] = words[i-16] +
+                   (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
+                   words[i-7] +
+                   (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
+
+      // sixth round
+      x = h + f1(e,f,g) + 0xa2bfe8a1 + words[40]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0xa81a664b + words[41]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0xc24b8b70 + words[42]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0xc76c51a3 + words[43]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0xd192e819 + words[44]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0xd6990624 + words[45]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0xf40e3585 + words[46]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0x106aa070 + words[47]; y = f2(b,c,d); e += x; a = x + y;
+
+      // extend to 56 words
+      for (; i < 56; i++)
+        words[i] = words[i-16] +
+                   (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
+                   words[i-7] +
+                   (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
+
+      // seventh round
+      x = h + f1(e,f,g) + 0x19a4c116 + words[48]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0x1e376c08 + words[49]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0x2748774c + words[50]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0x34b0bcb5 + words[51]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0x391c0cb3 + words[52]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0x4ed8aa4a + words[53]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0x5b9cca4f + words[54]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0x682e6ff3 + words[55]; y = f2(b,c,d); e += x; a = x + y;
+
+      // extend to 64 words
+      for (; i < 64; i++)
+        words[i] = words[i-16] +
+                   (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
+                   words[i-7] +
+                   (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
+
+      // eigth round
+      x = h + f1(e,f,g) + 0x748f82ee + words[56]; y = f2(a,b,c); d += x; h = x + y;
+      x = g + f1(d,e,f) + 0x78a5636f + words[57]; y = f2(h,a,b); c += x; g = x + y;
+      x = f + f1(c,d,e) + 0x84c87814 + words[58]; y = f2(g,h,a); b += x; f = x + y;
+      x = e + f1(b,c,d) + 0x8cc70208 + words[59]; y = f2(f,g,h); a += x; e = x + y;
+      x = d + f1(a,b,c) + 0x90befffa + words[60]; y = f2(e,f,g); h += x; d = x + y;
+      x = c + f1(h,a,b) + 0xa4506ceb + words[61]; y = f2(d,e,f); g += x; c = x + y;
+      x = b + f1(g,h,a) + 0xbef9a3f7 + words[62]; y = f2(c,d,e); f += x; b = x + y;
+      x = a + f1(f,g,h) + 0xc67178f2 + words[63]; y = f2(b,c,d); e += x; a = x + y;
+
+      // update hash
+      hash[0] += a;
+      hash[1] += b;
+      hash[2] += c;
+      hash[3] += d;
+      hash[4] += e;
+      hash[5] += f;
+      hash[6] += g;
+      hash[7] += h;
+    }
+  }
+
+
+  /// block functions update the hash with numBlocks x 64 bytes
+  typedef void (*BlockFunc)(uint32_t hash[8], const uint8_t* data, size_t numBlocks);
+
+#if defined(SHA256_HAVE_SHANI) || defined(SHA256_HAVE_ARMCRYPTO)
+  /// same constants as processBlocksPortable(), for the hardware backends
+  const uint32_t RoundConstants[64] =
+  {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+  };
+#endif
+
+
+#ifdef SHA256_HAVE_SHANI
+  /// x86 SHA extensions, 4 rounds per step
+  __attribute__((target("sha,sse4.1")))
+  void processBlocksShaNi(uint32_t hash[8], const uint8_t* data, size_t numBlocks)
+  {
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // sha256rnds2 wants the state as ABEF and CDGH
+    __m128i tmp    = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &hash[0]), 0xB1); // CDAB
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &hash[4]), 0x1B); // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);    // ABEF
+    state1         = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+
+    for (; numBlocks > 0; numBlocks--, data += SHA256::BlockSize)
+    {
+      __m128i abef = state0;
+      __m128i cdgh = state1;
+
+      // words[4*i .. 4*i+3] live in msg[i & 3]
+      __m128i msg[4];
+      for (int i = 0; i < 4; i++)
+        msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 16 * i)), byteSwap);
+
+      for (int i = 0; i < 16; i++)
+      {
+        __m128i wk = _mm_add_epi32(msg[i & 3], _mm_loadu_si128((const __m128i*) &RoundConstants[4 * i]));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0E));
+
+        // extend to words[4*i+16 .. 4*i+19]
+        if (i < 12)
+        {
+          __m128i next = _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]);
+          next = _mm_add_epi32(next, _mm_alignr_epi8(msg[(i + 3) & 3], msg[(i + 2) & 3], 4));
+          msg[i & 3] = _mm_sha256msg2_epu32(next, msg[(i + 3) & 3]);
+        }
+      }
+
+      state0 = _mm_add_epi32(state0, abef);
+      state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    // back to ABCD and EFGH
+    tmp    = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);       // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);    // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);       // HGFE
+    _mm_storeu_si128((__m128i*) &hash[0], state0);
+    _mm_storeu_si128((__m128i*) &hash[4], state1);
+  }
+#endif
+
+
+#ifdef SHA256_HAVE_ARMCRYPTO
+  /// ARMv8 cryptography extensions, 4 rounds per step
+  __attribute__((target("+crypto")))
+  void processBlocksArmCrypto(uint32_t hash[8], const uint8_t* data, size_t numBlocks)
+  {
+    uint32x4_t state0 = vld1q_u32(&hash[0]);
+    uint32x4_t state1 = vld1q_u32(&hash[4]);
+
+    for (; numBlocks > 0; numBlocks--, data += SHA256::BlockSize)
+    {
+      uint32x4_t abcd = state0;
+      uint32x4_t efgh = state1;
+
+      // words[4*i .. 4*i+3] live in msg[i & 3]
+      uint32x4_t msg[4];
+      for (int i = 0; i < 4; i++)
+        msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+
+      for (int i = 0; i < 16; i++)
+      {
+        uint32x4_t wk = vaddq_u32(msg[i & 3], vld1q_u32(&RoundConstants[4 * i]));
+
+        // extend to words[4*i+16 .. 4*i+19]
+        if (i < 12)
+          msg[i & 3] = vsha256su1q_u32(vsha256su0q_u32(msg[i & 3], msg[(i + 1) & 3]),
+                                       msg[(i + 2) & 3], msg[(i + 3) & 3]);
+
+        uint32x4_t tmp = state0;
+        state0 = vsha256hq_u32 (state0, state1, wk);
+        state1 = vsha256h2q_u32(state1, tmp,    wk);
+      }
+
+      state0 = vaddq_u32(state0, abcd);
+      state1 = vaddq_u32(state1, efgh);
+    }
+
+    vst1q_u32(&hash[0], state0);
+    vst1q_u32(&hash[4], state1);
+  }
+#endif
+
+
+  SHA256::Backend s_backend   = SHA256::Auto;
+  BlockFunc       s_blockFunc = NULL;
+
+  bool backendSupported(SHA256::Backend backend)
+  {
+    switch (backend)
+    {
+      case SHA256::Portable:
+        return true;
+#ifdef SHA256_HAVE_SHANI
+      case SHA256::ShaNi:
+        return __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("sha");
 #endif
+#ifdef SHA256_HAVE_ARMCRYPTO
+      case SHA256::ArmCrypto:
+        return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+#endif
+      default:
+        return false;
+    }
+  }
+}
+
+
+/// pick the fastest supported backend unless one is forced
+SHA256::Backend SHA256::selectBackend(Backend backend)
+{
+  if (backend == Auto || !backendSupported(backend))
+  {
+    backend = Portable;
+    if (backendSupported(ArmCrypto))
+      backend = ArmCrypto;
+    if (backendSupported(ShaNi))
+      backend = ShaNi;
+  }
+
+  switch (backend)
+  {
+#ifdef SHA256_HAVE_SHANI
+    case ShaNi:     s_blockFunc = processBlocksShaNi;     break;
+#endif
+#ifdef SHA256_HAVE_ARMCRYPTO
+    case ArmCrypto: s_blockFunc = processBlocksArmCrypto; break;
+#endif
+    default:        s_blockFunc = processBlocksPortable;  backend = Portable; break;
+  }
 
-  uint32_t x,y; // temporaries
-
-  // first round
-  x = h + f1(e,f,g) + 0x428a2f98 + words[ 0]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0x71374491 + words[ 1]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0xb5c0fbcf + words[ 2]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0xe9b5dba5 + words[ 3]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0x3956c25b + words[ 4]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0x59f111f1 + words[ 5]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0x923f82a4 + words[ 6]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0xab1c5ed5 + words[ 7]; y = f2(b,c,d); e += x; a = x + y;
-
-  // secound round
-  x = h + f1(e,f,g) + 0xd807aa98 + words[ 8]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0x12835b01 + words[ 9]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0x243185be + words[10]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0x550c7dc3 + words[11]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0x72be5d74 + words[12]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0x80deb1fe + words[13]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0x9bdc06a7 + words[14]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0xc19bf174 + words[15]; y = f2(b,c,d); e += x; a = x + y;
-
-  // extend to 24 words
-  for (; i < 24; i++)
-    words[i] = words[i-16] +
-               (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
-               words[i-7] +
-               (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
-
-  // third round
-  x = h + f1(e,f,g) + 0xe49b69c1 + words[16]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0xefbe4786 + words[17]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0x0fc19dc6 + words[18]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0x240ca1cc + words[19]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0x2de92c6f + words[20]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0x4a7484aa + words[21]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0x5cb0a9dc + words[22]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0x76f988da + words[23]; y = f2(b,c,d); e += x; a = x + y;
-
-  // extend to 32 words
-  for (; i < 32; i++)
-    words[i] = words[i-16] +
-               (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
-               words[i-7] +
-               (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
-
-  // fourth round
-  x = h + f1(e,f,g) + 0x983e5152 + words[24]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0xa831c66d + words[25]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0xb00327c8 + words[26]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0xbf597fc7 + words[27]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0xc6e00bf3 + words[28]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0xd5a79147 + words[29]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0x06ca6351 + words[30]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0x14292967 + words[31]; y = f2(b,c,d); e += x; a = x + y;
-
-  // extend to 40 words
-  for (; i < 40; i++)
-    words[i] = words[i-16] +
-               (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
-               words[i-7] +
-               (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
-
-  // fifth round
-  x = h + f1(e,f,g) + 0x27b70a85 + words[32]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0x2e1b2138 + words[33]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0x4d2c6dfc + words[34]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0x53380d13 + words[35]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0x650a7354 + words[36]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0x766a0abb + words[37]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0x81c2c92e + words[38]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0x92722c85 + words[39]; y = f2(b,c,d); e += x; a = x + y;
-
-  // extend to 48 words
-  for (; i < 48; i++)
-    words[i] = words[i-16] +
-               (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
-               words[i-7] +
-               (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
-
-  // sixth round
-  x = h + f1(e,f,g) + 0xa2bfe8a1 + words[40]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0xa81a664b + words[41]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0xc24b8b70 + words[42]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0xc76c51a3 + words[43]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0xd192e819 + words[44]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0xd6990624 + words[45]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0xf40e3585 + words[46]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0x106aa070 + words[47]; y = f2(b,c,d); e += x; a = x + y;
-
-  // extend to 56 words
-  for (; i < 56; i++)
-    words[i] = words[i-16] +
-               (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
-               words[i-7] +
-               (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
-
-  // seventh round
-  x = h + f1(e,f,g) + 0x19a4c116 + words[48]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0x1e376c08 + words[49]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0x2748774c + words[50]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0x34b0bcb5 + words[51]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0x391c0cb3 + words[52]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0x4ed8aa4a + words[53]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0x5b9cca4f + words[54]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0x682e6ff3 + words[55]; y = f2(b,c,d); e += x; a = x + y;
-
-  // extend to 64 words
-  for (; i < 64; i++)
-    words[i] = words[i-16] +
-               (rotate(words[i-15],  7) ^ rotate(words[i-15], 18) ^ (words[i-15] >>  3)) +
-               words[i-7] +
-               (rotate(words[i- 2], 17) ^ rotate(words[i- 2], 19) ^ (words[i- 2] >> 10));
-
-  // eigth round
-  x = h + f1(e,f,g) + 0x748f82ee + words[56]; y = f2(a,b,c); d += x; h = x + y;
-  x = g + f1(d,e,f) + 0x78a5636f + words[57]; y = f2(h,a,b); c += x; g = x + y;
-  x = f + f1(c,d,e) + 0x84c87814 + words[58]; y = f2(g,h,a); b += x; f = x + y;
-  x = e + f1(b,c,d) + 0x8cc70208 + words[59]; y = f2(f,g,h); a += x; e = x + y;
-  x = d + f1(a,b,c) + 0x90befffa + words[60]; y = f2(e,f,g); h += x; d = x + y;
-  x = c + f1(h,a,b) + 0xa4506ceb + words[61]; y = f2(d,e,f); g += x; c = x + y;
-  x = b + f1(g,h,a) + 0xbef9a3f7 + words[62]; y = f2(c,d,e); f += x; b = x + y;
-  x = a + f1(f,g,h) + 0xc67178f2 + words[63]; y = f2(b,c,d); e += x; a = x + y;
-
-  // update hash
-  m_hash[0] += a;
-  m_hash[1] += b;
-  m_hash[2] += c;
-  m_hash[3] += d;
-  m_hash[4] += e;
-  m_hash[5] += f;
-  m_hash[6] += g;
-  m_hash[7] += h;
+  s_backend = backend;
+  return backend;
+}
+
+
+/// backend in use
+SHA256::Backend SHA256::selectedBackend()
+{
+  if (s_blockFunc == NULL)
+    selectBackend(s_backend);
+
+  return s_backend;
+}
+
+
+const char* SHA256::backendName(Backend backend)
+{
+  switch (backend)
+  {
+    case Portable:  return "portable";
+    case ShaNi:     return "sha-ni";
+    case ArmCrypto: return "armv8-crypto";
+    default:        return "auto";
+  }
+}
+
+
+/// process one or more blocks of 64 bytes
+void SHA256::processBlocks(const void* data, size_t numBlocks)
+{
+  // first use picks the backend, call selectBackend() up front when using several threads
+  if (s_blockFunc == NULL)
+    selectBackend(s_backend);
+
+  s_blockFunc(m_hash, (const uint8_t*) data, numBlocks);
 }
 
 
@@ -242,42 +464,55 @@ void SHA256::add(const void* data, size_t numBytes)
 {
   const uint8_t* current = (const uint8_t*) data;
 
-  if (m_bufferSize > 0)
+  // a few bytes that don't fill the buffer: cheaper than calling memcpy
+  if (numBytes < 8 && m_bufferSize + numBytes < BlockSize)
   {
-    while (numBytes > 0 && m_bufferSize < BlockSize)
-    {
+    while (numBytes-- > 0)
       m_buffer[m_bufferSize++] = *current++;
-      numBytes--;
-    }
+    return;
   }
 
-  // full buffer
-  if (m_bufferSize == BlockSize)
+  // complete a partially filled buffer
+  if (m_bufferSize > 0)
   {
-    processBlock(m_buffer);
+    size_t fill = BlockSize - m_bufferSize;
+    if (fill > numBytes)
+      fill = numBytes;
+    memcpy(m_buffer + m_bufferSize, current, fill);
+    m_bufferSize += fill;
+    current      += fill;
+    numBytes     -= fill;
+
+    // still not full ?
+    if (m_bufferSize < BlockSize)
+      return;
+
+    processBlocks(m_buffer, 1);
     m_numBytes  += BlockSize;
     m_bufferSize = 0;
   }
 
-  // no more data ?
-  if (numBytes == 0)
-    return;
-
-  // process full blocks
-  while (numBytes >= BlockSize)
+  // process full blocks straight from the input
+  if (numBytes >= BlockSize)
   {
-    processBlock(current);
-    current    += BlockSize;
-    m_numBytes += BlockSize;
-    numBytes   -= BlockSize;
+    size_t numBlocks = numBytes / BlockSize;
+    processBlocks(current, numBlocks);
+    current    += numBlocks * BlockSize;
+    m_numBytes += numBlocks * BlockSize;
+    numBytes   -= numBlocks * BlockSize;
   }
 
   // keep remaining bytes in buffer
-  while (numBytes > 0)
-  {
-    m_buffer[m_bufferSize++] = *current++;
-    numBytes--;
-  }
+  memcpy(m_buffer, current, numBytes);
+  m_bufferSize = numBytes;
+}
+
+
+/// add several memory blocks, in order
+void SHA256::add(const Segment* segments, size_t numSegments)
+{
+  for (size_t i = 0; i < numSegments; i++)
+    add(segments[i].data, segments[i].numBytes);
 }
 
 
@@ -340,10 +575,10 @@ void SHA256::processBuffer()
   *addLength   = (unsigned char)( msgBits        & 0xFF);
 
   // process blocks
-  processBlock(m_buffer);
+  processBlocks(m_buffer, 1);
   // flowed over into a second block ?
   if (paddedLength > BlockSize)
-    processBlock(extra);
+    processBlocks(extra, 1);
 }
 
 
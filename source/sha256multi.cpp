@@ -0,0 +1,331 @@
+// //////////////////////////////////////////////////////////
+// sha256multi.cpp
+// several independent SHA256 hashes computed side by side in SIMD lanes
+//
+// - scalar:  one lane after another, using the SHA256 backend
+// - SSE2:    4 lanes (x86 hosts)
+// - AVX2:    8 lanes (x86 hosts)
+// - NEON:    4 lanes (ARM with NEON, not the 3DS)
+//
+// The lane kernel is written once with GCC vector extensions, each lane
+// holds the same word of a different stream.
+//
+
+#include "sha256multi.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SHA256MULTI_HAVE_X86
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SHA256MULTI_HAVE_NEON
+#endif
+
+
+namespace
+{
+  const uint32_t RoundConstants[64] =
+  {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+  };
+
+  typedef uint32_t Vec4 __attribute__((vector_size(16)));
+  typedef uint32_t Vec8 __attribute__((vector_size(32)));
+
+  /// lane functions update hash[lane] with numBlocks x 64 bytes of data[lane]
+  typedef void (*LanesFunc)(uint32_t* const hash[], const uint8_t* const data[], size_t numBlocks);
+
+  // a macro rather than a function, 32 byte vectors can't be passed around without AVX
+#define ROTATE(a, c) (((a) >> (c)) | ((a) << (32 - (c))))
+
+  /// big endian 32 bit word, may be unaligned
+  inline __attribute__((always_inline)) uint32_t loadWord(const uint8_t* data)
+  {
+    return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) |
+           (uint32_t(data[2]) <<  8) |  uint32_t(data[3]);
+  }
+
+  /// same steps as the portable SHA256 block function, one stream per lane
+  template <typename Vec, int Lanes>
+  inline __attribute__((always_inline)) void processLanes(uint32_t* const hash[], const uint8_t* const data[], size_t numBlocks)
+  {
+    Vec state[8];
+    for (int i = 0; i < 8; i++)
+      for (int lane = 0; lane < Lanes; lane++)
+        state[i][lane] = hash[lane][i];
+
+    for (size_t block = 0; block < numBlocks; block++)
+    {
+      Vec a = state[0], b = state[1], c = state[2], d = state[3];
+      Vec e = state[4], f = state[5], g = state[6], h = state[7];
+
+      // last 16 words of the message schedule
+      Vec words[16];
+      for (int i = 0; i < 64; i++)
+      {
+        if (i < 16)
+          for (int lane = 0; lane < Lanes; lane++)
+            words[i][lane] = loadWord(data[lane] + block * SHA256::BlockSize + 4 * i);
+        else
+        {
+          Vec w15 = words[(i - 15) & 15];
+          Vec w2  = words[(i -  2) & 15];
+          words[i & 15] += (ROTATE(w15,  7) ^ ROTATE(w15, 18) ^ (w15 >>  3)) +
+                           words[(i - 7) & 15] +
+                           (ROTATE(w2,  17) ^ ROTATE(w2,  19) ^ (w2  >> 10));
+        }
+
+        Vec x = h + (ROTATE(e, 6) ^ ROTATE(e, 11) ^ ROTATE(e, 25)) + (g ^ (e & (f ^ g))) +
+                RoundConstants[i] + words[i & 15];
+        Vec y = (ROTATE(a, 2) ^ ROTATE(a, 13) ^ ROTATE(a, 22)) + ((a & b) | (c & (a | b)));
+        h = g; g = f; f = e; e = d + x;
+        d = c; c = b; b = a; a = x + y;
+      }
+
+      state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+      state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+
+    for (int i = 0; i < 8; i++)
+      for (int lane = 0; lane < Lanes; lane++)
+        hash[lane][i] = state[i][lane];
+  }
+
+#if defined(SHA256MULTI_HAVE_X86) || defined(SHA256MULTI_HAVE_NEON)
+  /// SSE2 on x86, NEON on ARM
+  void processLanes4(uint32_t* const hash[], const uint8_t* const data[], size_t numBlocks)
+  {
+    processLanes<Vec4, 4>(hash, data, numBlocks);
+  }
+#endif
+
+#ifdef SHA256MULTI_HAVE_X86
+  __attribute__((target("avx2")))
+  void processLanesAvx2(uint32_t* const hash[], const uint8_t* const data[], size_t numBlocks)
+  {
+    processLanes<Vec8, 8>(hash, data, numBlocks);
+  }
+#endif
+
+
+  SHA256Multi::Backend s_backend   = SHA256Multi::Auto;
+  LanesFunc            s_lanesFunc = NULL;
+  bool                 s_ready     = false;
+
+  bool backendSupported(SHA256Multi::Backend backend)
+  {
+    switch (backend)
+    {
+      case SHA256Multi::Scalar:
+        return true;
+#ifdef SHA256MULTI_HAVE_X86
+      case SHA256Multi::Sse2:
+        return __builtin_cpu_supports("sse2");
+      case SHA256Multi::Avx2:
+        return __builtin_cpu_supports("avx2");
+#endif
+#ifdef SHA256MULTI_HAVE_NEON
+      case SHA256Multi::Neon:
+        return true;
+#endif
+      default:
+        return false;
+    }
+  }
+}
+
+
+/// pick the fastest supported backend unless one is forced
+SHA256Multi::Backend SHA256Multi::selectBackend(Backend backend)
+{
+  if (backend == Auto || !backendSupported(backend))
+  {
+    backend = Scalar;
+    if (backendSupported(Neon))
+      backend = Neon;
+    if (backendSupported(Sse2))
+      backend = Sse2;
+    if (backendSupported(Avx2))
+      backend = Avx2;
+    // one lane after another beats the SIMD lanes when SHA256 runs on crypto instructions
+    if (SHA256::selectedBackend() != SHA256::Portable)
+      backend = Scalar;
+  }
+
+  switch (backend)
+  {
+#ifdef SHA256MULTI_HAVE_X86
+    case Sse2: s_lanesFunc = processLanes4;    break;
+    case Avx2: s_lanesFunc = processLanesAvx2; break;
+#endif
+#ifdef SHA256MULTI_HAVE_NEON
+    case Neon: s_lanesFunc = processLanes4;    break;
+#endif
+    default:   s_lanesFunc = NULL; backend = Scalar; break;
+  }
+
+  s_backend = backend;
+  s_ready   = true;
+  return backend;
+}
+
+
+const char* SHA256Multi::backendName(Backend backend)
+{
+  switch (backend)
+  {
+    case Scalar: return "scalar";
+    case Sse2:   return "sse2";
+    case Avx2:   return "avx2";
+    case Neon:   return "neon";
+    default:     return "auto";
+  }
+}
+
+
+unsigned SHA256Multi::backendLanes(Backend backend)
+{
+  switch (backend)
+  {
+    case Sse2:
+    case Neon: return 4;
+    case Avx2: return 8;
+    default:   return 1;
+  }
+}
+
+
+/// hash numLanes streams
+SHA256Multi::SHA256Multi(unsigned numLanes)
+: m_numLanes(numLanes < 1 ? 1 : numLanes > unsigned(MaxLanes) ? unsigned(MaxLanes) : numLanes)
+{
+}
+
+
+/// restart all lanes
+void SHA256Multi::reset()
+{
+  for (unsigned lane = 0; lane < m_numLanes; lane++)
+    m_lanes[lane].reset();
+}
+
+
+/// process numBlocks x 64 bytes in every lane
+void SHA256Multi::processBlocks(const uint8_t* const data[], size_t numBlocks)
+{
+  // first use picks the backend, call selectBackend() up front when using several threads
+  if (!s_ready)
+    selectBackend(s_backend);
+
+  if (s_lanesFunc == NULL)
+  {
+    for (unsigned lane = 0; lane < m_numLanes; lane++)
+      m_lanes[lane].processBlocks(data[lane], numBlocks);
+  }
+  else
+  {
+    const unsigned width = backendLanes(s_backend);
+    for (unsigned first = 0; first < m_numLanes; first += width)
+    {
+      // unused lanes of the last group hash a copy of its first lane
+      uint32_t        spare[MaxLanes][SHA256::HashValues];
+      uint32_t*       hash [MaxLanes];
+      const uint8_t*  input[MaxLanes];
+      for (unsigned i = 0; i < width; i++)
+      {
+        unsigned lane = first + i;
+        if (lane < m_numLanes)
+        {
+          hash [i] = m_lanes[lane].m_hash;
+          input[i] = data[lane];
+        }
+        else
+        {
+          hash [i] = spare[i];
+          input[i] = data[first];
+          memcpy(spare[i], m_lanes[first].m_hash, sizeof(spare[i]));
+        }
+      }
+      s_lanesFunc(hash, input, numBlocks);
+    }
+  }
+
+  for (unsigned lane = 0; lane < m_numLanes; lane++)
+    m_lanes[lane].m_numBytes += numBlocks * SHA256::BlockSize;
+}
+
+
+/// add numBytes of data[lane] to every lane
+void SHA256Multi::add(const void* const data[], size_t numBytes)
+{
+  const uint8_t* current[MaxLanes];
+  size_t         left   [MaxLanes];
+  size_t         minLeft = numBytes;
+
+  // lanes with buffered bytes complete their block on their own
+  for (unsigned lane = 0; lane < m_numLanes; lane++)
+  {
+    current[lane] = (const uint8_t*) data[lane];
+    left   [lane] = numBytes;
+
+    size_t bufferSize = m_lanes[lane].m_bufferSize;
+    if (bufferSize > 0)
+    {
+      size_t fill = SHA256::BlockSize - bufferSize;
+      if (fill > numBytes)
+        fill = numBytes;
+      m_lanes[lane].add(current[lane], fill);
+      current[lane] += fill;
+      left   [lane] -= fill;
+    }
+
+    if (left[lane] < minLeft)
+      minLeft = left[lane];
+  }
+
+  // full blocks side by side
+  size_t numBlocks = minLeft / SHA256::BlockSize;
+  if (numBlocks > 0)
+  {
+    processBlocks(current, numBlocks);
+    for (unsigned lane = 0; lane < m_numLanes; lane++)
+    {
+      current[lane] += numBlocks * SHA256::BlockSize;
+      left   [lane] -= numBlocks * SHA256::BlockSize;
+    }
+  }
+
+  // keep remaining bytes in the buffers
+  for (unsigned lane = 0; lane < m_numLanes; lane++)
+    m_lanes[lane].add(current[lane], left[lane]);
+}
+
+
+/// add arbitrary number of bytes to one lane
+void SHA256Multi::add(unsigned lane, const void* data, size_t numBytes)
+{
+  m_lanes[lane].add(data, numBytes);
+}
+
+
+/// return latest hash of a lane as 64 hex characters
+std::string SHA256Multi::getHash(unsigned lane)
+{
+  return m_lanes[lane].getHash();
+}
+
+
+/// return latest hash of a lane as bytes
+void SHA256Multi::getHash(unsigned lane, unsigned char buffer[SHA256::HashBytes])
+{
+  m_lanes[lane].getHash(buffer);
+}
@@ -24,6 +24,9 @@
 #include "fs.h"
 #include "misc.h"
 #include "title.h"
+#include "multidigest.h"
+#include "metrics.h"
+#include "iotune.h"
 
 #define _FILE_ "title.cpp" // Replacement for __FILE__ without the path
 
@@ -44,7 +47,8 @@ std::vector<TitleInfo> getTitleInfos(FS_MediaType mediaType)
 	const FS_Path filePath = {PATH_BINARY, 0x14, (const u8*)fileLowPath};
 
 
-	if((res = AM_GetTitleCount(mediaType, &count))) throw titleException(_FILE_, __LINE__, res, "无法获取title数量!");
+	TRACE_SCOPE("getTitleInfos");
+	if((res = SERVICE_CALL(AM_GetTitleCount, mediaType, &count))) throw titleException(_FILE_, __LINE__, res, "无法获取title数量!");
 
 
 	std::vector<TitleInfo> titleInfos; titleInfos.reserve(count);
@@ -54,24 +58,24 @@ std::vector<TitleInfo> getTitleInfos(FS_MediaType mediaType)
 
 
 	u32 throwaway;
-	if((res = AM_GetTitleList(&throwaway, mediaType, count, &titleIdList))) throw titleException(_FILE_, __LINE__, res, "获取titleID列表失败!");
-	if((res = AM_GetTitleInfo(mediaType, count, &titleIdList, &titleList))) throw titleException(_FILE_, __LINE__, res, "获取title列表失败!");
+	if((res = SERVICE_CALL(AM_GetTitleList, &throwaway, mediaType, count, &titleIdList))) throw titleException(_FILE_, __LINE__, res, "获取titleID列表失败!");
+	if((res = SERVICE_CALL(AM_GetTitleInfo, mediaType, count, &titleIdList, &titleList))) throw titleException(_FILE_, __LINE__, res, "获取title列表失败!");
 	for(u32 i=0; i<count; i++)
 	{
 		// Copy title ID, size and version directly
 		memcpy(&tmpTitleInfo.titleID, &titleList[i].titleID, 18);
-		if(AM_GetTitleProductCode(mediaType, titleIdList[i], tmpStr)) memset(tmpStr, 0, 16);
+		if(SERVICE_CALL(AM_GetTitleProductCode, mediaType, titleIdList[i], tmpStr)) memset(tmpStr, 0, 16);
 		tmpTitleInfo.productCode = tmpStr;
 
 		// Copy the title ID into our archive low path
 		memcpy(archiveLowPath, &titleIdList[i], 8);
 		icon.clear();
-		if(!FSUSER_OpenFileDirectly(&fileHandle, iconArchive, filePath, FS_OPEN_READ, 0))
+		if(!SERVICE_CALL(FSUSER_OpenFileDirectly, &fileHandle, iconArchive, filePath, FS_OPEN_READ, 0))
 		{
 			// Nintendo decided to release a title with an icon entry but with size 0 so this will fail.
 			// Ignoring errors because of this here.
-			FSFILE_Read(fileHandle, &bytesRead, 0, &icon, sizeof(Icon));
-			FSFILE_Close(fileHandle);
+			SERVICE_CALL(FSFILE_Read, fileHandle, &bytesRead, 0, &icon, sizeof(Icon));
+			SERVICE_CALL(FSFILE_Close, fileHandle);
 		}
 
 		tmpTitleInfo.title = icon[0].appTitles[sysLang].longDesc;
@@ -85,10 +89,13 @@ std::vector<TitleInfo> getTitleInfos(FS_MediaType mediaType)
 }
 
 
-void installCia(const std::u16string& path, FS_MediaType mediaType, std::function<void (const std::u16string& file, u32 percent)> callback)
+void installCia(const std::u16string& path, FS_MediaType mediaType, std::function<void (const std::u16string& file, u32 percent)> callback, MultiDigest *digest, const std::string& expectedSha256)
 {
+	TRACE_SCOPE("installCia");
 	fs::File ciaFile(path, FS_OPEN_READ), cia;
-	Buffer<u8> buffer(MAX_BUF_SIZE, false);
+	const u32 bufSize = iotune::blockSize();
+	Buffer<u8> buffer(bufSize, false);
+	MultiDigest sha256(MultiDigest::Sha256);
 	Handle ciaHandle;
 	u32 blockSize;
 	u64 ciaSize, offset = 0;
@@ -96,14 +103,15 @@ void installCia(const std::u16string& path, FS_MediaType mediaType, std::functio
 
 
 
+	if(!digest && !expectedSha256.empty()) digest = &sha256;
 	ciaSize = ciaFile.size();
-	if((res = AM_StartCiaInstall(mediaType, &ciaHandle))) throw titleException(_FILE_, __LINE__, res, "无法开始CIA安装!");
+	if((res = SERVICE_CALL(AM_StartCiaInstall, mediaType, &ciaHandle))) throw titleException(_FILE_, __LINE__, res, "无法开始CIA安装!");
 	cia.setFileHandle(ciaHandle); // Use the handle returned by AM
 
 
-	for(u32 i=0; i<=ciaSize / MAX_BUF_SIZE; i++)
+	for(u32 i=0; i<=ciaSize / bufSize; i++)
 	{
-		blockSize = ((ciaSize - offset<MAX_BUF_SIZE) ? ciaSize - offset : MAX_BUF_SIZE);
+		blockSize = ((ciaSize - offset<bufSize) ? ciaSize - offset : bufSize);
 
 		if(blockSize>0)
 		{
@@ -113,17 +121,30 @@ void installCia(const std::u16string& path, FS_MediaType mediaType, std::functio
 				cia.write(&buffer, blockSize);
 			} catch(fsException& e)
 			{
-				AM_CancelCIAInstall(ciaHandle); // Abort installation
+				SERVICE_CALL(AM_CancelCIAInstall, ciaHandle); // Abort installation
 				cia.setFileHandle(0); // Reset the handle so it doesn't get closed twice
 				throw;
 			}
 
+			if(digest)
+			{
+				TRACE_SCOPE_BYTES("MultiDigest::add", blockSize);
+				digest->add(&buffer, blockSize);
+			}
 			offset += blockSize;
 			if(callback) callback(path, offset * 100 / ciaSize);
 		}
 	}
 
-	if((res = AM_FinishCiaInstall(ciaHandle))) throw titleException(_FILE_, __LINE__, res, "无法停止CIA安装!");
+	cia.setFileHandle(0); // AM takes the handle, don't close it again
+
+	// Changed or misread since it was verified, AM must not commit it
+	if(!expectedSha256.empty() && digest->getSha256() != expectedSha256)
+	{
+		SERVICE_CALL(AM_CancelCIAInstall, ciaHandle);
+		throw titleException(_FILE_, __LINE__, 0, "\x1b[31m安装的文件与验证时不一致!\x1b[0m\n");
+	}
+	if((res = SERVICE_CALL(AM_FinishCiaInstall, ciaHandle))) throw titleException(_FILE_, __LINE__, res, "无法停止CIA安装!");
 }
 
 
@@ -132,9 +153,9 @@ void deleteTitle(FS_MediaType mediaType, u64 titleID)
 	Result res;
 
 	// System app
-	if(titleID>>32 & 0xFFFF) {if((res = AM_DeleteTitle(mediaType, titleID))) throw titleException(_FILE_, __LINE__, res, "删除系统title失败!");} // Who likes ambiguous else?
+	if(titleID>>32 & 0xFFFF) {if((res = SERVICE_CALL(AM_DeleteTitle, mediaType, titleID))) throw titleException(_FILE_, __LINE__, res, "删除系统title失败!");} // Who likes ambiguous else?
 	// Normal app
-	else if((res = AM_DeleteAppTitle(mediaType, titleID))) throw titleException(_FILE_, __LINE__, res, "删除应用title失败!");
+	else if((res = SERVICE_CALL(AM_DeleteAppTitle, mediaType, titleID))) throw titleException(_FILE_, __LINE__, res, "删除应用title失败!");
 }
 
 
@@ -0,0 +1,140 @@
+/*
+ *  sysUpdater is an update app for the Nintendo 3DS.
+ *  Copyright (C) 2015 profi200
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#include "trace.h"
+
+#ifdef TRACE_ENABLED
+
+#include <algorithm>
+#include <string>
+#include <cstdio>
+#include <3ds.h>
+#include "fs.h"
+
+#ifndef _3DS
+#include <chrono>
+#endif
+
+
+
+namespace trace
+{
+	struct Event
+	{
+		const char *name;
+		u64 start;
+		u64 end;
+		u32 bytes;
+	};
+
+	static Event events[TRACE_MAX_EVENTS]; // Preallocated, recording never allocates
+	static u32 next = 0;
+	static u32 count = 0;
+	static bool paused = false;
+
+
+	// System ticks on the 3DS, nanoseconds on the host
+	u64 now()
+	{
+#ifdef _3DS
+		return svcGetSystemTick();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	static double toMicroseconds(u64 ticks)
+	{
+#ifdef _3DS
+		return ticks / (SYSCLOCK_ARM11 / 1000000.0);
+#else
+		return ticks / 1000.0;
+#endif
+	}
+
+	void record(const char *name, u64 start, u64 end, u32 bytes)
+	{
+		if(paused) return;
+
+		Event& e = events[next];
+		e.name  = name;
+		e.start = start;
+		e.end   = end;
+		e.bytes = bytes;
+
+		next = (next + 1) % TRACE_MAX_EVENTS;
+		if(count < TRACE_MAX_EVENTS) count++;
+	}
+
+	void clear()
+	{
+		next = 0;
+		count = 0;
+	}
+
+	// Complete ("X") events. Spans are recorded when they end so nested spans come
+	// before their parents, the viewer sorts them by timestamp.
+	bool dump(const std::u16string& path)
+	{
+		const u32 first = (next + TRACE_MAX_EVENTS - count) % TRACE_MAX_EVENTS;
+		u64 base = ~0ULL;
+		std::string json;
+		char line[192];
+
+
+		for(u32 i=0; i<count; i++)
+		{
+			const Event& e = events[(first + i) % TRACE_MAX_EVENTS];
+			if(e.start < base) base = e.start;
+		}
+
+		json.reserve(count * 96 + 256);
+		json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+		        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"sysDowngrader\"}}";
+		for(u32 i=0; i<count; i++)
+		{
+			const Event& e = events[(first + i) % TRACE_MAX_EVENTS];
+			int len = snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f",
+			                   e.name, toMicroseconds(e.start - base), toMicroseconds(e.end - e.start));
+			if(e.bytes) len += snprintf(line + len, sizeof(line) - len, ",\"args\":{\"bytes\":%lu}", (unsigned long)e.bytes);
+			json.append(line, len);
+			json += '}';
+		}
+		json += "\n]}\n";
+
+		paused = true;
+		try
+		{
+			fs::File file(path, FS_OPEN_WRITE|FS_OPEN_CREATE);
+			file.setSize(0);
+			for(size_t offset = 0; offset < json.size(); offset += MAX_BUF_SIZE)
+				file.write(json.data() + offset, std::min<size_t>(json.size() - offset, MAX_BUF_SIZE));
+		}
+		catch(fsException& e)
+		{
+			paused = false;
+			return false;
+		}
+		paused = false;
+
+		clear();
+		return true;
+	}
+} // namespace trace
+
+#endif // TRACE_ENABLED
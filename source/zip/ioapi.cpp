@@ -10,11 +10,10 @@
 
 */
 
+#include <new>
 #include <string>
 #include "fs.h"
 
-fs::File _zipFile_;
-
 
 #if defined(_WIN32) && (!(defined(_CRT_SECURE_NO_WARNINGS)))
         #define _CRT_SECURE_NO_WARNINGS
@@ -26,9 +25,10 @@ fs::File _zipFile_;
 #define FTELLO_FUNC(stream) ftello(stream)
 #define FSEEKO_FUNC(stream, offset, origin) fseeko(stream, offset, origin)
 #else
-#define FOPEN_FUNC(filename, mode) _zipFile_.open(std::u16string((char16_t*)filename), mode)
-#define FTELLO_FUNC() _zipFile_.tell()
-#define FSEEKO_FUNC(offset, origin) _zipFile_.seek(offset, origin)
+// Every stream is its own fs::File, the access index of unzip.cpp opens a second one
+#define FOPEN_FUNC(stream, filename, mode) ((fs::File*)stream)->open(std::u16string((const char16_t*)filename), mode)
+#define FTELLO_FUNC(stream) ((fs::File*)stream)->tell()
+#define FSEEKO_FUNC(stream, offset, origin) ((fs::File*)stream)->seek(offset, origin)
 #endif
 
 
@@ -98,22 +98,17 @@ static long    ZCALLBACK fseek64_file_func OF((voidpf opaque, voidpf stream, ZPO
 static int     ZCALLBACK fclose_file_func OF((voidpf opaque, voidpf stream));
 static int     ZCALLBACK ferror_file_func OF((voidpf opaque, voidpf stream));
 
+static voidpf ZCALLBACK fopen64_file_func OF((voidpf opaque, const void* filename, int mode));
+static long    ZCALLBACK fseek64_file_func OF((voidpf opaque, voidpf stream, ZPOS64_T offset, int origin));
+
+// The 32 bit functions take UTF-8 names and share the fs::File streams of the 64 bit ones
 static voidpf ZCALLBACK fopen_file_func (voidpf opaque, const char* filename, int mode)
 {
-    FILE* file = NULL;
-    const char* mode_fopen = NULL;
-    if ((mode & ZLIB_FILEFUNC_MODE_READWRITEFILTER)==ZLIB_FILEFUNC_MODE_READ)
-        mode_fopen = "rb";
-    else
-    if (mode & ZLIB_FILEFUNC_MODE_EXISTING)
-        mode_fopen = "r+b";
-    else
-    if (mode & ZLIB_FILEFUNC_MODE_CREATE)
-        mode_fopen = "wb";
+    u16 path[0x106] = {0};
 
-    if ((filename!=NULL) && (mode_fopen != NULL))
-        file = fopen(filename, mode_fopen);
-    return file;
+    if ((filename==NULL) || (utf8_to_utf16(path, (const u8*)filename, 0x105) < 0))
+        return NULL;
+    return fopen64_file_func(opaque, path, mode);
 }
 
 static voidpf ZCALLBACK fopen64_file_func (voidpf opaque, const void* filename, int mode)
@@ -128,56 +123,65 @@ static voidpf ZCALLBACK fopen64_file_func (voidpf opaque, const void* filename,
     if (mode & ZLIB_FILEFUNC_MODE_CREATE)
         mode_fopen = FS_OPEN_READ|FS_OPEN_WRITE|FS_OPEN_CREATE;
 
-    if ((filename!=NULL))
-        FOPEN_FUNC(filename, mode_fopen);
-    return ((FILE*)0x1); // dummy
+    if ((filename==NULL) || (mode_fopen==0))
+        return NULL;
+
+    fs::File* file = new (std::nothrow) fs::File();
+    if (file == NULL)
+        return NULL;
+    try
+    {
+        FOPEN_FUNC(file, filename, mode_fopen);
+        if ((mode & ZLIB_FILEFUNC_MODE_CREATE) && !(mode & ZLIB_FILEFUNC_MODE_EXISTING))
+            file->setSize(0); // like "wb", an old longer file would leave its central dir at the end
+    }
+    catch (fsException& e)
+    {
+        delete file;
+        return NULL;
+    }
+    return file;
 }
 
 
 static uLong ZCALLBACK fread_file_func (voidpf opaque, voidpf stream, void* buf, uLong size)
 {
-    return _zipFile_.read(buf, size);
+    try
+    {
+        return ((fs::File*)stream)->read(buf, size);
+    }
+    catch (fsException& e)
+    {
+        return 0;
+    }
 }
 
 static uLong ZCALLBACK fwrite_file_func (voidpf opaque, voidpf stream, const void* buf, uLong size)
 {
-    return _zipFile_.write(buf, size);
+    try
+    {
+        return ((fs::File*)stream)->write(buf, size);
+    }
+    catch (fsException& e)
+    {
+        return 0;
+    }
 }
 
 static long ZCALLBACK ftell_file_func (voidpf opaque, voidpf stream)
 {
-    long ret;
-    ret = ftell((FILE *)stream);
-    return ret;
+    return (long)FTELLO_FUNC(stream);
 }
 
 
 static ZPOS64_T ZCALLBACK ftell64_file_func (voidpf opaque, voidpf stream)
 {
-    return FTELLO_FUNC();
+    return FTELLO_FUNC(stream);
 }
 
 static long ZCALLBACK fseek_file_func (voidpf  opaque, voidpf stream, uLong offset, int origin)
 {
-    int fseek_origin=0;
-    long ret;
-    switch (origin)
-    {
-    case ZLIB_FILEFUNC_SEEK_CUR :
-        fseek_origin = SEEK_CUR;
-        break;
-    case ZLIB_FILEFUNC_SEEK_END :
-        fseek_origin = SEEK_END;
-        break;
-    case ZLIB_FILEFUNC_SEEK_SET :
-        fseek_origin = SEEK_SET;
-        break;
-    default: return -1;
-    }
-    ret = 0;
-    if (fseek((FILE *)stream, offset, fseek_origin) != 0)
-        ret = -1;
-    return ret;
+    return fseek64_file_func(opaque, stream, offset, origin);
 }
 
 static long ZCALLBACK fseek64_file_func (voidpf  opaque, voidpf stream, ZPOS64_T offset, int origin)
@@ -198,16 +202,21 @@ static long ZCALLBACK fseek64_file_func (voidpf  opaque, voidpf stream, ZPOS64_T
     default: return -1;
     }
     ret = 0;
-
-    FSEEKO_FUNC(offset, fseek_origin);
-
+    try
+    {
+        FSEEKO_FUNC(stream, offset, fseek_origin);
+    }
+    catch (fsException& e)
+    {
+        ret = -1;
+    }
     return ret;
 }
 
 
 static int ZCALLBACK fclose_file_func (voidpf opaque, voidpf stream)
 {
-    _zipFile_.close();
+    delete (fs::File*)stream; // closes it
     return 0;
 }
 
@@ -74,6 +74,7 @@
 
 #include "zlib.h"
 #include "unzip.h"
+#include "crc32.h"
 
 #ifdef STDC
 #  include <stddef.h>
@@ -157,9 +158,39 @@ typedef struct
     uLong compression_method;   /* compression method (0==store) */
     ZPOS64_T byte_before_the_zipfile;/* byte before the zipfile, (>0 for sfx)*/
     int   raw;
+
+    ZPOS64_T offset_data;       /* position of the first byte of compressed data */
+    int   seeked;               /* crc32 only covers part of the data after a seek */
 } file_in_zip64_read_info_s;
 
 
+/* unz64_access_point contain what inflate needs to resume in the middle of a
+    deflated file : the position in both streams, the bits of the byte before
+    in that are still to be decoded, and the last 32K of uncompressed data */
+#define UNZ_WINDOW_SIZE (32768)
+
+typedef struct
+{
+    ZPOS64_T out;               /* offset in uncompressed data */
+    ZPOS64_T in;                /* offset in compressed data, from offset_data */
+    int bits;                   /* bits of the byte at in-1 still to be used */
+    uInt window_size;           /* valid bytes at the end of window */
+    unsigned char window[UNZ_WINDOW_SIZE];
+} unz64_access_point;
+
+typedef struct
+{
+    ZPOS64_T offset_curfile;    /* which file of the zipfile this is about */
+    uLong crc;
+    ZPOS64_T compressed_size;
+    ZPOS64_T uncompressed_size;
+    ZPOS64_T span;              /* distance between access points */
+    uLong count;
+    uLong capacity;
+    unz64_access_point* points;
+} unz64_access_index;
+
+
 /* unz64_s contain internal information about the zipfile
 */
 typedef struct
@@ -186,6 +217,8 @@ typedef struct
 
     int isZip64;
 
+    unz64_access_index* access_index; /* checkpoints for unzSeekCurrentFile64 */
+
 #    ifndef NOUNCRYPT
     unsigned long keys[3];     /* keys defining the pseudo-random sequence */
     const z_crc_t* pcrc_32_tab;
@@ -750,6 +783,7 @@ local unzFile unzOpenInternal (const void *path,
     us.central_pos = central_pos;
     us.pfile_in_zip_read = NULL;
     us.encrypted = 0;
+    us.access_index = NULL;
 
 
     s=(unz64_s*)ALLOC(sizeof(unz64_s));
@@ -815,6 +849,8 @@ extern int ZEXPORT unzClose (unzFile file)
     if (s->pfile_in_zip_read!=NULL)
         unzCloseCurrentFile(file);
 
+    unzFreeAccessIndex(file);
+
     ZCLOSE64(s->z_filefunc, s->filestream);
     TRYFREE(s);
     return UNZ_OK;
@@ -1606,6 +1642,8 @@ extern int ZEXPORT unzOpenCurrentFile3 (unzFile file, int* method,
     pfile_in_zip_read_info->pos_in_zipfile =
             s->cur_file_info_internal.offset_curfile + SIZEZIPLOCALHEADER +
               iSizeVar;
+    pfile_in_zip_read_info->offset_data = pfile_in_zip_read_info->pos_in_zipfile;
+    pfile_in_zip_read_info->seeked = 0;
 
     pfile_in_zip_read_info->stream.avail_in = (uInt)0;
 
@@ -1781,7 +1819,7 @@ extern int ZEXPORT unzReadCurrentFile  (unzFile file, voidp buf, unsigned len)
 
             pfile_in_zip_read_info->total_out_64 = pfile_in_zip_read_info->total_out_64 + uDoCopy;
 
-            pfile_in_zip_read_info->crc32 = crc32(pfile_in_zip_read_info->crc32,
+            pfile_in_zip_read_info->crc32 = CRC32::update(pfile_in_zip_read_info->crc32,
                                 pfile_in_zip_read_info->stream.next_out,
                                 uDoCopy);
             pfile_in_zip_read_info->rest_read_uncompressed-=uDoCopy;
@@ -1818,7 +1856,7 @@ extern int ZEXPORT unzReadCurrentFile  (unzFile file, voidp buf, unsigned len)
 
             pfile_in_zip_read_info->total_out_64 = pfile_in_zip_read_info->total_out_64 + uOutThis;
 
-            pfile_in_zip_read_info->crc32 = crc32(pfile_in_zip_read_info->crc32,bufBefore, (uInt)(uOutThis));
+            pfile_in_zip_read_info->crc32 = CRC32::update(pfile_in_zip_read_info->crc32,bufBefore, (uInt)(uOutThis));
             pfile_in_zip_read_info->rest_read_uncompressed -= uOutThis;
             iRead += (uInt)(uTotalOutAfter - uTotalOutBefore);
 
@@ -1862,7 +1900,7 @@ extern int ZEXPORT unzReadCurrentFile  (unzFile file, voidp buf, unsigned len)
             pfile_in_zip_read_info->total_out_64 = pfile_in_zip_read_info->total_out_64 + uOutThis;
 
             pfile_in_zip_read_info->crc32 =
-                crc32(pfile_in_zip_read_info->crc32,bufBefore,
+                CRC32::update(pfile_in_zip_read_info->crc32,bufBefore,
                         (uInt)(uOutThis));
 
             pfile_in_zip_read_info->rest_read_uncompressed -=
@@ -2017,7 +2055,8 @@ extern int ZEXPORT unzCloseCurrentFile (unzFile file)
 
 
     if ((pfile_in_zip_read_info->rest_read_uncompressed == 0) &&
-        (!pfile_in_zip_read_info->raw))
+        (!pfile_in_zip_read_info->raw) &&
+        (!pfile_in_zip_read_info->seeked))
     {
         if (pfile_in_zip_read_info->crc32 != pfile_in_zip_read_info->crc32_wait)
             err=UNZ_CRCERROR;
@@ -2043,6 +2082,538 @@ extern int ZEXPORT unzCloseCurrentFile (unzFile file)
 }
 
 
+/***************************************************************************/
+/* Random access into deflated files, after zran.c from the zlib examples.
+   unzBuildAccessIndex inflates the current file once and keeps an access
+   point every span bytes of uncompressed data; unzSeekCurrentFile64 then
+   only has to inflate from the closest access point before the target. */
+
+#define UNZ_INDEX_MAGIC   (0x31585a55) /* "UZX1" */
+
+local unz64_access_point* unz64local_addAccessPoint OF((
+    unz64_access_index* index,
+    ZPOS64_T out,
+    ZPOS64_T in,
+    int bits,
+    uInt left,
+    const unsigned char* window));
+
+local unz64_access_point* unz64local_addAccessPoint(unz64_access_index* index,
+                                                    ZPOS64_T out,
+                                                    ZPOS64_T in,
+                                                    int bits,
+                                                    uInt left,
+                                                    const unsigned char* window)
+{
+    unz64_access_point* point;
+
+    if (index->count == index->capacity)
+    {
+        uLong capacity = (index->capacity == 0) ? 8 : index->capacity * 2;
+        unz64_access_point* points = (unz64_access_point*)realloc(index->points,
+                                        capacity * sizeof(unz64_access_point));
+        if (points == NULL)
+            return NULL;
+        index->points = points;
+        index->capacity = capacity;
+    }
+
+    point = index->points + index->count++;
+    point->out = out;
+    point->in = in;
+    point->bits = bits;
+    point->window_size = (out < UNZ_WINDOW_SIZE) ? (uInt)out : UNZ_WINDOW_SIZE;
+    /* window is circular, left is the unused space at its end,
+       no window means the caller fills it */
+    if (window == NULL)
+        return point;
+    if (left)
+        memcpy(point->window, window + UNZ_WINDOW_SIZE - left, left);
+    if (left < UNZ_WINDOW_SIZE)
+        memcpy(point->window + left, window, UNZ_WINDOW_SIZE - left);
+    return point;
+}
+
+local unz64_access_index* unz64local_allocAccessIndex OF((unz64_s* s, ZPOS64_T span));
+
+local unz64_access_index* unz64local_allocAccessIndex(unz64_s* s, ZPOS64_T span)
+{
+    unz64_access_index* index = (unz64_access_index*)ALLOC(sizeof(unz64_access_index));
+    if (index == NULL)
+        return NULL;
+
+    index->offset_curfile = s->cur_file_info_internal.offset_curfile;
+    index->crc = s->cur_file_info.crc;
+    index->compressed_size = s->cur_file_info.compressed_size;
+    index->uncompressed_size = s->cur_file_info.uncompressed_size;
+    index->span = span;
+    index->count = 0;
+    index->capacity = 0;
+    index->points = NULL;
+    return index;
+}
+
+local void unz64local_freeAccessIndex OF((unz64_access_index* index));
+
+local void unz64local_freeAccessIndex(unz64_access_index* index)
+{
+    if (index == NULL)
+        return;
+    TRYFREE(index->points);
+    TRYFREE(index);
+}
+
+extern void ZEXPORT unzFreeAccessIndex (unzFile file)
+{
+    unz64_s* s;
+    if (file==NULL)
+        return;
+    s=(unz64_s*)file;
+
+    unz64local_freeAccessIndex(s->access_index);
+    s->access_index = NULL;
+}
+
+extern int ZEXPORT unzBuildAccessIndex (unzFile file, ZPOS64_T span)
+{
+    int err=UNZ_OK;
+    unz64_s* s;
+    file_in_zip64_read_info_s* pfile_in_zip_read_info;
+    unz64_access_index* index;
+    unsigned char* input;
+    unsigned char* window;
+    z_stream stream;
+    ZPOS64_T totin, totout, last;
+    ZPOS64_T pos, rest;
+    int ret;
+
+    if (file==NULL)
+        return UNZ_PARAMERROR;
+    s=(unz64_s*)file;
+    pfile_in_zip_read_info=s->pfile_in_zip_read;
+
+    if (pfile_in_zip_read_info==NULL || pfile_in_zip_read_info->raw || s->encrypted || span == 0)
+        return UNZ_PARAMERROR;
+
+    index = unz64local_allocAccessIndex(s, span);
+    if (index == NULL)
+        return UNZ_INTERNALERROR;
+
+    /* stored files are seeked without access points */
+    if (pfile_in_zip_read_info->compression_method != Z_DEFLATED)
+    {
+        unzFreeAccessIndex(file);
+        s->access_index = index;
+        return UNZ_OK;
+    }
+
+    input = (unsigned char*)ALLOC(UNZ_BUFSIZE);
+    window = (unsigned char*)ALLOC(UNZ_WINDOW_SIZE);
+    if (input == NULL || window == NULL)
+    {
+        TRYFREE(input);
+        TRYFREE(window);
+        unz64local_freeAccessIndex(index);
+        return UNZ_INTERNALERROR;
+    }
+
+    stream.zalloc = (alloc_func)0;
+    stream.zfree = (free_func)0;
+    stream.opaque = (voidpf)0;
+    stream.next_in = (Bytef*)0;
+    stream.avail_in = 0;
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+    {
+        TRYFREE(input);
+        TRYFREE(window);
+        unz64local_freeAccessIndex(index);
+        return UNZ_INTERNALERROR;
+    }
+
+    /* the inflate output goes round window so it always holds the last 32K,
+       access points are taken at the end of a block header */
+    totin = totout = last = 0;
+    pos = pfile_in_zip_read_info->offset_data;
+    rest = s->cur_file_info.compressed_size;
+    stream.avail_out = 0;
+    ret = Z_OK;
+    while (err==UNZ_OK && ret != Z_STREAM_END)
+    {
+        if (stream.avail_in == 0)
+        {
+            uInt uReadThis = UNZ_BUFSIZE;
+            if (rest == 0)
+            {
+                /* some writers end the file without a final block */
+                if (totout != s->cur_file_info.uncompressed_size)
+                    err = UNZ_BADZIPFILE;
+                break;
+            }
+            if (rest < uReadThis)
+                uReadThis = (uInt)rest;
+            if (ZSEEK64(s->z_filefunc, s->filestream,
+                        pos + s->byte_before_the_zipfile, ZLIB_FILEFUNC_SEEK_SET)!=0 ||
+                ZREAD64(s->z_filefunc, s->filestream, input, uReadThis)!=uReadThis)
+            {
+                err = UNZ_ERRNO;
+                break;
+            }
+            pos += uReadThis;
+            rest -= uReadThis;
+            stream.next_in = input;
+            stream.avail_in = uReadThis;
+        }
+
+        do
+        {
+            if (stream.avail_out == 0)
+            {
+                stream.avail_out = UNZ_WINDOW_SIZE;
+                stream.next_out = window;
+            }
+
+            totin += stream.avail_in;
+            totout += stream.avail_out;
+            ret = inflate(&stream, Z_BLOCK);
+            totin -= stream.avail_in;
+            totout -= stream.avail_out;
+            if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR)
+            {
+                err = UNZ_BADZIPFILE;
+                break;
+            }
+            if (ret == Z_MEM_ERROR)
+            {
+                err = UNZ_INTERNALERROR;
+                break;
+            }
+            if (ret == Z_STREAM_END)
+                break;
+
+            if ((stream.data_type & 128) && !(stream.data_type & 64) &&
+                (totout == 0 || totout - last > span))
+            {
+                if (unz64local_addAccessPoint(index, totout, totin, stream.data_type & 7,
+                                              stream.avail_out, window) == NULL)
+                {
+                    err = UNZ_INTERNALERROR;
+                    break;
+                }
+                last = totout;
+            }
+        } while (stream.avail_in != 0);
+    }
+
+    inflateEnd(&stream);
+    TRYFREE(input);
+    TRYFREE(window);
+
+    if (err != UNZ_OK)
+    {
+        unz64local_freeAccessIndex(index);
+        return err;
+    }
+
+    unzFreeAccessIndex(file);
+    s->access_index = index;
+    return UNZ_OK;
+}
+
+local void unz64local_putValue OF((unsigned char* dest, ZPOS64_T x, int nbByte));
+
+local void unz64local_putValue (unsigned char* dest, ZPOS64_T x, int nbByte)
+{
+    int n;
+    for (n = 0; n < nbByte; n++)
+    {
+        dest[n] = (unsigned char)(x & 0xff);
+        x >>= 8;
+    }
+}
+
+extern int ZEXPORT unzSaveAccessIndex (unzFile file, const void* path)
+{
+    int err=UNZ_OK;
+    unz64_s* s;
+    unz64_access_index* index;
+    voidpf stream;
+    unsigned char header[44];
+    uLong i;
+
+    if (file==NULL)
+        return UNZ_PARAMERROR;
+    s=(unz64_s*)file;
+    index=s->access_index;
+
+    if (index==NULL)
+        return UNZ_PARAMERROR;
+
+    stream = ZOPEN64(s->z_filefunc, path,
+                     ZLIB_FILEFUNC_MODE_WRITE | ZLIB_FILEFUNC_MODE_CREATE);
+    if (stream == NULL)
+        return UNZ_ERRNO;
+
+    unz64local_putValue(header, UNZ_INDEX_MAGIC, 4);
+    unz64local_putValue(header + 4, index->offset_curfile, 8);
+    unz64local_putValue(header + 12, index->crc, 4);
+    unz64local_putValue(header + 16, index->compressed_size, 8);
+    unz64local_putValue(header + 24, index->uncompressed_size, 8);
+    unz64local_putValue(header + 32, index->span, 8);
+    unz64local_putValue(header + 40, index->count, 4);
+    if (ZWRITE64(s->z_filefunc, stream, header, 44) != 44)
+        err = UNZ_ERRNO;
+
+    /* only the valid part of each window is written */
+    for (i = 0; i < index->count && err==UNZ_OK; i++)
+    {
+        const unz64_access_point* point = index->points + i;
+        unz64local_putValue(header, point->out, 8);
+        unz64local_putValue(header + 8, point->in, 8);
+        unz64local_putValue(header + 16, (ZPOS64_T)point->bits, 1);
+        unz64local_putValue(header + 17, point->window_size, 4);
+        if (ZWRITE64(s->z_filefunc, stream, header, 21) != 21 ||
+            ZWRITE64(s->z_filefunc, stream,
+                     point->window + UNZ_WINDOW_SIZE - point->window_size,
+                     point->window_size) != point->window_size)
+            err = UNZ_ERRNO;
+    }
+
+    if (ZCLOSE64(s->z_filefunc, stream) != 0 && err==UNZ_OK)
+        err = UNZ_ERRNO;
+    return err;
+}
+
+extern int ZEXPORT unzLoadAccessIndex (unzFile file, const void* path)
+{
+    int err=UNZ_OK;
+    unz64_s* s;
+    unz64_access_index* index;
+    voidpf stream;
+    uLong uMagic, uCrc, uCount, uL, i;
+    ZPOS64_T uOffset, uCompressed, uUncompressed, uSpan;
+    int iBits;
+
+    if (file==NULL)
+        return UNZ_PARAMERROR;
+    s=(unz64_s*)file;
+
+    if (!s->current_file_ok)
+        return UNZ_PARAMERROR;
+
+    stream = ZOPEN64(s->z_filefunc, path,
+                     ZLIB_FILEFUNC_MODE_READ | ZLIB_FILEFUNC_MODE_EXISTING);
+    if (stream == NULL)
+        return UNZ_ERRNO;
+
+    if (unz64local_getLong(&s->z_filefunc, stream, &uMagic) != UNZ_OK ||
+        unz64local_getLong64(&s->z_filefunc, stream, &uOffset) != UNZ_OK ||
+        unz64local_getLong(&s->z_filefunc, stream, &uCrc) != UNZ_OK ||
+        unz64local_getLong64(&s->z_filefunc, stream, &uCompressed) != UNZ_OK ||
+        unz64local_getLong64(&s->z_filefunc, stream, &uUncompressed) != UNZ_OK ||
+        unz64local_getLong64(&s->z_filefunc, stream, &uSpan) != UNZ_OK ||
+        unz64local_getLong(&s->z_filefunc, stream, &uCount) != UNZ_OK)
+        err = UNZ_ERRNO;
+
+    /* an index left over from another file, or another version of the zipfile */
+    if (err==UNZ_OK &&
+        (uMagic != UNZ_INDEX_MAGIC ||
+         uOffset != s->cur_file_info_internal.offset_curfile ||
+         uCrc != s->cur_file_info.crc ||
+         uCompressed != s->cur_file_info.compressed_size ||
+         uUncompressed != s->cur_file_info.uncompressed_size))
+        err = UNZ_BADZIPFILE;
+
+    index = NULL;
+    if (err==UNZ_OK)
+    {
+        index = unz64local_allocAccessIndex(s, uSpan);
+        if (index == NULL)
+            err = UNZ_INTERNALERROR;
+    }
+
+    for (i = 0; i < uCount && err==UNZ_OK; i++)
+    {
+        unz64_access_point* point;
+        ZPOS64_T uOut, uIn;
+
+        if (unz64local_getLong64(&s->z_filefunc, stream, &uOut) != UNZ_OK ||
+            unz64local_getLong64(&s->z_filefunc, stream, &uIn) != UNZ_OK ||
+            unz64local_getByte(&s->z_filefunc, stream, &iBits) != UNZ_OK ||
+            unz64local_getLong(&s->z_filefunc, stream, &uL) != UNZ_OK)
+        {
+            err = UNZ_ERRNO;
+            break;
+        }
+        if (uOut > uUncompressed || uIn > uCompressed || iBits > 7 ||
+            uL > UNZ_WINDOW_SIZE || (uIn == 0 && iBits != 0))
+        {
+            err = UNZ_BADZIPFILE;
+            break;
+        }
+
+        point = unz64local_addAccessPoint(index, uOut, uIn, iBits, 0, NULL);
+        if (point == NULL)
+        {
+            err = UNZ_INTERNALERROR;
+            break;
+        }
+        point->window_size = (uInt)uL;
+        if (ZREAD64(s->z_filefunc, stream,
+                    point->window + UNZ_WINDOW_SIZE - uL, uL) != uL)
+            err = UNZ_ERRNO;
+    }
+
+    ZCLOSE64(s->z_filefunc, stream);
+
+    if (err != UNZ_OK)
+    {
+        unz64local_freeAccessIndex(index);
+        return err;
+    }
+
+    unzFreeAccessIndex(file);
+    s->access_index = index;
+    return UNZ_OK;
+}
+
+/* Restart inflate at out bytes of uncompressed data, in bytes after the start
+   of the compressed data. The window must hold the 32K before out. */
+local int unz64local_resumeAt OF((
+    unz64_s* s,
+    ZPOS64_T out,
+    ZPOS64_T in,
+    int bits,
+    const unsigned char* window,
+    uInt window_size));
+
+local int unz64local_resumeAt (unz64_s* s,
+                               ZPOS64_T out,
+                               ZPOS64_T in,
+                               int bits,
+                               const unsigned char* window,
+                               uInt window_size)
+{
+    file_in_zip64_read_info_s* pfile_in_zip_read_info=s->pfile_in_zip_read;
+
+    if (pfile_in_zip_read_info->stream_initialised == Z_DEFLATED &&
+        inflateReset(&pfile_in_zip_read_info->stream) != Z_OK)
+        return UNZ_INTERNALERROR;
+
+    if (bits)
+    {
+        int ch;
+        if (ZSEEK64(s->z_filefunc, s->filestream,
+                    pfile_in_zip_read_info->offset_data + in - 1 +
+                        pfile_in_zip_read_info->byte_before_the_zipfile,
+                    ZLIB_FILEFUNC_SEEK_SET)!=0 ||
+            unz64local_getByte(&s->z_filefunc, s->filestream, &ch) != UNZ_OK)
+            return UNZ_ERRNO;
+        if (inflatePrime(&pfile_in_zip_read_info->stream, bits, ch >> (8 - bits)) != Z_OK)
+            return UNZ_INTERNALERROR;
+    }
+    if (window_size &&
+        inflateSetDictionary(&pfile_in_zip_read_info->stream, window, window_size) != Z_OK)
+        return UNZ_INTERNALERROR;
+
+    pfile_in_zip_read_info->pos_in_zipfile = pfile_in_zip_read_info->offset_data + in;
+    pfile_in_zip_read_info->rest_read_compressed = s->cur_file_info.compressed_size - in;
+    pfile_in_zip_read_info->rest_read_uncompressed = s->cur_file_info.uncompressed_size - out;
+    pfile_in_zip_read_info->total_out_64 = out;
+    pfile_in_zip_read_info->stream.total_out = (uLong)out;
+    pfile_in_zip_read_info->stream.avail_in = 0;
+    pfile_in_zip_read_info->crc32 = 0;
+    pfile_in_zip_read_info->seeked = (out != 0);
+    return UNZ_OK;
+}
+
+extern int ZEXPORT unzSeekCurrentFile64 (unzFile file, ZPOS64_T pos)
+{
+    int err=UNZ_OK;
+    unz64_s* s;
+    file_in_zip64_read_info_s* pfile_in_zip_read_info;
+    const unz64_access_point* point = NULL;
+    char* buf;
+
+    if (file==NULL)
+        return UNZ_PARAMERROR;
+    s=(unz64_s*)file;
+    pfile_in_zip_read_info=s->pfile_in_zip_read;
+
+    if (pfile_in_zip_read_info==NULL || pfile_in_zip_read_info->raw)
+        return UNZ_PARAMERROR;
+    if (pos > s->cur_file_info.uncompressed_size)
+        return UNZ_PARAMERROR;
+    if (pos == pfile_in_zip_read_info->total_out_64)
+        return UNZ_OK;
+
+    if (pfile_in_zip_read_info->compression_method==0)
+    {
+        if (s->encrypted)
+            return UNZ_PARAMERROR;
+        return unz64local_resumeAt(s, pos, pos, 0, NULL, 0);
+    }
+    if (pfile_in_zip_read_info->compression_method!=Z_DEFLATED)
+        return UNZ_PARAMERROR;
+
+    if (s->access_index != NULL &&
+        s->access_index->offset_curfile == s->cur_file_info_internal.offset_curfile)
+    {
+        /* last access point at or before pos */
+        uLong lo = 0, hi = s->access_index->count;
+        while (lo < hi)
+        {
+            uLong mid = lo + (hi - lo) / 2;
+            if (s->access_index->points[mid].out <= pos)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo > 0)
+            point = s->access_index->points + lo - 1;
+    }
+
+    /* only jump when that is closer than inflating on from here */
+    if (point != NULL &&
+        (pos < pfile_in_zip_read_info->total_out_64 ||
+         point->out > pfile_in_zip_read_info->total_out_64))
+    {
+        if (s->encrypted)
+            return UNZ_PARAMERROR;
+        err = unz64local_resumeAt(s, point->out, point->in, point->bits,
+                                  point->window + UNZ_WINDOW_SIZE - point->window_size,
+                                  point->window_size);
+    }
+    else if (pos < pfile_in_zip_read_info->total_out_64)
+    {
+        if (s->encrypted)
+            return UNZ_PARAMERROR;
+        err = unz64local_resumeAt(s, 0, 0, 0, NULL, 0);
+    }
+    if (err != UNZ_OK)
+        return err;
+
+    if (pfile_in_zip_read_info->total_out_64 == pos)
+        return UNZ_OK;
+
+    buf = (char*)ALLOC(UNZ_BUFSIZE);
+    if (buf == NULL)
+        return UNZ_INTERNALERROR;
+    while (pfile_in_zip_read_info->total_out_64 < pos)
+    {
+        ZPOS64_T uSkip = pos - pfile_in_zip_read_info->total_out_64;
+        int iRead = unzReadCurrentFile(file, buf,
+                        (uSkip < UNZ_BUFSIZE) ? (unsigned)uSkip : UNZ_BUFSIZE);
+        if (iRead <= 0)
+        {
+            err = (iRead == 0) ? UNZ_BADZIPFILE : iRead;
+            break;
+        }
+    }
+    TRYFREE(buf);
+    return err;
+}
+
+
 /*
   Get the global comment string of the ZipFile, in the szComment buffer.
   uSizeBuf is the size of the szComment buffer.
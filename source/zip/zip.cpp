@@ -28,6 +28,13 @@
 #include <time.h>
 #include "zlib.h"
 #include "zip.h"
+#include "crc32.h"
+
+#include <3ds.h>
+#ifndef _3DS
+#  include <new>
+#  include <thread>
+#endif
 
 #ifdef STDC
 #  include <stddef.h>
@@ -98,7 +105,7 @@
 const char zip_copyright[] =" zip 1.01 Copyright 1998-2004 Gilles Vollant - http://www.winimage.com/zLibDll";
 
 
-#define SIZEDATA_INDATABLOCK (4096-(4*4))
+#define CENTRALDIR_ARENA_MIN (64*1024) /* first allocation of the central dir arena */
 
 #define LOCALHEADERMAGIC    (0x04034b50)
 #define CENTRALHEADERMAGIC  (0x02014b50)
@@ -111,21 +118,58 @@ const char zip_copyright[] =" zip 1.01 Copyright 1998-2004 Gilles Vollant - http
 
 #define SIZECENTRALHEADER (0x2e) /* 46 */
 
-typedef struct linkedlist_datablock_internal_s
+/* parallel deflate (see zipSetParallelDeflate) */
+#define PDEFLATE_MAX_THREADS     (8)
+#define PDEFLATE_DEF_BLOCK_SIZE  (128*1024)
+#define PDEFLATE_DICT_SIZE       (32768)
+#define PDEFLATE_STACK_SIZE      (0x4000)
+
+/* adaptive store/deflate (see zipSetAdaptiveStore) */
+#define ADAPTIVE_DEF_SAMPLE_SIZE (128*1024)
+#define ADAPTIVE_DEF_MAX_RATIO   (95)
+#define ADAPTIVE_TRIAL_LEVEL     (1)
+
+/* The central directory is built in one growable buffer. The header of the file
+   currently written lives in the unused tail and is committed on close. */
+typedef struct centraldir_arena_s
 {
-  struct linkedlist_datablock_internal_s* next_datablock;
-  uLong  avail_in_this_block;
-  uLong  filled_in_this_block;
-  uLong  unused; /* for future use and alignement */
-  unsigned char data[SIZEDATA_INDATABLOCK];
-} linkedlist_datablock_internal;
-
-typedef struct linkedlist_data_s
+    unsigned char* data;
+    uLong size;             /* committed bytes */
+    uLong capacity;         /* allocated bytes */
+} centraldir_arena;
+
+
+typedef struct
 {
-    linkedlist_datablock_internal* first_block;
-    linkedlist_datablock_internal* last_block;
-} linkedlist_data;
+    z_stream stream;            /* deflate stream of this worker, reset per block */
+    const Bytef* in;            /* block to compress */
+    uInt in_size;
+    uInt dict_size;             /* bytes right before in used as dictionary */
+    Bytef* out;                 /* compressed block, ends with a sync flush */
+    uInt out_capacity;
+    uInt out_size;
+    uLong crc32;                /* crc32 of this block only */
+    int err;
+#ifdef _3DS
+    Thread thread;              /* worker of this job, NULL for the caller's job */
+#else
+    std::thread* thread;
+#endif
+    LightEvent go;              /* a block (or quit) handed to the worker */
+    LightEvent done;            /* the worker finished the block */
+    int quit;
+} pdeflate_job;
 
+typedef struct
+{
+    int threads;
+    int started;                /* 1 once the workers run, entries under one batch never start them */
+    uInt block_size;
+    Bytef* window;              /* PDEFLATE_DICT_SIZE bytes of history followed by the batch */
+    uInt dict_size;             /* valid history bytes right before the batch */
+    uInt filled;                /* bytes in the batch */
+    pdeflate_job jobs[PDEFLATE_MAX_THREADS];
+} pdeflate_state;
 
 typedef struct
 {
@@ -139,7 +183,7 @@ typedef struct
 
     ZPOS64_T pos_local_header;     /* offset of the local header of the file
                                      currenty writing */
-    char* central_header;       /* central header data for the current file */
+    char* central_header;       /* central header data for the current file (arena tail) */
     uLong size_centralExtra;
     uLong size_centralheader;   /* size of the central header for cur file */
     uLong size_centralExtraFree; /* Extra bytes allocated to the centralheader but that are not used */
@@ -147,6 +191,14 @@ typedef struct
 
     int  method;                /* compression method of file currenty wr.*/
     int  raw;                   /* 1 for directly writing raw data */
+    pdeflate_state* pdeflate;   /* parallel deflate of this file, NULL for the single stream */
+    Bytef* sample;              /* first bytes of the file while store/deflate is undecided */
+    uInt sample_size;
+    int  level;                 /* deflate parameters, kept for the deferred init */
+    int  windowBits;
+    int  memLevel;
+    int  strategy;
+    int  method_changed;        /* 1 if the local header needs the final method/flag */
     Byte buffered_data[Z_BUFSIZE];/* buffer contain compressed data to be writ*/
     uLong dosDate;
     uLong crc32;
@@ -166,7 +218,7 @@ typedef struct
 {
     zlib_filefunc64_32_def z_filefunc;
     voidpf filestream;        /* io structore of the zipfile */
-    linkedlist_data central_dir;/* datablock with central dir in construction*/
+    centraldir_arena central_dir;/* central dir in construction */
     int  in_opened_file_inzip;  /* 1 if a file in the zip is currently writ.*/
     curfile64_info ci;            /* info on the file curretly writing */
 
@@ -174,6 +226,14 @@ typedef struct
     ZPOS64_T add_position_when_writting_offset;
     ZPOS64_T number_entry;
 
+    int  pdeflate_threads;      /* >1 deflates new files with that many workers */
+    uInt pdeflate_block_size;
+#ifdef _3DS
+    s32  pdeflate_cores[PDEFLATE_MAX_THREADS]; /* core of worker i+1, the caller is worker 0 */
+#endif
+    uInt adaptive_sample_size;  /* >0 samples deflated files and stores them if they don't shrink */
+    int  adaptive_max_ratio;    /* store if compressed sample > this percentage of the sample */
+
 #ifndef NO_ADDFILEINEXISTINGZIP
     char *globalcomment;
 #endif
@@ -186,90 +246,38 @@ typedef struct
 #include "crypt.h"
 #endif
 
-local linkedlist_datablock_internal* allocate_new_datablock()
+local void init_arena(centraldir_arena* arena)
 {
-    linkedlist_datablock_internal* ldi;
-    ldi = (linkedlist_datablock_internal*)
-                 ALLOC(sizeof(linkedlist_datablock_internal));
-    if (ldi!=NULL)
-    {
-        ldi->next_datablock = NULL ;
-        ldi->filled_in_this_block = 0 ;
-        ldi->avail_in_this_block = SIZEDATA_INDATABLOCK ;
-    }
-    return ldi;
+    arena->data = NULL;
+    arena->size = arena->capacity = 0;
 }
 
-local void free_datablock(linkedlist_datablock_internal* ldi)
+local void free_arena(centraldir_arena* arena)
 {
-    while (ldi!=NULL)
-    {
-        linkedlist_datablock_internal* ldinext = ldi->next_datablock;
-        TRYFREE(ldi);
-        ldi = ldinext;
-    }
+    TRYFREE(arena->data);
+    init_arena(arena);
 }
 
-local void init_linkedlist(linkedlist_data* ll)
+/* Make room for len more bytes after the committed data, growing geometrically */
+local int reserve_in_arena(centraldir_arena* arena, uLong len)
 {
-    ll->first_block = ll->last_block = NULL;
-}
+    uLong needed = arena->size + len;
+    uLong capacity;
+    unsigned char* data;
 
-local void free_linkedlist(linkedlist_data* ll)
-{
-    free_datablock(ll->first_block);
-    ll->first_block = ll->last_block = NULL;
-}
+    if (needed <= arena->capacity)
+        return ZIP_OK;
 
+    capacity = (arena->capacity < CENTRALDIR_ARENA_MIN) ? CENTRALDIR_ARENA_MIN : arena->capacity;
+    while (capacity < needed)
+        capacity *= 2;
 
-local int add_data_in_datablock(linkedlist_data* ll, const void* buf, uLong len)
-{
-    linkedlist_datablock_internal* ldi;
-    const unsigned char* from_copy;
-
-    if (ll==NULL)
+    data = (unsigned char*)realloc(arena->data, capacity);
+    if (data == NULL)
         return ZIP_INTERNALERROR;
 
-    if (ll->last_block == NULL)
-    {
-        ll->first_block = ll->last_block = allocate_new_datablock();
-        if (ll->first_block == NULL)
-            return ZIP_INTERNALERROR;
-    }
-
-    ldi = ll->last_block;
-    from_copy = (unsigned char*)buf;
-
-    while (len>0)
-    {
-        uInt copy_this;
-        uInt i;
-        unsigned char* to_copy;
-
-        if (ldi->avail_in_this_block==0)
-        {
-            ldi->next_datablock = allocate_new_datablock();
-            if (ldi->next_datablock == NULL)
-                return ZIP_INTERNALERROR;
-            ldi = ldi->next_datablock ;
-            ll->last_block = ldi;
-        }
-
-        if (ldi->avail_in_this_block < len)
-            copy_this = (uInt)ldi->avail_in_this_block;
-        else
-            copy_this = (uInt)len;
-
-        to_copy = &(ldi->data[ldi->filled_in_this_block]);
-
-        for (i=0;i<copy_this;i++)
-            *(to_copy+i)=*(from_copy+i);
-
-        ldi->filled_in_this_block += copy_this;
-        ldi->avail_in_this_block -= copy_this;
-        from_copy += copy_this ;
-        len -= copy_this;
-    }
+    arena->data = data;
+    arena->capacity = capacity;
     return ZIP_OK;
 }
 
@@ -809,28 +817,22 @@ int LoadCentralDirectoryRecord(zip64_internal* pziinit)
   byte_before_the_zipfile = central_pos - (offset_central_dir+size_central_dir);
   pziinit->add_position_when_writting_offset = byte_before_the_zipfile;
 
-  {
-    ZPOS64_T size_central_dir_to_read = size_central_dir;
-    size_t buf_size = SIZEDATA_INDATABLOCK;
-    void* buf_read = (void*)ALLOC(buf_size);
-    if (ZSEEK64(pziinit->z_filefunc, pziinit->filestream, offset_central_dir + byte_before_the_zipfile, ZLIB_FILEFUNC_SEEK_SET) != 0)
-      err=ZIP_ERRNO;
-
-    while ((size_central_dir_to_read>0) && (err==ZIP_OK))
-    {
-      ZPOS64_T read_this = SIZEDATA_INDATABLOCK;
-      if (read_this > size_central_dir_to_read)
-        read_this = size_central_dir_to_read;
+  // read the existing central dir straight into the arena
+  if ((uLong)size_central_dir != size_central_dir)
+    err=ZIP_BADZIPFILE;
 
-      if (ZREAD64(pziinit->z_filefunc, pziinit->filestream,buf_read,(uLong)read_this) != read_this)
-        err=ZIP_ERRNO;
+  if (err==ZIP_OK)
+    err = reserve_in_arena(&pziinit->central_dir, (uLong)size_central_dir);
 
-      if (err==ZIP_OK)
-        err = add_data_in_datablock(&pziinit->central_dir,buf_read, (uLong)read_this);
+  if ((err==ZIP_OK) && (ZSEEK64(pziinit->z_filefunc, pziinit->filestream, offset_central_dir + byte_before_the_zipfile, ZLIB_FILEFUNC_SEEK_SET) != 0))
+    err=ZIP_ERRNO;
 
-      size_central_dir_to_read-=read_this;
-    }
-    TRYFREE(buf_read);
+  if ((err==ZIP_OK) && (size_central_dir>0))
+  {
+    if (ZREAD64(pziinit->z_filefunc, pziinit->filestream, pziinit->central_dir.data, (uLong)size_central_dir) != size_central_dir)
+      err=ZIP_ERRNO;
+    else
+      pziinit->central_dir.size = (uLong)size_central_dir;
   }
   pziinit->begin_pos = byte_before_the_zipfile;
   pziinit->number_entry = number_entry_CD;
@@ -876,7 +878,13 @@ extern zipFile ZEXPORT zipOpen3 (const void *pathname, int append, zipcharpc* gl
     ziinit.ci.stream_initialised = 0;
     ziinit.number_entry = 0;
     ziinit.add_position_when_writting_offset = 0;
-    init_linkedlist(&(ziinit.central_dir));
+    ziinit.ci.pdeflate = NULL;
+    ziinit.pdeflate_threads = 1;
+    ziinit.pdeflate_block_size = PDEFLATE_DEF_BLOCK_SIZE;
+    ziinit.ci.sample = NULL;
+    ziinit.adaptive_sample_size = 0;
+    ziinit.adaptive_max_ratio = ADAPTIVE_DEF_MAX_RATIO;
+    init_arena(&(ziinit.central_dir));
 
 
 
@@ -907,6 +915,7 @@ extern zipFile ZEXPORT zipOpen3 (const void *pathname, int append, zipcharpc* gl
 #    ifndef NO_ADDFILEINEXISTINGZIP
         TRYFREE(ziinit.globalcomment);
 #    endif /* !NO_ADDFILEINEXISTINGZIP*/
+        free_arena(&ziinit.central_dir);
         TRYFREE(zi);
         return NULL;
     }
@@ -955,6 +964,468 @@ extern zipFile ZEXPORT zipOpen64 (const void* pathname, int append)
     return zipOpen3(pathname,append,NULL,NULL);
 }
 
+extern int ZEXPORT zipSetParallelDeflate (zipFile file, int threads, uLong blockSize)
+{
+    zip64_internal* zi;
+
+    if (file == NULL)
+        return ZIP_PARAMERROR;
+    zi = (zip64_internal*)file;
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > PDEFLATE_MAX_THREADS)
+        threads = PDEFLATE_MAX_THREADS;
+    if (blockSize == 0)
+        blockSize = PDEFLATE_DEF_BLOCK_SIZE;
+    if (blockSize < PDEFLATE_DICT_SIZE)
+        blockSize = PDEFLATE_DICT_SIZE;
+
+#ifdef _3DS
+    {
+        // A worker on the caller's core only takes turns with it. The app core stays
+        // with the caller, workers go to core 2 of a New 3DS and to the syscore when
+        // the app was given time on it (APT_SetAppCpuTimeLimit). No such core: serial.
+        int cores = 0;
+        u8 isNew3DS = 0;
+        u32 percent = 0;
+
+        APT_CheckNew3DS(&isNew3DS);
+        if (isNew3DS)
+            zi->pdeflate_cores[cores++] = 2;
+        if (R_SUCCEEDED(APT_GetAppCpuTimeLimit(&percent)) && (percent > 0))
+            zi->pdeflate_cores[cores++] = 1;
+        if (threads > cores + 1)
+            threads = cores + 1;
+    }
+#endif
+
+    zi->pdeflate_threads = threads;
+    zi->pdeflate_block_size = (uInt)blockSize;
+
+    // workers may hash concurrently, pick the CRC kernel now
+    CRC32::selectKernel();
+    return ZIP_OK;
+}
+
+local void pdeflate_free(pdeflate_state* pd)
+{
+    int i;
+
+    if (pd == NULL)
+        return;
+    for (i=0;i<pd->threads;i++)
+    {
+        pdeflate_job* job = &pd->jobs[i];
+
+        if (job->thread != NULL)
+        {
+            job->quit = 1;
+            LightEvent_Signal(&job->go);
+#ifdef _3DS
+            threadJoin(job->thread, U64_MAX);
+            threadFree(job->thread);
+#else
+            job->thread->join();
+            delete job->thread;
+#endif
+        }
+        if (job->out != NULL)
+            deflateEnd(&job->stream);
+        TRYFREE(job->out);
+    }
+    TRYFREE(pd->window);
+    TRYFREE(pd);
+}
+
+local int pdeflate_init_job(pdeflate_job* job, uInt block_size, int level, int windowBits, int memLevel, int strategy)
+{
+    if (windowBits>0)
+        windowBits = -windowBits;
+    if (deflateInit2(&job->stream, level, Z_DEFLATED, windowBits, memLevel, strategy) != Z_OK)
+        return ZIP_INTERNALERROR;
+
+    // deflateBound() covers Z_FINISH, leave room for the sync flush marker
+    job->out_capacity = (uInt)deflateBound(&job->stream, block_size) + 64;
+    job->out = (Bytef*)ALLOC(job->out_capacity);
+    if (job->out == NULL)
+    {
+        deflateEnd(&job->stream);
+        return ZIP_INTERNALERROR;
+    }
+
+    return ZIP_OK;
+}
+
+/* Only the batch buffer and the caller's stream, the workers start with the first full batch */
+local pdeflate_state* pdeflate_alloc(int threads, uInt block_size, int level, int windowBits, int memLevel, int strategy)
+{
+    pdeflate_state* pd;
+
+    pd = (pdeflate_state*)ALLOC(sizeof(pdeflate_state));
+    if (pd == NULL)
+        return NULL;
+    memset(pd, 0, sizeof(pdeflate_state));
+    pd->threads = threads;
+    pd->block_size = block_size;
+
+    pd->window = (Bytef*)ALLOC(PDEFLATE_DICT_SIZE + (uLong)threads * block_size);
+    if ((pd->window == NULL) || (pdeflate_init_job(&pd->jobs[0], block_size, level, windowBits, memLevel, strategy) != ZIP_OK))
+    {
+        pdeflate_free(pd);
+        return NULL;
+    }
+
+    return pd;
+}
+
+local void pdeflate_compress(pdeflate_job* job)
+{
+    z_stream* stream = &job->stream;
+    int err;
+
+    job->crc32 = CRC32::update(0, job->in, job->in_size);
+
+    err = deflateReset(stream);
+    if ((err == Z_OK) && (job->dict_size > 0))
+        err = deflateSetDictionary(stream, job->in - job->dict_size, job->dict_size);
+
+    stream->next_in = (Bytef*)job->in;
+    stream->avail_in = job->in_size;
+    stream->next_out = job->out;
+    stream->avail_out = job->out_capacity;
+
+    // Z_SYNC_FLUSH byte aligns the block so the blocks can simply be concatenated
+    if (err == Z_OK)
+        err = deflate(stream, Z_SYNC_FLUSH);
+
+    job->out_size = job->out_capacity - stream->avail_out;
+    job->err = ((err == Z_OK) && (stream->avail_in == 0)) ? ZIP_OK : ZIP_INTERNALERROR;
+}
+
+/* A worker lives as long as the file, it sleeps between the batches */
+#ifdef _3DS
+local void pdeflate_worker(void* arg)
+#else
+local void pdeflate_worker(pdeflate_job* arg)
+#endif
+{
+    pdeflate_job* job = (pdeflate_job*)arg;
+
+    for (;;)
+    {
+        LightEvent_Wait(&job->go);
+        if (job->quit)
+            break;
+        pdeflate_compress(job);
+        LightEvent_Signal(&job->done);
+    }
+}
+
+/* The file has at least one full batch: start a worker per job but the caller's. A worker
+   that can't be started leaves its block to the caller, every batch. */
+local int pdeflate_start(zip64_internal* zi)
+{
+    pdeflate_state* pd = zi->ci.pdeflate;
+    int i;
+#ifdef _3DS
+    s32 prio = 0x30;
+
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+#endif
+
+    pd->started = 1;
+    for (i=1;i<pd->threads;i++)
+    {
+        pdeflate_job* job = &pd->jobs[i];
+
+        if (pdeflate_init_job(job, pd->block_size, zi->ci.level, zi->ci.windowBits, zi->ci.memLevel, zi->ci.strategy) != ZIP_OK)
+            return ZIP_INTERNALERROR;
+
+        LightEvent_Init(&job->go, RESET_ONESHOT);
+        LightEvent_Init(&job->done, RESET_ONESHOT);
+#ifdef _3DS
+        job->thread = threadCreate(pdeflate_worker, job, PDEFLATE_STACK_SIZE, prio, zi->pdeflate_cores[i-1], false);
+#else
+        try
+        {
+            job->thread = new (std::nothrow) std::thread(pdeflate_worker, job);
+        }
+        catch (...) {}
+#endif
+    }
+
+    return ZIP_OK;
+}
+
+/* Compress the buffered batch, one block per worker, and write it in order */
+local int pdeflate_flush_batch(zip64_internal* zi)
+{
+    pdeflate_state* pd = zi->ci.pdeflate;
+    Bytef* batch = pd->window + PDEFLATE_DICT_SIZE;
+    uInt offset, keep;
+    int count = 0;
+    int i;
+    int err = ZIP_OK;
+
+    if (pd->filled == 0)
+        return ZIP_OK;
+
+    for (offset=0;offset<pd->filled;offset+=pd->block_size)
+    {
+        pdeflate_job* job = &pd->jobs[count++];
+        uInt history = offset + pd->dict_size;
+
+        if (job->out == NULL) // its stream couldn't be set up in pdeflate_start()
+            return ZIP_INTERNALERROR;
+        job->in = batch + offset;
+        job->in_size = (pd->filled - offset < pd->block_size) ? pd->filled - offset : pd->block_size;
+        job->dict_size = (history < PDEFLATE_DICT_SIZE) ? history : PDEFLATE_DICT_SIZE;
+    }
+
+    // The calling thread takes the first block
+    for (i=1;i<count;i++)
+        if (pd->jobs[i].thread != NULL)
+            LightEvent_Signal(&pd->jobs[i].go);
+    pdeflate_compress(&pd->jobs[0]);
+    for (i=1;i<count;i++)
+    {
+        if (pd->jobs[i].thread != NULL)
+            LightEvent_Wait(&pd->jobs[i].done);
+        else
+            pdeflate_compress(&pd->jobs[i]);
+    }
+
+    for (i=0;i<count;i++)
+    {
+        pdeflate_job* job = &pd->jobs[i];
+
+        if ((err == ZIP_OK) && (job->err != ZIP_OK))
+            err = job->err;
+        if ((err == ZIP_OK) && (ZWRITE64(zi->z_filefunc,zi->filestream,job->out,job->out_size) != job->out_size))
+            err = ZIP_ERRNO;
+
+        zi->ci.crc32 = CRC32::combine(zi->ci.crc32, job->crc32, job->in_size);
+        zi->ci.totalCompressedData += job->out_size;
+        zi->ci.totalUncompressedData += job->in_size;
+    }
+
+    // keep the last 32 KB as dictionary for the next batch
+    keep = pd->filled + pd->dict_size;
+    if (keep > PDEFLATE_DICT_SIZE)
+        keep = PDEFLATE_DICT_SIZE;
+    memmove(batch - keep, batch + pd->filled - keep, keep);
+    pd->dict_size = keep;
+    pd->filled = 0;
+
+    return err;
+}
+
+/* A file shorter than one batch: the caller's stream deflates it in one go, no workers */
+local int pdeflate_single(zip64_internal* zi)
+{
+    pdeflate_state* pd = zi->ci.pdeflate;
+    pdeflate_job* job = &pd->jobs[0];
+    z_stream* stream = &job->stream;
+    int zerr = Z_OK;
+    int err = ZIP_OK;
+
+    stream->next_in = pd->window + PDEFLATE_DICT_SIZE;
+    stream->avail_in = pd->filled;
+    while ((err == ZIP_OK) && (zerr == Z_OK))
+    {
+        uInt out_size;
+
+        stream->next_out = job->out;
+        stream->avail_out = job->out_capacity;
+        zerr = deflate(stream, Z_FINISH);
+        if ((zerr != Z_OK) && (zerr != Z_STREAM_END))
+            err = ZIP_INTERNALERROR;
+
+        out_size = job->out_capacity - stream->avail_out;
+        if ((err == ZIP_OK) && (ZWRITE64(zi->z_filefunc,zi->filestream,job->out,out_size) != out_size))
+            err = ZIP_ERRNO;
+        zi->ci.totalCompressedData += out_size;
+    }
+
+    zi->ci.stream.data_type = stream->data_type; // text flag of the central header, as the single stream sets it
+    zi->ci.crc32 = CRC32::update(zi->ci.crc32, pd->window + PDEFLATE_DICT_SIZE, pd->filled);
+    zi->ci.totalUncompressedData += pd->filled;
+    pd->filled = 0;
+    return err;
+}
+
+local int pdeflate_write(zip64_internal* zi, const void* buf, unsigned int len)
+{
+    pdeflate_state* pd = zi->ci.pdeflate;
+    const Bytef* from = (const Bytef*)buf;
+    uInt batch_size = (uInt)pd->threads * pd->block_size;
+    int err = ZIP_OK;
+
+    while ((err == ZIP_OK) && (len > 0))
+    {
+        uInt copy_this = batch_size - pd->filled;
+        if (copy_this > len)
+            copy_this = len;
+
+        memcpy(pd->window + PDEFLATE_DICT_SIZE + pd->filled, from, copy_this);
+        pd->filled += copy_this;
+        from += copy_this;
+        len -= copy_this;
+
+        if ((pd->filled == batch_size) && !pd->started)
+            err = pdeflate_start(zi);
+        if ((err == ZIP_OK) && (pd->filled == batch_size))
+            err = pdeflate_flush_batch(zi);
+    }
+
+    return err;
+}
+
+local int pdeflate_finish(zip64_internal* zi)
+{
+    // empty final block with fixed codes, ends the raw deflate stream
+    static const Bytef final_block[2] = {0x03, 0x00};
+    int err;
+
+    if (!zi->ci.pdeflate->started)
+        err = pdeflate_single(zi);
+    else
+    {
+        err = pdeflate_flush_batch(zi);
+        if ((err == ZIP_OK) && (ZWRITE64(zi->z_filefunc,zi->filestream,final_block,2) != 2))
+            err = ZIP_ERRNO;
+        zi->ci.totalCompressedData += 2;
+    }
+
+    pdeflate_free(zi->ci.pdeflate);
+    zi->ci.pdeflate = NULL;
+    return err;
+}
+
+extern int ZEXPORT zipSetAdaptiveStore (zipFile file, uLong sampleSize, int maxRatio)
+{
+    zip64_internal* zi;
+
+    if (file == NULL)
+        return ZIP_PARAMERROR;
+    zi = (zip64_internal*)file;
+
+    if ((maxRatio <= 0) || (maxRatio > 100))
+        maxRatio = ADAPTIVE_DEF_MAX_RATIO;
+
+    zi->adaptive_sample_size = (uInt)sampleSize;
+    zi->adaptive_max_ratio = maxRatio;
+    return ZIP_OK;
+}
+
+/* Start the deflate stream(s) of the current file */
+local int deflate_begin(zip64_internal* zi)
+{
+    int err = Z_OK;
+
+    if (zi->pdeflate_threads > 1)
+    {
+        zi->ci.pdeflate = pdeflate_alloc(zi->pdeflate_threads, zi->pdeflate_block_size,
+                                         zi->ci.level, zi->ci.windowBits, zi->ci.memLevel, zi->ci.strategy);
+        if (zi->ci.pdeflate == NULL)
+            err = ZIP_INTERNALERROR;
+    }
+    else
+    {
+        zi->ci.stream.zalloc = (alloc_func)0;
+        zi->ci.stream.zfree = (free_func)0;
+        zi->ci.stream.opaque = (voidpf)0;
+
+        err = deflateInit2(&zi->ci.stream, zi->ci.level, Z_DEFLATED, zi->ci.windowBits, zi->ci.memLevel, zi->ci.strategy);
+
+        if (err==Z_OK)
+            zi->ci.stream_initialised = Z_DEFLATED;
+    }
+
+    return err;
+}
+
+/* Trial compress the sample with a fast level. Encrypted (e.g. CIA) data doesn't
+   shrink, so the file is stored instead and the deflate work is skipped. */
+local int adaptive_decide(zip64_internal* zi)
+{
+    Bytef* sample = zi->ci.sample;
+    uInt sample_size = zi->ci.sample_size;
+    int store = 0;
+    int err = ZIP_OK;
+
+    if (sample_size > 0)
+    {
+        z_stream trial;
+        Bytef* out;
+        uLong out_capacity;
+
+        memset(&trial, 0, sizeof(trial));
+        if (deflateInit2(&trial, ADAPTIVE_TRIAL_LEVEL, Z_DEFLATED, zi->ci.windowBits, zi->ci.memLevel, zi->ci.strategy) == Z_OK)
+        {
+            // Bail out as soon as the output reaches the limit
+            out_capacity = (uLong)sample_size * zi->adaptive_max_ratio / 100;
+            out = (Bytef*)ALLOC(out_capacity + 1);
+            if (out != NULL)
+            {
+                trial.next_in = sample;
+                trial.avail_in = sample_size;
+                trial.next_out = out;
+                trial.avail_out = (uInt)out_capacity + 1;
+                if (deflate(&trial, Z_FINISH) != Z_STREAM_END)
+                    store = 1;
+                else if (trial.total_out > out_capacity)
+                    store = 1;
+                TRYFREE(out);
+            }
+            deflateEnd(&trial);
+        }
+    }
+
+    zi->ci.sample = NULL;
+    zi->ci.sample_size = 0;
+
+    if (store)
+    {
+        // Switch to STORED. Level bits only make sense for deflate.
+        zi->ci.method = 0;
+        zi->ci.flag &= ~6;
+        zi->ci.method_changed = 1;
+        zip64local_putValue_inmemory(zi->ci.central_header+8,(uLong)zi->ci.flag,2);
+        zip64local_putValue_inmemory(zi->ci.central_header+10,(uLong)zi->ci.method,2);
+    }
+    else
+        err = deflate_begin(zi);
+
+    if ((err == ZIP_OK) && (sample_size > 0))
+        err = zipWriteInFileInZip((zipFile)zi, sample, sample_size);
+
+    TRYFREE(sample);
+    return err;
+}
+
+local int adaptive_write(zip64_internal* zi, const void* buf, unsigned int len)
+{
+    uInt copy_this = zi->adaptive_sample_size - zi->ci.sample_size;
+    int err = ZIP_OK;
+
+    if (copy_this > len)
+        copy_this = len;
+
+    memcpy(zi->ci.sample + zi->ci.sample_size, buf, copy_this);
+    zi->ci.sample_size += copy_this;
+
+    if (zi->ci.sample_size == zi->adaptive_sample_size)
+    {
+        err = adaptive_decide(zi);
+        if ((err == ZIP_OK) && (len > copy_this))
+            err = zipWriteInFileInZip((zipFile)zi, (const Bytef*)buf + copy_this, len - copy_this);
+    }
+
+    return err;
+}
+
 int Write_LocalFileHeader(zip64_internal* zi, const char* filename, uInt size_extrafield_local, const void* extrafield_local)
 {
   /* write the local header */
@@ -1128,12 +1599,23 @@ extern int ZEXPORT zipOpenNewFileInZip4_64 (zipFile file, const char* filename,
     zi->ci.stream_initialised = 0;
     zi->ci.pos_in_buffered_data = 0;
     zi->ci.raw = raw;
+    zi->ci.pdeflate = NULL;
+    zi->ci.sample = NULL;
+    zi->ci.sample_size = 0;
+    zi->ci.method_changed = 0;
+    zi->ci.level = level;
+    zi->ci.windowBits = (windowBits>0) ? -windowBits : windowBits;
+    zi->ci.memLevel = memLevel;
+    zi->ci.strategy = strategy;
     zi->ci.pos_local_header = ZTELL64(zi->z_filefunc,zi->filestream);
 
     zi->ci.size_centralheader = SIZECENTRALHEADER + size_filename + size_extrafield_global + size_comment;
     zi->ci.size_centralExtraFree = 32; // Extra space we have reserved in case we need to add ZIP64 extra info data
 
-    zi->ci.central_header = (char*)ALLOC((uInt)zi->ci.size_centralheader + zi->ci.size_centralExtraFree);
+    // build the central header in place, no allocation per file
+    if (reserve_in_arena(&zi->central_dir, zi->ci.size_centralheader + zi->ci.size_centralExtraFree) != ZIP_OK)
+        return ZIP_INTERNALERROR;
+    zi->ci.central_header = (char*)zi->central_dir.data + zi->central_dir.size;
 
     zi->ci.size_centralExtra = size_extrafield_global;
     zip64local_putValue_inmemory(zi->ci.central_header,(uLong)CENTRALHEADERMAGIC,4);
@@ -1176,8 +1658,6 @@ extern int ZEXPORT zipOpenNewFileInZip4_64 (zipFile file, const char* filename,
     for (i=0;i<size_comment;i++)
         *(zi->ci.central_header+SIZECENTRALHEADER+size_filename+
               size_extrafield_global+i) = *(comment+i);
-    if (zi->ci.central_header == NULL)
-        return ZIP_INTERNALERROR;
 
     zi->ci.zip64 = zip64;
     zi->ci.totalCompressedData = 0;
@@ -1209,16 +1689,24 @@ extern int ZEXPORT zipOpenNewFileInZip4_64 (zipFile file, const char* filename,
     if ((err==ZIP_OK) && (zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
 #endif
     {
-        if(zi->ci.method == Z_DEFLATED)
+        if((zi->ci.method == Z_DEFLATED) && (password == NULL) && (zi->adaptive_sample_size > 0))
+        {
+          // store or deflate is decided once the sample is full, see adaptive_decide()
+          zi->ci.sample = (Bytef*)ALLOC(zi->adaptive_sample_size);
+          if (zi->ci.sample == NULL)
+              err = ZIP_INTERNALERROR;
+        }
+        else if((zi->ci.method == Z_DEFLATED) && (password == NULL))
+        {
+          err = deflate_begin(zi);
+        }
+        else if(zi->ci.method == Z_DEFLATED)
         {
           zi->ci.stream.zalloc = (alloc_func)0;
           zi->ci.stream.zfree = (free_func)0;
           zi->ci.stream.opaque = (voidpf)0;
 
-          if (windowBits>0)
-              windowBits = -windowBits;
-
-          err = deflateInit2(&zi->ci.stream, level, Z_DEFLATED, windowBits, memLevel, strategy);
+          err = deflateInit2(&zi->ci.stream, level, Z_DEFLATED, zi->ci.windowBits, memLevel, strategy);
 
           if (err==Z_OK)
               zi->ci.stream_initialised = Z_DEFLATED;
@@ -1411,7 +1899,14 @@ extern int ZEXPORT zipWriteInFileInZip (zipFile file,const void* buf,unsigned in
     if (zi->in_opened_file_inzip == 0)
         return ZIP_PARAMERROR;
 
-    zi->ci.crc32 = crc32(zi->ci.crc32,(const Bytef*)buf,(uInt)len);
+    if (zi->ci.sample != NULL)
+        return adaptive_write(zi, buf, len);
+
+    // the workers compute the CRC of their blocks
+    if (zi->ci.pdeflate != NULL)
+        return pdeflate_write(zi, buf, len);
+
+    zi->ci.crc32 = CRC32::update(zi->ci.crc32,buf,len);
 
 #ifdef HAVE_BZIP2
     if(zi->ci.method == Z_BZIP2ED && (!zi->ci.raw))
@@ -1527,7 +2022,17 @@ extern int ZEXPORT zipCloseFileInZipRaw64 (zipFile file, ZPOS64_T uncompressed_s
         return ZIP_PARAMERROR;
     zi->ci.stream.avail_in = 0;
 
-    if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
+    // files smaller than the sample are decided now
+    if (zi->ci.sample != NULL)
+        err = adaptive_decide(zi);
+
+    if (zi->ci.pdeflate != NULL)
+    {
+        int tmp_err = pdeflate_finish(zi);
+        if (err == ZIP_OK)
+            err = tmp_err;
+    }
+    else if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
                 {
                         while (err==ZIP_OK)
                         {
@@ -1580,7 +2085,7 @@ extern int ZEXPORT zipCloseFileInZipRaw64 (zipFile file, ZPOS64_T uncompressed_s
             err = ZIP_ERRNO;
                 }
 
-    if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw))
+    if ((zi->ci.method == Z_DEFLATED) && (!zi->ci.raw) && (zi->ci.stream_initialised == Z_DEFLATED))
     {
         int tmp_err = deflateEnd(&zi->ci.stream);
         if (err == ZIP_OK)
@@ -1694,10 +2199,10 @@ extern int ZEXPORT zipCloseFileInZipRaw64 (zipFile file, ZPOS64_T uncompressed_s
       zip64local_putValue_inmemory(zi->ci.central_header+30,(uLong)zi->ci.size_centralExtra,2);
     }
 
+    // commit the header that was built in the arena tail
     if (err==ZIP_OK)
-        err = add_data_in_datablock(&zi->central_dir, zi->ci.central_header, (uLong)zi->ci.size_centralheader);
-
-    free(zi->ci.central_header);
+        zi->central_dir.size += zi->ci.size_centralheader;
+    zi->ci.central_header = NULL;
 
     if (err==ZIP_OK)
     {
@@ -1705,7 +2210,18 @@ extern int ZEXPORT zipCloseFileInZipRaw64 (zipFile file, ZPOS64_T uncompressed_s
 
         ZPOS64_T cur_pos_inzip = ZTELL64(zi->z_filefunc,zi->filestream);
 
-        if (ZSEEK64(zi->z_filefunc,zi->filestream, zi->ci.pos_local_header + 14,ZLIB_FILEFUNC_SEEK_SET)!=0)
+        if (zi->ci.method_changed)
+        {
+            // adaptive store switched the method after the local header was written
+            if (ZSEEK64(zi->z_filefunc,zi->filestream, zi->ci.pos_local_header + FLAG_LOCALHEADER_OFFSET,ZLIB_FILEFUNC_SEEK_SET)!=0)
+                err = ZIP_ERRNO;
+            if (err==ZIP_OK)
+                err = zip64local_putValue(&zi->z_filefunc,zi->filestream,(uLong)zi->ci.flag,2);
+            if (err==ZIP_OK)
+                err = zip64local_putValue(&zi->z_filefunc,zi->filestream,(uLong)zi->ci.method,2);
+        }
+
+        if ((err==ZIP_OK) && ZSEEK64(zi->z_filefunc,zi->filestream, zi->ci.pos_local_header + 14,ZLIB_FILEFUNC_SEEK_SET)!=0)
             err = ZIP_ERRNO;
 
         if (err==ZIP_OK)
@@ -1904,22 +2420,13 @@ extern int ZEXPORT zipClose (zipFile file, const char* global_comment)
 
     centraldir_pos_inzip = ZTELL64(zi->z_filefunc,zi->filestream);
 
-    if (err==ZIP_OK)
+    if ((err==ZIP_OK) && (zi->central_dir.size>0))
     {
-        linkedlist_datablock_internal* ldi = zi->central_dir.first_block;
-        while (ldi!=NULL)
-        {
-            if ((err==ZIP_OK) && (ldi->filled_in_this_block>0))
-            {
-                if (ZWRITE64(zi->z_filefunc,zi->filestream, ldi->data, ldi->filled_in_this_block) != ldi->filled_in_this_block)
-                    err = ZIP_ERRNO;
-            }
-
-            size_centraldir += ldi->filled_in_this_block;
-            ldi = ldi->next_datablock;
-        }
+        if (ZWRITE64(zi->z_filefunc,zi->filestream, zi->central_dir.data, zi->central_dir.size) != zi->central_dir.size)
+            err = ZIP_ERRNO;
     }
-    free_linkedlist(&(zi->central_dir));
+    size_centraldir = zi->central_dir.size;
+    free_arena(&(zi->central_dir));
 
     pos = centraldir_pos_inzip - zi->add_position_when_writting_offset;
     if(pos >= 0xffffffff || zi->number_entry > 0xFFFF)